@@ -19,6 +19,7 @@
 #include "CFTextProvider.h"
 #include "CFTextProvider_Private.h"
 #include "CFException.h"
+#include "CFMutableString.h"
 #include "CFASSFileChange.h"
 #include "CFASSFileChange_Private.h"
 
@@ -41,6 +42,18 @@ void CFASSFileMakeChange(CFASSFileRef file, CFASSFileChangeRef change)
         CFASSFileDialogueCollectionMakeChange(file->dialogueCollection, change);
 }
 
+void CFASSFileMakeChangeConcurrently(CFASSFileRef file, CFASSFileChangeRef change, unsigned int threadAmount)
+{
+    if(file == NULL || change == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFile %p MakeChangeConcurrently %p", file, change);
+    if(CFASSFileChangeShouldDispatchToScriptInfo(change))
+        CFASSFileScriptInfoMakeChange(file->scriptInfo, change);
+    if(CFASSFileChangeShouldDispatchToStyleCollection(change))
+        CFASSFileStyleCollectionMakeChange(file->styleCollection, change);
+    if(CFASSFileChangeShouldDispatchToDialogueCollection(change))
+        CFASSFileDialogueCollectionMakeChangeConcurrently(file->dialogueCollection, change, threadAmount);
+}
+
 void CFASSFileReceiveResolutionXYChangeFromScriptInfo(CFASSFileRef file, CFUSize oldSize, CFUSize newSize)
 {
     if(file == NULL)
@@ -188,27 +201,17 @@ wchar_t *CFASSFileAllocateFileContent(CFASSFileRef file)
         CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileAllocate File NULL Content");
         return NULL;
     }
-    wchar_t *scriptInfo = CFASSFileScriptInfoAllocateFileContent(file->scriptInfo),
-    *styleCollection = CFASSFileStyleCollectionAllocateFileContent(file->styleCollection),
-    *dialogueCollection = CFASSFileDialogueCollectionAllocateFileContent(file->dialogueCollection);
-    if(scriptInfo == NULL || styleCollection == NULL || dialogueCollection == NULL)
-    {
-        CFExceptionRaise(CFExceptionNameProcessFailed, NULL, "CFASSFileAllocateFileContent failed scriptInfo %X styleCollection %X dialogueCollection %X", (unsigned int)scriptInfo, (unsigned int)styleCollection, (unsigned int)dialogueCollection);
-        if(scriptInfo!=NULL) free(scriptInfo);
-        if(styleCollection!=NULL) free(styleCollection);
-        if(dialogueCollection!=NULL) free(dialogueCollection);
+    // every part appends into the same buffer, nothing is measured or copied twice
+    CFMutableStringRef string;
+    if((string = CFMutableStringCreateEmpty()) == NULL)
         return NULL;
-    }
-    size_t stringLength = wcslen(scriptInfo) + wcslen(styleCollection) + wcslen(dialogueCollection);
-    wchar_t *result;
-    if((result = malloc(sizeof(wchar_t)*(stringLength+1)))!=NULL)
+    if(CFASSFileScriptInfoAppendFileContent(file->scriptInfo, string) != 0 ||
+       CFASSFileStyleCollectionAppendFileContent(file->styleCollection, string) != 0 ||
+       CFASSFileDialogueCollectionAppendFileContent(file->dialogueCollection, string) != 0)
     {
-        wcscpy(result, scriptInfo);
-        wcscat(result, styleCollection);
-        wcscat(result, dialogueCollection);
+        CFMutableStringDestory(string);
+        CFExceptionRaise(CFExceptionNameProcessFailed, NULL, "CFASSFileAllocateFileContent %p failed", file);
+        return NULL;
     }
-    free(scriptInfo);
-    free(styleCollection);
-    free(dialogueCollection);
-    return result;
+    return CFMutableStringDestoryAndStealCharacters(string, NULL);
 }
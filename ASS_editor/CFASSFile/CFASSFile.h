@@ -42,4 +42,11 @@ wchar_t *CFASSFileAllocateFileContent(CFASSFileRef file);
 
 void CFASSFileMakeChange(CFASSFileRef file, CFASSFileChangeRef change);
 
+void CFASSFileMakeChangeConcurrently(CFASSFileRef file, CFASSFileChangeRef change, unsigned int threadAmount);
+/* threadAmount */
+// 0 means one thread for each online processor
+/* Discussion */
+// same as CFASSFileMakeChange, but dialogues receive change in parallel
+// see CFASSFileDialogueCollectionMakeChangeConcurrently
+
 #endif /* CFASSFile_h */
@@ -18,6 +18,7 @@
 
 static CFASSFileChangeRef CFASSFileChangeEmpty(void);
 static bool CFASSFileChangeCombineInto(CFASSFileChangeRef dest, CFASSFileChangeRef source);
+static void CFASSFileChangeCompilePlan(CFASSFileChangeRef change);
 
 #pragma mark - Dispatch Rule
 
@@ -25,58 +26,75 @@ bool CFASSFileChangeShouldDispatchToScriptInfo(CFASSFileChangeRef change)
 {
     if(change == NULL)
         CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileChange NULL ShouldDispatchToScriptInfo");
-    if(change->type & CFASSFileChangeTypeResolution)
-        return true;
-    return false;
+    return (change->plan.nodes & CFASSFileChangePlanNodeScriptInfo) != 0;
 }
 
 bool CFASSFileChangeShouldDispatchToStyleCollection(CFASSFileChangeRef change)
 {
     if(change == NULL)
         CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileChange NULL ShouldDispatchToStyleCollection");
-    if(change->type & CFASSFileChangeTypeFontSize)
-        return true;
-    if(change->type & CFASSFileChangeTypeFontName)
-        return true;
-    if(change->type & CFASSFileChangeTypeOutlineColor)
-        return true;
-    if(change->type & CFASSFileChangeTypePrimaryColor)
-        return true;
-    if(change->type & CFASSFileChangeTypeBlod)
-        return true;
-    if(change->type & CFASSFileChangeTypeBorderStyle)
-        return true;
-    if(change->type & CFASSFileChangeTypeOutline)
-        return true;
-    if(change->type & CFASSFileChangeTypeShadow)
-        return true;
-    return false;
+    return (change->plan.nodes & CFASSFileChangePlanNodeStyleCollection) != 0;
 }
 
 bool CFASSFileChangeShouldDispatchToDialogueCollection(CFASSFileChangeRef change)
 {
     if(change == NULL)
-        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileChange NULL ShouldDispatchToStyleCollection");
-    if((change->type & CFASSFileChangeTypeFontSize) && change->fontSize.affectOverride)
-        return true;
-    if((change->type & CFASSFileChangeTypeFontName) && change->fontName.affectOverride)
-        return true;
-    if(change->type & CFASSFileChangeTypeTimeOffset)
-        return true;
-    if(change->type & CFASSFileChangeTypeDiscardAllOverride)
-        return true;
-    return false;
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileChange NULL ShouldDispatchToDialogueCollection");
+    return (change->plan.nodes & (CFASSFileChangePlanNodeDialogue |
+                                  CFASSFileChangePlanNodeDialogueText |
+                                  CFASSFileChangePlanNodeOverride)) != 0;
+}
+
+bool CFASSFileChangeShouldDispatchToDialogueText(CFASSFileChangeRef change)
+{
+    if(change == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileChange NULL ShouldDispatchToDialogueText");
+    return (change->plan.nodes & (CFASSFileChangePlanNodeDialogueText | CFASSFileChangePlanNodeOverride)) != 0;
 }
 
 bool CFASSFileChangeShouldDispatchToDialogueTextContentOverride(CFASSFileChangeRef change)
 {
     if(change == NULL)
         CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileChange NULL ShouldDispatchToDialogueTextContentOverride");
+    return (change->plan.nodes & CFASSFileChangePlanNodeOverride) != 0;
+}
+
+bool CFASSFileChangeShouldDispatchToOverrideContentTypes(CFASSFileChangeRef change, unsigned int overrideContentTypes)
+{
+    if(change == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileChange NULL ShouldDispatchToOverrideContentTypes");
+    return (change->plan.overrideContentTypes & overrideContentTypes) != 0;
+}
+
+static void CFASSFileChangeCompilePlan(CFASSFileChangeRef change)
+{
+    CFASSFileChangePlan plan = {CFASSFileChangePlanNodeNone, 0};
+    if(change->type & CFASSFileChangeTypeResolution)
+        plan.nodes |= CFASSFileChangePlanNodeScriptInfo;
+    if(change->type & (CFASSFileChangeTypeFontSize |
+                       CFASSFileChangeTypeFontName |
+                       CFASSFileChangeTypeOutlineColor |
+                       CFASSFileChangeTypePrimaryColor |
+                       CFASSFileChangeTypeBlod |
+                       CFASSFileChangeTypeBorderStyle |
+                       CFASSFileChangeTypeOutline |
+                       CFASSFileChangeTypeShadow))
+        plan.nodes |= CFASSFileChangePlanNodeStyleCollection;
     if((change->type & CFASSFileChangeTypeFontSize) && change->fontSize.affectOverride)
-        return true;
+    {
+        plan.nodes |= CFASSFileChangePlanNodeOverride;
+        plan.overrideContentTypes |= CFASSFileChangePlanOverrideContentTypeBit(CFASSFileDialogueTextContentOverrideContentTypeFontSize);
+    }
     if((change->type & CFASSFileChangeTypeFontName) && change->fontName.affectOverride)
-        return true;
-    return false;
+    {
+        plan.nodes |= CFASSFileChangePlanNodeOverride;
+        plan.overrideContentTypes |= CFASSFileChangePlanOverrideContentTypeBit(CFASSFileDialogueTextContentOverrideContentTypeFontName);
+    }
+    if(change->type & CFASSFileChangeTypeTimeOffset)
+        plan.nodes |= CFASSFileChangePlanNodeDialogue;
+    if(change->type & CFASSFileChangeTypeDiscardAllOverride)
+        plan.nodes |= CFASSFileChangePlanNodeDialogueText;
+    change->plan = plan;
 }
 
 #pragma mark - Change Creation
@@ -89,6 +107,7 @@ CFASSFileChangeRef CFASSFileChangeBorderStyle(int borderStyle)
     {
         result->type = CFASSFileChangeTypeBorderStyle;
         result->borderStyle.borderStyle = borderStyle;
+        CFASSFileChangeCompilePlan(result);
         return result;
     }
     return NULL;
@@ -103,6 +122,7 @@ CFASSFileChangeRef CFASSFileChangeOutlineWidth(unsigned int outlinePixelWidth, b
         result->type = CFASSFileChangeTypeOutline;
         result->outline.forceBorderStyle = forceBorderStyle;
         result->outline.pixel = outlinePixelWidth;
+        CFASSFileChangeCompilePlan(result);
         return result;
     }
     return NULL;
@@ -117,6 +137,7 @@ CFASSFileChangeRef CFASSFileChangeShadowWidth(unsigned int shadowPixelWidth, boo
         result->type = CFASSFileChangeTypeShadow;
         result->shadow.forceBorderStyle = forceBorderStyle;
         result->shadow.pixel = shadowPixelWidth;
+        CFASSFileChangeCompilePlan(result);
         return result;
     }
     return NULL;
@@ -129,6 +150,7 @@ CFASSFileChangeRef CFASSFileChangeTimeOffset(long hundredths)
     {
         result->type = CFASSFileChangeTypeTimeOffset;
         result->timeOffset.hundredths = hundredths;
+        CFASSFileChangeCompilePlan(result);
         return result;
     }
     return NULL;
@@ -144,6 +166,7 @@ CFASSFileChangeRef CFASSFileChangePrimaryColor(unsigned char red, unsigned char
         result->primaryColor.green = green;
         result->primaryColor.blue = blue;
         result->primaryColor.alpha = alpha;
+        CFASSFileChangeCompilePlan(result);
         return result;
     }
     return NULL;
@@ -159,6 +182,7 @@ CFASSFileChangeRef CFASSFileChangeOutlineColor(unsigned char red, unsigned char
         result->outlineColor.green = green;
         result->outlineColor.blue = blue;
         result->outlineColor.alpha = alpha;
+        CFASSFileChangeCompilePlan(result);
         return result;
     }
     return NULL;
@@ -173,6 +197,7 @@ CFASSFileChangeRef CFASSFileChangeFontSize(bool usingPercentage, double percenta
         result->fontSize.byPercentage = usingPercentage;
         result->fontSize.fontSize = newSize;
         result->fontSize.percentage = percentage;
+        CFASSFileChangeCompilePlan(result);
         return result;
     }
     return NULL;
@@ -187,6 +212,7 @@ CFASSFileChangeRef CFASSFileChangeFontName(wchar_t *fontName, bool affectOverrid
         {
             result->type = CFASSFileChangeTypeFontName;
             result->fontName.affectOverride = affectOverride;
+            CFASSFileChangeCompilePlan(result);
             return result;
         }
         CFASSFileChangeDestory(result);
@@ -201,6 +227,7 @@ CFASSFileChangeRef CFASSFileChangeResolution(CFUSize newSize)
     {
         result->type = CFASSFileChangeTypeResolution;
         result->resolution.newSize = newSize;
+        CFASSFileChangeCompilePlan(result);
         return result;
     }
     return NULL;
@@ -212,6 +239,7 @@ CFASSFileChangeRef CFASSFileChangeDiscardAllOverride(void)
     if((result = CFASSFileChangeEmpty()) != NULL)
     {
         result->type = CFASSFileChangeTypeDiscardAllOverride;
+        CFASSFileChangeCompilePlan(result);
         return result;
     }
     return NULL;
@@ -224,6 +252,7 @@ CFASSFileChangeRef CFASSFileChangeBlod(bool blod)
     {
         result->type = CFASSFileChangeTypeBlod;
         result->blod.isBlod = blod;
+        CFASSFileChangeCompilePlan(result);
         return result;
     }
     return NULL;
@@ -235,7 +264,10 @@ static CFASSFileChangeRef CFASSFileChangeEmpty(void)
     if((result = malloc(sizeof(struct CFASSFileChange))) != NULL)
     {
         result->type = CFASSFileChangeTypeNone;
+        result->fontSize.affectOverride = false;
         result->fontName.fontName = NULL;
+        result->fontName.affectOverride = false;
+        CFASSFileChangeCompilePlan(result);
         return result;
     }
     return NULL;
@@ -332,7 +364,7 @@ static bool CFASSFileChangeCombineInto(CFASSFileChangeRef dest, CFASSFileChangeR
         if(dest->fontName.fontName == NULL)
             return false;
         dest->type |= CFASSFileChangeTypeFontName;      // exist latter
-        dest->fontName.affectOverride = dest->fontName.affectOverride;
+        dest->fontName.affectOverride = source->fontName.affectOverride;
     }
     if(source->type & CFASSFileChangeTypeResolution)
     {
@@ -383,5 +415,6 @@ static bool CFASSFileChangeCombineInto(CFASSFileChangeRef dest, CFASSFileChangeR
         dest->type |= CFASSFileChangeTypeShadow;
         dest->shadow = source->shadow;
     }
+    CFASSFileChangeCompilePlan(dest);
     return true;
 }
@@ -18,7 +18,7 @@ typedef struct CFASSFileChange *CFASSFileChangeRef;
  * 1. create change function
  * 2. CombineInto function
  * 3. Destory function
- * 4. Disptach function
+ * 4. Disptach function and plan compile rule
  * 5. Somewhere in ASSFile structure to apply this change
  */
 
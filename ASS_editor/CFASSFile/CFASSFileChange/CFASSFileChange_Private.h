@@ -12,6 +12,7 @@
 #include <stdbool.h>
 
 #include "CFASSFileChange.h"
+#include "CFASSFileDialogueTextContentOverrideContent.h"
 
 #pragma mark - Internal Structure
 
@@ -30,9 +31,29 @@ typedef enum {
     CFASSFileChangeTypeShadow = 1 << 10,
 } CFASSFileChangeType;
 
+typedef enum {
+    CFASSFileChangePlanNodeNone = 0,
+    CFASSFileChangePlanNodeScriptInfo = 1 << 0,
+    CFASSFileChangePlanNodeStyleCollection = 1 << 1,
+    CFASSFileChangePlanNodeDialogue = 1 << 2,           // dialogue own field, like start and end time
+    CFASSFileChangePlanNodeDialogueText = 1 << 3,       // the content array of dialogue text itself
+    CFASSFileChangePlanNodeOverride = 1 << 4,           // override blocks, limited by overrideContentTypes
+} CFASSFileChangePlanNode;
+
+#define CFASSFileChangePlanOverrideContentTypeBit(contentType) (1U << (contentType))
+
+typedef struct CFASSFileChangePlan
+{
+    CFASSFileChangePlanNode nodes;
+    unsigned int overrideContentTypes;      // CFASSFileChangePlanOverrideContentTypeBit of each override tag touched
+} CFASSFileChangePlan;
+// compiled from type once the change is created or combined
+// walk through ASSFile structure skip any subtree that plan not touched
+
 struct CFASSFileChange
 {
     CFASSFileChangeType type;
+    CFASSFileChangePlan plan;
     struct
     {
         CFUSize newSize;
@@ -89,6 +110,14 @@ bool CFASSFileChangeShouldDispatchToStyleCollection(CFASSFileChangeRef change);
 
 bool CFASSFileChangeShouldDispatchToDialogueCollection(CFASSFileChangeRef change);
 
+bool CFASSFileChangeShouldDispatchToDialogueText(CFASSFileChangeRef change);
+
 bool CFASSFileChangeShouldDispatchToDialogueTextContentOverride(CFASSFileChangeRef change);
 
+bool CFASSFileChangeShouldDispatchToOverrideContentTypes(CFASSFileChangeRef change, unsigned int overrideContentTypes);
+/* overrideContentTypes */
+// combination of CFASSFileChangePlanOverrideContentTypeBit
+/* Return */
+// true if any of the override tag types given is touched by change
+
 #endif /* CFASSFileChange_Private_h */
@@ -19,6 +19,8 @@
 
 static CFASSFileControlErrorHandling CFASSFileControlGlobalErrorHandling = CFASSFileControlErrorHandlingOutput | CFASSFileControlErrorHandlingIgnore;
 
+static bool CFASSFileControlGlobalOverrideSharing = true;
+
 static FILE *redirectFile = NULL;
 
 void CFASSFileControlErrorOutput(const wchar_t *fileContent, const wchar_t *errorPoint)
@@ -51,6 +53,16 @@ void CFASSFileControlSetErrorHandling(CFASSFileControlErrorHandling errorHandle)
     CFASSFileControlGlobalErrorHandling = errorHandle;
 }
 
+bool CFASSFileControlGetOverrideSharing(void)
+{
+    return CFASSFileControlGlobalOverrideSharing;
+}
+
+void CFASSFileControlSetOverrideSharing(bool isSharing)
+{
+    CFASSFileControlGlobalOverrideSharing = isSharing;
+}
+
 bool CFASSFileRedirectErrorInfomation(FILE *fp)
 {
     if(redirectFile == NULL && fp != NULL)
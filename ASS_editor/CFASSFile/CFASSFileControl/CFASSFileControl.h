@@ -21,6 +21,12 @@ CFASSFileControlErrorHandling CFASSFileControlGetErrorHandling(void);
 
 void CFASSFileControlSetErrorHandling(CFASSFileControlErrorHandling errorHandle);
 
+bool CFASSFileControlGetOverrideSharing(void);
+
+void CFASSFileControlSetOverrideSharing(bool isSharing);
+// if true, identical override blocks in one file are parsed once and shared between dialogues
+// a shared block is copied when a change is made to it, default is true
+
 bool CFASSFileRedirectErrorInfomation(FILE *fp);
 // if success, return true
 
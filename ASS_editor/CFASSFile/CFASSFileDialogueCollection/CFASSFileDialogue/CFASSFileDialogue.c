@@ -12,7 +12,6 @@
 #include <stdlib.h>
 #include <stdint.h>
 #include <stdbool.h>
-#include <time.h>
 
 #include "CFASSFileDialogue.h"
 #include "CFASSFileDialogue_Private.h"
@@ -21,9 +20,14 @@
 #include "CFASSFileDialogueText.h"
 #include "CFASSFileDialogueText_Private.h"
 #include "CFUseTool.h"
+#include "CFUnicodeStringInternTable.h"
 #include "CFException.h"
+#include "CFMutableString.h"
 #include "CFASSFileChange.h"
 #include "CFASSFileChange_Private.h"
+#include "CFASSFile.h"
+#include "CFASSFileStyleCollection.h"
+#include "CFASSFileStyleCollection_Private.h"
 
 //[Events]
 //Format: Layer, Start, End, Style, Name, MarginL, MarginR, MarginV, Effect, Text
@@ -38,15 +42,23 @@ struct CFASSFileDialogue
     unsigned int layer;                     // Subtitles having different layer number will be ignore during the collusion detection.
                                             // Higher numberer layers will be drawn over the lower numbers.
     CFASSFileDialogueTime start, end;       // 0:00:00.00 format ie. Hrs:Mins:Secs:hundredths.
-    wchar_t *style;                         // name for style, NULL for empty
-    wchar_t *name;                          // name for speaker, NULL for empty
+    const wchar_t *style;                   // name for style, NULL for empty, interned in nameTable
+    const wchar_t *name;                    // name for speaker, NULL for empty, interned in nameTable
     unsigned int marginL, marginR, marginV;
     CFASSFileDialogueEffectRef effect;      // if not have, assign NULL
     CFASSFileDialogueTextRef text;          // if not hace, don't assign NULL
+    CFUnicodeStringInternTableRef nameTable;    // retained, shared by dialogues of the same file
+    CFASSFileStyleRef cachedStyle;          // don't have ownership, resolved from style, may be NULL
+    CFASSFileStyleCollectionRef cachedStyleCollection;  // don't have ownership, the one cachedStyle resolved from, NULL for never
+    unsigned long cachedStyleGeneration;    // style collection generation when cachedStyle resolved, 0 for never
 };
 
 static bool CFASSFileDialogueTimeFormatCheck(CFASSFileDialogueTime time);
 
+static unsigned long CFASSFileDialogueTimeGetHundredths(CFASSFileDialogueTime time);
+
+static CFASSFileDialogueTime CFASSFileDialogueTimeMakeWithHundredths(unsigned long hundredths);
+
 static CFASSFileDialogueTime CFASSFileDialogueTimeOffset(CFASSFileDialogueTime fromTime, long hundredths);
 
 void CFASSFileDialogueMakeChange(CFASSFileDialogueRef dialogue, CFASSFileChangeRef change)
@@ -58,36 +70,106 @@ void CFASSFileDialogueMakeChange(CFASSFileDialogueRef dialogue, CFASSFileChangeR
         dialogue->start = CFASSFileDialogueTimeOffset(dialogue->start, change->timeOffset.hundredths);
         dialogue->end = CFASSFileDialogueTimeOffset(dialogue->end, change->timeOffset.hundredths);
     }
-    if(dialogue->effect!=NULL)
-        CFASSFileDialogueEffectMakeChange(dialogue->effect, change);
-    CFASSFileDialogueTextMakeChange(dialogue->text, change);
+    // CFASSFileDialogueEffectMakeChange changes nothing, the effect is not visited
+    if(CFASSFileChangeShouldDispatchToDialogueText(change))
+        CFASSFileDialogueTextMakeChange(dialogue->text, change);
 }
 
-static CFASSFileDialogueTime CFASSFileDialogueTimeOffset(CFASSFileDialogueTime fromTime, long hundredths)
+const wchar_t *CFASSFileDialogueGetStyleName(CFASSFileDialogueRef dialogue)
 {
-    struct tm temp;
-    temp.tm_hour = fromTime.hour;
-    temp.tm_min = fromTime.min;
-    temp.tm_sec = fromTime.sec;
-    temp.tm_year = 0;
-    hundredths += fromTime.hundredths;
-    long absoluteOffset = labs(hundredths)/100;
-    // hundredths %= 100;
-    if(hundredths>=0)
-        temp.tm_sec += absoluteOffset;
-    else
-        temp.tm_sec -= absoluteOffset;
-    if(hundredths<0)
+    if(dialogue == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogue NULL GetStyleName");
+    return dialogue->style;
+}
+
+const wchar_t *CFASSFileDialogueGetActorName(CFASSFileDialogueRef dialogue)
+{
+    if(dialogue == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogue NULL GetActorName");
+    return dialogue->name;
+}
+
+unsigned int CFASSFileDialogueGetLayer(CFASSFileDialogueRef dialogue)
+{
+    if(dialogue == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogue NULL GetLayer");
+    return dialogue->layer;
+}
+
+unsigned long CFASSFileDialogueGetStartTime(CFASSFileDialogueRef dialogue)
+{
+    if(dialogue == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogue NULL GetStartTime");
+    return CFASSFileDialogueTimeGetHundredths(dialogue->start);
+}
+
+unsigned long CFASSFileDialogueGetEndTime(CFASSFileDialogueRef dialogue)
+{
+    if(dialogue == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogue NULL GetEndTime");
+    return CFASSFileDialogueTimeGetHundredths(dialogue->end);
+}
+
+CFASSFileDialogueTextRef CFASSFileDialogueGetText(CFASSFileDialogueRef dialogue)
+{
+    if(dialogue == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogue NULL GetText");
+    return dialogue->text;
+}
+
+void CFASSFileDialogueGetMargins(CFASSFileDialogueRef dialogue, unsigned int *marginL, unsigned int *marginR, unsigned int *marginV)
+{
+    if(dialogue == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogue NULL GetMargins");
+    if(marginL != NULL) *marginL = dialogue->marginL;
+    if(marginR != NULL) *marginR = dialogue->marginR;
+    if(marginV != NULL) *marginV = dialogue->marginV;
+}
+
+void CFASSFileDialogueSetTime(CFASSFileDialogueRef dialogue, unsigned long startHundredths, unsigned long endHundredths)
+{
+    if(dialogue == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogue NULL SetTime");
+    dialogue->start = CFASSFileDialogueTimeMakeWithHundredths(startHundredths);
+    dialogue->end = CFASSFileDialogueTimeMakeWithHundredths(endHundredths);
+}
+
+static unsigned long CFASSFileDialogueTimeGetHundredths(CFASSFileDialogueTime time)
+{
+    return ((time.hour*60ul + time.min)*60ul + time.sec)*100ul + time.hundredths;
+}
+
+static CFASSFileDialogueTime CFASSFileDialogueTimeMakeWithHundredths(unsigned long hundredths)
+{
+    return (CFASSFileDialogueTime){.hour = (unsigned int)(hundredths/360000),
+                                   .min = (unsigned int)(hundredths/6000%60),
+                                   .sec = (unsigned int)(hundredths/100%60),
+                                   .hundredths = (unsigned int)(hundredths%100)};
+}
+
+CFASSFileStyleRef CFASSFileDialogueGetStyle(CFASSFileDialogueRef dialogue, CFASSFileStyleCollectionRef styleCollection)
+{
+    if(dialogue == NULL || styleCollection == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogue %p GetStyle %p", dialogue, styleCollection);
+    if(dialogue->style == NULL)
+        return NULL;
+    unsigned long generation = CFASSFileStyleCollectionGetGeneration(styleCollection);
+    if(dialogue->cachedStyleCollection != styleCollection || dialogue->cachedStyleGeneration != generation)
     {
-        temp.tm_sec--;
-        hundredths = labs(hundredths);
-        hundredths %= 100;
-        hundredths = 100 - hundredths;
+        dialogue->cachedStyle = CFASSFileStyleCollectionGetStyleByName(styleCollection, dialogue->style);
+        dialogue->cachedStyleCollection = styleCollection;
+        dialogue->cachedStyleGeneration = generation;
     }
-    else
-        hundredths %= 100;
-    mktime(&temp);
-    return (CFASSFileDialogueTime){.hour = temp.tm_hour, .min = temp.tm_min, .sec = temp.tm_sec, .hundredths = (unsigned int)hundredths};
+    return dialogue->cachedStyle;
+}
+
+static CFASSFileDialogueTime CFASSFileDialogueTimeOffset(CFASSFileDialogueTime fromTime, long hundredths)
+{
+    // plain arithmetic, mktime takes the libc timezone lock and would serialise concurrent change
+    unsigned long fromHundredths = CFASSFileDialogueTimeGetHundredths(fromTime);
+    if(hundredths < 0 && (unsigned long)-hundredths > fromHundredths)
+        return CFASSFileDialogueTimeMakeWithHundredths(0);
+    return CFASSFileDialogueTimeMakeWithHundredths(fromHundredths + hundredths);
 }
 
 CFASSFileDialogueRef CFASSFileDialogueCopy(CFASSFileDialogueRef dialogue)
@@ -96,30 +178,30 @@ CFASSFileDialogueRef CFASSFileDialogueCopy(CFASSFileDialogueRef dialogue)
     if((result = malloc(sizeof(struct CFASSFileDialogue))) != NULL)
     {
         *result = *dialogue;
-        if(dialogue->style == NULL || (result->style = CF_Dump_wchar_string(dialogue->style)) != NULL)
+        result->cachedStyle = NULL;
+        result->cachedStyleCollection = NULL;
+        result->cachedStyleGeneration = 0;
+        if(dialogue->effect == NULL || (result->effect = CFASSFileDialogueEffectCopy(dialogue->effect)) != NULL)
         {
-            if(dialogue->name == NULL || (result->name = CF_Dump_wchar_string(dialogue->name)) != NULL)
+            if((result->text = CFASSFileDialogueTextCopy(dialogue->text)) != NULL)
             {
-                if(dialogue->effect == NULL || (result->effect = CFASSFileDialogueEffectCopy(dialogue->effect)) != NULL)
-                {
-                    if((result->text = CFASSFileDialogueTextCopy(dialogue->text)) != NULL)
-                        return result;
-                    if(result->effect != NULL) CFASSFileDialogueEffectDestory(result->effect);
-                }
-                if(result->name != NULL) free(result->name);
+                CFUnicodeStringInternTableRetain(result->nameTable);    // style and name are shared, not dumped
+                return result;
             }
-            if(result->style != NULL) free(result->style);
+            if(result->effect != NULL) CFASSFileDialogueEffectDestory(result->effect);
         }
         free(result);
     }
     return NULL;
 }
 
-CFASSFileDialogueRef CFASSFileDialogueCreateWithString(const wchar_t *source)
+CFASSFileDialogueRef CFASSFileDialogueCreateWithString(const wchar_t *source, CFUnicodeStringInternTableRef nameTable, CFASSFileDialogueTextContentOverrideCacheRef overrideCache)
 {
+    if(source == NULL || nameTable == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogue CreateWithString %p nameTable %p", source, nameTable);
     unsigned int layer;
     CFASSFileDialogueTime start, end;
-    wchar_t *style, *name;
+    const wchar_t *style, *name;
     unsigned int marginL, marginR, marginV;
     CFASSFileDialogueEffectRef effect;      // if not have, assign NULL
     CFASSFileDialogueTextRef text;          // if not hace assign NULL
@@ -159,13 +241,8 @@ CFASSFileDialogueRef CFASSFileDialogueCreateWithString(const wchar_t *source)
     tokenEnd--;
     if(tokenEnd<source)
         style = NULL;
-    else
-    {
-        if((style = malloc(sizeof(wchar_t)*(tokenEnd-source+1+1))) == NULL)
-            return NULL;
-        wmemcpy(style, source, tokenEnd-source+1);
-        style[tokenEnd-source+1] = L'\0';
-    }
+    else if((style = CFUnicodeStringInternTableInternStringWithLength(nameTable, source, tokenEnd-source+1)) == NULL)
+        return NULL;
     source = tokenEnd+2;
     tokenEnd = source;
     while(*tokenEnd !=L',' && *tokenEnd !=L'\0' && *tokenEnd !=L'\n') tokenEnd++;
@@ -174,16 +251,8 @@ CFASSFileDialogueRef CFASSFileDialogueCreateWithString(const wchar_t *source)
     tokenEnd--;
     if(tokenEnd<source)
         name = NULL;
-    else
-    {
-        if((name = malloc(sizeof(wchar_t)*(tokenEnd-source+1+1))) == NULL)
-        {
-            if(style!=NULL) free(style);
-            return NULL;
-        }
-        wmemcpy(name, source, tokenEnd-source+1);
-        name[tokenEnd-source+1] = L'\0';
-    }
+    else if((name = CFUnicodeStringInternTableInternStringWithLength(nameTable, source, tokenEnd-source+1)) == NULL)
+        return NULL;
     source  = tokenEnd+2;
     temp = swscanf(source, L"%u,%u,%u,%n",
                    &marginL, &marginR, &marginV,
@@ -192,20 +261,12 @@ CFASSFileDialogueRef CFASSFileDialogueCreateWithString(const wchar_t *source)
        || source[scanAmount-1] != L','
        || source[scanAmount]==L'\0'
        || source[scanAmount] == L'\n')
-    {
-        if(style!=NULL) free(style);
-        if(name!=NULL) free(name);
         return NULL;
-    }
     source += scanAmount;
     tokenEnd = source;
     while(*tokenEnd !=L',' && *tokenEnd !=L'\0' && *tokenEnd !=L'\n') tokenEnd++;
     if(*tokenEnd != L',')
-    {
-        if(style!=NULL) free(style);
-        if(name!=NULL) free(name);
         return NULL;
-    }
     tokenEnd--;
     if(tokenEnd<source)
         effect = NULL;
@@ -213,28 +274,21 @@ CFASSFileDialogueRef CFASSFileDialogueCreateWithString(const wchar_t *source)
     {
         effect = CFASSFileDialogueEffectCreateWithString(source, tokenEnd);
         if(effect == NULL)
-        {
-            if(style!=NULL) free(style);
-            if(name!=NULL) free(name);
             return NULL;
-        }
     }
     source = tokenEnd+2;
-    text = CFASSFileDialogueTextCreateWithString(source);
+    text = CFASSFileDialogueTextCreateWithString(source, overrideCache);
     if(text == NULL)
     {
-        if(style!=NULL) free(style);
-        if(name!=NULL) free(name);
         if(effect!=NULL) CFASSFileDialogueEffectDestory(effect);
         return NULL;
     }
     CFASSFileDialogueRef result = malloc(sizeof(struct CFASSFileDialogue));
     if(result == NULL)
     {
-        if(style!=NULL) free(style);
-        if(name!=NULL) free(name);
         if(effect!=NULL) CFASSFileDialogueEffectDestory(effect);
         if(text!=NULL) CFASSFileDialogueTextDestory(text);
+        return NULL;
     }
     result->layer = layer;
     result->start = start;
@@ -246,6 +300,10 @@ CFASSFileDialogueRef CFASSFileDialogueCreateWithString(const wchar_t *source)
     result->marginV = marginV;
     result->effect = effect;
     result->text = text;
+    result->cachedStyle = NULL;
+    result->cachedStyleCollection = NULL;
+    result->cachedStyleGeneration = 0;
+    result->nameTable = CFUnicodeStringInternTableRetain(nameTable);
     return result;
 }
 
@@ -257,86 +315,69 @@ static bool CFASSFileDialogueTimeFormatCheck(CFASSFileDialogueTime time)
 
 int CFASSFileDialogueStoreStringResult(CFASSFileDialogueRef dialogue, wchar_t *targetPoint)
 {
-    int result = 0, temp;
-    if(targetPoint == NULL)
+    CFMutableStringRef string;
+    if((string = CFMutableStringCreateEmpty()) == NULL)
+        return -1;
+    int result = -1;
+    if(CFASSFileDialogueAppendStringResult(dialogue, string) == 0)
     {
-        FILE *fp = tmpfile();
-        if(fp == NULL) return -1;
-        
-        temp = fwprintf(fp, L"Dialogue: %u,%u:%02u:%02u.%02u,%u:%02u:%02u.%02u,",
-                        dialogue->layer,
-                        dialogue->start.hour, dialogue->start.min, dialogue->start.sec, dialogue->start.hundredths,
-                        dialogue->end.hour, dialogue->end.min, dialogue->end.sec, dialogue->end.hundredths);
-        if(temp < 0) return -1;
-        result += temp;
-
-        temp = fwprintf(fp, L"%ls,%ls,%u,%u,%u,",
-                        dialogue->style==NULL?L"":dialogue->style,
-                        dialogue->name==NULL?L"":dialogue->name,
-                        dialogue->marginL, dialogue->marginR, dialogue->marginV);
-        if(temp < 0) return -1;
-        result += temp;
-
-        if(dialogue->effect != NULL)
-        {
-            temp = CFASSFileDialogueEffectStoreStringResult(dialogue->effect, NULL);
-            if(temp < 0) return -1;
-            result += temp;
-        }
-
-        temp = fwprintf(fp, L",");
-        if(temp < 0) return -1;
-        result += temp;
-        
-        temp = CFASSFileDialogueTextStoreStringResult(dialogue->text, NULL);
-        if(temp < 0) return -1;
-        result += temp;
-        
-        fclose(fp);
-    }
-    else
-    {
-        temp = swprintf(targetPoint, SIZE_MAX, L"Dialogue: %u,%u:%02u:%02u.%02u,%u:%02u:%02u.%02u,",
-                        dialogue->layer,
-                        dialogue->start.hour, dialogue->start.min, dialogue->start.sec, dialogue->start.hundredths,
-                        dialogue->end.hour, dialogue->end.min, dialogue->end.sec, dialogue->end.hundredths);
-        if(temp < 0) return -1;
-        result += temp;
-        targetPoint += temp;
-        temp = swprintf(targetPoint, SIZE_MAX, L"%ls,%ls,%u,%u,%u,",
-                        dialogue->style==NULL?L"":dialogue->style,
-                        dialogue->name==NULL?L"":dialogue->name,
-                        dialogue->marginL, dialogue->marginR, dialogue->marginV);
-        if(temp < 0) return -1;
-        result += temp;
-        targetPoint += temp;
-        
-        if(dialogue->effect != NULL)
-        {
-            temp = CFASSFileDialogueEffectStoreStringResult(dialogue->effect, targetPoint);
-            if(temp < 0) return -1;
-            result += temp;
-            targetPoint += temp;
-        }
-        
-        temp = swprintf(targetPoint, SIZE_MAX, L",");
-        if(temp < 0) return -1;
-        result += temp;
-        targetPoint += temp;
-        
-        temp = CFASSFileDialogueTextStoreStringResult(dialogue->text, targetPoint);
-        if(temp < 0) return -1;
-        result += temp;
+        result = (int)CFMutableStringGetLength(string);
+        if(targetPoint != NULL)
+            wmemcpy(targetPoint, CFMutableStringGetCharacters(string), result + 1);
     }
+    CFMutableStringDestory(string);
     return result;
 }
 
+static void CFASSFileDialogueAppendTime(CFMutableStringRef string, CFASSFileDialogueTime time)
+{
+    // h:mm:ss.cc
+    CFMutableStringAppendUnsigned(string, time.hour);
+    CFMutableStringAppendCharacter(string, L':');
+    CFMutableStringAppendUnsignedWithMinimumDigits(string, time.min, 2);
+    CFMutableStringAppendCharacter(string, L':');
+    CFMutableStringAppendUnsignedWithMinimumDigits(string, time.sec, 2);
+    CFMutableStringAppendCharacter(string, L'.');
+    CFMutableStringAppendUnsignedWithMinimumDigits(string, time.hundredths, 2);
+}
+
+int CFASSFileDialogueAppendStringResult(CFASSFileDialogueRef dialogue, CFMutableStringRef string)
+{
+    if(dialogue == NULL || string == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogue %p AppendStringResult %p", dialogue, string);
+    CFMutableStringAppendString(string, L"Dialogue: ");
+    CFMutableStringAppendUnsigned(string, dialogue->layer);
+    CFMutableStringAppendCharacter(string, L',');
+    CFASSFileDialogueAppendTime(string, dialogue->start);
+    CFMutableStringAppendCharacter(string, L',');
+    CFASSFileDialogueAppendTime(string, dialogue->end);
+    CFMutableStringAppendCharacter(string, L',');
+    
+    CFMutableStringAppendString(string, dialogue->style==NULL?L"":dialogue->style);
+    CFMutableStringAppendCharacter(string, L',');
+    CFMutableStringAppendString(string, dialogue->name==NULL?L"":dialogue->name);
+    CFMutableStringAppendCharacter(string, L',');
+    CFMutableStringAppendUnsigned(string, dialogue->marginL);
+    CFMutableStringAppendCharacter(string, L',');
+    CFMutableStringAppendUnsigned(string, dialogue->marginR);
+    CFMutableStringAppendCharacter(string, L',');
+    CFMutableStringAppendUnsigned(string, dialogue->marginV);
+    CFMutableStringAppendCharacter(string, L',');
+    
+    if(dialogue->effect != NULL && CFASSFileDialogueEffectAppendStringResult(dialogue->effect, string) != 0)
+        return -1;
+    CFMutableStringAppendCharacter(string, L',');
+    
+    if(CFASSFileDialogueTextAppendStringResult(dialogue->text, string) != 0)
+        return -1;
+    return CFMutableStringIsFailed(string) ? -1 : 0;
+}
+
 //Dialogue: 0,0:03:54.09,0:04:04.04,zhizuorenyuan,NTP,0,0,0,,{\fad(150,150)}翻译
 
 void CFASSFileDialogueDestory(CFASSFileDialogueRef dialogue)
 {
-    if(dialogue->style!=NULL) free(dialogue->style);
-    if(dialogue->name!=NULL) free(dialogue->name);
+    CFUnicodeStringInternTableRelease(dialogue->nameTable);
     if(dialogue->effect!=NULL) CFASSFileDialogueEffectDestory(dialogue->effect);
     CFASSFileDialogueTextDestory(dialogue->text);
     free(dialogue);
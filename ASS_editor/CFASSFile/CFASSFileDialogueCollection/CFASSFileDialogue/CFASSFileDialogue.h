@@ -10,6 +10,9 @@
 #define CFASSFileDialogue_h
 
 #include "CFASSFileChange.h"
+#include "CFASSFileStyle.h"
+#include "CFASSFileStyleCollection.h"
+#include "CFASSFileDialogueText.h"
 
 typedef struct CFASSFileDialogue *CFASSFileDialogueRef;
 
@@ -19,6 +22,38 @@ CFASSFileDialogueRef CFASSFileDialogueCopy(CFASSFileDialogueRef dialogue);
 
 void CFASSFileDialogueDestory(CFASSFileDialogueRef dialogue);
 
+#pragma mark - Get Component
+
+unsigned int CFASSFileDialogueGetLayer(CFASSFileDialogueRef dialogue);
+
+unsigned long CFASSFileDialogueGetStartTime(CFASSFileDialogueRef dialogue);
+
+unsigned long CFASSFileDialogueGetEndTime(CFASSFileDialogueRef dialogue);
+/* Return */
+// time in hundredths of second
+
+void CFASSFileDialogueGetMargins(CFASSFileDialogueRef dialogue, unsigned int *marginL, unsigned int *marginR, unsigned int *marginV);
+/* marginL, marginR, marginV */
+// could be NULL
+
+const wchar_t *CFASSFileDialogueGetStyleName(CFASSFileDialogueRef dialogue);
+
+const wchar_t *CFASSFileDialogueGetActorName(CFASSFileDialogueRef dialogue);
+/* Return */
+// NULL for empty, the string is shared by dialogues of the same file
+// dialogues of the same file having the same name return the same pointer, so compare them by pointer
+
+CFASSFileDialogueTextRef CFASSFileDialogueGetText(CFASSFileDialogueRef dialogue);
+/* Return */
+// the dialogue keeps the ownership
+
+CFASSFileStyleRef CFASSFileDialogueGetStyle(CFASSFileDialogueRef dialogue, CFASSFileStyleCollectionRef styleCollection);
+/* Return */
+// the style named by dialogue in styleCollection, NULL if dialogue has no style name or it is not found
+/* Discussion */
+// the resolved style is cached in dialogue, it is reused until styleCollection add, remove or rename a style
+// as the cache is written, don't call it on the same dialogue from different threads at the same time
+
 #pragma mark - Receive Change
 
 void CFASSFileDialogueMakeChange(CFASSFileDialogueRef dialogue, CFASSFileChangeRef change);
@@ -18,6 +18,7 @@
 #include "CFASSFileChange.h"
 #include "CFASSFileChange_Private.h"
 #include "CFException.h"
+#include "CFMutableString.h"
 
 typedef enum CFASSFileDialogueEffectType
 {
@@ -161,88 +162,55 @@ CFASSFileDialogueEffectRef CFASSFileDialogueEffectCreateWithString(const wchar_t
 }
 int CFASSFileDialogueEffectStoreStringResult(CFASSFileDialogueEffectRef effect, wchar_t *targetPoint)
 {
+    CFMutableStringRef string;
+    if((string = CFMutableStringCreateEmpty()) == NULL)
+        return -1;
     int result = -1;
-    if(targetPoint != NULL)
-        switch (effect->type)
-        {
+    if(CFASSFileDialogueEffectAppendStringResult(effect, string) == 0)
+    {
+        result = (int)CFMutableStringGetLength(string);
+        if(targetPoint != NULL)
+            wmemcpy(targetPoint, CFMutableStringGetCharacters(string), result + 1);
+    }
+    CFMutableStringDestory(string);
+    return result;
+}
+
+int CFASSFileDialogueEffectAppendStringResult(CFASSFileDialogueEffectRef effect, CFMutableStringRef string)
+{
+    if(effect == NULL || string == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueEffect %p AppendStringResult %p", effect, string);
+    switch (effect->type)
+    {
         case CFASSFileDialogueEffectTypeKaraoke:
-            result = swprintf(targetPoint, SIZE_MAX, L"Karaoke");
+            CFMutableStringAppendString(string, L"Karaoke");
             break;
         case CFASSFileDialogueEffectTypeScroll:
+            CFMutableStringAppendString(string, effect->data.scroll.scrollDirection == CFASSFileDialogueEffectScrollDirectionUp?L"Scroll up;":L"Scroll down;");
+            CFMutableStringAppendInteger(string, effect->data.scroll.positionY1);
+            CFMutableStringAppendCharacter(string, L';');
+            CFMutableStringAppendInteger(string, effect->data.scroll.positionY2);
+            CFMutableStringAppendCharacter(string, L';');
+            CFMutableStringAppendUnsigned(string, effect->data.scroll.delay);
             if(effect->data.scroll.hasFadeAwayHeight)
-                result = swprintf(targetPoint, SIZE_MAX, L"Scroll %ls;%d;%d;%u;%d",
-                                  effect->data.scroll.scrollDirection == CFASSFileDialogueEffectScrollDirectionUp?L"up":L"down",
-                                  effect->data.scroll.positionY1, effect->data.scroll.positionY2,
-                                  effect->data.scroll.delay,
-                                  effect->data.scroll.fadeAwayHeight);
-            else
-                result = swprintf(targetPoint, SIZE_MAX, L"Scroll %ls;%d;%d;%u",
-                                  effect->data.scroll.scrollDirection == CFASSFileDialogueEffectScrollDirectionUp?L"up":L"down",
-                                  effect->data.scroll.positionY1, effect->data.scroll.positionY2,
-                                  effect->data.scroll.delay);
+            {
+                CFMutableStringAppendCharacter(string, L';');
+                CFMutableStringAppendInteger(string, effect->data.scroll.fadeAwayHeight);
+            }
             break;
         case CFASSFileDialogueEffectTypeBanner:
-            if(!effect->data.banner.usingDefaultDirection && effect->data.banner.hasFadeAwayWidth)
-                result = swprintf(targetPoint, SIZE_MAX, L"Banner;%u;%u;%d",
-                                  effect->data.banner.delay,
-                                  effect->data.banner.leftToRight?1u:0u,
-                                  effect->data.banner.fadeAwayWidth);
-            else if(!effect->data.banner.usingDefaultDirection && !effect->data.banner.hasFadeAwayWidth)
-                result = swprintf(targetPoint, SIZE_MAX, L"Banner;%u;%u",
-                                  effect->data.banner.delay,
-                                  effect->data.banner.leftToRight?1u:0u);
-            else if(effect->data.banner.usingDefaultDirection && effect->data.banner.hasFadeAwayWidth)
-                result = swprintf(targetPoint, SIZE_MAX, L"Banner;%u;%d",
-                                  effect->data.banner.delay,
-                                  effect->data.banner.fadeAwayWidth);
-            else if(effect->data.banner.usingDefaultDirection && !effect->data.banner.hasFadeAwayWidth)
-                result = swprintf(targetPoint, SIZE_MAX, L"Banner;%u", effect->data.banner.delay);
+            CFMutableStringAppendString(string, L"Banner;");
+            CFMutableStringAppendUnsigned(string, effect->data.banner.delay);
+            if(!effect->data.banner.usingDefaultDirection)
+                CFMutableStringAppendString(string, effect->data.banner.leftToRight?L";1":L";0");
+            if(effect->data.banner.hasFadeAwayWidth)
+            {
+                CFMutableStringAppendCharacter(string, L';');
+                CFMutableStringAppendInteger(string, effect->data.banner.fadeAwayWidth);
+            }
             break;
-        }
-    else
-    {
-        FILE *fp = tmpfile();
-        if(fp == NULL) return -1;
-        switch (effect->type)
-        {
-            case CFASSFileDialogueEffectTypeKaraoke:
-                result = fwprintf(fp, L"Karaoke");
-                break;
-            case CFASSFileDialogueEffectTypeScroll:
-                if(effect->data.scroll.hasFadeAwayHeight)
-                    result = fwprintf(fp, L"Scroll %ls;%d;%d;%u;%d",
-                                    effect->data.scroll.scrollDirection == CFASSFileDialogueEffectScrollDirectionUp?L"up":L"down",
-                                    effect->data.scroll.positionY1, effect->data.scroll.positionY2,
-                                    effect->data.scroll.delay,
-                                    effect->data.scroll.fadeAwayHeight);
-                else
-                    result = fwprintf(fp, L"Scroll %ls;%d;%d;%u",
-                                    effect->data.scroll.scrollDirection == CFASSFileDialogueEffectScrollDirectionUp?L"up":L"down",
-                                    effect->data.scroll.positionY1, effect->data.scroll.positionY2,
-                                    effect->data.scroll.delay);
-                break;
-            case CFASSFileDialogueEffectTypeBanner:
-                if(!effect->data.banner.usingDefaultDirection && effect->data.banner.hasFadeAwayWidth)
-                    result = fwprintf(fp, L"Banner;%u;%u;%d",
-                                      effect->data.banner.delay,
-                                      effect->data.banner.leftToRight?1u:0u,
-                                      effect->data.banner.fadeAwayWidth);
-                else if(!effect->data.banner.usingDefaultDirection && !effect->data.banner.hasFadeAwayWidth)
-                    result = fwprintf(fp, L"Banner;%u;%u",
-                                      effect->data.banner.delay,
-                                      effect->data.banner.leftToRight?1u:0u);
-                else if(effect->data.banner.usingDefaultDirection && effect->data.banner.hasFadeAwayWidth)
-                    result = fwprintf(fp, L"Banner;%u;%d",
-                                      effect->data.banner.delay,
-                                      effect->data.banner.fadeAwayWidth);
-                else if(effect->data.banner.usingDefaultDirection && !effect->data.banner.hasFadeAwayWidth)
-                    result = fwprintf(fp, L"Banner;%u", effect->data.banner.delay);
-                break;
-        }
-        fclose(fp);
     }
-    if(result<0) return -1;
-    return result;
+    return CFMutableStringIsFailed(string) ? -1 : 0;
 }
 
 void CFASSFileDialogueEffectDestory(CFASSFileDialogueEffectRef effect)
@@ -10,6 +10,7 @@
 #define CFASSFileDialogueEffect_Private_h
 
 #include "CFASSFileDialogueEffect.h"
+#include "CFMutableString.h"
 
 CFASSFileDialogueEffectRef CFASSFileDialogueEffectCreateWithString(const wchar_t *beginPoint, const wchar_t *endPoint);
 
@@ -21,4 +22,8 @@ int CFASSFileDialogueEffectStoreStringResult(CFASSFileDialogueEffectRef effect,
 // if targetPoint is NULL, it will not try to store string in it
 // return will be the store string Length if targetPoint is long enough even is NULL
 
+int CFASSFileDialogueEffectAppendStringResult(CFASSFileDialogueEffectRef effect, CFMutableStringRef string);
+/* Return */
+// 0 for success, -1 if anything went wrong
+
 #endif /* CFASSFileDialogueEffect_Private_h */
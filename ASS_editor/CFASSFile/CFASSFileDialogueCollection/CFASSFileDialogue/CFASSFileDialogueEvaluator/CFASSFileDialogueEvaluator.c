@@ -0,0 +1,566 @@
+//
+//  CFASSFileDialogueEvaluator.c
+//  ASS_editor
+//
+//  Created by Bill Sun on 2018/11/5.
+//  Copyright © 2018 Bill Sun. All rights reserved.
+//
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "CFASSFileDialogueEvaluator.h"
+#include "CFASSFileDialogueText.h"
+#include "CFASSFileDialogueTextContent.h"
+#include "CFASSFileDialogueTextContentOverride.h"
+#include "CFASSFileDialogueTextContentOverride_Private.h"
+#include "CFASSFileDialogueTextContentOverrideContent.h"
+#include "CFASSFileDialogueTextContentOverrideContent_Private.h"
+#include "CFEnumerator.h"
+#include "CFException.h"
+
+#define CFASSFileDialogueEvaluatorPropertyAmount CFASSFileDialogueTextContentOverrideContentPropertyAmount
+
+typedef struct CFASSFileDialogueEvaluatorAnimation
+{
+    CFASSFileDialogueTextContentOverrideContentProperty property;
+    double beginMS, endMS, acceleration, target;
+} CFASSFileDialogueEvaluatorAnimation;
+
+typedef struct CFASSFileDialogueEvaluatorRun
+{
+    const wchar_t *text;
+    double base[CFASSFileDialogueEvaluatorPropertyAmount];
+    size_t animationBegin, animationEnd;            // keyframe tracks in evaluator->animations
+    bool hasKaraoke, hasSweepEffect;
+    double karaokeBeginMS, karaokeDurationMS;
+} CFASSFileDialogueEvaluatorRun;
+
+struct CFASSFileDialogueEvaluator
+{
+    double startMS, endMS;
+    CFASSFileDialogueEvaluatorRun *runs;
+    size_t runAmount, runCapacity;
+    CFASSFileDialogueEvaluatorAnimation *animations;
+    size_t animationAmount, animationCapacity;
+    bool hasMovement;
+    double fromX, fromY, toX, toY, movementBeginMS, movementEndMS;
+    bool hasFade;
+    double fadeAlphas[3], fadeTimes[4];
+};
+
+typedef struct CFASSFileDialogueEvaluatorCompiler
+{
+    CFASSFileDialogueEvaluatorRef evaluator;
+    CFASSFileStyleCollectionRef styleCollection;
+    CFASSFileStyleRef dialogueStyle;
+    double base[CFASSFileDialogueEvaluatorPropertyAmount];
+    CFASSFileDialogueEvaluatorAnimation *pending;
+    size_t pendingAmount, pendingCapacity;
+    bool pendingChanged;
+    size_t animationBegin, animationEnd;
+    bool hasKaraoke, hasSweepEffect;
+    double karaokeBeginMS, karaokeDurationMS, karaokeNextMS;
+} CFASSFileDialogueEvaluatorCompiler;
+
+static void CFASSFileDialogueEvaluatorLoadStyle(double *values, CFASSFileStyleRef style);
+
+static int CFASSFileDialogueEvaluatorCompileOverride(CFASSFileDialogueEvaluatorCompiler *compiler, CFASSFileDialogueTextContentOverrideRef override);
+
+static int CFASSFileDialogueEvaluatorCompileText(CFASSFileDialogueEvaluatorCompiler *compiler, const wchar_t *text);
+
+static void *CFASSFileDialogueEvaluatorReserve(void *array, size_t elementSize, size_t amount, size_t *capacity);
+
+#pragma mark - Create/Destory
+
+CFASSFileDialogueEvaluatorRef CFASSFileDialogueEvaluatorCreate(CFASSFileDialogueRef dialogue, CFASSFileStyleCollectionRef styleCollection)
+{
+    if(dialogue == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueEvaluatorCreate %p %p", dialogue, styleCollection);
+    CFASSFileDialogueEvaluatorRef result;
+    if((result = calloc(1, sizeof(struct CFASSFileDialogueEvaluator))) != NULL)
+    {
+        result->startMS = CFASSFileDialogueGetStartTime(dialogue) * 10.0;
+        result->endMS = CFASSFileDialogueGetEndTime(dialogue) * 10.0;
+        CFASSFileDialogueEvaluatorCompiler compiler = {0};
+        compiler.evaluator = result;
+        compiler.styleCollection = styleCollection;
+        compiler.dialogueStyle = styleCollection != NULL ? CFASSFileDialogueGetStyle(dialogue, styleCollection) : NULL;
+        CFASSFileDialogueEvaluatorLoadStyle(compiler.base, compiler.dialogueStyle);
+        compiler.pendingChanged = true;
+        CFEnumeratorRef enumerator;
+        if((enumerator = CFASSFileDialogueTextCreateEnumerator(CFASSFileDialogueGetText(dialogue))) != NULL)
+        {
+            int compileResult = 0;
+            CFASSFileDialogueTextContentRef eachContent;
+            while(compileResult == 0 && (eachContent = CFEnumeratorNextObject(enumerator)) != NULL)
+            {
+                if(CFASSFileDialogueTextContentGetType(eachContent) == CFASSFileDialogueTextContentTypeOverride)
+                    compileResult = CFASSFileDialogueEvaluatorCompileOverride(&compiler, CFASSFileDialogueTextContentGetOverride(eachContent));
+                else
+                    compileResult = CFASSFileDialogueEvaluatorCompileText(&compiler, CFASSFileDialogueTextContentGetText(eachContent));
+            }
+            CFEnumeratorDestory(enumerator);
+            free(compiler.pending);
+            if(compileResult == 0)
+                return result;
+        }
+        else
+            free(compiler.pending);
+        CFASSFileDialogueEvaluatorDestory(result);
+    }
+    return NULL;
+}
+
+void CFASSFileDialogueEvaluatorDestory(CFASSFileDialogueEvaluatorRef evaluator)
+{
+    if(evaluator == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueEvaluatorDestory NULL");
+    free(evaluator->runs);
+    free(evaluator->animations);
+    free(evaluator);
+}
+
+#pragma mark - Compile
+
+static void CFASSFileDialogueEvaluatorLoadStyle(double *values, CFASSFileStyleRef style)
+{
+    // without style, the defaults of a style line nobody edited
+    unsigned int outline = 2, shadow = 2;
+    CFASSFileStyleColor colors[4] = {
+        CFASSFileStyleColorMake(0, 0xFF, 0xFF, 0xFF),
+        CFASSFileStyleColorMake(0, 0xFF, 0, 0),
+        CFASSFileStyleColorMake(0, 0, 0, 0),
+        CFASSFileStyleColorMake(0, 0, 0, 0)
+    };
+    for(unsigned int index = 0; index < CFASSFileDialogueEvaluatorPropertyAmount; index++)
+        values[index] = 0;
+    values[CFASSFileDialogueTextContentOverrideContentPropertyFontSize] = 18;
+    values[CFASSFileDialogueTextContentOverrideContentPropertyFontScaleX] = 100;
+    values[CFASSFileDialogueTextContentOverrideContentPropertyFontScaleY] = 100;
+    if(style != NULL)
+    {
+        values[CFASSFileDialogueTextContentOverrideContentPropertyFontSize] = CFASSFileStyleGetFontSize(style);
+        CFASSFileStyleGetScale(style,
+                               &values[CFASSFileDialogueTextContentOverrideContentPropertyFontScaleX],
+                               &values[CFASSFileDialogueTextContentOverrideContentPropertyFontScaleY]);
+        values[CFASSFileDialogueTextContentOverrideContentPropertyFontSpacing] = CFASSFileStyleGetSpacing(style);
+        values[CFASSFileDialogueTextContentOverrideContentPropertyRotationZ] = CFASSFileStyleGetAngle(style);
+        CFASSFileStyleGetOutlineAndShadow(style, &outline, &shadow);
+        CFASSFileStyleGetColors(style, &colors[0], &colors[1], &colors[2], &colors[3]);
+    }
+    values[CFASSFileDialogueTextContentOverrideContentPropertyBorderX] = outline;
+    values[CFASSFileDialogueTextContentOverrideContentPropertyBorderY] = outline;
+    values[CFASSFileDialogueTextContentOverrideContentPropertyShadowX] = shadow;
+    values[CFASSFileDialogueTextContentOverrideContentPropertyShadowY] = shadow;
+    for(unsigned int index = 0; index < 4; index++)
+    {
+        values[CFASSFileDialogueTextContentOverrideContentPropertyColor + 3 * index] = colors[index].blue;
+        values[CFASSFileDialogueTextContentOverrideContentPropertyColor + 3 * index + 1] = colors[index].green;
+        values[CFASSFileDialogueTextContentOverrideContentPropertyColor + 3 * index + 2] = colors[index].red;
+        values[CFASSFileDialogueTextContentOverrideContentPropertyAlpha + index] = colors[index].alpha;
+    }
+}
+
+static void *CFASSFileDialogueEvaluatorReserve(void *array, size_t elementSize, size_t amount, size_t *capacity)
+{
+    if(amount < *capacity)
+        return array;
+    size_t newCapacity = *capacity == 0 ? 8 : *capacity * 2;
+    void *newArray;
+    if((newArray = realloc(array, elementSize * newCapacity)) != NULL)
+        *capacity = newCapacity;
+    return newArray;
+}
+
+static int CFASSFileDialogueEvaluatorCompileAnimation(CFASSFileDialogueEvaluatorCompiler *compiler,
+                                                      bool hasTimeOffset,
+                                                      unsigned int beginMS, unsigned int endMS,
+                                                      double acceleration,
+                                                      const wchar_t *modifiers)
+{
+    CFASSFileDialogueTextContentOverrideRef override;
+    if((override = CFASSFileDialogueTextContentOverrideCreateWithString(modifiers, false)) == NULL)
+        return 0;   // nothing could be animated, \t is kept as it is when encoding
+    CFEnumeratorRef enumerator;
+    if((enumerator = CFASSFileDialogueTextContentOverrideCreateEnumerator(override)) == NULL)
+    {
+        CFASSFileDialogueTextContentOverrideDestory(override);
+        return -1;
+    }
+    int result = 0;
+    CFASSFileDialogueTextContentOverrideContentRef eachContent;
+    while(result == 0 && (eachContent = CFEnumeratorNextObject(enumerator)) != NULL)
+    {
+        CFASSFileDialogueTextContentOverrideContentProperty properties[CFASSFileDialogueTextContentOverrideContentPropertyMaximumPerContent];
+        double values[CFASSFileDialogueTextContentOverrideContentPropertyMaximumPerContent];
+        unsigned int amount = CFASSFileDialogueTextContentOverrideContentGetProperties(eachContent, properties, values);
+        for(unsigned int index = 0; index < amount && result == 0; index++)
+        {
+            CFASSFileDialogueEvaluatorAnimation *pending;
+            if((pending = CFASSFileDialogueEvaluatorReserve(compiler->pending, sizeof(CFASSFileDialogueEvaluatorAnimation), compiler->pendingAmount, &compiler->pendingCapacity)) == NULL)
+            {
+                result = -1;
+                break;
+            }
+            compiler->pending = pending;
+            pending[compiler->pendingAmount++] = (CFASSFileDialogueEvaluatorAnimation){
+                .property = properties[index],
+                .beginMS = hasTimeOffset ? beginMS : 0,
+                .endMS = hasTimeOffset ? endMS : compiler->evaluator->endMS - compiler->evaluator->startMS,
+                .acceleration = acceleration,
+                .target = values[index]
+            };
+            compiler->pendingChanged = true;
+        }
+    }
+    CFEnumeratorDestory(enumerator);
+    CFASSFileDialogueTextContentOverrideDestory(override);
+    return result;
+}
+
+static int CFASSFileDialogueEvaluatorCompileOverride(CFASSFileDialogueEvaluatorCompiler *compiler, CFASSFileDialogueTextContentOverrideRef override)
+{
+    CFASSFileDialogueEvaluatorRef evaluator = compiler->evaluator;
+    CFEnumeratorRef enumerator;
+    if((enumerator = CFASSFileDialogueTextContentOverrideCreateEnumerator(override)) == NULL)
+        return -1;
+    int result = 0;
+    CFASSFileDialogueTextContentOverrideContentRef eachContent;
+    while(result == 0 && (eachContent = CFEnumeratorNextObject(enumerator)) != NULL)
+    {
+        CFASSFileDialogueTextContentOverrideContentProperty properties[CFASSFileDialogueTextContentOverrideContentPropertyMaximumPerContent];
+        double values[CFASSFileDialogueTextContentOverrideContentPropertyMaximumPerContent];
+        unsigned int amount = CFASSFileDialogueTextContentOverrideContentGetProperties(eachContent, properties, values);
+        if(amount != 0)
+        {
+            // a static value overrides whatever was animating the property before it
+            for(unsigned int index = 0; index < amount; index++)
+            {
+                compiler->base[properties[index]] = values[index];
+                size_t kept = 0;
+                for(size_t pendingIndex = 0; pendingIndex < compiler->pendingAmount; pendingIndex++)
+                    if(compiler->pending[pendingIndex].property != properties[index])
+                        compiler->pending[kept++] = compiler->pending[pendingIndex];
+                compiler->pendingAmount = kept;
+            }
+            compiler->pendingChanged = true;
+            continue;
+        }
+        int fromX, fromY, toX, toY;
+        unsigned int beginMS, endMS, centiSeconds;
+        bool isComplexed, hasSweepEffect, hasTimeOffset;
+        unsigned char alphas[3];
+        unsigned int times[4];
+        double acceleration;
+        const wchar_t *modifiers, *styleName;
+        if(CFASSFileDialogueTextContentOverrideContentGetMovement(eachContent, &fromX, &fromY, &toX, &toY, &beginMS, &endMS) == 0)
+        {
+            // the first \pos or \move wins
+            if(evaluator->hasMovement)
+                continue;
+            evaluator->hasMovement = true;
+            evaluator->fromX = fromX;
+            evaluator->fromY = fromY;
+            evaluator->toX = toX;
+            evaluator->toY = toY;
+            evaluator->movementBeginMS = beginMS;
+            evaluator->movementEndMS = endMS;
+            if(beginMS == 0 && endMS == 0)
+                evaluator->movementEndMS = evaluator->endMS - evaluator->startMS;
+        }
+        else if(CFASSFileDialogueTextContentOverrideContentGetFade(eachContent, &isComplexed, alphas, times) == 0)
+        {
+            if(evaluator->hasFade)
+                continue;
+            evaluator->hasFade = true;
+            for(unsigned int index = 0; index < 3; index++)
+                evaluator->fadeAlphas[index] = alphas[index];
+            if(isComplexed)
+                for(unsigned int index = 0; index < 4; index++)
+                    evaluator->fadeTimes[index] = times[index];
+            else
+            {
+                double durationMS = evaluator->endMS - evaluator->startMS;
+                evaluator->fadeTimes[0] = 0;
+                evaluator->fadeTimes[1] = times[0];
+                evaluator->fadeTimes[2] = durationMS - times[1];
+                evaluator->fadeTimes[3] = durationMS;
+            }
+        }
+        else if(CFASSFileDialogueTextContentOverrideContentGetKaraoke(eachContent, &centiSeconds, &hasSweepEffect) == 0)
+        {
+            compiler->hasKaraoke = true;
+            compiler->hasSweepEffect = hasSweepEffect;
+            compiler->karaokeBeginMS = compiler->karaokeNextMS;
+            compiler->karaokeDurationMS = centiSeconds * 10.0;
+            compiler->karaokeNextMS += compiler->karaokeDurationMS;
+        }
+        else if(CFASSFileDialogueTextContentOverrideContentGetAnimation(eachContent, &hasTimeOffset, &beginMS, &endMS, &acceleration, &modifiers) == 0)
+            result = CFASSFileDialogueEvaluatorCompileAnimation(compiler, hasTimeOffset, beginMS, endMS, acceleration, modifiers);
+        else if(CFASSFileDialogueTextContentOverrideContentGetReset(eachContent, &styleName) == 0)
+        {
+            CFASSFileStyleRef style = compiler->dialogueStyle;
+            if(styleName != NULL && compiler->styleCollection != NULL)
+            {
+                CFASSFileStyleRef namedStyle = CFASSFileStyleCollectionGetStyleByName(compiler->styleCollection, styleName);
+                if(namedStyle != NULL)
+                    style = namedStyle;
+            }
+            CFASSFileDialogueEvaluatorLoadStyle(compiler->base, style);
+            compiler->pendingAmount = 0;
+            compiler->pendingChanged = true;
+        }
+    }
+    CFEnumeratorDestory(enumerator);
+    return result;
+}
+
+static int CFASSFileDialogueEvaluatorCompileText(CFASSFileDialogueEvaluatorCompiler *compiler, const wchar_t *text)
+{
+    CFASSFileDialogueEvaluatorRef evaluator = compiler->evaluator;
+    if(compiler->pendingChanged)
+    {
+        // runs with no override between them share their tracks
+        CFASSFileDialogueEvaluatorAnimation *animations;
+        size_t neededAmount = evaluator->animationAmount + compiler->pendingAmount;
+        while(evaluator->animationCapacity < neededAmount)
+        {
+            if((animations = CFASSFileDialogueEvaluatorReserve(evaluator->animations, sizeof(CFASSFileDialogueEvaluatorAnimation), evaluator->animationCapacity, &evaluator->animationCapacity)) == NULL)
+                return -1;
+            evaluator->animations = animations;
+        }
+        if(compiler->pendingAmount != 0)
+            memcpy(evaluator->animations + evaluator->animationAmount, compiler->pending, sizeof(CFASSFileDialogueEvaluatorAnimation) * compiler->pendingAmount);
+        compiler->animationBegin = evaluator->animationAmount;
+        compiler->animationEnd = evaluator->animationAmount = neededAmount;
+        compiler->pendingChanged = false;
+    }
+    CFASSFileDialogueEvaluatorRun *runs;
+    if((runs = CFASSFileDialogueEvaluatorReserve(evaluator->runs, sizeof(CFASSFileDialogueEvaluatorRun), evaluator->runAmount, &evaluator->runCapacity)) == NULL)
+        return -1;
+    evaluator->runs = runs;
+    CFASSFileDialogueEvaluatorRun *run = &runs[evaluator->runAmount++];
+    run->text = text;
+    memcpy(run->base, compiler->base, sizeof(run->base));
+    run->animationBegin = compiler->animationBegin;
+    run->animationEnd = compiler->animationEnd;
+    run->hasKaraoke = compiler->hasKaraoke;
+    run->hasSweepEffect = compiler->hasSweepEffect;
+    run->karaokeBeginMS = compiler->karaokeBeginMS;
+    run->karaokeDurationMS = compiler->karaokeDurationMS;
+    return 0;
+}
+
+#pragma mark - Get Component
+
+size_t CFASSFileDialogueEvaluatorGetRunAmount(CFASSFileDialogueEvaluatorRef evaluator)
+{
+    if(evaluator == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueEvaluatorGetRunAmount NULL");
+    return evaluator->runAmount;
+}
+
+const wchar_t *CFASSFileDialogueEvaluatorGetRunText(CFASSFileDialogueEvaluatorRef evaluator, size_t index)
+{
+    if(evaluator == NULL || index >= evaluator->runAmount)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueEvaluator %p GetRunText %zu", evaluator, index);
+    return evaluator->runs[index].text;
+}
+
+#pragma mark - Evaluate
+
+static double CFASSFileDialogueEvaluatorProgress(double timeMS, double beginMS, double endMS)
+{
+    if(timeMS < beginMS)
+        return 0;
+    if(timeMS >= endMS)
+        return 1;
+    return (timeMS - beginMS) / (endMS - beginMS);
+}
+
+static unsigned char CFASSFileDialogueEvaluatorByte(double value)
+{
+    if(value <= 0)
+        return 0;
+    if(value >= 255)
+        return 255;
+    return (unsigned char)(value + 0.5);
+}
+
+bool CFASSFileDialogueEvaluatorEvaluate(CFASSFileDialogueEvaluatorRef evaluator,
+                                        double timeMS,
+                                        CFASSFileDialogueEvaluatorFrame *frame,
+                                        CFASSFileDialogueEvaluatorRunState *runStates)
+{
+    if(evaluator == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueEvaluatorEvaluate NULL");
+    double relativeMS = timeMS - evaluator->startMS;
+    if(frame != NULL)
+    {
+        frame->hasPosition = evaluator->hasMovement;
+        if(evaluator->hasMovement)
+        {
+            double progress = CFASSFileDialogueEvaluatorProgress(relativeMS, evaluator->movementBeginMS, evaluator->movementEndMS);
+            frame->positionX = evaluator->fromX + (evaluator->toX - evaluator->fromX) * progress;
+            frame->positionY = evaluator->fromY + (evaluator->toY - evaluator->fromY) * progress;
+        }
+        else
+            frame->positionX = frame->positionY = 0;
+        double alpha = 0;
+        if(evaluator->hasFade)
+        {
+            const double *times = evaluator->fadeTimes, *alphas = evaluator->fadeAlphas;
+            if(relativeMS < times[2])
+                alpha = alphas[0] + (alphas[1] - alphas[0]) * CFASSFileDialogueEvaluatorProgress(relativeMS, times[0], times[1]);
+            else
+                alpha = alphas[1] + (alphas[2] - alphas[1]) * CFASSFileDialogueEvaluatorProgress(relativeMS, times[2], times[3]);
+        }
+        frame->fadeAlpha = CFASSFileDialogueEvaluatorByte(alpha);
+    }
+    if(runStates != NULL)
+        for(size_t runIndex = 0; runIndex < evaluator->runAmount; runIndex++)
+        {
+            const CFASSFileDialogueEvaluatorRun *run = &evaluator->runs[runIndex];
+            double values[CFASSFileDialogueEvaluatorPropertyAmount];
+            memcpy(values, run->base, sizeof(values));
+            // tracks apply in stream order, each one moves from where the former left the property
+            for(size_t index = run->animationBegin; index < run->animationEnd; index++)
+            {
+                const CFASSFileDialogueEvaluatorAnimation *animation = &evaluator->animations[index];
+                double progress = CFASSFileDialogueEvaluatorProgress(relativeMS, animation->beginMS, animation->endMS);
+                if(progress > 0 && progress < 1 && animation->acceleration != 1)
+                    progress = pow(progress, animation->acceleration);
+                values[animation->property] += (animation->target - values[animation->property]) * progress;
+            }
+            CFASSFileDialogueEvaluatorRunState *state = &runStates[runIndex];
+            state->fontSize = values[CFASSFileDialogueTextContentOverrideContentPropertyFontSize];
+            state->fontScaleX = values[CFASSFileDialogueTextContentOverrideContentPropertyFontScaleX];
+            state->fontScaleY = values[CFASSFileDialogueTextContentOverrideContentPropertyFontScaleY];
+            state->fontSpacing = values[CFASSFileDialogueTextContentOverrideContentPropertyFontSpacing];
+            state->rotationX = values[CFASSFileDialogueTextContentOverrideContentPropertyRotationX];
+            state->rotationY = values[CFASSFileDialogueTextContentOverrideContentPropertyRotationY];
+            state->rotationZ = values[CFASSFileDialogueTextContentOverrideContentPropertyRotationZ];
+            state->shearingX = values[CFASSFileDialogueTextContentOverrideContentPropertyShearingX];
+            state->shearingY = values[CFASSFileDialogueTextContentOverrideContentPropertyShearingY];
+            state->borderX = values[CFASSFileDialogueTextContentOverrideContentPropertyBorderX];
+            state->borderY = values[CFASSFileDialogueTextContentOverrideContentPropertyBorderY];
+            state->shadowX = values[CFASSFileDialogueTextContentOverrideContentPropertyShadowX];
+            state->shadowY = values[CFASSFileDialogueTextContentOverrideContentPropertyShadowY];
+            state->blurEdge = values[CFASSFileDialogueTextContentOverrideContentPropertyBlurEdge];
+            state->blur = values[CFASSFileDialogueTextContentOverrideContentPropertyBlur];
+            CFASSFileStyleColor *colors[4] = {&state->primaryColor, &state->secondaryColor, &state->outlineColor, &state->backColor};
+            for(unsigned int index = 0; index < 4; index++)
+            {
+                colors[index]->blue = CFASSFileDialogueEvaluatorByte(values[CFASSFileDialogueTextContentOverrideContentPropertyColor + 3 * index]);
+                colors[index]->green = CFASSFileDialogueEvaluatorByte(values[CFASSFileDialogueTextContentOverrideContentPropertyColor + 3 * index + 1]);
+                colors[index]->red = CFASSFileDialogueEvaluatorByte(values[CFASSFileDialogueTextContentOverrideContentPropertyColor + 3 * index + 2]);
+                colors[index]->alpha = CFASSFileDialogueEvaluatorByte(values[CFASSFileDialogueTextContentOverrideContentPropertyAlpha + index]);
+            }
+            // \k and \ko switch at the syllable start, \kf and \K sweep through the syllable
+            if(!run->hasKaraoke)
+                state->karaokeProgress = 1;
+            else if(run->hasSweepEffect)
+                state->karaokeProgress = CFASSFileDialogueEvaluatorProgress(relativeMS, run->karaokeBeginMS, run->karaokeBeginMS + run->karaokeDurationMS);
+            else
+                state->karaokeProgress = relativeMS >= run->karaokeBeginMS ? 1 : 0;
+        }
+    return timeMS >= evaluator->startMS && timeMS < evaluator->endMS;
+}
+
+#pragma mark - Evaluate Collection
+
+typedef struct CFASSFileDialogueEvaluatorSchedule
+{
+    double startMS;
+    size_t dialogueIndex;
+} CFASSFileDialogueEvaluatorSchedule;
+
+static int CFASSFileDialogueEvaluatorScheduleCompare(const void *first, const void *second)
+{
+    const CFASSFileDialogueEvaluatorSchedule *firstSchedule = first, *secondSchedule = second;
+    if(firstSchedule->startMS != secondSchedule->startMS)
+        return firstSchedule->startMS < secondSchedule->startMS ? -1 : 1;
+    return firstSchedule->dialogueIndex < secondSchedule->dialogueIndex ? -1 : firstSchedule->dialogueIndex > secondSchedule->dialogueIndex;
+}
+
+int CFASSFileDialogueEvaluatorEvaluateCollection(CFASSFileDialogueCollectionRef dialogueCollection,
+                                                 CFASSFileStyleCollectionRef styleCollection,
+                                                 double firstFrameMS, double frameDurationMS, size_t frameAmount,
+                                                 CFASSFileDialogueEvaluatorFrameFunction function,
+                                                 void *info)
+{
+    if(dialogueCollection == NULL || function == NULL || !(frameDurationMS > 0))
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueEvaluatorEvaluateCollection %p %p %f %f %zu %p", dialogueCollection, styleCollection, firstFrameMS, frameDurationMS, frameAmount, function);
+    size_t dialogueAmount = CFASSFileDialogueCollectionGetLength(dialogueCollection);
+    if(dialogueAmount == 0 || frameAmount == 0)
+        return 0;
+    int result = -1;
+    CFASSFileDialogueEvaluatorRef *evaluators;
+    if((evaluators = calloc(dialogueAmount, sizeof(CFASSFileDialogueEvaluatorRef))) != NULL)
+    {
+        CFASSFileDialogueEvaluatorSchedule *schedules;
+        if((schedules = malloc(sizeof(CFASSFileDialogueEvaluatorSchedule) * dialogueAmount)) != NULL)
+        {
+            size_t *shownIndexes;
+            if((shownIndexes = malloc(sizeof(size_t) * dialogueAmount)) != NULL)
+            {
+                size_t maximumRunAmount = 0;
+                size_t compiledAmount;
+                for(compiledAmount = 0; compiledAmount < dialogueAmount; compiledAmount++)
+                {
+                    if((evaluators[compiledAmount] = CFASSFileDialogueEvaluatorCreate(CFASSFileDialogueCollectionGetDialogueAtIndex(dialogueCollection, compiledAmount), styleCollection)) == NULL)
+                        break;
+                    schedules[compiledAmount].startMS = evaluators[compiledAmount]->startMS;
+                    schedules[compiledAmount].dialogueIndex = compiledAmount;
+                    if(evaluators[compiledAmount]->runAmount > maximumRunAmount)
+                        maximumRunAmount = evaluators[compiledAmount]->runAmount;
+                }
+                CFASSFileDialogueEvaluatorRunState *runStates = NULL;
+                if(compiledAmount == dialogueAmount &&
+                   (maximumRunAmount == 0 || (runStates = malloc(sizeof(CFASSFileDialogueEvaluatorRunState) * maximumRunAmount)) != NULL))
+                {
+                    qsort(schedules, dialogueAmount, sizeof(CFASSFileDialogueEvaluatorSchedule), CFASSFileDialogueEvaluatorScheduleCompare);
+                    size_t nextSchedule = 0, shownAmount = 0;
+                    for(size_t frameIndex = 0; frameIndex < frameAmount; frameIndex++)
+                    {
+                        double timeMS = firstFrameMS + frameDurationMS * frameIndex;
+                        // shownIndexes stays sorted by dialogue index, so each frame reports in collection order
+                        while(nextSchedule < dialogueAmount && schedules[nextSchedule].startMS <= timeMS)
+                        {
+                            size_t dialogueIndex = schedules[nextSchedule++].dialogueIndex;
+                            size_t position = shownAmount++;
+                            while(position > 0 && shownIndexes[position - 1] > dialogueIndex)
+                            {
+                                shownIndexes[position] = shownIndexes[position - 1];
+                                position--;
+                            }
+                            shownIndexes[position] = dialogueIndex;
+                        }
+                        size_t keptAmount = 0;
+                        for(size_t index = 0; index < shownAmount; index++)
+                        {
+                            CFASSFileDialogueEvaluatorRef evaluator = evaluators[shownIndexes[index]];
+                            if(evaluator->endMS <= timeMS)
+                                continue;
+                            shownIndexes[keptAmount++] = shownIndexes[index];
+                            CFASSFileDialogueEvaluatorFrame frame;
+                            CFASSFileDialogueEvaluatorEvaluate(evaluator, timeMS, &frame, runStates);
+                            function(info, frameIndex, shownIndexes[index], evaluator, &frame, runStates);
+                        }
+                        shownAmount = keptAmount;
+                    }
+                    free(runStates);
+                    result = 0;
+                }
+                for(size_t index = 0; index < compiledAmount; index++)
+                    CFASSFileDialogueEvaluatorDestory(evaluators[index]);
+                free(shownIndexes);
+            }
+            free(schedules);
+        }
+        free(evaluators);
+    }
+    return result;
+}
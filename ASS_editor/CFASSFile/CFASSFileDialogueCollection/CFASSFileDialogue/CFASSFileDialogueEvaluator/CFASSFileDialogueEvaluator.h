@@ -0,0 +1,97 @@
+//
+//  CFASSFileDialogueEvaluator.h
+//  ASS_editor
+//
+//  Created by Bill Sun on 2018/11/5.
+//  Copyright © 2018 Bill Sun. All rights reserved.
+//
+
+#ifndef CFASSFileDialogueEvaluator_h
+#define CFASSFileDialogueEvaluator_h
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <wchar.h>
+
+#include "CFASSFileStyle.h"
+#include "CFASSFileStyleCollection.h"
+#include "CFASSFileDialogue.h"
+#include "CFASSFileDialogueCollection.h"
+
+typedef struct CFASSFileDialogueEvaluator *CFASSFileDialogueEvaluatorRef;
+
+typedef struct CFASSFileDialogueEvaluatorRunState
+{
+    double fontSize, fontScaleX, fontScaleY, fontSpacing;
+    double rotationX, rotationY, rotationZ;
+    double shearingX, shearingY;
+    double borderX, borderY, shadowX, shadowY;
+    double blurEdge, blur;
+    CFASSFileStyleColor primaryColor, secondaryColor, outlineColor, backColor;
+    double karaokeProgress;             // 0 not highlighted yet, 1 fully highlighted, between for \kf sweep
+} CFASSFileDialogueEvaluatorRunState;
+
+typedef struct CFASSFileDialogueEvaluatorFrame
+{
+    bool hasPosition;                   // \pos or \move
+    double positionX, positionY;
+    unsigned char fadeAlpha;            // \fad or \fade, 0 opaque, combine with color alpha
+} CFASSFileDialogueEvaluatorFrame;
+
+#pragma mark - Create/Destory
+
+CFASSFileDialogueEvaluatorRef CFASSFileDialogueEvaluatorCreate(CFASSFileDialogueRef dialogue, CFASSFileStyleCollectionRef styleCollection);
+/* styleCollection */
+// resolves the dialogue style and \r, could be NULL to start from the default style
+/* Return */
+// NULL if out of memory
+/* Discussion */
+// the override stream is compiled into runs of text, each with its static state and keyframe tracks
+// the evaluator doesn't reference dialogue after create, except the run text
+
+void CFASSFileDialogueEvaluatorDestory(CFASSFileDialogueEvaluatorRef evaluator);
+
+#pragma mark - Get Component
+
+size_t CFASSFileDialogueEvaluatorGetRunAmount(CFASSFileDialogueEvaluatorRef evaluator);
+
+const wchar_t *CFASSFileDialogueEvaluatorGetRunText(CFASSFileDialogueEvaluatorRef evaluator, size_t index);
+/* Return */
+// owned by the dialogue, invalid once the dialogue changes or is destoryed
+
+#pragma mark - Evaluate
+
+bool CFASSFileDialogueEvaluatorEvaluate(CFASSFileDialogueEvaluatorRef evaluator,
+                                        double timeMS,
+                                        CFASSFileDialogueEvaluatorFrame *frame,
+                                        CFASSFileDialogueEvaluatorRunState *runStates);
+/* timeMS */
+// time of the video in milliseconds, the same clock as dialogue start and end
+/* frame, runStates */
+// could be NULL, runStates holds CFASSFileDialogueEvaluatorGetRunAmount states
+/* Return */
+// true if the dialogue is shown at timeMS, the states are filled anyway
+/* Discussion */
+// \t tracks, \move, \fad, \fade and karaoke are interpolated, no allocation and no string is touched
+
+typedef void (*CFASSFileDialogueEvaluatorFrameFunction)(void *info,
+                                                        size_t frameIndex,
+                                                        size_t dialogueIndex,
+                                                        CFASSFileDialogueEvaluatorRef evaluator,
+                                                        const CFASSFileDialogueEvaluatorFrame *frame,
+                                                        const CFASSFileDialogueEvaluatorRunState *runStates);
+
+int CFASSFileDialogueEvaluatorEvaluateCollection(CFASSFileDialogueCollectionRef dialogueCollection,
+                                                 CFASSFileStyleCollectionRef styleCollection,
+                                                 double firstFrameMS, double frameDurationMS, size_t frameAmount,
+                                                 CFASSFileDialogueEvaluatorFrameFunction function,
+                                                 void *info);
+/* function */
+// called for every dialogue shown in every frame, frames in order, dialogues of a frame in collection order
+// evaluator, frame and runStates are valid only during the call
+/* Return */
+// 0 for success, -1 if out of memory and no frame is evaluated
+/* Discussion */
+// every dialogue is compiled once, frames are swept with the list of dialogues shown, sorted by start time
+
+#endif /* CFASSFileDialogueEvaluator_h */
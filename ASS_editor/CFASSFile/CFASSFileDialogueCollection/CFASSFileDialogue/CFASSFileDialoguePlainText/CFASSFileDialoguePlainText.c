@@ -0,0 +1,320 @@
+//
+//  CFASSFileDialoguePlainText.c
+//  ASS_editor
+//
+//  Created by Bill Sun on 2018/11/5.
+//  Copyright © 2018 Bill Sun. All rights reserved.
+//
+
+#include <stdlib.h>
+#include <stdbool.h>
+
+#include "CFASSFileDialoguePlainText.h"
+#include "CFASSFileDialogueText.h"
+#include "CFASSFileDialogueTextContent.h"
+#include "CFASSFileDialogueTextContentOverride.h"
+#include "CFASSFileDialogueTextContentOverrideContent.h"
+#include "CFASSFileDialogueTextContentOverrideContent_Private.h"
+#include "CFEnumerator.h"
+#include "CFException.h"
+
+#define CFASSFileDialoguePlainTextIsLeadSurrogate(unit) ((unit) >= 0xD800 && (unit) <= 0xDBFF)
+#define CFASSFileDialoguePlainTextIsTrailSurrogate(unit) ((unit) >= 0xDC00 && (unit) <= 0xDFFF)
+
+// what \N \n and \h stand for, \n is a break only under WrapStyle 2 but the view can't see the script info
+static const wchar_t CFASSFileDialoguePlainTextLineSeparator[] = {0x2028, L'\0'};
+static const wchar_t CFASSFileDialoguePlainTextNoBreakSpace[] = {0x00A0, L'\0'};
+
+struct CFASSFileDialoguePlainText
+{
+    size_t runAmount, runCapacity;
+    const wchar_t **texts;
+    size_t *textLengths;                // in wchar_t
+    size_t *locations;                  // first code point of each run in the view, the one past the last is the length
+    size_t *contentIndexes;
+    size_t escapeAmount;                // \N \n \h in all runs, each is two wchar_t for one code point
+};
+
+static bool CFASSFileDialoguePlainTextAppendRun(CFASSFileDialoguePlainTextRef plainText, const wchar_t *text, size_t contentIndex);
+static size_t CFASSFileDialoguePlainTextFindRun(CFASSFileDialoguePlainTextRef plainText, size_t index);
+static size_t CFASSFileDialoguePlainTextGetOffset(CFASSFileDialoguePlainTextRef plainText, size_t runIndex, size_t codePointOffset);
+static const wchar_t *CFASSFileDialoguePlainTextGetEscape(const wchar_t *text, size_t offset, size_t textLength);
+static bool CFASSFileDialoguePlainTextUpdateDrawingMode(CFASSFileDialogueTextContentOverrideRef override, unsigned int *drawingMode);
+
+#pragma mark - Create/Destory
+
+CFASSFileDialoguePlainTextRef CFASSFileDialoguePlainTextCreate(CFASSFileDialogueRef dialogue)
+{
+    if(dialogue == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialoguePlainTextCreate NULL");
+    CFASSFileDialoguePlainTextRef result;
+    if((result = calloc(1, sizeof(struct CFASSFileDialoguePlainText))) != NULL)
+    {
+        if((result->locations = malloc(sizeof(size_t))) != NULL)
+        {
+            result->locations[0] = 0;
+            CFEnumeratorRef enumerator;
+            if((enumerator = CFASSFileDialogueTextCreateEnumerator(CFASSFileDialogueGetText(dialogue))) != NULL)
+            {
+                bool succeed = true;
+                size_t contentIndex = 0;
+                unsigned int drawingMode = 0;       // text under \p1 and above is drawing commands, not shown
+                CFASSFileDialogueTextContentRef eachContent;
+                while(succeed && (eachContent = CFEnumeratorNextObject(enumerator)) != NULL)
+                {
+                    if(CFASSFileDialogueTextContentGetType(eachContent) == CFASSFileDialogueTextContentTypeOverride)
+                        succeed = CFASSFileDialoguePlainTextUpdateDrawingMode(CFASSFileDialogueTextContentGetOverride(eachContent), &drawingMode);
+                    else if(drawingMode == 0)
+                        succeed = CFASSFileDialoguePlainTextAppendRun(result, CFASSFileDialogueTextContentGetText(eachContent), contentIndex);
+                    contentIndex++;
+                }
+                CFEnumeratorDestory(enumerator);
+                if(succeed)
+                    return result;
+            }
+        }
+        CFASSFileDialoguePlainTextDestory(result);
+    }
+    return NULL;
+}
+
+void CFASSFileDialoguePlainTextDestory(CFASSFileDialoguePlainTextRef plainText)
+{
+    if(plainText == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialoguePlainTextDestory NULL");
+    free(plainText->texts);
+    free(plainText->textLengths);
+    free(plainText->locations);
+    free(plainText->contentIndexes);
+    free(plainText);
+}
+
+#pragma mark - Get Component
+
+size_t CFASSFileDialoguePlainTextGetLength(CFASSFileDialoguePlainTextRef plainText)
+{
+    if(plainText == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialoguePlainTextGetLength NULL");
+    return plainText->locations[plainText->runAmount];
+}
+
+UTF32Char CFASSFileDialoguePlainTextGetCharacterAtIndex(CFASSFileDialoguePlainTextRef plainText, size_t index)
+{
+    if(plainText == NULL || index >= plainText->locations[plainText->runAmount])
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialoguePlainTextGetCharacterAtIndex %p %zu", plainText, index);
+    size_t runIndex = CFASSFileDialoguePlainTextFindRun(plainText, index);
+    const wchar_t *text = plainText->texts[runIndex];
+    size_t offset = CFASSFileDialoguePlainTextGetOffset(plainText, runIndex, index - plainText->locations[runIndex]);
+    const wchar_t *escape = CFASSFileDialoguePlainTextGetEscape(text, offset, plainText->textLengths[runIndex]);
+    if(escape != NULL)
+        return (UTF32Char)*escape;
+    UTF32Char character = (UTF32Char)text[offset];
+#if WCHAR_MAX <= 0xFFFF
+    if(CFASSFileDialoguePlainTextIsLeadSurrogate(character) && offset + 1 < plainText->textLengths[runIndex] &&
+       CFASSFileDialoguePlainTextIsTrailSurrogate((UTF32Char)text[offset + 1]))
+        character = 0x10000 + ((character - 0xD800) << 10) + ((UTF32Char)text[offset + 1] - 0xDC00);
+#endif
+    return character;
+}
+
+size_t CFASSFileDialoguePlainTextGetRunAmount(CFASSFileDialoguePlainTextRef plainText)
+{
+    if(plainText == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialoguePlainTextGetRunAmount NULL");
+    return plainText->runAmount;
+}
+
+const wchar_t *CFASSFileDialoguePlainTextGetRun(CFASSFileDialoguePlainTextRef plainText, size_t runIndex, CFRange *range)
+{
+    if(plainText == NULL || runIndex >= plainText->runAmount)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialoguePlainTextGetRun %p %zu", plainText, runIndex);
+    if(range != NULL)
+        *range = CFRangeMake(plainText->locations[runIndex], plainText->locations[runIndex + 1] - plainText->locations[runIndex]);
+    return plainText->texts[runIndex];
+}
+
+CFASSFileDialoguePlainTextLocation CFASSFileDialoguePlainTextGetSourceLocation(CFASSFileDialoguePlainTextRef plainText, size_t index)
+{
+    if(plainText == NULL || index > plainText->locations[plainText->runAmount])
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialoguePlainTextGetSourceLocation %p %zu", plainText, index);
+    CFASSFileDialoguePlainTextLocation result = {0, 0};
+    if(plainText->runAmount == 0)
+        return result;
+    if(index == plainText->locations[plainText->runAmount])
+    {
+        result.contentIndex = plainText->contentIndexes[plainText->runAmount - 1];
+        result.offset = plainText->textLengths[plainText->runAmount - 1];
+        return result;
+    }
+    size_t runIndex = CFASSFileDialoguePlainTextFindRun(plainText, index);
+    result.contentIndex = plainText->contentIndexes[runIndex];
+    result.offset = CFASSFileDialoguePlainTextGetOffset(plainText, runIndex, index - plainText->locations[runIndex]);
+    return result;
+}
+
+#pragma mark - TextKit
+
+UTF32StringRef CFASSFileDialoguePlainTextCreateUTF32String(CFASSFileDialoguePlainTextRef plainText)
+{
+    if(plainText == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialoguePlainTextCreateUTF32String NULL");
+    if(plainText->escapeAmount == 0)
+        return UTF32StringCreateWithWideCharacterRuns(plainText->texts, plainText->textLengths, plainText->runAmount);
+    
+    // cut the runs at every escape, which is replaced by the one character it stands for
+    size_t pieceCapacity = plainText->runAmount + 2 * plainText->escapeAmount, pieceAmount = 0;
+    const wchar_t **pieces;
+    size_t *pieceLengths;
+    UTF32StringRef result = NULL;
+    if((pieces = malloc(sizeof(const wchar_t *) * pieceCapacity)) != NULL)
+    {
+        if((pieceLengths = malloc(sizeof(size_t) * pieceCapacity)) != NULL)
+        {
+            for(size_t runIndex = 0; runIndex < plainText->runAmount; runIndex++)
+            {
+                const wchar_t *text = plainText->texts[runIndex];
+                size_t textLength = plainText->textLengths[runIndex], pieceBegin = 0;
+                for(size_t offset = 0; offset < textLength; offset++)
+                {
+                    const wchar_t *escape = CFASSFileDialoguePlainTextGetEscape(text, offset, textLength);
+                    if(escape == NULL)
+                        continue;
+                    if(offset > pieceBegin)
+                    {
+                        pieces[pieceAmount] = text + pieceBegin;
+                        pieceLengths[pieceAmount++] = offset - pieceBegin;
+                    }
+                    pieces[pieceAmount] = escape;
+                    pieceLengths[pieceAmount++] = 1;
+                    pieceBegin = ++offset + 1;
+                }
+                if(textLength > pieceBegin)
+                {
+                    pieces[pieceAmount] = text + pieceBegin;
+                    pieceLengths[pieceAmount++] = textLength - pieceBegin;
+                }
+            }
+            result = UTF32StringCreateWithWideCharacterRuns(pieces, pieceLengths, pieceAmount);
+            free(pieceLengths);
+        }
+        free(pieces);
+    }
+    return result;
+}
+
+#pragma mark - Internal
+
+static bool CFASSFileDialoguePlainTextAppendRun(CFASSFileDialoguePlainTextRef plainText, const wchar_t *text, size_t contentIndex)
+{
+    size_t textLength = wcslen(text);
+    if(textLength == 0)
+        return true;
+    
+    if(plainText->runAmount == plainText->runCapacity)
+    {
+        size_t capacity = plainText->runCapacity == 0 ? 4 : plainText->runCapacity * 2;
+        const wchar_t **texts;
+        size_t *textLengths, *locations, *contentIndexes;
+        if((texts = realloc(plainText->texts, sizeof(const wchar_t *) * capacity)) == NULL)
+            return false;
+        plainText->texts = texts;
+        if((textLengths = realloc(plainText->textLengths, sizeof(size_t) * capacity)) == NULL)
+            return false;
+        plainText->textLengths = textLengths;
+        if((locations = realloc(plainText->locations, sizeof(size_t) * (capacity + 1))) == NULL)
+            return false;
+        plainText->locations = locations;
+        if((contentIndexes = realloc(plainText->contentIndexes, sizeof(size_t) * capacity)) == NULL)
+            return false;
+        plainText->contentIndexes = contentIndexes;
+        plainText->runCapacity = capacity;
+    }
+    
+    size_t codePointLength = textLength;
+    for(size_t offset = 0; offset + 1 < textLength; offset++)
+    {
+        bool isPair = false;        // two wchar_t for one code point
+        if(CFASSFileDialoguePlainTextGetEscape(text, offset, textLength) != NULL)
+        {
+            plainText->escapeAmount++;
+            isPair = true;
+        }
+#if WCHAR_MAX <= 0xFFFF
+        else if(CFASSFileDialoguePlainTextIsLeadSurrogate((UTF32Char)text[offset]) && CFASSFileDialoguePlainTextIsTrailSurrogate((UTF32Char)text[offset + 1]))
+            isPair = true;
+#endif
+        if(isPair)
+        {
+            codePointLength--;
+            offset++;
+        }
+    }
+    
+    size_t runIndex = plainText->runAmount++;
+    plainText->texts[runIndex] = text;
+    plainText->textLengths[runIndex] = textLength;
+    plainText->contentIndexes[runIndex] = contentIndex;
+    plainText->locations[runIndex + 1] = plainText->locations[runIndex] + codePointLength;
+    return true;
+}
+
+static size_t CFASSFileDialoguePlainTextFindRun(CFASSFileDialoguePlainTextRef plainText, size_t index)
+{
+    // the last run whose location is not greater than index
+    size_t lower = 0, upper = plainText->runAmount;
+    while(upper - lower > 1)
+    {
+        size_t middle = lower + (upper - lower) / 2;
+        if(plainText->locations[middle] <= index) lower = middle;
+        else upper = middle;
+    }
+    return lower;
+}
+
+static size_t CFASSFileDialoguePlainTextGetOffset(CFASSFileDialoguePlainTextRef plainText, size_t runIndex, size_t codePointOffset)
+{
+    // a run without escapes or surrogate pairs has one wchar_t each code point
+    if(plainText->locations[runIndex + 1] - plainText->locations[runIndex] == plainText->textLengths[runIndex])
+        return codePointOffset;
+    const wchar_t *text = plainText->texts[runIndex];
+    size_t textLength = plainText->textLengths[runIndex], offset = 0;
+    for(; codePointOffset > 0; codePointOffset--)
+    {
+        if(CFASSFileDialoguePlainTextGetEscape(text, offset, textLength) != NULL)
+            offset++;
+#if WCHAR_MAX <= 0xFFFF
+        else if(CFASSFileDialoguePlainTextIsLeadSurrogate((UTF32Char)text[offset]) && CFASSFileDialoguePlainTextIsTrailSurrogate((UTF32Char)text[offset + 1]))
+            offset++;
+#endif
+        offset++;
+    }
+    return offset;
+}
+
+static const wchar_t *CFASSFileDialoguePlainTextGetEscape(const wchar_t *text, size_t offset, size_t textLength)
+{
+    if(text[offset] != L'\\' || offset + 1 >= textLength)
+        return NULL;
+    switch (text[offset + 1]) {
+        case L'N':
+        case L'n':
+            return CFASSFileDialoguePlainTextLineSeparator;
+        case L'h':
+            return CFASSFileDialoguePlainTextNoBreakSpace;
+        default:
+            return NULL;
+    }
+}
+
+static bool CFASSFileDialoguePlainTextUpdateDrawingMode(CFASSFileDialogueTextContentOverrideRef override, unsigned int *drawingMode)
+{
+    CFEnumeratorRef enumerator;
+    if((enumerator = CFASSFileDialogueTextContentOverrideCreateEnumerator(override)) == NULL)
+        return false;
+    // the last \p of a block wins
+    CFASSFileDialogueTextContentOverrideContentRef eachContent;
+    while((eachContent = CFEnumeratorNextObject(enumerator)) != NULL)
+        CFASSFileDialogueTextContentOverrideContentGetDrawingMode(eachContent, drawingMode);
+    CFEnumeratorDestory(enumerator);
+    return true;
+}
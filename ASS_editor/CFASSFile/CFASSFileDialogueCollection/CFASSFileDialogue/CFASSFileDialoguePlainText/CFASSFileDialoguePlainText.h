@@ -0,0 +1,77 @@
+//
+//  CFASSFileDialoguePlainText.h
+//  ASS_editor
+//
+//  Created by Bill Sun on 2018/11/5.
+//  Copyright © 2018 Bill Sun. All rights reserved.
+//
+
+#ifndef CFASSFileDialoguePlainText_h
+#define CFASSFileDialoguePlainText_h
+
+#include <stddef.h>
+#include <wchar.h>
+
+#include "CFType.h"
+#include "CFASSFileDialogue.h"
+#include "UTF32String.h"
+
+typedef struct CFASSFileDialoguePlainText *CFASSFileDialoguePlainTextRef;
+
+typedef struct CFASSFileDialoguePlainTextLocation
+{
+    size_t contentIndex;                // index of the text content, in the order of CFASSFileDialogueTextCreateEnumerator
+    size_t offset;                      // wchar_t offset inside the text of that content
+} CFASSFileDialoguePlainTextLocation;
+
+#pragma mark - Create/Destory
+
+CFASSFileDialoguePlainTextRef CFASSFileDialoguePlainTextCreate(CFASSFileDialogueRef dialogue);
+/* Return */
+// NULL if out of memory
+/* Discussion */
+// the text contents of dialogue, override blocks skipped, viewed as one string of code points
+// text is referenced, not copied, the view is invalid once the dialogue changes or is destoryed
+// \N and \n are viewed as U+2028 LINE SEPARATOR, \h as U+00A0 NO-BREAK SPACE, one code point each
+// text drawn under \p1 and above is drawing commands, it is left out of the view
+
+void CFASSFileDialoguePlainTextDestory(CFASSFileDialoguePlainTextRef plainText);
+
+#pragma mark - Get Component
+
+size_t CFASSFileDialoguePlainTextGetLength(CFASSFileDialoguePlainTextRef plainText);
+/* Return */
+// in code points
+
+UTF32Char CFASSFileDialoguePlainTextGetCharacterAtIndex(CFASSFileDialoguePlainTextRef plainText, size_t index);
+/* index */
+// raise CFExceptionNameInvalidArgument if not less than the length
+
+size_t CFASSFileDialoguePlainTextGetRunAmount(CFASSFileDialoguePlainTextRef plainText);
+/* Discussion */
+// a run is the text of one text content, empty ones are skipped
+
+const wchar_t *CFASSFileDialoguePlainTextGetRun(CFASSFileDialoguePlainTextRef plainText, size_t runIndex, CFRange *range);
+/* range */
+// where the run is in the view, in code points, could be NULL
+/* Return */
+// owned by the dialogue, escapes in it are as written
+
+CFASSFileDialoguePlainTextLocation CFASSFileDialoguePlainTextGetSourceLocation(CFASSFileDialoguePlainTextRef plainText, size_t index);
+/* index */
+// the length maps to the end of the last run
+/* Return */
+// an escape maps to its backslash
+/* Discussion */
+// bidi levels, display orders and line ranges got from the view map back to the dialogue text by it
+
+#pragma mark - TextKit
+
+UTF32StringRef CFASSFileDialoguePlainTextCreateUTF32String(CFASSFileDialoguePlainTextRef plainText);
+/* Return */
+// NULL if out of memory
+/* Discussion */
+// filled directly from the runs with escapes replaced, indices of it are the same as the view
+// pass it to CABLGeneratorCreateWithString or CALineBreakCreateActions
+
+#endif /* CFASSFileDialoguePlainText_h */
@@ -17,6 +17,7 @@
 #include "CFASSFileDialogueTextContent_Private.h"
 #include "CFPointerArray.h"
 #include "CFException.h"
+#include "CFMutableString.h"
 #include "CFEnumerator.h"
 #include "CFASSFileChange.h"
 #include "CFASSFileChange_Private.h"
@@ -30,7 +31,6 @@ void CFASSFileDialogueTextMakeChange(CFASSFileDialogueTextRef dialogueText, CFAS
 {
     if(dialogueText == NULL || change == NULL)
         CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueText %p MakeChange %p", dialogueText, change);
-    CFEnumeratorRef enumerator;
     CFASSFileDialogueTextContentRef eachTextContent = NULL;
     
     if(change->type & CFASSFileChangeTypeDiscardAllOverride)
@@ -59,10 +59,15 @@ void CFASSFileDialogueTextMakeChange(CFASSFileDialogueTextRef dialogueText, CFAS
         if(CFPointerArrayGetLength(dialogueText->contentArray) == 0)
             CFPointerArrayAddPointer(dialogueText->contentArray, CFASSFileDialogueTextContentCreateEmptyString(), false);
     }
-    enumerator = CFASSFileDialogueTextCreateEnumerator(dialogueText);
-    while ((eachTextContent = CFEnumeratorNextObject(enumerator)) != NULL)
-        CFASSFileDialogueTextContentMakeChange(eachTextContent, change);
-    CFEnumeratorDestory(enumerator);
+    if(!CFASSFileChangeShouldDispatchToDialogueTextContentOverride(change))
+        return;     /* plain text never receive change */
+    size_t arrayLength = CFPointerArrayGetLength(dialogueText->contentArray);
+    for(size_t index = 0; index < arrayLength; index++)
+    {
+        eachTextContent = CFPointerArrayGetPointerAtIndex(dialogueText->contentArray, index);
+        if(CFASSFileDialogueTextContentGetType(eachTextContent) == CFASSFileDialogueTextContentTypeOverride)
+            CFASSFileDialogueTextContentMakeChange(eachTextContent, change);
+    }
 }
 
 CFEnumeratorRef CFASSFileDialogueTextCreateEnumerator(CFASSFileDialogueTextRef dialogueText)
@@ -120,26 +125,33 @@ CFASSFileDialogueTextRef CFASSFileDialogueTextCopy(CFASSFileDialogueTextRef dial
 
 int CFASSFileDialogueTextStoreStringResult(CFASSFileDialogueTextRef text, wchar_t * targetPoint)
 {
-    int result = 0, temp;
-    size_t arrayLength = CFPointerArrayGetLength(text->contentArray);
-    for(size_t index = 0; index<arrayLength; index++)
+    CFMutableStringRef string;
+    if((string = CFMutableStringCreateEmpty()) == NULL)
+        return -1;
+    int result = -1;
+    if(CFASSFileDialogueTextAppendStringResult(text, string) == 0)
     {
-        temp = CFASSFileDialogueTextContentStoreStringResult
-        ((CFASSFileDialogueTextContentRef)CFPointerArrayGetPointerAtIndex(text->contentArray, index), targetPoint);
-        if(temp == -1) return -1;
+        result = (int)CFMutableStringGetLength(string);
         if(targetPoint != NULL)
-            targetPoint += temp;
-        result += temp;
-    }
-    if(targetPoint != NULL)
-    {
-        targetPoint[0] = L'\n';
-        targetPoint[1] = L'\0';
+            wmemcpy(targetPoint, CFMutableStringGetCharacters(string), result + 1);
     }
-    return result+1;
+    CFMutableStringDestory(string);
+    return result;
+}
+
+int CFASSFileDialogueTextAppendStringResult(CFASSFileDialogueTextRef text, CFMutableStringRef string)
+{
+    if(text == NULL || string == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueText %p AppendStringResult %p", text, string);
+    size_t arrayLength = CFPointerArrayGetLength(text->contentArray);
+    for(size_t index = 0; index<arrayLength; index++)
+        if(CFASSFileDialogueTextContentAppendStringResult
+           ((CFASSFileDialogueTextContentRef)CFPointerArrayGetPointerAtIndex(text->contentArray, index), string) != 0)
+            return -1;
+    return CFMutableStringAppendCharacter(string, L'\n');
 }
 
-CFASSFileDialogueTextRef CFASSFileDialogueTextCreateWithString(const wchar_t *source)
+CFASSFileDialogueTextRef CFASSFileDialogueTextCreateWithString(const wchar_t *source, CFASSFileDialogueTextContentOverrideCacheRef overrideCache)
 {
     CFASSFileDialogueTextRef result;
     CFASSFileDialogueTextContentRef eachContent;
@@ -169,7 +181,7 @@ CFASSFileDialogueTextRef CFASSFileDialogueTextCreateWithString(const wchar_t *so
                 {
                     if(*beginPoint == L'{') contentType = CFASSFileDialogueTextContentTypeOverride;
                     else contentType = CFASSFileDialogueTextContentTypeText;
-                    if((eachContent = CFASSFileDialogueTextContentCreateWithString(contentType, beginPoint, endPoint - 1)) != NULL)
+                    if((eachContent = CFASSFileDialogueTextContentCreateWithString(contentType, beginPoint, endPoint - 1, overrideCache)) != NULL)
                     {
                         CFPointerArrayAddPointer(result->contentArray, eachContent, false);
                         if(*beginPoint == L'{')
@@ -14,9 +14,13 @@
 #include "CFASSFileDialogueTextContent_Private.h"
 #include "CFASSFileDialogueTextContentOverride.h"
 #include "CFASSFileDialogueTextContentOverride_Private.h"
+#include "CFASSFileDialogueTextContentOverrideCache.h"
+#include "CFASSFileDialogueTextContentOverrideCache_Private.h"
 #include "CFException.h"
+#include "CFMutableString.h"
 #include "CFASSFileChange.h"
 #include "CFASSFileChange_Private.h"
+#include "CFASSFileControl.h"
 
 struct CFASSFileDialogueTextContent
 {
@@ -24,7 +28,7 @@ struct CFASSFileDialogueTextContent
     union
     {
         wchar_t *text;
-        CFASSFileDialogueTextContentOverrideRef override;
+        CFASSFileDialogueTextContentOverrideRef override;     // may be shared with other contents, copy on write
     } data;
 };
 
@@ -34,7 +38,11 @@ void CFASSFileDialogueTextContentMakeChange(CFASSFileDialogueTextContentRef text
         CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTextContent %p MakeChange %p", textContent, change);
     if(textContent->type == CFASSFileDialogueTextContentTypeOverride &&
        CFASSFileChangeShouldDispatchToDialogueTextContentOverride(change))
-        CFASSFileDialogueTextContentOverrideMakeChange(textContent->data.override, change);
+    {
+        CFASSFileDialogueTextContentOverrideRef override;
+        if((override = CFASSFileDialogueTextContentOverrideMakeChangeCopyOnWrite(textContent->data.override, change)) != NULL)
+            textContent->data.override = override;
+    }
     else
     {
         /* change applied to text type */
@@ -48,6 +56,24 @@ CFASSFileDialogueTextContentType CFASSFileDialogueTextContentGetType(CFASSFileDi
     return textContent->type;
 }
 
+const wchar_t *CFASSFileDialogueTextContentGetText(CFASSFileDialogueTextContentRef textContent)
+{
+    if(textContent == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTextContent NULL GetText");
+    if(textContent->type != CFASSFileDialogueTextContentTypeText)
+        return NULL;
+    return textContent->data.text;
+}
+
+CFASSFileDialogueTextContentOverrideRef CFASSFileDialogueTextContentGetOverride(CFASSFileDialogueTextContentRef textContent)
+{
+    if(textContent == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTextContent NULL GetOverride");
+    if(textContent->type != CFASSFileDialogueTextContentTypeOverride)
+        return NULL;
+    return textContent->data.override;
+}
+
 CFASSFileDialogueTextContentRef CFASSFileDialogueTextContentCreateWithText(wchar_t *text, bool transferAllocationOwnership)
 {
     if(text == NULL)
@@ -116,7 +142,12 @@ CFASSFileDialogueTextContentRef CFASSFileDialogueTextContentCopy(CFASSFileDialog
                     return result;
                 break;
             case CFASSFileDialogueTextContentTypeOverride:
-                if((result->data.override = CFASSFileDialogueTextContentOverrideCopy(content->data.override)) != NULL)
+                // without sharing every content owns its override alone
+                if(CFASSFileControlGetOverrideSharing())
+                    result->data.override = CFASSFileDialogueTextContentOverrideRetain(content->data.override);
+                else
+                    result->data.override = CFASSFileDialogueTextContentOverrideCopy(content->data.override);
+                if(result->data.override != NULL)
                     return result;
                 break;
         }
@@ -139,6 +170,16 @@ int CFASSFileDialogueTextContentStoreStringResult(CFASSFileDialogueTextContentRe
         return CFASSFileDialogueTextContentOverrideStoreStringResult(textContent->data.override, targetPoint);
 }
 
+int CFASSFileDialogueTextContentAppendStringResult(CFASSFileDialogueTextContentRef textContent, CFMutableStringRef string)
+{
+    if(textContent == NULL || string == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTextContent %p AppendStringResult %p", textContent, string);
+    if(textContent->type == CFASSFileDialogueTextContentTypeText)
+        return CFMutableStringAppendString(string, textContent->data.text);
+    else
+        return CFASSFileDialogueTextContentOverrideAppendStringResult(textContent->data.override, string);
+}
+
 void CFASSFileDialogueTextContentDestory(CFASSFileDialogueTextContentRef content)
 {
     switch (content->type) {
@@ -171,7 +212,8 @@ CFASSFileDialogueTextContentRef CFASSFileDialogueTextContentCreateEmptyString(vo
 
 CFASSFileDialogueTextContentRef CFASSFileDialogueTextContentCreateWithString(CFASSFileDialogueTextContentType type,
                                                                              const wchar_t *data,
-                                                                             const wchar_t *endPoint)
+                                                                             const wchar_t *endPoint,
+                                                                             CFASSFileDialogueTextContentOverrideCacheRef overrideCache)
 {
     CFASSFileDialogueTextContentRef result;
     if((result = malloc(sizeof(struct CFASSFileDialogueTextContent))) != NULL)
@@ -194,7 +236,9 @@ CFASSFileDialogueTextContentRef CFASSFileDialogueTextContentCreateWithString(CFA
                 {
                     wchar_t *temp = wcschr(data, L'}');
                     if(temp!=NULL && temp<=endPoint)
-                        if((result->data.override = CFASSFileDialogueTextContentOverrideCreateWithString(data, true)) != NULL)
+                        if((result->data.override = overrideCache != NULL ?
+                            CFASSFileDialogueTextContentOverrideCacheCreateOverrideWithString(overrideCache, data) :
+                            CFASSFileDialogueTextContentOverrideCreateWithString(data, true)) != NULL)
                         {
                             result->type = CFASSFileDialogueTextContentTypeOverride;
                             return result;
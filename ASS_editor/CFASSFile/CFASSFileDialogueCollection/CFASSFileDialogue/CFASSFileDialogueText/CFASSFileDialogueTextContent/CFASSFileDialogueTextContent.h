@@ -31,6 +31,16 @@ void CFASSFileDialogueTextContentDestory(CFASSFileDialogueTextContentRef textCon
 
 CFASSFileDialogueTextContentType CFASSFileDialogueTextContentGetType(CFASSFileDialogueTextContentRef textContent);
 
+#pragma mark - Get Component
+
+const wchar_t *CFASSFileDialogueTextContentGetText(CFASSFileDialogueTextContentRef textContent);
+/* Return */
+// NULL if textContent is not text, the string is owned by textContent
+
+CFASSFileDialogueTextContentOverrideRef CFASSFileDialogueTextContentGetOverride(CFASSFileDialogueTextContentRef textContent);
+/* Return */
+// NULL if textContent is not override, it may be shared with other contents, don't change it
+
 #pragma mark - Receive Change
 
 void CFASSFileDialogueTextContentMakeChange(CFASSFileDialogueTextContentRef textContent, CFASSFileChangeRef change);
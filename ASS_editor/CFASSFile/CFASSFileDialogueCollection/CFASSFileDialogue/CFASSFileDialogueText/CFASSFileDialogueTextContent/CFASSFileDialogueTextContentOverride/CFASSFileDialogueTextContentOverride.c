@@ -8,6 +8,8 @@
 
 #include <stdlib.h>
 #include <stddef.h>
+#include <stdatomic.h>
+#include <wchar.h>
 
 #include "CFPointerArray.h"
 #include "CFASSFileDialogueTextContentOverride.h"
@@ -16,24 +18,33 @@
 #include "CFASSFileDialogueTextContentOverrideContent_Private.h"
 #include "CFUseTool.h"
 #include "CFException.h"
+#include "CFMutableString.h"
 #include "CFEnumerator.h"
 #include "CFASSFileChange.h"
 #include "CFASSFileChange_Private.h"
 
 struct CFASSFileDialogueTextContentOverride
 {
+    atomic_size_t retainCount;      // shared between dialogues, see CFASSFileDialogueTextContentOverrideCache
     CFPointerArrayRef contentArray;
+    unsigned int contentTypes;      // CFASSFileChangePlanOverrideContentTypeBit of each content, let change skip whole block
 };
 
 void CFASSFileDialogueTextContentOverrideMakeChange(CFASSFileDialogueTextContentOverrideRef override, CFASSFileChangeRef change)
 {
     if(override == NULL || change == NULL)
         CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTextContentOverride %p MakeChange %p", override, change);
-    CFEnumeratorRef enumerator = CFASSFileDialogueTextContentOverrideCreateEnumerator(override);
+    if(!CFASSFileChangeShouldDispatchToOverrideContentTypes(change, override->contentTypes))
+        return;
+    size_t arrayLength = CFPointerArrayGetLength(override->contentArray);
     CFASSFileDialogueTextContentOverrideContentRef eachContent;
-    while((eachContent = CFEnumeratorNextObject(enumerator)) != NULL)
-        CFASSFileDialogueTextContentOverrideContentMakeChange(eachContent, change);
-    CFEnumeratorDestory(enumerator);
+    for(size_t index = 0; index < arrayLength; index++)
+    {
+        eachContent = CFPointerArrayGetPointerAtIndex(override->contentArray, index);
+        unsigned int eachContentType = CFASSFileChangePlanOverrideContentTypeBit(CFASSFileDialogueTextContentOverrideContentGetType(eachContent));
+        if(CFASSFileChangeShouldDispatchToOverrideContentTypes(change, eachContentType))
+            CFASSFileDialogueTextContentOverrideContentMakeChange(eachContent, change);
+    }
 }
 
 CFEnumeratorRef CFASSFileDialogueTextContentOverrideCreateEnumerator(CFASSFileDialogueTextContentOverrideRef override)
@@ -56,6 +67,8 @@ CFASSFileDialogueTextContentOverrideRef CFASSFileDialogueTextContentOverrideCrea
         if((result->contentArray = CFPointerArrayCreateEmpty()) != NULL)
         {
             CFPointerArrayAddPointer(result->contentArray, content, false);
+            result->contentTypes = CFASSFileChangePlanOverrideContentTypeBit(CFASSFileDialogueTextContentOverrideContentGetType(content));
+            atomic_init(&result->retainCount, 1);
             return result;
         }
         free(result);
@@ -76,6 +89,7 @@ void CFASSFileDialogueTextContentOverrideAddContent(CFASSFileDialogueTextContent
         return;
     }
     CFPointerArrayAddPointer(override->contentArray, content, false);
+    override->contentTypes |= CFASSFileChangePlanOverrideContentTypeBit(CFASSFileDialogueTextContentOverrideContentGetType(content));
 }
 
 CFASSFileDialogueTextContentOverrideRef CFASSFileDialogueTextContentOverrideCopy(CFASSFileDialogueTextContentOverrideRef override)
@@ -98,7 +112,11 @@ CFASSFileDialogueTextContentOverrideRef CFASSFileDialogueTextContentOverrideCopy
                     CFPointerArrayAddPointer(result->contentArray, eachOverrideContent, false);
             }
             if(copyCheck)
+            {
+                result->contentTypes = override->contentTypes;
+                atomic_init(&result->retainCount, 1);
                 return result;
+            }
             arrayLength = CFPointerArrayGetLength(result->contentArray);
             for(size_t index = 0; index < arrayLength; index++)
                 CFASSFileDialogueTextContentOverrideContentDestory
@@ -109,9 +127,37 @@ CFASSFileDialogueTextContentOverrideRef CFASSFileDialogueTextContentOverrideCopy
     return NULL;
 }
 
+CFASSFileDialogueTextContentOverrideRef CFASSFileDialogueTextContentOverrideRetain(CFASSFileDialogueTextContentOverrideRef override)
+{
+    if(override == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTextContentOverride NULL Retain");
+    atomic_fetch_add_explicit(&override->retainCount, 1, memory_order_relaxed);
+    return override;
+}
+
+CFASSFileDialogueTextContentOverrideRef CFASSFileDialogueTextContentOverrideMakeChangeCopyOnWrite(CFASSFileDialogueTextContentOverrideRef override, CFASSFileChangeRef change)
+{
+    if(override == NULL || change == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTextContentOverride %p MakeChangeCopyOnWrite %p", override, change);
+    if(!CFASSFileChangeShouldDispatchToOverrideContentTypes(change, override->contentTypes))
+        return override;    // untouched, keep sharing
+    if(atomic_load_explicit(&override->retainCount, memory_order_acquire) > 1)
+    {
+        // copy finishes before release, so the other holders still see an unchanged block
+        CFASSFileDialogueTextContentOverrideRef copy;
+        if((copy = CFASSFileDialogueTextContentOverrideCopy(override)) == NULL)
+            return NULL;
+        CFASSFileDialogueTextContentOverrideDestory(override);
+        override = copy;
+    }
+    CFASSFileDialogueTextContentOverrideMakeChange(override, change);
+    return override;
+}
+
 void CFASSFileDialogueTextContentOverrideDestory(CFASSFileDialogueTextContentOverrideRef override)
 {
     if(override == NULL) return;
+    if(atomic_fetch_sub_explicit(&override->retainCount, 1, memory_order_acq_rel) != 1) return;
     size_t arrayLength = CFPointerArrayGetLength(override->contentArray);
     for(size_t index = 0; index<arrayLength; index++)
         CFASSFileDialogueTextContentOverrideContentDestory
@@ -127,39 +173,35 @@ int CFASSFileDialogueTextContentOverrideStoreStringResult(CFASSFileDialogueTextC
         CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTextContentOverride NULL StoreStringResult");
         return -1;
     }
-    int result = 0, temp;
-    if(targetPoint == NULL)
+    CFMutableStringRef string;
+    if((string = CFMutableStringCreateEmpty()) == NULL)
+        return -1;
+    int result = -1;
+    if(CFASSFileDialogueTextContentOverrideAppendStringResult(override, string) == 0)
     {
-        size_t arrayLength = CFPointerArrayGetLength(override->contentArray);
-        for(size_t index = 0; index<arrayLength; index++)
-        {
-            temp = CFASSFileDialogueTextContentOverrideContentStoreStringResult
-            ((CFASSFileDialogueTextContentOverrideContentRef)CFPointerArrayGetPointerAtIndex(override->contentArray, index), NULL);
-            if(temp < 0) return -1;
-            else result += temp;
-        }
-        return result + 2;  /* braces */
+        result = (int)CFMutableStringGetLength(string);
+        if(targetPoint != NULL)
+            wmemcpy(targetPoint, CFMutableStringGetCharacters(string), result + 1);
     }
-    else
+    CFMutableStringDestory(string);
+    return result;
+}
+
+int CFASSFileDialogueTextContentOverrideAppendStringResult(CFASSFileDialogueTextContentOverrideRef override, CFMutableStringRef string)
+{
+    if(override == NULL || string == NULL)
     {
-        *targetPoint++ = L'{';
-        size_t arrayLength = CFPointerArrayGetLength(override->contentArray);
-        for(size_t index = 0; index<arrayLength; index++)
-        {
-            temp = CFASSFileDialogueTextContentOverrideContentStoreStringResult
-            ((CFASSFileDialogueTextContentOverrideContentRef)CFPointerArrayGetPointerAtIndex(override->contentArray, index), targetPoint);
-            if(temp < 0)
-                return -1;
-            else
-            {
-                result += temp;
-                targetPoint += temp;
-            }
-        }
-        targetPoint[0] = L'}';
-        targetPoint[1] = L'\0';
-        return result + 2;  /* braces */
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTextContentOverride %p AppendStringResult %p", override, string);
+        return -1;
     }
+    CFMutableStringAppendCharacter(string, L'{');
+    size_t arrayLength = CFPointerArrayGetLength(override->contentArray);
+    for(size_t index = 0; index<arrayLength; index++)
+        if(CFASSFileDialogueTextContentOverrideContentAppendStringResult
+           ((CFASSFileDialogueTextContentOverrideContentRef)CFPointerArrayGetPointerAtIndex(override->contentArray, index), string) != 0)
+            return -1;
+    CFMutableStringAppendCharacter(string, L'}');
+    return CFMutableStringIsFailed(string) ? -1 : 0;
 }
 
 CFASSFileDialogueTextContentOverrideRef CFASSFileDialogueTextContentOverrideCreateWithString(const wchar_t *string, bool isIncludeBraces)
@@ -169,6 +211,8 @@ CFASSFileDialogueTextContentOverrideRef CFASSFileDialogueTextContentOverrideCrea
     {
         if((result->contentArray = CFPointerArrayCreateEmpty()) != NULL)
         {
+            result->contentTypes = 0;
+            atomic_init(&result->retainCount, 1);
             const wchar_t *beginPoint = string;
             const wchar_t *endPoint = NULL;
             bool checkMark = false;
@@ -221,7 +265,10 @@ CFASSFileDialogueTextContentOverrideRef CFASSFileDialogueTextContentOverrideCrea
                             tokenEnd--;
                         CFASSFileDialogueTextContentOverrideContentRef content;
                         if((content = CFASSFileDialogueTextContentOverrideContentCreateWithString(tokenBegin, tokenEnd))!=NULL)
+                        {
                             CFPointerArrayAddPointer(result->contentArray, content, false);
+                            result->contentTypes |= CFASSFileChangePlanOverrideContentTypeBit(CFASSFileDialogueTextContentOverrideContentGetType(content));
+                        }
                         else
                             formatCheck = false;
                         tokenBegin = tokenEnd + 1;
@@ -21,13 +21,23 @@ CFASSFileDialogueTextContentOverrideRef CFASSFileDialogueTextContentOverrideCrea
 
 CFASSFileDialogueTextContentOverrideRef CFASSFileDialogueTextContentOverrideCopy(CFASSFileDialogueTextContentOverrideRef override);
 
+CFASSFileDialogueTextContentOverrideRef CFASSFileDialogueTextContentOverrideRetain(CFASSFileDialogueTextContentOverrideRef override);
+/* Return */
+// the same override
+
 void CFASSFileDialogueTextContentOverrideDestory(CFASSFileDialogueTextContentOverrideRef override);
+/* Discussion */
+// override is freed when the last holder destory it
 
 void CFASSFileDialogueTextContentOverrideAddContent(CFASSFileDialogueTextContentOverrideRef override, CFASSFileDialogueTextContentOverrideContentRef content);
+/* Discussion */
+// override must not be retained by others, Copy it first
 
 #pragma mark - Receive Change
 
 void CFASSFileDialogueTextContentOverrideMakeChange(CFASSFileDialogueTextContentOverrideRef override, CFASSFileChangeRef change);
+/* Discussion */
+// change is made in place, override must not be retained by others
 
 #pragma mark - Get Component
 
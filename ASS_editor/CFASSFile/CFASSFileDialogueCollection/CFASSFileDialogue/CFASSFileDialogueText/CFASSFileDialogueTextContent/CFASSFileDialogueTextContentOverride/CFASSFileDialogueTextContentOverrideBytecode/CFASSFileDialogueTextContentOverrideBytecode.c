@@ -0,0 +1,299 @@
+//
+//  CFASSFileDialogueTextContentOverrideBytecode.c
+//  ASS_editor
+//
+//  Created by Bill Sun on 2018/11/5.
+//  Copyright © 2018 Bill Sun. All rights reserved.
+//
+
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+#include <wchar.h>
+
+#include "CFASSFileDialogueTextContentOverrideBytecode.h"
+#include "CFASSFileDialogueTextContentOverrideBytecode_Private.h"
+#include "CFASSFileDialogueTextContentOverride.h"
+#include "CFASSFileDialogueTextContentOverride_Private.h"
+#include "CFASSFileDialogueTextContentOverrideContent.h"
+#include "CFASSFileDialogueTextContentOverrideContent_Private.h"
+#include "CFUseTool.h"
+#include "CFException.h"
+#include "CFMutableString.h"
+#include "CFEnumerator.h"
+#include "CFASSFileChange.h"
+#include "CFASSFileChange_Private.h"
+
+struct CFASSFileDialogueTextContentOverrideBytecode
+{
+    unsigned char *stream;          // records back to back, each aligned to CFASSFileDialogueTextContentOverrideContentEncodingAlignment
+    size_t length, capacity;        // bytes
+    size_t contentAmount;
+    unsigned int contentTypes;      // CFASSFileChangePlanOverrideContentTypeBit of each record, let change skip whole block
+};
+
+#define CFASSFileDialogueTextContentOverrideBytecodeRecordHeader(record) \
+((CFASSFileDialogueTextContentOverrideContentEncodingHeader *)(record))
+
+static int CFASSFileDialogueTextContentOverrideBytecodeResizeRecord(CFASSFileDialogueTextContentOverrideBytecodeRef bytecode, size_t offset, size_t oldSize, size_t newSize);
+
+#pragma mark - Create/Copy/Destory
+
+CFASSFileDialogueTextContentOverrideBytecodeRef CFASSFileDialogueTextContentOverrideBytecodeCreateWithOverride(CFASSFileDialogueTextContentOverrideRef override)
+{
+    if(override == NULL)
+    {
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTextContentOverrideBytecodeCreateWithOverride NULL");
+        return NULL;
+    }
+    CFASSFileDialogueTextContentOverrideBytecodeRef result;
+    if((result = malloc(sizeof(struct CFASSFileDialogueTextContentOverrideBytecode))) != NULL)
+    {
+        CFEnumeratorRef enumerator;
+        if((enumerator = CFASSFileDialogueTextContentOverrideCreateEnumerator(override)) != NULL)
+        {
+            // measure first, so the stream is allocated once
+            size_t length = 0, contentAmount = 0;
+            unsigned int contentTypes = 0;
+            CFASSFileDialogueTextContentOverrideContentRef eachContent;
+            while((eachContent = CFEnumeratorNextObject(enumerator)) != NULL)
+            {
+                length += CFASSFileDialogueTextContentOverrideContentEncode(eachContent, NULL);
+                contentAmount++;
+                contentTypes |= CFASSFileChangePlanOverrideContentTypeBit(CFASSFileDialogueTextContentOverrideContentGetType(eachContent));
+            }
+            CFEnumeratorDestory(enumerator);
+            if((result->stream = malloc(length)) != NULL)
+            {
+                if((enumerator = CFASSFileDialogueTextContentOverrideCreateEnumerator(override)) != NULL)
+                {
+                    size_t offset = 0;
+                    while((eachContent = CFEnumeratorNextObject(enumerator)) != NULL)
+                        offset += CFASSFileDialogueTextContentOverrideContentEncode(eachContent, result->stream + offset);
+                    CFEnumeratorDestory(enumerator);
+                    result->length = result->capacity = length;
+                    result->contentAmount = contentAmount;
+                    result->contentTypes = contentTypes;
+                    return result;
+                }
+                free(result->stream);
+            }
+        }
+        free(result);
+    }
+    return NULL;
+}
+
+CFASSFileDialogueTextContentOverrideRef CFASSFileDialogueTextContentOverrideBytecodeCreateOverride(CFASSFileDialogueTextContentOverrideBytecodeRef bytecode)
+{
+    if(bytecode == NULL)
+    {
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTextContentOverrideBytecode NULL CreateOverride");
+        return NULL;
+    }
+    CFASSFileDialogueTextContentOverrideRef result = NULL;
+    CFASSFileDialogueTextContentOverrideContentRef eachContent;
+    CFASSFileDialogueTextContentOverrideBytecodeIterator iterator = CFASSFileDialogueTextContentOverrideBytecodeIteratorMake(bytecode);
+    while(CFASSFileDialogueTextContentOverrideBytecodeIteratorNext(&iterator))
+    {
+        if((eachContent = CFASSFileDialogueTextContentOverrideBytecodeIteratorCopyContent(&iterator)) == NULL)
+        {
+            CFASSFileDialogueTextContentOverrideDestory(result);
+            return NULL;
+        }
+        if(result == NULL)
+        {
+            if((result = CFASSFileDialogueTextContentOverrideCreateWithContent(eachContent)) == NULL)
+            {
+                CFASSFileDialogueTextContentOverrideContentDestory(eachContent);
+                return NULL;
+            }
+        }
+        else
+            CFASSFileDialogueTextContentOverrideAddContent(result, eachContent);
+    }
+    return result;
+}
+
+CFASSFileDialogueTextContentOverrideBytecodeRef CFASSFileDialogueTextContentOverrideBytecodeCopy(CFASSFileDialogueTextContentOverrideBytecodeRef bytecode)
+{
+    if(bytecode == NULL)
+    {
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTextContentOverrideBytecode NULL Copy");
+        return NULL;
+    }
+    CFASSFileDialogueTextContentOverrideBytecodeRef result;
+    if((result = malloc(sizeof(struct CFASSFileDialogueTextContentOverrideBytecode))) != NULL)
+    {
+        // records are position independent, copy is plain bytes
+        if((result->stream = malloc(bytecode->length)) != NULL)
+        {
+            memcpy(result->stream, bytecode->stream, bytecode->length);
+            result->length = result->capacity = bytecode->length;
+            result->contentAmount = bytecode->contentAmount;
+            result->contentTypes = bytecode->contentTypes;
+            return result;
+        }
+        free(result);
+    }
+    return NULL;
+}
+
+void CFASSFileDialogueTextContentOverrideBytecodeDestory(CFASSFileDialogueTextContentOverrideBytecodeRef bytecode)
+{
+    if(bytecode == NULL) return;
+    free(bytecode->stream);
+    free(bytecode);
+}
+
+CFASSFileDialogueTextContentOverrideBytecodeRef CFASSFileDialogueTextContentOverrideBytecodeCreateWithString(const wchar_t *string, bool isIncludeBraces)
+{
+    CFASSFileDialogueTextContentOverrideRef override;
+    if((override = CFASSFileDialogueTextContentOverrideCreateWithString(string, isIncludeBraces)) != NULL)
+    {
+        CFASSFileDialogueTextContentOverrideBytecodeRef result = CFASSFileDialogueTextContentOverrideBytecodeCreateWithOverride(override);
+        CFASSFileDialogueTextContentOverrideDestory(override);
+        return result;
+    }
+    return NULL;
+}
+
+#pragma mark - Receive Change
+
+static int CFASSFileDialogueTextContentOverrideBytecodeResizeRecord(CFASSFileDialogueTextContentOverrideBytecodeRef bytecode, size_t offset, size_t oldSize, size_t newSize)
+{
+    size_t newLength = bytecode->length - oldSize + newSize;
+    if(newLength > bytecode->capacity)
+    {
+        size_t newCapacity = bytecode->capacity * 2 > newLength ? bytecode->capacity * 2 : newLength;
+        unsigned char *newStream;
+        if((newStream = realloc(bytecode->stream, newCapacity)) == NULL)
+            return -1;
+        bytecode->stream = newStream;
+        bytecode->capacity = newCapacity;
+    }
+    memmove(bytecode->stream + offset + newSize, bytecode->stream + offset + oldSize, bytecode->length - offset - oldSize);
+    bytecode->length = newLength;
+    return 0;
+}
+
+void CFASSFileDialogueTextContentOverrideBytecodeMakeChange(CFASSFileDialogueTextContentOverrideBytecodeRef bytecode, CFASSFileChangeRef change)
+{
+    if(bytecode == NULL || change == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTextContentOverrideBytecode %p MakeChange %p", bytecode, change);
+    if(!CFASSFileChangeShouldDispatchToOverrideContentTypes(change, bytecode->contentTypes))
+        return;
+    size_t offset = 0;
+    while(offset < bytecode->length)
+    {
+        unsigned char *record = bytecode->stream + offset;
+        size_t recordSize = CFASSFileDialogueTextContentOverrideBytecodeRecordHeader(record)->size;
+        unsigned int recordType = CFASSFileChangePlanOverrideContentTypeBit(CFASSFileDialogueTextContentOverrideBytecodeRecordHeader(record)->type);
+        if(CFASSFileChangeShouldDispatchToOverrideContentTypes(change, recordType) &&
+           !CFASSFileDialogueTextContentOverrideContentEncodingMakeChange(record, change))
+        {
+            // string may change its length, go through the object form
+            CFASSFileDialogueTextContentOverrideContentRef content;
+            if((content = CFASSFileDialogueTextContentOverrideContentCreateWithEncoding(record)) != NULL)
+            {
+                CFASSFileDialogueTextContentOverrideContentMakeChange(content, change);
+                size_t newSize = CFASSFileDialogueTextContentOverrideContentEncode(content, NULL);
+                if(newSize == recordSize || CFASSFileDialogueTextContentOverrideBytecodeResizeRecord(bytecode, offset, recordSize, newSize) == 0)
+                {
+                    CFASSFileDialogueTextContentOverrideContentEncode(content, bytecode->stream + offset);
+                    recordSize = newSize;
+                }
+                CFASSFileDialogueTextContentOverrideContentDestory(content);
+            }
+        }
+        offset += recordSize;
+    }
+}
+
+#pragma mark - Get Component
+
+size_t CFASSFileDialogueTextContentOverrideBytecodeGetContentAmount(CFASSFileDialogueTextContentOverrideBytecodeRef bytecode)
+{
+    if(bytecode == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTextContentOverrideBytecode NULL GetContentAmount");
+    return bytecode->contentAmount;
+}
+
+size_t CFASSFileDialogueTextContentOverrideBytecodeGetLength(CFASSFileDialogueTextContentOverrideBytecodeRef bytecode)
+{
+    if(bytecode == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTextContentOverrideBytecode NULL GetLength");
+    return bytecode->length;
+}
+
+#pragma mark - Iterator
+
+CFASSFileDialogueTextContentOverrideBytecodeIterator CFASSFileDialogueTextContentOverrideBytecodeIteratorMake(CFASSFileDialogueTextContentOverrideBytecodeRef bytecode)
+{
+    if(bytecode == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTextContentOverrideBytecode NULL IteratorMake");
+    return (CFASSFileDialogueTextContentOverrideBytecodeIterator){.bytecode = bytecode, .offset = 0, .nextOffset = 0};
+}
+
+bool CFASSFileDialogueTextContentOverrideBytecodeIteratorNext(CFASSFileDialogueTextContentOverrideBytecodeIterator *iterator)
+{
+    if(iterator == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTextContentOverrideBytecodeIteratorNext NULL");
+    if(iterator->nextOffset >= iterator->bytecode->length)
+        return false;
+    iterator->offset = iterator->nextOffset;
+    iterator->nextOffset += CFASSFileDialogueTextContentOverrideBytecodeRecordHeader(iterator->bytecode->stream + iterator->offset)->size;
+    return true;
+}
+
+CFASSFileDialogueTextContentOverrideContentType CFASSFileDialogueTextContentOverrideBytecodeIteratorGetType(const CFASSFileDialogueTextContentOverrideBytecodeIterator *iterator)
+{
+    if(iterator == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTextContentOverrideBytecodeIteratorGetType NULL");
+    return CFASSFileDialogueTextContentOverrideBytecodeRecordHeader(iterator->bytecode->stream + iterator->offset)->type;
+}
+
+CFASSFileDialogueTextContentOverrideContentRef CFASSFileDialogueTextContentOverrideBytecodeIteratorCopyContent(const CFASSFileDialogueTextContentOverrideBytecodeIterator *iterator)
+{
+    if(iterator == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTextContentOverrideBytecodeIteratorCopyContent NULL");
+    return CFASSFileDialogueTextContentOverrideContentCreateWithEncoding(iterator->bytecode->stream + iterator->offset);
+}
+
+#pragma mark - Store Result
+
+int CFASSFileDialogueTextContentOverrideBytecodeStoreStringResult(CFASSFileDialogueTextContentOverrideBytecodeRef bytecode, wchar_t * targetPoint)
+{
+    if(bytecode == NULL)
+    {
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTextContentOverrideBytecode NULL StoreStringResult");
+        return -1;
+    }
+    CFMutableStringRef string;
+    if((string = CFMutableStringCreateEmpty()) == NULL)
+        return -1;
+    int result = -1;
+    if(CFASSFileDialogueTextContentOverrideBytecodeAppendStringResult(bytecode, string) == 0)
+    {
+        result = (int)CFMutableStringGetLength(string);
+        if(targetPoint != NULL)
+            wmemcpy(targetPoint, CFMutableStringGetCharacters(string), result + 1);
+    }
+    CFMutableStringDestory(string);
+    return result;
+}
+
+int CFASSFileDialogueTextContentOverrideBytecodeAppendStringResult(CFASSFileDialogueTextContentOverrideBytecodeRef bytecode, CFMutableStringRef string)
+{
+    if(bytecode == NULL || string == NULL)
+    {
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTextContentOverrideBytecode %p AppendStringResult %p", bytecode, string);
+        return -1;
+    }
+    CFMutableStringAppendCharacter(string, L'{');
+    for(size_t offset = 0; offset < bytecode->length; offset += CFASSFileDialogueTextContentOverrideBytecodeRecordHeader(bytecode->stream + offset)->size)
+        if(CFASSFileDialogueTextContentOverrideContentAppendEncodingStringResult(bytecode->stream + offset, string) != 0)
+            return -1;
+    CFMutableStringAppendCharacter(string, L'}');
+    return CFMutableStringIsFailed(string) ? -1 : 0;
+}
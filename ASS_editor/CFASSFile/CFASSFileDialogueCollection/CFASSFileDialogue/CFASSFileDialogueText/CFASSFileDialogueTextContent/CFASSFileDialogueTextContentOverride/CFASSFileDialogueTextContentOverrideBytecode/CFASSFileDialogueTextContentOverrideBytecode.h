@@ -0,0 +1,72 @@
+//
+//  CFASSFileDialogueTextContentOverrideBytecode.h
+//  ASS_editor
+//
+//  Created by Bill Sun on 2018/11/5.
+//  Copyright © 2018 Bill Sun. All rights reserved.
+//
+
+#ifndef CFASSFileDialogueTextContentOverrideBytecode_h
+#define CFASSFileDialogueTextContentOverrideBytecode_h
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "CFASSFileDialogueTextContentOverride.h"
+#include "CFASSFileDialogueTextContentOverrideContent.h"
+#include "CFASSFileChange.h"
+
+typedef struct CFASSFileDialogueTextContentOverrideBytecode *CFASSFileDialogueTextContentOverrideBytecodeRef;
+// packed form of an override block, all tags in one contiguous stream of (type, data) records
+// no allocation per tag, use it for storing large amount of override blocks
+
+typedef struct CFASSFileDialogueTextContentOverrideBytecodeIterator {
+    CFASSFileDialogueTextContentOverrideBytecodeRef bytecode;
+    size_t offset, nextOffset;
+} CFASSFileDialogueTextContentOverrideBytecodeIterator;
+
+#pragma mark - Create/Copy/Destory
+
+CFASSFileDialogueTextContentOverrideBytecodeRef CFASSFileDialogueTextContentOverrideBytecodeCreateWithOverride(CFASSFileDialogueTextContentOverrideRef override);
+
+CFASSFileDialogueTextContentOverrideRef CFASSFileDialogueTextContentOverrideBytecodeCreateOverride(CFASSFileDialogueTextContentOverrideBytecodeRef bytecode);
+/* Discussion */
+// the result is equal to the override which bytecode created with
+
+CFASSFileDialogueTextContentOverrideBytecodeRef CFASSFileDialogueTextContentOverrideBytecodeCopy(CFASSFileDialogueTextContentOverrideBytecodeRef bytecode);
+
+void CFASSFileDialogueTextContentOverrideBytecodeDestory(CFASSFileDialogueTextContentOverrideBytecodeRef bytecode);
+
+#pragma mark - Receive Change
+
+void CFASSFileDialogueTextContentOverrideBytecodeMakeChange(CFASSFileDialogueTextContentOverrideBytecodeRef bytecode, CFASSFileChangeRef change);
+/* Discussion */
+// tags without string are changed in place
+// tags with string are decoded, changed and encoded back, the stream moves only if the size changed
+
+#pragma mark - Get Component
+
+size_t CFASSFileDialogueTextContentOverrideBytecodeGetContentAmount(CFASSFileDialogueTextContentOverrideBytecodeRef bytecode);
+
+size_t CFASSFileDialogueTextContentOverrideBytecodeGetLength(CFASSFileDialogueTextContentOverrideBytecodeRef bytecode);
+/* Return */
+// the stream size in bytes
+
+#pragma mark - Iterator
+
+CFASSFileDialogueTextContentOverrideBytecodeIterator CFASSFileDialogueTextContentOverrideBytecodeIteratorMake(CFASSFileDialogueTextContentOverrideBytecodeRef bytecode);
+/* Discussion */
+// the iterator points before the first tag, call IteratorNext first
+// iterator is invalid after the bytecode changed
+
+bool CFASSFileDialogueTextContentOverrideBytecodeIteratorNext(CFASSFileDialogueTextContentOverrideBytecodeIterator *iterator);
+/* Return */
+// false if there is no more tag
+
+CFASSFileDialogueTextContentOverrideContentType CFASSFileDialogueTextContentOverrideBytecodeIteratorGetType(const CFASSFileDialogueTextContentOverrideBytecodeIterator *iterator);
+
+CFASSFileDialogueTextContentOverrideContentRef CFASSFileDialogueTextContentOverrideBytecodeIteratorCopyContent(const CFASSFileDialogueTextContentOverrideBytecodeIterator *iterator);
+/* Return */
+// caller owns the result, NULL if allocation failed
+
+#endif /* CFASSFileDialogueTextContentOverrideBytecode_h */
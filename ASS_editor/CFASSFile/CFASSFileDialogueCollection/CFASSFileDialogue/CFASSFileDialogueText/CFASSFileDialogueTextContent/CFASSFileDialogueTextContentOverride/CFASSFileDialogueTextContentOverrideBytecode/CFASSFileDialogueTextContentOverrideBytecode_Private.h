@@ -0,0 +1,32 @@
+//
+//  CFASSFileDialogueTextContentOverrideBytecode_Private.h
+//  ASS_editor
+//
+//  Created by Bill Sun on 2018/11/5.
+//  Copyright © 2018 Bill Sun. All rights reserved.
+//
+
+#ifndef CFASSFileDialogueTextContentOverrideBytecode_Private_h
+#define CFASSFileDialogueTextContentOverrideBytecode_Private_h
+
+#include <stdbool.h>
+#include <wchar.h>
+
+#include "CFASSFileDialogueTextContentOverrideBytecode.h"
+#include "CFMutableString.h"
+
+CFASSFileDialogueTextContentOverrideBytecodeRef CFASSFileDialogueTextContentOverrideBytecodeCreateWithString(const wchar_t *string, bool isIncludeBraces);
+/* string */
+// same as CFASSFileDialogueTextContentOverrideCreateWithString
+
+int CFASSFileDialogueTextContentOverrideBytecodeStoreStringResult(CFASSFileDialogueTextContentOverrideBytecodeRef bytecode, wchar_t * targetPoint);
+/* targetPoint */
+// this could be NULL
+/* Return */
+// same as CFASSFileDialogueTextContentOverrideStoreStringResult
+
+int CFASSFileDialogueTextContentOverrideBytecodeAppendStringResult(CFASSFileDialogueTextContentOverrideBytecodeRef bytecode, CFMutableStringRef string);
+/* Return */
+// 0 for success, -1 if anything went wrong
+
+#endif /* CFASSFileDialogueTextContentOverrideBytecode_Private_h */
@@ -0,0 +1,152 @@
+//
+//  CFASSFileDialogueTextContentOverrideCache.c
+//  ASS_editor
+//
+//  Created by Bill Sun on 2018/11/5.
+//  Copyright © 2018 Bill Sun. All rights reserved.
+//
+
+#include <stdlib.h>
+#include <wchar.h>
+
+#include "CFASSFileDialogueTextContentOverrideCache.h"
+#include "CFASSFileDialogueTextContentOverrideCache_Private.h"
+#include "CFASSFileDialogueTextContentOverride.h"
+#include "CFASSFileDialogueTextContentOverride_Private.h"
+#include "CFException.h"
+
+typedef struct CFASSFileDialogueTextContentOverrideCacheSlot
+{
+    size_t hash;
+    size_t length;
+    wchar_t *string;                                    // block text with braces, NULL for empty slot
+    CFASSFileDialogueTextContentOverrideRef override;   // retained by cache
+} CFASSFileDialogueTextContentOverrideCacheSlot;
+
+struct CFASSFileDialogueTextContentOverrideCache
+{
+    size_t amount;
+    size_t capacity;                                    // power of 2, kept at least twice of amount
+    CFASSFileDialogueTextContentOverrideCacheSlot *slots;
+};
+
+static size_t CFASSFileDialogueTextContentOverrideCacheHash(const wchar_t *string, size_t length);
+
+static CFASSFileDialogueTextContentOverrideCacheSlot *CFASSFileDialogueTextContentOverrideCacheFindSlot(CFASSFileDialogueTextContentOverrideCacheSlot *slots, size_t capacity,
+                                                                                                        const wchar_t *string, size_t length, size_t hash);
+
+static int CFASSFileDialogueTextContentOverrideCacheGrow(CFASSFileDialogueTextContentOverrideCacheRef cache);
+
+CFASSFileDialogueTextContentOverrideCacheRef CFASSFileDialogueTextContentOverrideCacheCreateEmpty(void)
+{
+    CFASSFileDialogueTextContentOverrideCacheRef result;
+    if((result = malloc(sizeof(struct CFASSFileDialogueTextContentOverrideCache))) != NULL)
+    {
+        result->capacity = 64;
+        if((result->slots = calloc(result->capacity, sizeof(CFASSFileDialogueTextContentOverrideCacheSlot))) != NULL)
+        {
+            result->amount = 0;
+            return result;
+        }
+        free(result);
+    }
+    return NULL;
+}
+
+void CFASSFileDialogueTextContentOverrideCacheDestory(CFASSFileDialogueTextContentOverrideCacheRef cache)
+{
+    if(cache == NULL) return;
+    for(size_t index = 0; index<cache->capacity; index++)
+        if(cache->slots[index].string != NULL)
+        {
+            free(cache->slots[index].string);
+            CFASSFileDialogueTextContentOverrideDestory(cache->slots[index].override);
+        }
+    free(cache->slots);
+    free(cache);
+}
+
+size_t CFASSFileDialogueTextContentOverrideCacheGetLength(CFASSFileDialogueTextContentOverrideCacheRef cache)
+{
+    if(cache == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTextContentOverrideCache NULL GetLength");
+    return cache->amount;
+}
+
+CFASSFileDialogueTextContentOverrideRef CFASSFileDialogueTextContentOverrideCacheCreateOverrideWithString(CFASSFileDialogueTextContentOverrideCacheRef cache, const wchar_t *string)
+{
+    if(cache == NULL || string == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTextContentOverrideCache %p CreateOverrideWithString %p", cache, string);
+    const wchar_t *endPoint = wcschr(string, L'}');
+    if(endPoint == NULL)
+        return NULL;
+    size_t length = endPoint - string + 1;
+    size_t hash = CFASSFileDialogueTextContentOverrideCacheHash(string, length);
+    CFASSFileDialogueTextContentOverrideCacheSlot *slot = CFASSFileDialogueTextContentOverrideCacheFindSlot(cache->slots, cache->capacity, string, length, hash);
+    if(slot->string != NULL)
+        return CFASSFileDialogueTextContentOverrideRetain(slot->override);
+    
+    CFASSFileDialogueTextContentOverrideRef result;
+    if((result = CFASSFileDialogueTextContentOverrideCreateWithString(string, true)) == NULL)
+        return NULL;
+    // failed to remember the block only loses sharing, result is still good
+    if((cache->amount+1)*2 > cache->capacity)
+    {
+        if(CFASSFileDialogueTextContentOverrideCacheGrow(cache) != 0)
+            return result;
+        slot = CFASSFileDialogueTextContentOverrideCacheFindSlot(cache->slots, cache->capacity, string, length, hash);
+    }
+    wchar_t *key;
+    if((key = malloc(sizeof(wchar_t)*(length+1))) == NULL)
+        return result;
+    wmemcpy(key, string, length);
+    key[length] = L'\0';
+    slot->hash = hash;
+    slot->length = length;
+    slot->string = key;
+    slot->override = CFASSFileDialogueTextContentOverrideRetain(result);
+    cache->amount++;
+    return result;
+}
+
+static size_t CFASSFileDialogueTextContentOverrideCacheHash(const wchar_t *string, size_t length)
+{
+    // FNV-1a over each wide character
+    size_t hash = (size_t)2166136261u;
+    for(size_t index = 0; index<length; index++)
+    {
+        hash ^= (size_t)string[index];
+        hash *= (size_t)16777619u;
+    }
+    return hash;
+}
+
+static CFASSFileDialogueTextContentOverrideCacheSlot *CFASSFileDialogueTextContentOverrideCacheFindSlot(CFASSFileDialogueTextContentOverrideCacheSlot *slots, size_t capacity,
+                                                                                                        const wchar_t *string, size_t length, size_t hash)
+{
+    // return the slot holding string, or the empty slot it should be put in
+    size_t mask = capacity - 1;
+    CFASSFileDialogueTextContentOverrideCacheSlot *slot;
+    for(size_t position = hash & mask; (slot = slots + position)->string != NULL; position = (position + 1) & mask)
+        if(slot->hash == hash && slot->length == length && wmemcmp(slot->string, string, length) == 0)
+            break;
+    return slot;
+}
+
+static int CFASSFileDialogueTextContentOverrideCacheGrow(CFASSFileDialogueTextContentOverrideCacheRef cache)
+{
+    size_t capacity = cache->capacity*2;
+    CFASSFileDialogueTextContentOverrideCacheSlot *slots;
+    if((slots = calloc(capacity, sizeof(CFASSFileDialogueTextContentOverrideCacheSlot))) == NULL)
+        return -1;
+    for(size_t index = 0; index<cache->capacity; index++)
+        if(cache->slots[index].string != NULL)
+            *CFASSFileDialogueTextContentOverrideCacheFindSlot(slots, capacity,
+                                                               cache->slots[index].string,
+                                                               cache->slots[index].length,
+                                                               cache->slots[index].hash) = cache->slots[index];
+    free(cache->slots);
+    cache->slots = slots;
+    cache->capacity = capacity;
+    return 0;
+}
@@ -0,0 +1,27 @@
+//
+//  CFASSFileDialogueTextContentOverrideCache.h
+//  ASS_editor
+//
+//  Created by Bill Sun on 2018/11/5.
+//  Copyright © 2018 Bill Sun. All rights reserved.
+//
+
+#ifndef CFASSFileDialogueTextContentOverrideCache_h
+#define CFASSFileDialogueTextContentOverrideCache_h
+
+#include <stddef.h>
+
+typedef struct CFASSFileDialogueTextContentOverrideCache *CFASSFileDialogueTextContentOverrideCacheRef;
+// parsed override blocks keyed by their source text, identical blocks are parsed once and shared
+
+CFASSFileDialogueTextContentOverrideCacheRef CFASSFileDialogueTextContentOverrideCacheCreateEmpty(void);
+
+void CFASSFileDialogueTextContentOverrideCacheDestory(CFASSFileDialogueTextContentOverrideCacheRef cache);
+/* Discussion */
+// overrides got from cache stay alive, each holder destory its own
+
+size_t CFASSFileDialogueTextContentOverrideCacheGetLength(CFASSFileDialogueTextContentOverrideCacheRef cache);
+/* Return Value */
+// the amount of distinct override blocks
+
+#endif /* CFASSFileDialogueTextContentOverrideCache_h */
@@ -0,0 +1,25 @@
+//
+//  CFASSFileDialogueTextContentOverrideCache_Private.h
+//  ASS_editor
+//
+//  Created by Bill Sun on 2018/11/5.
+//  Copyright © 2018 Bill Sun. All rights reserved.
+//
+
+#ifndef CFASSFileDialogueTextContentOverrideCache_Private_h
+#define CFASSFileDialogueTextContentOverrideCache_Private_h
+
+#include <wchar.h>
+
+#include "CFASSFileDialogueTextContentOverrideCache.h"
+#include "CFASSFileDialogueTextContentOverride.h"
+
+CFASSFileDialogueTextContentOverrideRef CFASSFileDialogueTextContentOverrideCacheCreateOverrideWithString(CFASSFileDialogueTextContentOverrideCacheRef cache, const wchar_t *string);
+/* string */
+// points to '{', and must contain '}', same as CFASSFileDialogueTextContentOverrideCreateWithString with braces
+/* Return */
+// the override is retained for caller, destory it after use, NULL if failed
+// the same block text returns the same override, it is shared so never change it in place
+// use CFASSFileDialogueTextContentOverrideMakeChangeCopyOnWrite instead
+
+#endif /* CFASSFileDialogueTextContentOverrideCache_Private_h */
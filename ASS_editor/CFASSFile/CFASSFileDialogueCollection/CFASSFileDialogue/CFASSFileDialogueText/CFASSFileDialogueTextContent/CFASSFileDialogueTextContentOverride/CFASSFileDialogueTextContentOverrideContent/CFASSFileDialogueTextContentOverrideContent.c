@@ -9,14 +9,21 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdint.h>
+#include <limits.h>
+#include <wchar.h>
+#include <string.h>
+#include <math.h>
 
 #include "CFASSFileDialogueTextContentOverrideContent.h"
+#include "CFASSFileDialogueTextContentOverrideContent_Private.h"
 #include "CFUseTool.h"
 #include "CFException.h"
+#include "CFMutableString.h"
 #include "CFASSFileChange.h"
 #include "CFASSFileChange_Private.h"
 #include "CFASSFileDialogueTextDrawingContext.h"
 #include "CFASSFileDialogueTextDrawingContext_Private.h"
+#include "CFASSFileDialogueTextDrawingRasterizer.h"
 
 
 struct CFASSFileDialogueTextContentOverrideContent {
@@ -171,1152 +178,1171 @@ struct CFASSFileDialogueTextContentOverrideContent {
     } data;
 };
 
-static bool CFASSFileDialogueTextContentOverrideContentCompareStringAndPrefix(const wchar_t *contentString,
-                                                                              const wchar_t *endPoint,
-                                                                              const wchar_t *matchAlpha);
-
 static bool CFASSFileDialogueTextContentOverrideContentCheckAnimationModifierSupport(CFASSFileDialogueTextContentOverrideContentRef content);
 
 static bool CFASSFileDialogueTextContentOverrideContentCheckAnimationModifiers(wchar_t *modifiers);
 
 #pragma mark - Translation between strings
 
+/* Tag dispatch
+ * the tag name after backslash is lexed once, then looked up in a perfect hash table
+ * whose slots are precomputed from CFASSFileDialogueTextContentOverrideContentTagHash
+ * each tag owns an argument parser that scans its argument in a single pass
+ * when adding a tag, recompute the slots and make sure no two tags collide
+ */
+
+#define CFASSFileDialogueTextContentOverrideContentTagSlotAmount 128
+
+#define CFASSFileDialogueTextContentOverrideContentTagVariantDefault 0u
+#define CFASSFileDialogueTextContentOverrideContentTagVariantX 1u
+#define CFASSFileDialogueTextContentOverrideContentTagVariantY 2u
+#define CFASSFileDialogueTextContentOverrideContentTagVariantZ 3u
+
+typedef bool (*CFASSFileDialogueTextContentOverrideContentTagParser)(CFASSFileDialogueTextContentOverrideContentRef result,
+                                                                     const wchar_t *argument,
+                                                                     const wchar_t *argumentEnd,
+                                                                     unsigned int variant);
+/* argumentEnd */
+// points after the last character of argument
+/* Return */
+// true and result->type is set if argument is valid, otherwise result is untouched of any allocation
+
+typedef struct CFASSFileDialogueTextContentOverrideContentTag
+{
+    const wchar_t *name;        // without the leading backslash
+    size_t nameLength;
+    CFASSFileDialogueTextContentOverrideContentTagParser parser;
+    unsigned int variant;       // which spelling matched, like axis, component number or tag type
+} CFASSFileDialogueTextContentOverrideContentTag;
+
+static bool CFASSFileDialogueTextContentOverrideContentParseToggle(CFASSFileDialogueTextContentOverrideContentRef result,
+                                                                   const wchar_t *argument,
+                                                                   const wchar_t *argumentEnd,
+                                                                   unsigned int variant);
+
+static bool CFASSFileDialogueTextContentOverrideContentParseBlod(CFASSFileDialogueTextContentOverrideContentRef result,
+                                                                 const wchar_t *argument,
+                                                                 const wchar_t *argumentEnd,
+                                                                 unsigned int variant);
+
+static bool CFASSFileDialogueTextContentOverrideContentParseBorder(CFASSFileDialogueTextContentOverrideContentRef result,
+                                                                   const wchar_t *argument,
+                                                                   const wchar_t *argumentEnd,
+                                                                   unsigned int variant);
+
+static bool CFASSFileDialogueTextContentOverrideContentParseShadow(CFASSFileDialogueTextContentOverrideContentRef result,
+                                                                   const wchar_t *argument,
+                                                                   const wchar_t *argumentEnd,
+                                                                   unsigned int variant);
+
+static bool CFASSFileDialogueTextContentOverrideContentParseBlurEdge(CFASSFileDialogueTextContentOverrideContentRef result,
+                                                                     const wchar_t *argument,
+                                                                     const wchar_t *argumentEnd,
+                                                                     unsigned int variant);
+
+static bool CFASSFileDialogueTextContentOverrideContentParseFontSize(CFASSFileDialogueTextContentOverrideContentRef result,
+                                                                     const wchar_t *argument,
+                                                                     const wchar_t *argumentEnd,
+                                                                     unsigned int variant);
+
+static bool CFASSFileDialogueTextContentOverrideContentParseFontScale(CFASSFileDialogueTextContentOverrideContentRef result,
+                                                                      const wchar_t *argument,
+                                                                      const wchar_t *argumentEnd,
+                                                                      unsigned int variant);
+
+static bool CFASSFileDialogueTextContentOverrideContentParseFontSpacing(CFASSFileDialogueTextContentOverrideContentRef result,
+                                                                        const wchar_t *argument,
+                                                                        const wchar_t *argumentEnd,
+                                                                        unsigned int variant);
+
+static bool CFASSFileDialogueTextContentOverrideContentParseTextRotation(CFASSFileDialogueTextContentOverrideContentRef result,
+                                                                         const wchar_t *argument,
+                                                                         const wchar_t *argumentEnd,
+                                                                         unsigned int variant);
+
+static bool CFASSFileDialogueTextContentOverrideContentParseTextShearing(CFASSFileDialogueTextContentOverrideContentRef result,
+                                                                         const wchar_t *argument,
+                                                                         const wchar_t *argumentEnd,
+                                                                         unsigned int variant);
+
+static bool CFASSFileDialogueTextContentOverrideContentParseTextEncoding(CFASSFileDialogueTextContentOverrideContentRef result,
+                                                                         const wchar_t *argument,
+                                                                         const wchar_t *argumentEnd,
+                                                                         unsigned int variant);
+
+static bool CFASSFileDialogueTextContentOverrideContentParseColor(CFASSFileDialogueTextContentOverrideContentRef result,
+                                                                  const wchar_t *argument,
+                                                                  const wchar_t *argumentEnd,
+                                                                  unsigned int variant);
+
+static bool CFASSFileDialogueTextContentOverrideContentParseAlpha(CFASSFileDialogueTextContentOverrideContentRef result,
+                                                                  const wchar_t *argument,
+                                                                  const wchar_t *argumentEnd,
+                                                                  unsigned int variant);
+
+static bool CFASSFileDialogueTextContentOverrideContentParseAlignment(CFASSFileDialogueTextContentOverrideContentRef result,
+                                                                      const wchar_t *argument,
+                                                                      const wchar_t *argumentEnd,
+                                                                      unsigned int variant);
+
+static bool CFASSFileDialogueTextContentOverrideContentParseKaraokeDuration(CFASSFileDialogueTextContentOverrideContentRef result,
+                                                                            const wchar_t *argument,
+                                                                            const wchar_t *argumentEnd,
+                                                                            unsigned int variant);
+
+static bool CFASSFileDialogueTextContentOverrideContentParseWrapStyle(CFASSFileDialogueTextContentOverrideContentRef result,
+                                                                      const wchar_t *argument,
+                                                                      const wchar_t *argumentEnd,
+                                                                      unsigned int variant);
+
+static bool CFASSFileDialogueTextContentOverrideContentParsePoint(CFASSFileDialogueTextContentOverrideContentRef result,
+                                                                  const wchar_t *argument,
+                                                                  const wchar_t *argumentEnd,
+                                                                  unsigned int variant);
+
+static bool CFASSFileDialogueTextContentOverrideContentParseMovement(CFASSFileDialogueTextContentOverrideContentRef result,
+                                                                     const wchar_t *argument,
+                                                                     const wchar_t *argumentEnd,
+                                                                     unsigned int variant);
+
+static bool CFASSFileDialogueTextContentOverrideContentParseFade(CFASSFileDialogueTextContentOverrideContentRef result,
+                                                                 const wchar_t *argument,
+                                                                 const wchar_t *argumentEnd,
+                                                                 unsigned int variant);
+
+static bool CFASSFileDialogueTextContentOverrideContentParseAnimation(CFASSFileDialogueTextContentOverrideContentRef result,
+                                                                      const wchar_t *argument,
+                                                                      const wchar_t *argumentEnd,
+                                                                      unsigned int variant);
+
+static bool CFASSFileDialogueTextContentOverrideContentParseClip(CFASSFileDialogueTextContentOverrideContentRef result,
+                                                                 const wchar_t *argument,
+                                                                 const wchar_t *argumentEnd,
+                                                                 unsigned int variant);
+
+static bool CFASSFileDialogueTextContentOverrideContentParseDrawing(CFASSFileDialogueTextContentOverrideContentRef result,
+                                                                    const wchar_t *argument,
+                                                                    const wchar_t *argumentEnd,
+                                                                    unsigned int variant);
+
+static bool CFASSFileDialogueTextContentOverrideContentParseBaselineOffset(CFASSFileDialogueTextContentOverrideContentRef result,
+                                                                           const wchar_t *argument,
+                                                                           const wchar_t *argumentEnd,
+                                                                           unsigned int variant);
+
+static bool CFASSFileDialogueTextContentOverrideContentParseFontName(CFASSFileDialogueTextContentOverrideContentRef result,
+                                                                     const wchar_t *argument,
+                                                                     const wchar_t *argumentEnd,
+                                                                     unsigned int variant);
+
+static bool CFASSFileDialogueTextContentOverrideContentParseReset(CFASSFileDialogueTextContentOverrideContentRef result,
+                                                                  const wchar_t *argument,
+                                                                  const wchar_t *argumentEnd,
+                                                                  unsigned int variant);
+
+static const CFASSFileDialogueTextContentOverrideContentTag CFASSFileDialogueTextContentOverrideContentTagTable[CFASSFileDialogueTextContentOverrideContentTagSlotAmount] = {
+    [  1] = {L"fscy",   4, CFASSFileDialogueTextContentOverrideContentParseFontScale, CFASSFileDialogueTextContentOverrideContentTagVariantY},
+    [  2] = {L"s",      1, CFASSFileDialogueTextContentOverrideContentParseToggle, CFASSFileDialogueTextContentOverrideContentTypeStrikeOut},
+    [  8] = {L"i",      1, CFASSFileDialogueTextContentOverrideContentParseToggle, CFASSFileDialogueTextContentOverrideContentTypeItalic},
+    [  9] = {L"2a",     2, CFASSFileDialogueTextContentOverrideContentParseAlpha, 2u},
+    [ 10] = {L"move",   4, CFASSFileDialogueTextContentOverrideContentParseMovement, 0u},
+    [ 11] = {L"fade",   4, CFASSFileDialogueTextContentOverrideContentParseFade, 1u},
+    [ 16] = {L"alpha",  5, CFASSFileDialogueTextContentOverrideContentParseAlpha, 0u},
+    [ 21] = {L"pbo",    3, CFASSFileDialogueTextContentOverrideContentParseBaselineOffset, 0u},
+    [ 24] = {L"1c",     2, CFASSFileDialogueTextContentOverrideContentParseColor, 1u},
+    [ 25] = {L"b",      1, CFASSFileDialogueTextContentOverrideContentParseBlod, 0u},
+    [ 26] = {L"K",      1, CFASSFileDialogueTextContentOverrideContentParseKaraokeDuration, 1u},
+    [ 30] = {L"fax",    3, CFASSFileDialogueTextContentOverrideContentParseTextShearing, CFASSFileDialogueTextContentOverrideContentTagVariantX},
+    [ 33] = {L"frz",    3, CFASSFileDialogueTextContentOverrideContentParseTextRotation, CFASSFileDialogueTextContentOverrideContentTagVariantZ},
+    [ 35] = {L"bord",   4, CFASSFileDialogueTextContentOverrideContentParseBorder, CFASSFileDialogueTextContentOverrideContentTagVariantDefault},
+    [ 36] = {L"3a",     2, CFASSFileDialogueTextContentOverrideContentParseAlpha, 3u},
+    [ 37] = {L"frx",    3, CFASSFileDialogueTextContentOverrideContentParseTextRotation, CFASSFileDialogueTextContentOverrideContentTagVariantX},
+    [ 41] = {L"r",      1, CFASSFileDialogueTextContentOverrideContentParseReset, 0u},
+    [ 42] = {L"fr",     2, CFASSFileDialogueTextContentOverrideContentParseTextRotation, CFASSFileDialogueTextContentOverrideContentTagVariantDefault},
+    [ 50] = {L"ko",     2, CFASSFileDialogueTextContentOverrideContentParseKaraokeDuration, 2u},
+    [ 51] = {L"2c",     2, CFASSFileDialogueTextContentOverrideContentParseColor, 2u},
+    [ 52] = {L"u",      1, CFASSFileDialogueTextContentOverrideContentParseToggle, CFASSFileDialogueTextContentOverrideContentTypeUnderline},
+    [ 53] = {L"kf",     2, CFASSFileDialogueTextContentOverrideContentParseKaraokeDuration, 1u},
+    [ 56] = {L"pos",    3, CFASSFileDialogueTextContentOverrideContentParsePoint, CFASSFileDialogueTextContentOverrideContentTypePosition},
+    [ 58] = {L"k",      1, CFASSFileDialogueTextContentOverrideContentParseKaraokeDuration, 0u},
+    [ 59] = {L"iclip",  5, CFASSFileDialogueTextContentOverrideContentParseClip, 1u},
+    [ 63] = {L"4a",     2, CFASSFileDialogueTextContentOverrideContentParseAlpha, 4u},
+    [ 64] = {L"a",      1, CFASSFileDialogueTextContentOverrideContentParseAlignment, 1u},
+    [ 66] = {L"blur",   4, CFASSFileDialogueTextContentOverrideContentParseBlurEdge, 1u},
+    [ 67] = {L"fscx",   4, CFASSFileDialogueTextContentOverrideContentParseFontScale, CFASSFileDialogueTextContentOverrideContentTagVariantX},
+    [ 70] = {L"fad",    3, CFASSFileDialogueTextContentOverrideContentParseFade, 0u},
+    [ 76] = {L"fsp",    3, CFASSFileDialogueTextContentOverrideContentParseFontSpacing, 0u},
+    [ 77] = {L"shad",   4, CFASSFileDialogueTextContentOverrideContentParseShadow, CFASSFileDialogueTextContentOverrideContentTagVariantDefault},
+    [ 78] = {L"3c",     2, CFASSFileDialogueTextContentOverrideContentParseColor, 3u},
+    [ 79] = {L"an",     2, CFASSFileDialogueTextContentOverrideContentParseAlignment, 0u},
+    [ 80] = {L"q",      1, CFASSFileDialogueTextContentOverrideContentParseWrapStyle, 0u},
+    [ 81] = {L"xbord",  5, CFASSFileDialogueTextContentOverrideContentParseBorder, CFASSFileDialogueTextContentOverrideContentTagVariantX},
+    [ 86] = {L"fn",     2, CFASSFileDialogueTextContentOverrideContentParseFontName, 0u},
+    [ 88] = {L"xshad",  5, CFASSFileDialogueTextContentOverrideContentParseShadow, CFASSFileDialogueTextContentOverrideContentTagVariantX},
+    [ 89] = {L"fe",     2, CFASSFileDialogueTextContentOverrideContentParseTextEncoding, 0u},
+    [ 91] = {L"t",      1, CFASSFileDialogueTextContentOverrideContentParseAnimation, 0u},
+    [ 92] = {L"fay",    3, CFASSFileDialogueTextContentOverrideContentParseTextShearing, CFASSFileDialogueTextContentOverrideContentTagVariantY},
+    [ 97] = {L"clip",   4, CFASSFileDialogueTextContentOverrideContentParseClip, 0u},
+    [ 99] = {L"fry",    3, CFASSFileDialogueTextContentOverrideContentParseTextRotation, CFASSFileDialogueTextContentOverrideContentTagVariantY},
+    [105] = {L"4c",     2, CFASSFileDialogueTextContentOverrideContentParseColor, 4u},
+    [108] = {L"ybord",  5, CFASSFileDialogueTextContentOverrideContentParseBorder, CFASSFileDialogueTextContentOverrideContentTagVariantY},
+    [109] = {L"be",     2, CFASSFileDialogueTextContentOverrideContentParseBlurEdge, 0u},
+    [110] = {L"1a",     2, CFASSFileDialogueTextContentOverrideContentParseAlpha, 1u},
+    [114] = {L"c",      1, CFASSFileDialogueTextContentOverrideContentParseColor, 0u},
+    [115] = {L"yshad",  5, CFASSFileDialogueTextContentOverrideContentParseShadow, CFASSFileDialogueTextContentOverrideContentTagVariantY},
+    [119] = {L"p",      1, CFASSFileDialogueTextContentOverrideContentParseDrawing, 0u},
+    [122] = {L"org",    3, CFASSFileDialogueTextContentOverrideContentParsePoint, CFASSFileDialogueTextContentOverrideContentTypeRotationOrigin},
+    [127] = {L"fs",     2, CFASSFileDialogueTextContentOverrideContentParseFontSize, 0u},
+};
+
+static size_t CFASSFileDialogueTextContentOverrideContentTagHash(const wchar_t *name, size_t nameLength)
+{
+    unsigned long second = nameLength > 1 ? (unsigned long)name[1] : 0ul;
+    return ((unsigned long)name[0]*27 + second*23 + (unsigned long)name[nameLength-1]*62 + nameLength*7) &
+           (CFASSFileDialogueTextContentOverrideContentTagSlotAmount - 1);
+}
+
+static const CFASSFileDialogueTextContentOverrideContentTag *CFASSFileDialogueTextContentOverrideContentTagLookup(const wchar_t *name, size_t nameLength)
+{
+    const CFASSFileDialogueTextContentOverrideContentTag *tag =
+    &CFASSFileDialogueTextContentOverrideContentTagTable[CFASSFileDialogueTextContentOverrideContentTagHash(name, nameLength)];
+    if(tag->name != NULL && tag->nameLength == nameLength && wmemcmp(tag->name, name, nameLength) == 0)
+        return tag;
+    return NULL;
+}
+
 CFASSFileDialogueTextContentOverrideContentRef CFASSFileDialogueTextContentOverrideContentCreateWithString(const wchar_t *contentString, const wchar_t *endPoint)
 {
-    if(contentString != NULL)
+    if(contentString == NULL || *contentString != L'\\')
+        return NULL;
+    const wchar_t *contentEnd = endPoint != NULL ? endPoint + 1 : contentString + wcslen(contentString);
+    const wchar_t *name = contentString + 1, *nameEnd = name;
+    if(nameEnd < contentEnd && *nameEnd >= L'1' && *nameEnd <= L'4')      /* \1c \2a ... */
+        nameEnd++;
+    while(nameEnd < contentEnd && ((*nameEnd >= L'a' && *nameEnd <= L'z') || (*nameEnd >= L'A' && *nameEnd <= L'Z')))
+        nameEnd++;
+    size_t nameLength = nameEnd - name;
+    if(nameLength == 0)
+        return NULL;
+    const CFASSFileDialogueTextContentOverrideContentTag *tag = CFASSFileDialogueTextContentOverrideContentTagLookup(name, nameLength);
+    if(tag == NULL && nameLength > 2 && name[0] == L'f' && name[1] == L'n')       /* \fnArial */
+        tag = CFASSFileDialogueTextContentOverrideContentTagLookup(name, 2);
+    else if(tag == NULL && nameLength > 1 && name[0] == L'r')                     /* \rStyleName */
+        tag = CFASSFileDialogueTextContentOverrideContentTagLookup(name, 1);
+    if(tag == NULL)
+        return NULL;
+    CFASSFileDialogueTextContentOverrideContentRef result;
+    if((result = malloc(sizeof(struct CFASSFileDialogueTextContentOverrideContent))) != NULL)
+    {
+        if(tag->parser(result, name + tag->nameLength, contentEnd, tag->variant))
+            return result;
+        free(result);
+    }
+    return NULL;
+}
+
+#pragma mark - Argument Scan
+
+static void CFASSFileDialogueTextContentOverrideContentSkipBlank(const wchar_t **point, const wchar_t *end)
+{
+    while(*point < end && (**point == L' ' || **point == L'\t'))
+        (*point)++;
+}
+
+static bool CFASSFileDialogueTextContentOverrideContentScanCharacter(const wchar_t **point, const wchar_t *end, wchar_t character)
+{
+    const wchar_t *scan = *point;
+    CFASSFileDialogueTextContentOverrideContentSkipBlank(&scan, end);
+    if(scan >= end || *scan != character)
+        return false;
+    *point = scan + 1;
+    return true;
+}
+
+static bool CFASSFileDialogueTextContentOverrideContentScanInteger(const wchar_t **point, const wchar_t *end, int *value)
+{
+    const wchar_t *scan = *point;
+    CFASSFileDialogueTextContentOverrideContentSkipBlank(&scan, end);
+    bool negative = false;
+    if(scan < end && (*scan == L'-' || *scan == L'+'))
+        negative = *scan++ == L'-';
+    if(scan >= end || *scan < L'0' || *scan > L'9')
+        return false;
+    long long number = 0;
+    while(scan < end && *scan >= L'0' && *scan <= L'9')
+    {
+        number = number*10 + (*scan++ - L'0');
+        if(number > (long long)INT_MAX + 1)
+            return false;
+    }
+    if(negative)
+        number = -number;
+    if(number > INT_MAX)
+        return false;
+    *value = (int)number;
+    *point = scan;
+    return true;
+}
+
+static bool CFASSFileDialogueTextContentOverrideContentScanUnsigned(const wchar_t **point, const wchar_t *end, unsigned int *value)
+{
+    const wchar_t *scan = *point;
+    CFASSFileDialogueTextContentOverrideContentSkipBlank(&scan, end);
+    if(scan < end && *scan == L'+')
+        scan++;
+    if(scan >= end || *scan < L'0' || *scan > L'9')
+        return false;
+    unsigned long long number = 0;
+    while(scan < end && *scan >= L'0' && *scan <= L'9')
+    {
+        number = number*10 + (*scan++ - L'0');
+        if(number > UINT_MAX)
+            return false;
+    }
+    *value = (unsigned int)number;
+    *point = scan;
+    return true;
+}
+
+static bool CFASSFileDialogueTextContentOverrideContentScanHex(const wchar_t **point, const wchar_t *end, unsigned long *value)
+{
+    const wchar_t *scan = *point;
+    CFASSFileDialogueTextContentOverrideContentSkipBlank(&scan, end);
+    unsigned long number = 0;
+    const wchar_t *digitBegin = scan;
+    for(; scan < end; scan++)
+    {
+        unsigned int digit;
+        if(*scan >= L'0' && *scan <= L'9') digit = *scan - L'0';
+        else if(*scan >= L'a' && *scan <= L'f') digit = *scan - L'a' + 10;
+        else if(*scan >= L'A' && *scan <= L'F') digit = *scan - L'A' + 10;
+        else break;
+        if(number > 0xFFFFFFFFul >> 4)
+            return false;
+        number = number << 4 | digit;
+    }
+    if(scan == digitBegin)
+        return false;
+    *value = number;
+    *point = scan;
+    return true;
+}
+
+static bool CFASSFileDialogueTextContentOverrideContentScanDouble(const wchar_t **point, const wchar_t *end, double *value)
+{
+    const wchar_t *scan = *point;
+    CFASSFileDialogueTextContentOverrideContentSkipBlank(&scan, end);
+    wchar_t buffer[64];     // wcstod is not bounded by end, copy candidate characters first
+    size_t length = 0;
+    while(scan + length < end && length < sizeof(buffer)/sizeof(wchar_t) - 1 &&
+          ((scan[length] >= L'0' && scan[length] <= L'9') ||
+           scan[length] == L'.' || scan[length] == L'-' || scan[length] == L'+' ||
+           scan[length] == L'e' || scan[length] == L'E'))
+    {
+        buffer[length] = scan[length];
+        length++;
+    }
+    buffer[length] = L'\0';
+    wchar_t *numberEnd;
+    double number = wcstod(buffer, &numberEnd);
+    if(numberEnd == buffer)
+        return false;
+    *value = number;
+    *point = scan + (numberEnd - buffer);
+    return true;
+}
+
+static wchar_t *CFASSFileDialogueTextContentOverrideContentCreateString(const wchar_t *begin, const wchar_t *end)
+{
+    wchar_t *result;
+    if((result = malloc(sizeof(wchar_t)*(end-begin+1))) != NULL)
+    {
+        wmemcpy(result, begin, end-begin);
+        result[end-begin] = L'\0';
+    }
+    return result;
+}
+
+#pragma mark - Tag Argument Parser
+
+static bool CFASSFileDialogueTextContentOverrideContentParseToggle(CFASSFileDialogueTextContentOverrideContentRef result,
+                                                                   const wchar_t *argument,
+                                                                   const wchar_t *argumentEnd,
+                                                                   unsigned int variant)
+{
+    int isOn;
+    if(!CFASSFileDialogueTextContentOverrideContentScanInteger(&argument, argumentEnd, &isOn) || isOn < 0 || isOn > 1)
+        return false;
+    result->type = (CFASSFileDialogueTextContentOverrideContentType)variant;
+    switch(result->type)
+    {
+        case CFASSFileDialogueTextContentOverrideContentTypeItalic:
+            result->data.italic.isItalic = isOn;
+            break;
+        case CFASSFileDialogueTextContentOverrideContentTypeUnderline:
+            result->data.underline.isUnderline = isOn;
+            break;
+        default:
+            result->data.strikeOut.isStrikeOut = isOn;
+            break;
+    }
+    return true;
+}
+
+static bool CFASSFileDialogueTextContentOverrideContentParseBlod(CFASSFileDialogueTextContentOverrideContentRef result,
+                                                                 const wchar_t *argument,
+                                                                 const wchar_t *argumentEnd,
+                                                                 unsigned int variant)
+{
+    (void)variant;
+    int weight;
+    if(!CFASSFileDialogueTextContentOverrideContentScanInteger(&argument, argumentEnd, &weight) || weight < 0)
+        return false;
+    result->type = CFASSFileDialogueTextContentOverrideContentTypeBlod;
+    result->data.blod.weight = weight;
+    return true;
+}
+
+static bool CFASSFileDialogueTextContentOverrideContentParseBorder(CFASSFileDialogueTextContentOverrideContentRef result,
+                                                                   const wchar_t *argument,
+                                                                   const wchar_t *argumentEnd,
+                                                                   unsigned int variant)
+{
+    double borderSize;
+    if(!CFASSFileDialogueTextContentOverrideContentScanDouble(&argument, argumentEnd, &borderSize) || borderSize < 0)
+        return false;
+    result->type = CFASSFileDialogueTextContentOverrideContentTypeBorder;
+    result->data.border.usingComplexed = variant != CFASSFileDialogueTextContentOverrideContentTagVariantDefault;
+    result->data.border.axis = variant == CFASSFileDialogueTextContentOverrideContentTagVariantY ? CF2DAxisY : CF2DAxisX;
+    result->data.border.resolutionPixels = borderSize;
+    return true;
+}
+
+static bool CFASSFileDialogueTextContentOverrideContentParseShadow(CFASSFileDialogueTextContentOverrideContentRef result,
+                                                                   const wchar_t *argument,
+                                                                   const wchar_t *argumentEnd,
+                                                                   unsigned int variant)
+{
+    double shadowDepth;
+    if(!CFASSFileDialogueTextContentOverrideContentScanDouble(&argument, argumentEnd, &shadowDepth) || shadowDepth < 0)
+        return false;
+    result->type = CFASSFileDialogueTextContentOverrideContentTypeShadow;
+    result->data.shadow.usingComplexed = variant != CFASSFileDialogueTextContentOverrideContentTagVariantDefault;
+    result->data.shadow.axis = variant == CFASSFileDialogueTextContentOverrideContentTagVariantY ? CF2DAxisY : CF2DAxisX;
+    result->data.shadow.depth = shadowDepth;
+    return true;
+}
+
+static bool CFASSFileDialogueTextContentOverrideContentParseBlurEdge(CFASSFileDialogueTextContentOverrideContentRef result,
+                                                                     const wchar_t *argument,
+                                                                     const wchar_t *argumentEnd,
+                                                                     unsigned int variant)
+{
+    unsigned int strength;
+    if(!CFASSFileDialogueTextContentOverrideContentScanUnsigned(&argument, argumentEnd, &strength))
+        return false;
+    result->type = CFASSFileDialogueTextContentOverrideContentTypeBlurEdge;
+    result->data.blurEdge.usingGuassian = variant != 0;
+    result->data.blurEdge.strength = strength;
+    return true;
+}
+
+static bool CFASSFileDialogueTextContentOverrideContentParseFontSize(CFASSFileDialogueTextContentOverrideContentRef result,
+                                                                     const wchar_t *argument,
+                                                                     const wchar_t *argumentEnd,
+                                                                     unsigned int variant)
+{
+    (void)variant;
+    unsigned int resolutionPixels;
+    if(!CFASSFileDialogueTextContentOverrideContentScanUnsigned(&argument, argumentEnd, &resolutionPixels))
+        return false;
+    result->type = CFASSFileDialogueTextContentOverrideContentTypeFontSize;
+    result->data.fontSize.resolutionPixels = resolutionPixels;
+    return true;
+}
+
+static bool CFASSFileDialogueTextContentOverrideContentParseFontScale(CFASSFileDialogueTextContentOverrideContentRef result,
+                                                                      const wchar_t *argument,
+                                                                      const wchar_t *argumentEnd,
+                                                                      unsigned int variant)
+{
+    unsigned int percentage;
+    if(!CFASSFileDialogueTextContentOverrideContentScanUnsigned(&argument, argumentEnd, &percentage))
+        return false;
+    result->type = CFASSFileDialogueTextContentOverrideContentTypeFontScale;
+    result->data.fontScale.axis = variant == CFASSFileDialogueTextContentOverrideContentTagVariantY ? CF2DAxisY : CF2DAxisX;
+    result->data.fontScale.percentage = percentage;
+    return true;
+}
+
+static bool CFASSFileDialogueTextContentOverrideContentParseFontSpacing(CFASSFileDialogueTextContentOverrideContentRef result,
+                                                                        const wchar_t *argument,
+                                                                        const wchar_t *argumentEnd,
+                                                                        unsigned int variant)
+{
+    (void)variant;
+    double resolutionPixels;
+    if(!CFASSFileDialogueTextContentOverrideContentScanDouble(&argument, argumentEnd, &resolutionPixels))
+        return false;
+    result->type = CFASSFileDialogueTextContentOverrideContentTypeFontSpacing;
+    result->data.spacing.resolutionPixels = resolutionPixels;
+    return true;
+}
+
+static bool CFASSFileDialogueTextContentOverrideContentParseTextRotation(CFASSFileDialogueTextContentOverrideContentRef result,
+                                                                         const wchar_t *argument,
+                                                                         const wchar_t *argumentEnd,
+                                                                         unsigned int variant)
+{
+    int degrees;
+    if(!CFASSFileDialogueTextContentOverrideContentScanInteger(&argument, argumentEnd, &degrees))
+        return false;
+    result->type = CFASSFileDialogueTextContentOverrideContentTypeTextRotation;
+    result->data.rotation.usingComplexed = variant != CFASSFileDialogueTextContentOverrideContentTagVariantDefault;
+    result->data.rotation.axis = variant == CFASSFileDialogueTextContentOverrideContentTagVariantX ? CF3DAxisX :
+                                 variant == CFASSFileDialogueTextContentOverrideContentTagVariantY ? CF3DAxisY : CF3DAxisZ;
+    result->data.rotation.degrees = degrees;
+    return true;
+}
+
+static bool CFASSFileDialogueTextContentOverrideContentParseTextShearing(CFASSFileDialogueTextContentOverrideContentRef result,
+                                                                         const wchar_t *argument,
+                                                                         const wchar_t *argumentEnd,
+                                                                         unsigned int variant)
+{
+    double factor;
+    if(!CFASSFileDialogueTextContentOverrideContentScanDouble(&argument, argumentEnd, &factor))
+        return false;
+    result->type = CFASSFileDialogueTextContentOverrideContentTypeTextShearing;
+    result->data.shearing.axis = variant == CFASSFileDialogueTextContentOverrideContentTagVariantY ? CF2DAxisY : CF2DAxisX;
+    result->data.shearing.factor = factor;
+    return true;
+}
+
+static bool CFASSFileDialogueTextContentOverrideContentParseTextEncoding(CFASSFileDialogueTextContentOverrideContentRef result,
+                                                                         const wchar_t *argument,
+                                                                         const wchar_t *argumentEnd,
+                                                                         unsigned int variant)
+{
+    (void)variant;
+    unsigned int identifier;
+    if(!CFASSFileDialogueTextContentOverrideContentScanUnsigned(&argument, argumentEnd, &identifier))
+        return false;
+    result->type = CFASSFileDialogueTextContentOverrideContentTypeTextEncoding;
+    result->data.fontEncoding.identifier = identifier;
+    return true;
+}
+
+static bool CFASSFileDialogueTextContentOverrideContentParseColor(CFASSFileDialogueTextContentOverrideContentRef result,
+                                                                  const wchar_t *argument,
+                                                                  const wchar_t *argumentEnd,
+                                                                  unsigned int variant)
+{
+    unsigned long colorInfo;    // B G R
+    if(!CFASSFileDialogueTextContentOverrideContentScanCharacter(&argument, argumentEnd, L'&') ||
+       !CFASSFileDialogueTextContentOverrideContentScanCharacter(&argument, argumentEnd, L'H') ||
+       !CFASSFileDialogueTextContentOverrideContentScanHex(&argument, argumentEnd, &colorInfo) ||
+       colorInfo > 0xFFFFFF)
+        return false;
+    result->type = CFASSFileDialogueTextContentOverrideContentTypeColor;
+    result->data.color.usingComplexed = variant != 0;
+    result->data.color.componentNumber = variant;
+    result->data.color.red = colorInfo % (0xFF+1);
+    colorInfo /= (0xFF+1);
+    result->data.color.green = colorInfo % (0xFF+1);
+    colorInfo /= (0xFF+1);
+    result->data.color.blue = colorInfo % (0xFF+1);
+    return true;
+}
+
+static bool CFASSFileDialogueTextContentOverrideContentParseAlpha(CFASSFileDialogueTextContentOverrideContentRef result,
+                                                                  const wchar_t *argument,
+                                                                  const wchar_t *argumentEnd,
+                                                                  unsigned int variant)
+{
+    unsigned long transparent;
+    if(!CFASSFileDialogueTextContentOverrideContentScanCharacter(&argument, argumentEnd, L'&') ||
+       !CFASSFileDialogueTextContentOverrideContentScanCharacter(&argument, argumentEnd, L'H') ||
+       !CFASSFileDialogueTextContentOverrideContentScanHex(&argument, argumentEnd, &transparent) ||
+       transparent > 0xFF)
+        return false;
+    result->type = CFASSFileDialogueTextContentOverrideContentTypeAlpha;
+    result->data.alpha.setAllComponent = variant == 0;
+    result->data.alpha.componentNumber = variant;
+    result->data.alpha.transparent = transparent;
+    return true;
+}
+
+static bool CFASSFileDialogueTextContentOverrideContentParseAlignment(CFASSFileDialogueTextContentOverrideContentRef result,
+                                                                      const wchar_t *argument,
+                                                                      const wchar_t *argumentEnd,
+                                                                      unsigned int variant)
+{
+    unsigned int position;
+    if(!CFASSFileDialogueTextContentOverrideContentScanUnsigned(&argument, argumentEnd, &position))
+        return false;
+    result->type = CFASSFileDialogueTextContentOverrideContentTypeAlignment;
+    result->data.alignment.legacy = variant != 0;
+    result->data.alignment.position = position;
+    return true;
+}
+
+static bool CFASSFileDialogueTextContentOverrideContentParseKaraokeDuration(CFASSFileDialogueTextContentOverrideContentRef result,
+                                                                            const wchar_t *argument,
+                                                                            const wchar_t *argumentEnd,
+                                                                            unsigned int variant)
+{
+    unsigned int sentiSeconds;
+    if(!CFASSFileDialogueTextContentOverrideContentScanUnsigned(&argument, argumentEnd, &sentiSeconds))
+        return false;
+    result->type = CFASSFileDialogueTextContentOverrideContentTypeKaraokeDuration;
+    result->data.karaokeDuration.hasSweepEffect = variant == 1;                         /* \K \kf */
+    result->data.karaokeDuration.removeBorderOutlineBeforeHighlight = variant == 2;     /* \ko */
+    result->data.karaokeDuration.sentiSeconds = sentiSeconds;
+    return true;
+}
+
+static bool CFASSFileDialogueTextContentOverrideContentParseWrapStyle(CFASSFileDialogueTextContentOverrideContentRef result,
+                                                                      const wchar_t *argument,
+                                                                      const wchar_t *argumentEnd,
+                                                                      unsigned int variant)
+{
+    (void)variant;
+    unsigned int style;
+    if(!CFASSFileDialogueTextContentOverrideContentScanUnsigned(&argument, argumentEnd, &style) || style > 3)
+        return false;
+    result->type = CFASSFileDialogueTextContentOverrideContentTypeWrapingStyle;
+    result->data.wrapStyle.style = style;
+    return true;
+}
+
+static bool CFASSFileDialogueTextContentOverrideContentParsePoint(CFASSFileDialogueTextContentOverrideContentRef result,
+                                                                  const wchar_t *argument,
+                                                                  const wchar_t *argumentEnd,
+                                                                  unsigned int variant)
+{
+    int x, y;
+    if(!CFASSFileDialogueTextContentOverrideContentScanCharacter(&argument, argumentEnd, L'(') ||
+       !CFASSFileDialogueTextContentOverrideContentScanInteger(&argument, argumentEnd, &x) ||
+       !CFASSFileDialogueTextContentOverrideContentScanCharacter(&argument, argumentEnd, L',') ||
+       !CFASSFileDialogueTextContentOverrideContentScanInteger(&argument, argumentEnd, &y))
+        return false;
+    result->type = (CFASSFileDialogueTextContentOverrideContentType)variant;
+    if(result->type == CFASSFileDialogueTextContentOverrideContentTypePosition)
+    {
+        result->data.position.x = x;
+        result->data.position.y = y;
+    }
+    else
+    {
+        result->data.rotationOrigin.x = x;
+        result->data.rotationOrigin.y = y;
+    }
+    return true;
+}
+
+static bool CFASSFileDialogueTextContentOverrideContentParseMovement(CFASSFileDialogueTextContentOverrideContentRef result,
+                                                                     const wchar_t *argument,
+                                                                     const wchar_t *argumentEnd,
+                                                                     unsigned int variant)
+{
+    (void)variant;
+    int fromX, fromY, toX, toY;
+    unsigned int startFromMS, endFromMS;
+    if(!CFASSFileDialogueTextContentOverrideContentScanCharacter(&argument, argumentEnd, L'(') ||
+       !CFASSFileDialogueTextContentOverrideContentScanInteger(&argument, argumentEnd, &fromX) ||
+       !CFASSFileDialogueTextContentOverrideContentScanCharacter(&argument, argumentEnd, L',') ||
+       !CFASSFileDialogueTextContentOverrideContentScanInteger(&argument, argumentEnd, &fromY) ||
+       !CFASSFileDialogueTextContentOverrideContentScanCharacter(&argument, argumentEnd, L',') ||
+       !CFASSFileDialogueTextContentOverrideContentScanInteger(&argument, argumentEnd, &toX) ||
+       !CFASSFileDialogueTextContentOverrideContentScanCharacter(&argument, argumentEnd, L',') ||
+       !CFASSFileDialogueTextContentOverrideContentScanInteger(&argument, argumentEnd, &toY))
+        return false;
+    if(CFASSFileDialogueTextContentOverrideContentScanCharacter(&argument, argumentEnd, L',') &&
+       CFASSFileDialogueTextContentOverrideContentScanUnsigned(&argument, argumentEnd, &startFromMS) &&
+       CFASSFileDialogueTextContentOverrideContentScanCharacter(&argument, argumentEnd, L',') &&
+       CFASSFileDialogueTextContentOverrideContentScanUnsigned(&argument, argumentEnd, &endFromMS))
+    {
+        result->data.movement.hasTimeControl = true;
+        result->data.movement.startFromMS = startFromMS;
+        result->data.movement.endFromMS = endFromMS;
+    }
+    else
+    {
+        result->data.movement.hasTimeControl = false;
+        result->data.movement.startFromMS = 0;
+        result->data.movement.endFromMS = 0;
+    }
+    result->type = CFASSFileDialogueTextContentOverrideContentTypeMove;
+    result->data.movement.fromX = fromX;
+    result->data.movement.fromY = fromY;
+    result->data.movement.toX = toX;
+    result->data.movement.toY = toY;
+    return true;
+}
+
+static bool CFASSFileDialogueTextContentOverrideContentParseFade(CFASSFileDialogueTextContentOverrideContentRef result,
+                                                                 const wchar_t *argument,
+                                                                 const wchar_t *argumentEnd,
+                                                                 unsigned int variant)
+{
+    unsigned int values[7];
+    unsigned int valueAmount = variant != 0 ? 7 : 2;
+    if(!CFASSFileDialogueTextContentOverrideContentScanCharacter(&argument, argumentEnd, L'('))
+        return false;
+    for(unsigned int index = 0; index < valueAmount; index++)
+        if((index != 0 && !CFASSFileDialogueTextContentOverrideContentScanCharacter(&argument, argumentEnd, L',')) ||
+           !CFASSFileDialogueTextContentOverrideContentScanUnsigned(&argument, argumentEnd, &values[index]))
+            return false;
+    if(variant == 0)        /* \fad(fadeIn,fadeOut) */
+    {
+        result->type = CFASSFileDialogueTextContentOverrideContentTypeFade;
+        result->data.fade.isComplexed = false;
+        result->data.fade.fadeInMS = values[0];
+        result->data.fade.fadeOutMS = values[1];
+        result->data.fade.beginAlpha = 0;
+        result->data.fade.middleAlpha = 0;
+        result->data.fade.endAlpha = 0;
+        result->data.fade.fadeInBeginMS = 0;
+        result->data.fade.fadeInEndMS = 0;
+        result->data.fade.fadeOutBeginMS = 0;
+        result->data.fade.fadeOutEndMS = 0;
+        return true;
+    }
+    if(values[0] > 0xFF || values[1] > 0xFF || values[2] > 0xFF)
+        return false;
+    result->type = CFASSFileDialogueTextContentOverrideContentTypeFade;
+    result->data.fade.isComplexed = true;
+    result->data.fade.fadeInMS = 0;
+    result->data.fade.fadeOutMS = 0;
+    result->data.fade.beginAlpha = values[0];
+    result->data.fade.middleAlpha = values[1];
+    result->data.fade.endAlpha = values[2];
+    result->data.fade.fadeInBeginMS = values[3];
+    result->data.fade.fadeInEndMS = values[4];
+    result->data.fade.fadeOutBeginMS = values[5];
+    result->data.fade.fadeOutEndMS = values[6];
+    return true;
+}
+
+static bool CFASSFileDialogueTextContentOverrideContentParseAnimation(CFASSFileDialogueTextContentOverrideContentRef result,
+                                                                      const wchar_t *argument,
+                                                                      const wchar_t *argumentEnd,
+                                                                      unsigned int variant)
+{
+    (void)variant;
+    if(!CFASSFileDialogueTextContentOverrideContentScanCharacter(&argument, argumentEnd, L'('))
+        return false;
+    unsigned int values[3];
+    unsigned int valueAmount = 0;
+    while(valueAmount < 3)
     {
-        CFASSFileDialogueTextContentOverrideContentRef result;
-        if((result = malloc(sizeof(struct CFASSFileDialogueTextContentOverrideContent))) != NULL)
+        const wchar_t *attempt = argument;
+        if(!CFASSFileDialogueTextContentOverrideContentScanUnsigned(&attempt, argumentEnd, &values[valueAmount]) ||
+           !CFASSFileDialogueTextContentOverrideContentScanCharacter(&attempt, argumentEnd, L','))
+            break;
+        argument = attempt;
+        valueAmount++;
+    }
+    CFASSFileDialogueTextContentOverrideContentSkipBlank(&argument, argumentEnd);
+    if(argument >= argumentEnd || *argument != L'\\')
+        return false;
+    const wchar_t *dataEndPoint = argument;
+    while(dataEndPoint < argumentEnd && *dataEndPoint != L')')
+    {
+        if(*dataEndPoint == L'(')
         {
-            int temp;
-            if(CFASSFileDialogueTextContentOverrideContentCompareStringAndPrefix(contentString,     /* italic */
-                                                                                 endPoint,
-                                                                                 L"i"))
-            {
-                int isItalic;
-                temp = swscanf(contentString, L"\\i%d", &isItalic);
-                if(temp == 1 && isItalic>=0 && isItalic<=1)
-                {
-                    result->type = CFASSFileDialogueTextContentOverrideContentTypeItalic;
-                    result->data.italic.isItalic = isItalic;
-                    return result;
-                }
-            }
-            else if(CFASSFileDialogueTextContentOverrideContentCompareStringAndPrefix(contentString,     /* blod */
-                                                                                      endPoint,
-                                                                                      L"b"))
-            {
-                int weight;
-                temp = swscanf(contentString, L"\\b%d", &weight);
-                if(temp == 1 && weight>=0)
-                {
-                    result->type = CFASSFileDialogueTextContentOverrideContentTypeBlod;
-                    result->data.blod.weight = weight;
-                    return result;
-                }
-            }
-            else if(CFASSFileDialogueTextContentOverrideContentCompareStringAndPrefix(contentString,     /* underline */
-                                                                                      endPoint,
-                                                                                      L"u"))
-            {
-                int isUnderline;
-                temp = swscanf(contentString, L"\\u%d", &isUnderline);
-                if(temp == 1 && isUnderline>=0 && isUnderline<=1)
-                {
-                    result->type = CFASSFileDialogueTextContentOverrideContentTypeUnderline;
-                    result->data.underline.isUnderline = isUnderline;
-                    return result;
-                }
-            }
-            else if(CFASSFileDialogueTextContentOverrideContentCompareStringAndPrefix(contentString,     /* strikeOut */
-                                                                                      endPoint,
-                                                                                      L"s"))
-            {
-                int isStrikeOut;
-                temp = swscanf(contentString, L"\\s%d", &isStrikeOut);
-                if(temp == 1 && isStrikeOut>=0 && isStrikeOut<=1)
-                {
-                    result->type = CFASSFileDialogueTextContentOverrideContentTypeStrikeOut;
-                    result->data.strikeOut.isStrikeOut = isStrikeOut;
-                    return result;
-                }
-            }
-            else if(CFASSFileDialogueTextContentOverrideContentCompareStringAndPrefix(contentString,     /* bord */
-                                                                                      endPoint,
-                                                                                      L"bord") ||
-                    CFASSFileDialogueTextContentOverrideContentCompareStringAndPrefix(contentString,     /* bord x */
-                                                                                      endPoint,
-                                                                                      L"xbord") ||
-                    CFASSFileDialogueTextContentOverrideContentCompareStringAndPrefix(contentString,     /* bord y */
-                                                                                      endPoint,
-                                                                                      L"ybord"))
-            {
-                double borderSize;
-                if((temp = swscanf(contentString, L"\\bord%lf", &borderSize)) == 1)
-                    result->data.border.usingComplexed = false;
-                else if((temp = swscanf(contentString, L"\\xbord%lf", &borderSize)) == 1)
-                    result->data.border.axis = CF2DAxisX;
-                else if((temp = swscanf(contentString, L"\\ybord%lf", &borderSize)) == 1)
-                    result->data.border.axis = CF2DAxisY;
-                if(temp == 1 && borderSize>=0)
-                {
-                    result->type = CFASSFileDialogueTextContentOverrideContentTypeBorder;
-                    result->data.border.resolutionPixels = borderSize;
-                    return result;
-                }
-            }
-            else if(CFASSFileDialogueTextContentOverrideContentCompareStringAndPrefix(contentString,     /* shadow */
-                                                                                      endPoint,
-                                                                                      L"shad") ||
-                    CFASSFileDialogueTextContentOverrideContentCompareStringAndPrefix(contentString,     /* shadow x */
-                                                                                      endPoint,
-                                                                                      L"xshad") ||
-                    CFASSFileDialogueTextContentOverrideContentCompareStringAndPrefix(contentString,     /* shadow y */
-                                                                                      endPoint,
-                                                                                      L"yshad"))
-            {
-                double shadowDepth;
-                if((temp = swscanf(contentString, L"\\shad%lf", &shadowDepth)) == 1)
-                    result->data.shadow.usingComplexed = false;
-                else if((temp = swscanf(contentString, L"\\xshad%lf", &shadowDepth)) == 1)
-                    result->data.shadow.axis = CF2DAxisX;
-                else if((temp = swscanf(contentString, L"\\yshad%lf", &shadowDepth)) == 1)
-                    result->data.shadow.axis = CF2DAxisY;
-                if(temp == 1 && shadowDepth>=0)
-                {
-                    result->type = CFASSFileDialogueTextContentOverrideContentTypeShadow;
-                    result->data.shadow.depth = shadowDepth;
-                    return result;
-                }
-            }
-            else if(CFASSFileDialogueTextContentOverrideContentCompareStringAndPrefix(contentString,     /* legacy blur */
-                                                                                      endPoint,
-                                                                                      L"be") ||
-                    CFASSFileDialogueTextContentOverrideContentCompareStringAndPrefix(contentString,     /* guassian blur */
-                                                                                      endPoint,
-                                                                                      L"blur"))
-            {
-                unsigned int strength;
-                if((temp = swscanf(contentString, L"\\be%u", &strength)) == 1)
-                    result->data.blurEdge.usingGuassian = false;
-                else if((temp = swscanf(contentString, L"\\blur%u", &strength)) == 1)
-                    result->data.blurEdge.usingGuassian = true;
-                if(temp == 1)
-                {
-                    result->type = CFASSFileDialogueTextContentOverrideContentTypeBlurEdge;
-                    result->data.blurEdge.strength = strength;
-                    return result;
-                }
-            }
-            else if(CFASSFileDialogueTextContentOverrideContentCompareStringAndPrefix(contentString,     /* font size */
-                                                                                      endPoint,
-                                                                                      L"fs"))
-            {
-                unsigned int resolutionPixels;
-                if((temp = swscanf(contentString, L"\\fs%u", &resolutionPixels)) == 1)
-                {
-                    result->type = CFASSFileDialogueTextContentOverrideContentTypeFontSize;
-                    result->data.fontSize.resolutionPixels = resolutionPixels;
-                    return result;
-                }
-            }
-            else if(CFASSFileDialogueTextContentOverrideContentCompareStringAndPrefix(contentString,     /* font scale x */
-                                                                                      endPoint,
-                                                                                      L"fscx") ||
-                    CFASSFileDialogueTextContentOverrideContentCompareStringAndPrefix(contentString,     /* font scale y */
-                                                                                      endPoint,
-                                                                                      L"fscy"))
-            {
-                unsigned int percentage;
-                if((temp = swscanf(contentString, L"\\fscx%u", &percentage)) == 1)
-                    result->data.fontScale.axis = CF2DAxisX;
-                else if((temp = swscanf(contentString, L"\\fscy%u", &percentage)) == 1)
-                    result->data.fontScale.axis = CF2DAxisY;
-                if(temp == 1)
-                {
-                    result->type = CFASSFileDialogueTextContentOverrideContentTypeFontScale;
-                    result->data.fontScale.percentage = percentage;
-                    return result;
-                }
-            }
-            else if(CFASSFileDialogueTextContentOverrideContentCompareStringAndPrefix(contentString,     /* text spacing */
-                                                                                      endPoint,
-                                                                                      L"fsp"))
-            {
-                double resolutionPixels;
-                if((temp = swscanf(contentString, L"\\fsp%lf", &resolutionPixels)) == 1)
-                {
-                    result->type = CFASSFileDialogueTextContentOverrideContentTypeFontSpacing;
-                    result->data.spacing.resolutionPixels = resolutionPixels;
-                    return result;
-                }
-            }
-            else if(CFASSFileDialogueTextContentOverrideContentCompareStringAndPrefix(contentString,     /* rotation default */
-                                                                                      endPoint,
-                                                                                      L"fr") ||
-                    CFASSFileDialogueTextContentOverrideContentCompareStringAndPrefix(contentString,     /* rotation x */
-                                                                                      endPoint,
-                                                                                      L"frx") ||
-                    CFASSFileDialogueTextContentOverrideContentCompareStringAndPrefix(contentString,     /* rotation y */
-                                                                                      endPoint,
-                                                                                      L"fry")  ||
-                    CFASSFileDialogueTextContentOverrideContentCompareStringAndPrefix(contentString,     /* rotation z */
-                                                                                      endPoint,
-                                                                                      L"frz"))
-            {
-                int degrees;
-                if((temp = swscanf(contentString, L"\\fr%d", &degrees)) == 1)
-                    result->data.rotation.usingComplexed = true;
-                else if((temp = swscanf(contentString, L"\\frx%d", &degrees)) == 1)
-                {
-                    result->data.rotation.usingComplexed = false;
-                    result->data.rotation.axis = CF3DAxisX;
-                }
-                else if((temp = swscanf(contentString, L"\\fry%d", &degrees)) == 1)
-                {
-                    result->data.rotation.usingComplexed = false;
-                    result->data.rotation.axis = CF3DAxisY;
-                }
-                else if((temp = swscanf(contentString, L"\\frz%d", &degrees)) == 1)
-                {
-                    result->data.rotation.usingComplexed = false;
-                    result->data.rotation.axis = CF3DAxisZ;
-                }
-                if(temp == 1)
-                {
-                    result->type = CFASSFileDialogueTextContentOverrideContentTypeTextRotation;
-                    result->data.rotation.degrees = degrees;
-                    return result;
-                }
-            }
-            else if(CFASSFileDialogueTextContentOverrideContentCompareStringAndPrefix(contentString,     /* text shearing x */
-                                                                                      endPoint,
-                                                                                      L"fax") ||
-                    CFASSFileDialogueTextContentOverrideContentCompareStringAndPrefix(contentString,     /* text shearing y */
-                                                                                      endPoint,
-                                                                                      L"fay"))
-            {
-                double factor;
-                if((temp = swscanf(contentString, L"\\fax%lf", &factor)) == 1)
-                    result->data.shearing.axis = CF2DAxisX;
-                else if((temp = swscanf(contentString, L"\\fay%lf", &factor)) == 1)
-                    result->data.shearing.axis = CF2DAxisY;
-                if(temp == 1)
-                {
-                    result->type = CFASSFileDialogueTextContentOverrideContentTypeTextShearing;
-                    result->data.shearing.factor = factor;
-                    return result;
-                }
-            }
-            else if(CFASSFileDialogueTextContentOverrideContentCompareStringAndPrefix(contentString,     /* font encoding */
-                                                                                      endPoint,
-                                                                                      L"fe"))
-            {
-                unsigned int identifier;
-                if((temp = swscanf(contentString, L"\\fe%u", &identifier)) == 1)
-                {
-                    result->type = CFASSFileDialogueTextContentOverrideContentTypeTextEncoding;
-                    result->data.fontEncoding.identifier = identifier;
-                    return result;
-                }
-            }
-            else if(CFASSFileDialogueTextContentOverrideContentCompareStringAndPrefix(contentString,     /* color default */
-                                                                                      endPoint,
-                                                                                      L"c") ||
-                    CF_wchar_string_match_beginning(contentString, L"\\1c") ||
-                    CF_wchar_string_match_beginning(contentString, L"\\2c") ||
-                    CF_wchar_string_match_beginning(contentString, L"\\3c") ||
-                    CF_wchar_string_match_beginning(contentString, L"\\4c"))
-            {
-                unsigned int componentNumber;
-                unsigned long colorInfo;    // B G R
-                bool checkMark = false;
-                if((temp = swscanf(contentString, L"\\c&H%lx&", &colorInfo)) == 1)
-                {
-                    result->data.color.usingComplexed = false;
-                    result->data.color.componentNumber = 0u;
-                    checkMark = true;
-                }
-                else if((temp = swscanf(contentString, L"\\%uc&H%lx&", &componentNumber, &colorInfo)) == 2)
-                    if(componentNumber>=1 && componentNumber<=4)
-                    {
-                        result->data.color.usingComplexed = true;
-                        result->data.color.componentNumber = componentNumber;
-                        checkMark = true;
-                    }
-                if(checkMark && colorInfo<=0xFFFFFF)
-                {
-                    result->type = CFASSFileDialogueTextContentOverrideContentTypeColor;
-                    result->data.color.red = colorInfo % (0xFF+1);
-                    colorInfo /= (0xFF+1);
-                    result->data.color.green = colorInfo % (0xFF+1);
-                    colorInfo /= (0xFF+1);
-                    result->data.color.blue = colorInfo % (0xFF+1);
-                    return result;
-                }
-                
-            }
-            else if(CFASSFileDialogueTextContentOverrideContentCompareStringAndPrefix(contentString,     /* alpha all */
-                                                                                      endPoint,
-                                                                                      L"alpha") ||
-                    CF_wchar_string_match_beginning(contentString, L"\\1a")  ||                           /* alpha 1 */
-                    CF_wchar_string_match_beginning(contentString, L"\\2a")  ||                           /* alpha 1 */
-                    CF_wchar_string_match_beginning(contentString, L"\\3a")  ||                           /* alpha 1 */
-                    CF_wchar_string_match_beginning(contentString, L"\\4a"))                              /* alpha 1 */
-            {
-                unsigned int componentNumber;
-                unsigned int transparent_uint;
-                if((temp = swscanf(contentString, L"\\alpha&H%X&", &transparent_uint)) == 1)
-                {
-                    if(transparent_uint<= 0xFF)
-                    {
-                        result->type = CFASSFileDialogueTextContentOverrideContentTypeAlpha;
-                        result->data.alpha.setAllComponent = true;
-                        result->data.alpha.componentNumber = 0;
-                        result->data.alpha.transparent = transparent_uint;
-                        return result;
-                    }
-                }
-                else if((temp = swscanf(contentString, L"\\%ua&H%X&", &componentNumber, &transparent_uint)) == 2)
-                    if(transparent_uint<= 0xFF && componentNumber>=1 && componentNumber<=4)
-                    {
-                        result->type = CFASSFileDialogueTextContentOverrideContentTypeAlpha;
-                        result->data.alpha.setAllComponent = false;
-                        result->data.alpha.componentNumber = componentNumber;
-                        result->data.alpha.transparent = transparent_uint;
-                        return result;
-                    }
-            }
-            else if(CFASSFileDialogueTextContentOverrideContentCompareStringAndPrefix(contentString,     /* alignment legacy */
-                                                                                      endPoint,
-                                                                                      L"a") ||
-                    CFASSFileDialogueTextContentOverrideContentCompareStringAndPrefix(contentString,     /* alignment numPad style */
-                                                                                      endPoint,
-                                                                                      L"an"))
-            {
-                unsigned int position;
-                if((temp = swscanf(contentString, L"\\a%u", &position)) == 1)
-                    result->data.alignment.legacy = true;
-                else if((temp = swscanf(contentString, L"\\an%u", &position)) == 1)
-                    result->data.alignment.legacy = false;
-                if(temp == 1)
-                {
-                    result->type = CFASSFileDialogueTextContentOverrideContentTypeAlignment;
-                    result->data.alignment.position = position;
-                    return result;
-                }
-            }
-            else if(CFASSFileDialogueTextContentOverrideContentCompareStringAndPrefix(contentString,     /* karaoke duration without sweep */
-                                                                                      endPoint,
-                                                                                      L"k") ||
-                    CFASSFileDialogueTextContentOverrideContentCompareStringAndPrefix(contentString,     /* karaoke duration with sweep */
-                                                                                      endPoint,
-                                                                                      L"K") ||
-                    CFASSFileDialogueTextContentOverrideContentCompareStringAndPrefix(contentString,     /* karaoke duration with sweep */
-                                                                                      endPoint,
-                                                                                      L"kf") ||
-                    CFASSFileDialogueTextContentOverrideContentCompareStringAndPrefix(contentString,     /* karaoke duration remove b/s */
-                                                                                      endPoint,
-                                                                                      L"ko"))
-            {
-                unsigned int sentiSeconds;
-                if((temp = swscanf(contentString, L"\\k%u", &sentiSeconds)) == 1)
-                {
-                    result->data.karaokeDuration.hasSweepEffect = false;
-                    result->data.karaokeDuration.removeBorderOutlineBeforeHighlight = false;
-                }
-                else if((temp = swscanf(contentString, L"\\K%u", &sentiSeconds)) == 1)
-                {
-                    result->data.karaokeDuration.hasSweepEffect = true;
-                    result->data.karaokeDuration.removeBorderOutlineBeforeHighlight = false;
-                }
-                else if((temp = swscanf(contentString, L"\\kf%u", &sentiSeconds)) == 1)
-                {
-                    result->data.karaokeDuration.hasSweepEffect = true;
-                    result->data.karaokeDuration.removeBorderOutlineBeforeHighlight = false;
-                }
-                else if((temp = swscanf(contentString, L"\\ko%u", &sentiSeconds)) == 1)
-                {
-                    result->data.karaokeDuration.hasSweepEffect = false;
-                    result->data.karaokeDuration.removeBorderOutlineBeforeHighlight = true;
-                }
-                if(temp == 1)
-                {
-                    result->type = CFASSFileDialogueTextContentOverrideContentTypeKaraokeDuration;
-                    result->data.karaokeDuration.sentiSeconds = sentiSeconds;
-                    return result;
-                }
-                
-            }
-            else if(CFASSFileDialogueTextContentOverrideContentCompareStringAndPrefix(contentString,     /* Wrap style */
-                                                                                      endPoint,
-                                                                                      L"q"))
-            {
-                unsigned int style;
-                if((temp = swscanf(contentString, L"\\q%u", &style)) == 1)
-                    if(style <= 3)
-                    {
-                        result->type = CFASSFileDialogueTextContentOverrideContentTypeWrapingStyle;
-                        result->data.wrapStyle.style = style;
-                        return result;
-                    }
-            }
-            else if(CFASSFileDialogueTextContentOverrideContentCompareStringAndPrefix(contentString,     /* position */
-                                                                                      endPoint,
-                                                                                      L"pos"))
-            {
-                int x, y;
-                if((temp = swscanf(contentString, L"\\pos(%d,%d)", &x, &y)) == 2)
-                {
-                    result->type = CFASSFileDialogueTextContentOverrideContentTypePosition;
-                    result->data.position.x = x;
-                    result->data.position.y = y;
-                    return result;
-                }
-            }
-            else if(CFASSFileDialogueTextContentOverrideContentCompareStringAndPrefix(contentString,     /* movement */
-                                                                                      endPoint,
-                                                                                      L"move"))
-            {
-                int fromX, fromY, toX, toY;
-                unsigned int startFromMS, endFromMS;
-                if((temp = swscanf(contentString, L"\\move(%d,%d,%d,%d,%u,%u)", &fromX, &fromY, &toX, &toY, &startFromMS, &endFromMS)) == 6)
-                {
-                    result->data.movement.hasTimeControl = true;
-                    result->data.movement.startFromMS = startFromMS;
-                    result->data.movement.endFromMS = endFromMS;
-                }
-                else if((temp = swscanf(contentString, L"\\move(%d,%d,%d,%d)", &fromX, &fromY, &toX, &toY)) == 4)
-                {
-                    result->data.movement.hasTimeControl = false;
-                    result->data.movement.startFromMS = 0;
-                    result->data.movement.endFromMS = 0;
-                }
-                if(temp >= 4)
-                {
-                    result->type = CFASSFileDialogueTextContentOverrideContentTypeMove;
-                    result->data.movement.fromX = fromX;
-                    result->data.movement.fromY = fromY;
-                    result->data.movement.toX = toX;
-                    result->data.movement.toY = toY;
-                    return result;
-                }
-            }
-            else if(CFASSFileDialogueTextContentOverrideContentCompareStringAndPrefix(contentString,     /* rotation origin */
-                                                                                      endPoint,
-                                                                                      L"org"))
+            while(dataEndPoint < argumentEnd && *dataEndPoint != L')') dataEndPoint++;
+            if(dataEndPoint >= argumentEnd) return false;
+        }
+        dataEndPoint++;
+    }
+    if(dataEndPoint >= argumentEnd)
+        return false;
+    result->data.animation.hasTimeOffset = valueAmount >= 2;
+    result->data.animation.hasAcceleration = valueAmount == 1 || valueAmount == 3;
+    result->data.animation.beginOffsetMS = valueAmount >= 2 ? values[0] : 0;
+    result->data.animation.endOffsetMS = valueAmount >= 2 ? values[1] : 0;
+    result->data.animation.acceleration = valueAmount == 3 ? values[2] : valueAmount == 1 ? values[0] : 0;
+    if((result->data.animation.modifiers = CFASSFileDialogueTextContentOverrideContentCreateString(argument, dataEndPoint)) != NULL)
+    {
+        if(CFASSFileDialogueTextContentOverrideContentCheckAnimationModifiers(result->data.animation.modifiers))
+        {
+            result->type = CFASSFileDialogueTextContentOverrideContentTypeAnimation;
+            return true;
+        }
+        free(result->data.animation.modifiers);
+    }
+    return false;
+}
+
+static bool CFASSFileDialogueTextContentOverrideContentParseClip(CFASSFileDialogueTextContentOverrideContentRef result,
+                                                                 const wchar_t *argument,
+                                                                 const wchar_t *argumentEnd,
+                                                                 unsigned int variant)
+{
+    if(!CFASSFileDialogueTextContentOverrideContentScanCharacter(&argument, argumentEnd, L'('))
+        return false;
+    result->data.clip.reverse = variant != 0;
+    int upLeftX, upLeftY, lowRightX, lowRightY;
+    const wchar_t *scan = argument;
+    if(CFASSFileDialogueTextContentOverrideContentScanInteger(&scan, argumentEnd, &upLeftX) &&
+       CFASSFileDialogueTextContentOverrideContentScanCharacter(&scan, argumentEnd, L',') &&
+       CFASSFileDialogueTextContentOverrideContentScanInteger(&scan, argumentEnd, &upLeftY) &&
+       CFASSFileDialogueTextContentOverrideContentScanCharacter(&scan, argumentEnd, L',') &&
+       CFASSFileDialogueTextContentOverrideContentScanInteger(&scan, argumentEnd, &lowRightX) &&
+       CFASSFileDialogueTextContentOverrideContentScanCharacter(&scan, argumentEnd, L',') &&
+       CFASSFileDialogueTextContentOverrideContentScanInteger(&scan, argumentEnd, &lowRightY))
+    {
+        result->type = CFASSFileDialogueTextContentOverrideContentTypeClip;
+        result->data.clip.usingDrawingCommand = false;
+        result->data.clip.hasScale = false;
+        result->data.clip.upLeftX = upLeftX;
+        result->data.clip.upLeftY = upLeftY;
+        result->data.clip.lowRightX = lowRightX;
+        result->data.clip.lowRightY = lowRightY;
+        result->data.clip.drawingCommand = NULL;
+        return true;
+    }
+    unsigned int scale;
+    scan = argument;
+    result->data.clip.usingDrawingCommand = true;
+    result->data.clip.hasScale = false;
+    if(CFASSFileDialogueTextContentOverrideContentScanUnsigned(&scan, argumentEnd, &scale) &&
+       CFASSFileDialogueTextContentOverrideContentScanCharacter(&scan, argumentEnd, L',') &&
+       scan < argumentEnd && *scan != L')')
+    {
+        result->data.clip.hasScale = true;
+        result->data.clip.scale = scale;
+        argument = scan;
+    }
+    const wchar_t *dataEndPoint = argument;
+    while(dataEndPoint < argumentEnd && *dataEndPoint != L')') dataEndPoint++;
+    if(dataEndPoint >= argumentEnd || dataEndPoint == argument)
+        return false;
+    if((result->data.clip.drawingCommand = CFASSFileDialogueTextContentOverrideContentCreateString(argument, dataEndPoint)) != NULL)
+    {
+        CFASSFileDialogueTextDrawingContextRef drawingContext;
+        if((drawingContext = CFASSFileDialogueTextDrawingContextCreateFromString(result->data.clip.drawingCommand)) != NULL)
+        {
+            CFASSFileDialogueTextDrawingContextDestory(drawingContext);
+            result->type = CFASSFileDialogueTextContentOverrideContentTypeClip;
+            return true;
+        }
+        free(result->data.clip.drawingCommand);
+    }
+    return false;
+}
+
+static bool CFASSFileDialogueTextContentOverrideContentParseDrawing(CFASSFileDialogueTextContentOverrideContentRef result,
+                                                                    const wchar_t *argument,
+                                                                    const wchar_t *argumentEnd,
+                                                                    unsigned int variant)
+{
+    (void)variant;
+    unsigned int mode;
+    if(!CFASSFileDialogueTextContentOverrideContentScanUnsigned(&argument, argumentEnd, &mode))
+        return false;
+    result->type = CFASSFileDialogueTextContentOverrideContentTypeDrawing;
+    result->data.drawing.mode = mode;
+    return true;
+}
+
+static bool CFASSFileDialogueTextContentOverrideContentParseBaselineOffset(CFASSFileDialogueTextContentOverrideContentRef result,
+                                                                           const wchar_t *argument,
+                                                                           const wchar_t *argumentEnd,
+                                                                           unsigned int variant)
+{
+    (void)variant;
+    int towardsBottomPixels;
+    if(!CFASSFileDialogueTextContentOverrideContentScanInteger(&argument, argumentEnd, &towardsBottomPixels))
+        return false;
+    result->type = CFASSFileDialogueTextContentOverrideContentTypeBaselineOffset;
+    result->data.baselineOffset.towardsBottomPixels = towardsBottomPixels;
+    return true;
+}
+
+static bool CFASSFileDialogueTextContentOverrideContentParseFontName(CFASSFileDialogueTextContentOverrideContentRef result,
+                                                                     const wchar_t *argument,
+                                                                     const wchar_t *argumentEnd,
+                                                                     unsigned int variant)
+{
+    (void)variant;
+    if(argument >= argumentEnd || *argument == L'\\')
+        return false;
+    if((result->data.fontName.name = CFASSFileDialogueTextContentOverrideContentCreateString(argument, argumentEnd)) == NULL)
+        return false;
+    result->type = CFASSFileDialogueTextContentOverrideContentTypeFontName;
+    return true;
+}
+
+static bool CFASSFileDialogueTextContentOverrideContentParseReset(CFASSFileDialogueTextContentOverrideContentRef result,
+                                                                  const wchar_t *argument,
+                                                                  const wchar_t *argumentEnd,
+                                                                  unsigned int variant)
+{
+    (void)variant;
+    if(argument >= argumentEnd)
+    {
+        result->type = CFASSFileDialogueTextContentOverrideContentTypeReset;
+        result->data.reset.resetToDefault = true;
+        result->data.reset.styleName = NULL;
+        return true;
+    }
+    if((result->data.reset.styleName = CFASSFileDialogueTextContentOverrideContentCreateString(argument, argumentEnd)) == NULL)
+        return false;
+    result->type = CFASSFileDialogueTextContentOverrideContentTypeReset;
+    result->data.reset.resetToDefault = false;
+    return true;
+}
+
+int CFASSFileDialogueTextContentOverrideContentStoreStringResult(CFASSFileDialogueTextContentOverrideContentRef overrideContent, wchar_t *targetPoint)
+{
+    if(overrideContent == NULL)
+    {
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTextContentOverrideContent NULL StoreStringResult");
+        return -1;
+    }
+    CFMutableStringRef string;
+    if((string = CFMutableStringCreateEmpty()) == NULL)
+        return -1;
+    int result = -1;
+    if(CFASSFileDialogueTextContentOverrideContentAppendStringResult(overrideContent, string) == 0)
+    {
+        result = (int)CFMutableStringGetLength(string);
+        if(targetPoint != NULL)
+            wmemcpy(targetPoint, CFMutableStringGetCharacters(string), result + 1);
+    }
+    CFMutableStringDestory(string);
+    return result;
+}
+
+int CFASSFileDialogueTextContentOverrideContentAppendStringResult(CFASSFileDialogueTextContentOverrideContentRef overrideContent, CFMutableStringRef string)
+{
+    if(overrideContent == NULL || string == NULL)
+    {
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTextContentOverrideContent %p AppendStringResult %p", overrideContent, string);
+        return -1;
+    }
+    switch (overrideContent->type) {
+        case CFASSFileDialogueTextContentOverrideContentTypeBlod:
+            CFMutableStringAppendString(string, L"\\b");
+            CFMutableStringAppendUnsigned(string, overrideContent->data.blod.weight);
+            break;
+        case CFASSFileDialogueTextContentOverrideContentTypeItalic:
+            CFMutableStringAppendString(string, overrideContent->data.italic.isItalic ? L"\\i1" : L"\\i0");
+            break;
+        case CFASSFileDialogueTextContentOverrideContentTypeUnderline:
+            CFMutableStringAppendString(string, overrideContent->data.underline.isUnderline ? L"\\u1" : L"\\u0");
+            break;
+        case CFASSFileDialogueTextContentOverrideContentTypeStrikeOut:
+            CFMutableStringAppendString(string, overrideContent->data.strikeOut.isStrikeOut ? L"\\s1" : L"\\s0");
+            break;
+        case CFASSFileDialogueTextContentOverrideContentTypeBorder:
+            if(overrideContent->data.border.usingComplexed)
+                CFMutableStringAppendString(string, overrideContent->data.border.axis == CF2DAxisX ? L"\\xbord" : L"\\ybord");
+            else
+                CFMutableStringAppendString(string, L"\\bord");
+            CFMutableStringAppendDouble(string, overrideContent->data.border.resolutionPixels);
+            break;
+        case CFASSFileDialogueTextContentOverrideContentTypeShadow:
+            if(overrideContent->data.shadow.usingComplexed)
+                CFMutableStringAppendString(string, overrideContent->data.shadow.axis == CF2DAxisX ? L"\\xshad" : L"\\yshad");
+            else
+                CFMutableStringAppendString(string, L"\\shad");
+            CFMutableStringAppendDouble(string, overrideContent->data.shadow.depth);
+            break;
+        case CFASSFileDialogueTextContentOverrideContentTypeBlurEdge:
+            CFMutableStringAppendString(string, overrideContent->data.blurEdge.usingGuassian ? L"\\blur" : L"\\be");
+            CFMutableStringAppendUnsigned(string, overrideContent->data.blurEdge.strength);
+            break;
+        case CFASSFileDialogueTextContentOverrideContentTypeFontName:
+            CFMutableStringAppendString(string, L"\\fn");
+            CFMutableStringAppendString(string, overrideContent->data.fontName.name);
+            break;
+        case CFASSFileDialogueTextContentOverrideContentTypeFontSize:
+            CFMutableStringAppendString(string, L"\\fs");
+            CFMutableStringAppendUnsigned(string, overrideContent->data.fontSize.resolutionPixels);
+            break;
+        case CFASSFileDialogueTextContentOverrideContentTypeFontScale:
+            CFMutableStringAppendString(string, overrideContent->data.fontScale.axis == CF2DAxisX ? L"\\fscx" : L"\\fscy");
+            CFMutableStringAppendUnsigned(string, overrideContent->data.fontScale.percentage);
+            break;
+        case CFASSFileDialogueTextContentOverrideContentTypeFontSpacing:
+            CFMutableStringAppendString(string, L"\\fsp");
+            CFMutableStringAppendDouble(string, overrideContent->data.spacing.resolutionPixels);
+            break;
+        case CFASSFileDialogueTextContentOverrideContentTypeTextRotation:
+            if(overrideContent->data.rotation.usingComplexed)
+                CFMutableStringAppendString(string,
+                                            overrideContent->data.rotation.axis == CF3DAxisX ? L"\\frx" :
+                                            overrideContent->data.rotation.axis == CF3DAxisY ? L"\\fry" : L"\\frz");
+            else
+                CFMutableStringAppendString(string, L"\\fr");
+            CFMutableStringAppendInteger(string, overrideContent->data.rotation.degrees);
+            break;
+        case CFASSFileDialogueTextContentOverrideContentTypeTextShearing:
+            CFMutableStringAppendString(string, overrideContent->data.shearing.axis == CF2DAxisX ? L"\\fax" : L"\\fay");
+            CFMutableStringAppendDouble(string, overrideContent->data.shearing.factor);
+            break;
+        case CFASSFileDialogueTextContentOverrideContentTypeTextEncoding:
+            CFMutableStringAppendString(string, L"\\fe");
+            CFMutableStringAppendUnsigned(string, overrideContent->data.fontEncoding.identifier);
+            break;
+        case CFASSFileDialogueTextContentOverrideContentTypeColor:
+            CFMutableStringAppendCharacter(string, L'\\');
+            if(overrideContent->data.color.usingComplexed)
+                CFMutableStringAppendUnsigned(string, overrideContent->data.color.componentNumber);
+            CFMutableStringAppendString(string, L"c&H");
+            CFMutableStringAppendHex(string,
+                                       overrideContent->data.color.red
+                                     + overrideContent->data.color.green*(0xFF+1)
+                                     + overrideContent->data.color.blue *(0xFFFF+1), 1);
+            CFMutableStringAppendCharacter(string, L'&');
+            break;
+        case CFASSFileDialogueTextContentOverrideContentTypeAlpha:
+            CFMutableStringAppendCharacter(string, L'\\');
+            if(overrideContent->data.alpha.setAllComponent)
+                CFMutableStringAppendString(string, L"alpha&H");
+            else
             {
-                int x, y;
-                if((temp = swscanf(contentString, L"\\org(%d,%d)", &x, &y)) == 2)
-                {
-                    result->type = CFASSFileDialogueTextContentOverrideContentTypeRotationOrigin;
-                    result->data.rotationOrigin.x = x;
-                    result->data.rotationOrigin.y = y;
-                    return result;
-                }
+                CFMutableStringAppendUnsigned(string, overrideContent->data.alpha.componentNumber);
+                CFMutableStringAppendString(string, L"a&H");
             }
-            else if(CFASSFileDialogueTextContentOverrideContentCompareStringAndPrefix(contentString,     /* fade */
-                                                                                      endPoint,
-                                                                                      L"fad") ||
-                    CFASSFileDialogueTextContentOverrideContentCompareStringAndPrefix(contentString,     /* fade complex */
-                                                                                      endPoint,
-                                                                                      L"fade"))
+            CFMutableStringAppendHex(string, overrideContent->data.alpha.transparent, 1);
+            CFMutableStringAppendCharacter(string, L'&');
+            break;
+        case CFASSFileDialogueTextContentOverrideContentTypeAlignment:
+            CFMutableStringAppendString(string, overrideContent->data.alignment.legacy ? L"\\a" : L"\\an");
+            CFMutableStringAppendUnsigned(string, overrideContent->data.alignment.position);
+            break;
+        case CFASSFileDialogueTextContentOverrideContentTypeKaraokeDuration:
+            if(overrideContent->data.karaokeDuration.hasSweepEffect)
+                CFMutableStringAppendString(string, L"\\kf");
+            else if(overrideContent->data.karaokeDuration.removeBorderOutlineBeforeHighlight)
+                CFMutableStringAppendString(string, L"\\ko");
+            else
+                CFMutableStringAppendString(string, L"\\k");
+            CFMutableStringAppendUnsigned(string, overrideContent->data.karaokeDuration.sentiSeconds);
+            break;
+        case CFASSFileDialogueTextContentOverrideContentTypeWrapingStyle:
+            CFMutableStringAppendString(string, L"\\q");
+            CFMutableStringAppendUnsigned(string, overrideContent->data.wrapStyle.style);
+            break;
+        case CFASSFileDialogueTextContentOverrideContentTypeReset:
+            CFMutableStringAppendString(string, L"\\r");
+            if(!overrideContent->data.reset.resetToDefault)
+                CFMutableStringAppendString(string, overrideContent->data.reset.styleName);
+            break;
+        case CFASSFileDialogueTextContentOverrideContentTypeAnimation:
+            CFMutableStringAppendString(string, L"\\t(");
+            if(overrideContent->data.animation.hasTimeOffset)
             {
-                unsigned int fadeInMS, fadeOutMS,
-                             beginAlpha, middleAlpha, endAlpha,
-                             fadeInBeginMS, fadeInEndMS, fadeOutBeginMS, fadeOutEndMS;
-                
-                if((temp = swscanf(contentString, L"\\fad(%u,%u)", &fadeInMS, &fadeOutMS)) == 2)
-                {
-                    result->type = CFASSFileDialogueTextContentOverrideContentTypeFade;
-                    result->data.fade.isComplexed = false;
-                    result->data.fade.fadeInMS = fadeInMS;
-                    result->data.fade.fadeOutMS = fadeOutMS;
-                    result->data.fade.beginAlpha = 0;
-                    result->data.fade.middleAlpha = 0;
-                    result->data.fade.endAlpha = 0;
-                    result->data.fade.fadeInBeginMS = 0;
-                    result->data.fade.fadeInEndMS = 0;
-                    result->data.fade.fadeOutBeginMS = 0;
-                    result->data.fade.fadeOutEndMS = 0;
-                    return result;
-                    
-                }
-                else if((temp = swscanf(contentString, L"\\fade(%u,%u,%u,%u,%u,%u,%u)",
-                                        &beginAlpha, &middleAlpha, &endAlpha,
-                                        &fadeInBeginMS, &fadeInEndMS,
-                                        &fadeOutBeginMS, &fadeOutEndMS)) == 7)
-                    if(beginAlpha<=0xFF && middleAlpha<=0xFF && endAlpha<=0xFF)
-                    {
-                        result->type = CFASSFileDialogueTextContentOverrideContentTypeFade;
-                        result->data.fade.isComplexed = true;
-                        result->data.fade.fadeInMS = fadeInMS;
-                        result->data.fade.fadeOutMS = fadeOutMS;
-                        result->data.fade.beginAlpha = beginAlpha;
-                        result->data.fade.middleAlpha = middleAlpha;
-                        result->data.fade.endAlpha = endAlpha;
-                        result->data.fade.fadeInBeginMS = fadeInBeginMS;
-                        result->data.fade.fadeInEndMS = fadeInEndMS;
-                        result->data.fade.fadeOutBeginMS = fadeOutBeginMS;
-                        result->data.fade.fadeOutEndMS = fadeOutEndMS;
-                        return result;
-                    }
+                CFMutableStringAppendUnsigned(string, overrideContent->data.animation.beginOffsetMS);
+                CFMutableStringAppendCharacter(string, L',');
+                CFMutableStringAppendUnsigned(string, overrideContent->data.animation.endOffsetMS);
+                CFMutableStringAppendCharacter(string, L',');
             }
-            else if(CFASSFileDialogueTextContentOverrideContentCompareStringAndPrefix(contentString,     /* animation */
-                                                                                      endPoint,
-                                                                                      L"t"))
+            if(overrideContent->data.animation.hasAcceleration)
             {
-                unsigned int beginOffsetMS, endOffsetMS;
-                unsigned int acceleration;
-                if((temp = swscanf(contentString, L"\\t(%u,%u,%u,\\", &beginOffsetMS, &endOffsetMS, &acceleration)) == 3)
-                {
-                    result->data.animation.hasAcceleration = true;
-                    result->data.animation.hasTimeOffset = true;
-                    result->data.animation.acceleration = acceleration;
-                    result->data.animation.beginOffsetMS = beginOffsetMS;
-                    result->data.animation.endOffsetMS = endOffsetMS;
-                }
-                else if((temp = swscanf(contentString, L"\\t(%u,%u,\\", &beginOffsetMS, &endOffsetMS)) == 2)
-                {
-                    result->data.animation.hasAcceleration = false;
-                    result->data.animation.hasTimeOffset = true;
-                    result->data.animation.beginOffsetMS = beginOffsetMS;
-                    result->data.animation.endOffsetMS = endOffsetMS;
-                }
-                else if((temp = swscanf(contentString, L"\\t(%u,\\", &acceleration)) == 1)
-                {
-                    result->data.animation.hasAcceleration = true;
-                    result->data.animation.hasTimeOffset = false;
-                    result->data.animation.acceleration = acceleration;
-                }
-                if(temp >= 1)
-                {
-                    const wchar_t *dataBeginPoint = contentString + 1;
-                    while(*dataBeginPoint != L'\\' && dataBeginPoint<endPoint) dataBeginPoint++;
-                    bool checkPoint = true;
-                    if(*dataBeginPoint == L'\\')
-                    {
-                        const wchar_t *dataEndPoint = dataBeginPoint;
-                        while(*dataEndPoint!=L')' && dataEndPoint<endPoint && checkPoint)
-                        {
-                            if(*dataEndPoint == L'(')
-                            {
-                                while(*dataEndPoint != L')' && dataEndPoint<endPoint) dataEndPoint++;
-                                if(*dataEndPoint != L')') checkPoint = false;
-                            }
-                            dataEndPoint++;
-                        }
-                        if(checkPoint && *dataEndPoint == L')')
-                        {
-                            dataEndPoint--;
-                            if((result->data.animation.modifiers = malloc(sizeof(wchar_t)*(dataEndPoint-dataBeginPoint+1+1))) != NULL)
-                            {
-                                result->type = CFASSFileDialogueTextContentOverrideContentTypeAnimation;
-                                wmemcpy(result->data.animation.modifiers, dataBeginPoint, dataEndPoint-dataBeginPoint+1);
-                                result->data.animation.modifiers[dataEndPoint-dataBeginPoint+1] = L'\0';
-                                if(CFASSFileDialogueTextContentOverrideContentCheckAnimationModifiers(result->data.animation.modifiers))
-                                    return result;
-                                free(result->data.animation.modifiers);
-                            }
-                        }
-                    }
-                }
+                CFMutableStringAppendUnsigned(string, overrideContent->data.animation.acceleration);
+                CFMutableStringAppendCharacter(string, L',');
             }
-            else if(CFASSFileDialogueTextContentOverrideContentCompareStringAndPrefix(contentString,     /* clip */
-                                                                                      endPoint,
-                                                                                      L"clip") ||
-                    CFASSFileDialogueTextContentOverrideContentCompareStringAndPrefix(contentString,     /* clip reversed */
-                                                                                      endPoint,
-                                                                                      L"iclip"))
+            CFMutableStringAppendString(string, overrideContent->data.animation.modifiers);
+            CFMutableStringAppendCharacter(string, L')');
+            break;
+        case CFASSFileDialogueTextContentOverrideContentTypeMove:
+            CFMutableStringAppendString(string, L"\\move(");
+            CFMutableStringAppendInteger(string, overrideContent->data.movement.fromX);
+            CFMutableStringAppendCharacter(string, L',');
+            CFMutableStringAppendInteger(string, overrideContent->data.movement.fromY);
+            CFMutableStringAppendCharacter(string, L',');
+            CFMutableStringAppendInteger(string, overrideContent->data.movement.toX);
+            CFMutableStringAppendCharacter(string, L',');
+            CFMutableStringAppendInteger(string, overrideContent->data.movement.toY);
+            if(overrideContent->data.movement.hasTimeControl)
             {
-                int upLeftX, upLeftY;
-                int lowRightX, lowRightY;
-                unsigned int scale;
-                const wchar_t *dataBeginPoint = NULL, *dataEndPoint;
-                bool checkMark = false;
-                if((temp = swscanf(contentString, L"\\clip(%d,%d,%d,%d)", &upLeftX, &upLeftY, &lowRightX, &lowRightY)) == 4)
-                {
-                    result->data.clip.reverse = false;
-                    result->data.clip.usingDrawingCommand = false;
-                    result->data.clip.hasScale = false;
-                    result->data.clip.upLeftX = upLeftX;
-                    result->data.clip.upLeftY = upLeftY;
-                    result->data.clip.lowRightX = lowRightX;
-                    result->data.clip.lowRightY = lowRightY;
-                    checkMark = true;
-                }
-                else if((temp = swscanf(contentString, L"\\iclip(%d,%d,%d,%d)", &upLeftX, &upLeftY, &lowRightX, &lowRightY)) == 4)
-                {
-                    result->data.clip.reverse = true;
-                    result->data.clip.usingDrawingCommand = false;
-                    result->data.clip.hasScale = false;
-                    result->data.clip.upLeftX = upLeftX;
-                    result->data.clip.upLeftY = upLeftY;
-                    result->data.clip.lowRightX = lowRightX;
-                    result->data.clip.lowRightY = lowRightY;
-                    checkMark = true;
-                }
-                else if((temp = swscanf(contentString, L"\\clip(%u,%*l[^)])", &scale)) == 1)
-                {
-                    dataBeginPoint = contentString;
-                    while (*dataBeginPoint!=L'(') dataBeginPoint++;
-                    dataBeginPoint++;
-                    result->data.clip.reverse = false;
-                    result->data.clip.usingDrawingCommand = true;
-                    result->data.clip.hasScale = true;
-                    result->data.clip.scale = scale;
-                    checkMark = true;
-                }
-                else if((temp = swscanf(contentString, L"\\iclip(%u,%*l[^)])", &scale)) == 1)
-                {
-                    dataBeginPoint = contentString;
-                    while (*dataBeginPoint!=L'(') dataBeginPoint++;
-                    dataBeginPoint++;
-                    result->data.clip.reverse = true;
-                    result->data.clip.usingDrawingCommand = true;
-                    result->data.clip.hasScale = true;
-                    result->data.clip.scale = scale;
-                    checkMark = true;
-                }
-                else if(CF_wchar_string_match_beginning(contentString, L"\\clip("))
-                {
-                    dataBeginPoint = contentString + wcslen(L"\\clip(");
-                    result->data.clip.reverse = false;
-                    result->data.clip.usingDrawingCommand = true;
-                    result->data.clip.hasScale = false;
-                    checkMark = true;
-                }
-                else if(CF_wchar_string_match_beginning(contentString, L"\\iclip("))
-                {
-                    dataBeginPoint = contentString + wcslen(L"\\iclip(");
-                    result->data.clip.reverse = true;
-                    result->data.clip.usingDrawingCommand = true;
-                    result->data.clip.hasScale = false;
-                    checkMark = true;
-                }
-                if(checkMark)       // manage clip.drawingCommand
-                {
-                    result->type = CFASSFileDialogueTextContentOverrideContentTypeClip;
-                    if(result->data.clip.usingDrawingCommand)
-                    {
-                        if(result->data.clip.hasScale)
-                        {
-                            while (*dataBeginPoint!=L',')
-                                dataBeginPoint++;
-                            if(dataBeginPoint<endPoint) dataBeginPoint++;
-                        }
-                        dataEndPoint = dataBeginPoint;
-                        while(*dataEndPoint!=L')' && dataEndPoint<endPoint) dataEndPoint++;
-                        if(*dataEndPoint == L')')
-                        {
-                            dataEndPoint--;
-                            if(dataEndPoint>=dataBeginPoint)
-                                if((result->data.clip.drawingCommand = malloc(sizeof(wchar_t)*(dataEndPoint-dataBeginPoint+1+1)))!=NULL)
-                                {
-                                    wmemcpy(result->data.clip.drawingCommand, dataBeginPoint, dataEndPoint-dataBeginPoint+1);
-                                    result->data.clip.drawingCommand[dataEndPoint-dataBeginPoint+1] = L'\0';
-                                    CFASSFileDialogueTextDrawingContextRef drawingContext;
-                                    if((drawingContext = CFASSFileDialogueTextDrawingContextCreateFromString(result->data.clip.drawingCommand)) != NULL)
-                                    {
-                                        CFASSFileDialogueTextDrawingContextDestory(drawingContext);
-                                        return result;
-                                    }
-                                    free(result->data.clip.drawingCommand);
-                                }
-                        }
-                    }
-                    else
-                    {
-                        result->data.clip.drawingCommand = NULL;
-                        return result;
-                    }
-                }
+                CFMutableStringAppendCharacter(string, L',');
+                CFMutableStringAppendUnsigned(string, overrideContent->data.movement.startFromMS);
+                CFMutableStringAppendCharacter(string, L',');
+                CFMutableStringAppendUnsigned(string, overrideContent->data.movement.endFromMS);
             }
-            else if(CFASSFileDialogueTextContentOverrideContentCompareStringAndPrefix(contentString,     /* drawing mode */
-                                                                                      endPoint,
-                                                                                      L"p"))
+            CFMutableStringAppendCharacter(string, L')');
+            break;
+        case CFASSFileDialogueTextContentOverrideContentTypePosition:
+            CFMutableStringAppendString(string, L"\\pos(");
+            CFMutableStringAppendInteger(string, overrideContent->data.position.x);
+            CFMutableStringAppendCharacter(string, L',');
+            CFMutableStringAppendInteger(string, overrideContent->data.position.y);
+            CFMutableStringAppendCharacter(string, L')');
+            break;
+        case CFASSFileDialogueTextContentOverrideContentTypeRotationOrigin:
+            CFMutableStringAppendString(string, L"\\org(");
+            CFMutableStringAppendInteger(string, overrideContent->data.rotationOrigin.x);
+            CFMutableStringAppendCharacter(string, L',');
+            CFMutableStringAppendInteger(string, overrideContent->data.rotationOrigin.y);
+            CFMutableStringAppendCharacter(string, L')');
+            break;
+        case CFASSFileDialogueTextContentOverrideContentTypeFade:
+            if(overrideContent->data.fade.isComplexed)
             {
-                unsigned int mode;
-                if((temp = swscanf(contentString, L"\\p%u", &mode)) == 1)
-                {
-                    result->type = CFASSFileDialogueTextContentOverrideContentTypeDrawing;
-                    result->data.drawing.mode = mode;
-                    return result;
-                }
+                CFMutableStringAppendString(string, L"\\fade(");
+                CFMutableStringAppendUnsigned(string, overrideContent->data.fade.beginAlpha);
+                CFMutableStringAppendCharacter(string, L',');
+                CFMutableStringAppendUnsigned(string, overrideContent->data.fade.middleAlpha);
+                CFMutableStringAppendCharacter(string, L',');
+                CFMutableStringAppendUnsigned(string, overrideContent->data.fade.endAlpha);
+                CFMutableStringAppendCharacter(string, L',');
+                CFMutableStringAppendUnsigned(string, overrideContent->data.fade.fadeInBeginMS);
+                CFMutableStringAppendCharacter(string, L',');
+                CFMutableStringAppendUnsigned(string, overrideContent->data.fade.fadeInEndMS);
+                CFMutableStringAppendCharacter(string, L',');
+                CFMutableStringAppendUnsigned(string, overrideContent->data.fade.fadeOutBeginMS);
+                CFMutableStringAppendCharacter(string, L',');
+                CFMutableStringAppendUnsigned(string, overrideContent->data.fade.fadeOutEndMS);
             }
-            else if(CFASSFileDialogueTextContentOverrideContentCompareStringAndPrefix(contentString,     /* baseline offset */
-                                                                                      endPoint,
-                                                                                      L"pbo"))
+            else
             {
-                int towardsBottomPixels;
-                if((temp = swscanf(contentString, L"\\pbo%d", &towardsBottomPixels)) == 1)
-                {
-                    result->type = CFASSFileDialogueTextContentOverrideContentTypeBaselineOffset;
-                    result->data.baselineOffset.towardsBottomPixels = towardsBottomPixels;
-                    return result;
-                }
+                CFMutableStringAppendString(string, L"\\fad(");
+                CFMutableStringAppendUnsigned(string, overrideContent->data.fade.fadeInMS);
+                CFMutableStringAppendCharacter(string, L',');
+                CFMutableStringAppendUnsigned(string, overrideContent->data.fade.fadeOutMS);
             }
-            else if(CF_wchar_string_match_beginning(contentString, L"\\fn"))                             /* font name */
+            CFMutableStringAppendCharacter(string, L')');
+            break;
+        case CFASSFileDialogueTextContentOverrideContentTypeClip:
+            CFMutableStringAppendString(string, overrideContent->data.clip.reverse ? L"\\iclip(" : L"\\clip(");
+            if(overrideContent->data.clip.usingDrawingCommand)
             {
-                const wchar_t *dataBeginPoint = contentString + wcslen(L"\\fn"), *dataEndPoint;
-                if(dataBeginPoint <= endPoint && *dataBeginPoint!=L'\\')
+                if(overrideContent->data.clip.hasScale)
                 {
-                    dataEndPoint = dataBeginPoint;
-                    while(dataEndPoint<endPoint) dataEndPoint++;
-                    if((result->data.fontName.name = malloc(sizeof(wchar_t)*(dataEndPoint-dataBeginPoint+1+1))) != NULL)
-                    {
-                        result->type = CFASSFileDialogueTextContentOverrideContentTypeFontName;
-                        wmemcpy(result->data.fontName.name, dataBeginPoint, dataEndPoint-dataBeginPoint+1);
-                        result->data.fontName.name[dataEndPoint-dataBeginPoint+1] = L'\0';
-                        return result;
-                    }
+                    CFMutableStringAppendUnsigned(string, overrideContent->data.clip.scale);
+                    CFMutableStringAppendCharacter(string, L',');
                 }
+                CFMutableStringAppendString(string, overrideContent->data.clip.drawingCommand);
             }
-            else if(CF_wchar_string_match_beginning(contentString, L"\\r"))                              /* reset */
+            else
             {
-                const wchar_t *dataBeginPoint = contentString + wcslen(L"\\r"), *dataEndPoint;
-                if(dataBeginPoint <= endPoint)
-                {
-                    dataEndPoint = dataBeginPoint;
-                    while(dataEndPoint<endPoint) dataEndPoint++;
-                    if((result->data.reset.styleName = malloc(sizeof(wchar_t)*(dataEndPoint-dataBeginPoint+1+1))) != NULL)
-                    {
-                        result->type = CFASSFileDialogueTextContentOverrideContentTypeReset;
-                        result->data.reset.resetToDefault = false;
-                        wmemcpy(result->data.reset.styleName, dataBeginPoint, dataEndPoint-dataBeginPoint+1);
-                        result->data.reset.styleName[dataEndPoint-dataBeginPoint+1] = L'\0';
-                        return result;
-                    }
-                }
-                else
-                {
-                    result->type = CFASSFileDialogueTextContentOverrideContentTypeReset;
-                    result->data.reset.resetToDefault = true;
-                    result->data.reset.styleName = NULL;
-                    return result;
-                }
+                CFMutableStringAppendInteger(string, overrideContent->data.clip.upLeftX);
+                CFMutableStringAppendCharacter(string, L',');
+                CFMutableStringAppendInteger(string, overrideContent->data.clip.upLeftY);
+                CFMutableStringAppendCharacter(string, L',');
+                CFMutableStringAppendInteger(string, overrideContent->data.clip.lowRightX);
+                CFMutableStringAppendCharacter(string, L',');
+                CFMutableStringAppendInteger(string, overrideContent->data.clip.lowRightY);
             }
-            free(result);
-        }
-    }
-    return NULL;
-}
-
-static bool CFASSFileDialogueTextContentOverrideContentCompareStringAndPrefix(const wchar_t *contentString,
-                                                                              const wchar_t *endPoint,
-                                                                              const wchar_t *matchAlpha)
-{
-    if(*contentString != L'\\') return false;
-    contentString++;
-    const wchar_t *searchEnd = contentString - 1;
-    while(iswalpha(searchEnd[1])) searchEnd++;
-    if(searchEnd<contentString) return false;
-    while (contentString <= searchEnd)
-        if(*matchAlpha++ != *contentString++) return false;
-    if(*matchAlpha != L'\0') return false;
-    return true;
-}
-
-int CFASSFileDialogueTextContentOverrideContentStoreStringResult(CFASSFileDialogueTextContentOverrideContentRef overrideContent, wchar_t *targetPoint)
-{
-    int result = -1;
-    unsigned long colorInfo;
-    if(targetPoint == NULL)
-    {
-        FILE *fp = tmpfile();
-        if(fp == NULL) return -1;
-        
-        switch (overrideContent->type) {
-            case CFASSFileDialogueTextContentOverrideContentTypeBlod:
-                result = fwprintf(fp, L"\\b%u", overrideContent->data.blod.weight);
-                break;
-            case CFASSFileDialogueTextContentOverrideContentTypeItalic:
-                result = fwprintf(fp, L"\\i%lc", overrideContent->data.italic.isItalic?L'1':L'0');
-                break;
-            case CFASSFileDialogueTextContentOverrideContentTypeUnderline:
-                result = fwprintf(fp, L"\\u%lc", overrideContent->data.underline.isUnderline?L'1':L'0');
-                break;
-            case CFASSFileDialogueTextContentOverrideContentTypeStrikeOut:
-                result = fwprintf(fp, L"\\u%lc", overrideContent->data.underline.isUnderline?L'1':L'0');
-                break;
-            case CFASSFileDialogueTextContentOverrideContentTypeBorder:
-                if(overrideContent->data.border.usingComplexed)
-                    result = fwprintf(fp, L"\\%lcbord%g",
-                                      overrideContent->data.border.axis == CF2DAxisX?L'x':L'y',
-                                      overrideContent->data.border.resolutionPixels);
-                else
-                    result = fwprintf(fp, L"\\bord%g", overrideContent->data.border.resolutionPixels);
-                break;
-            case CFASSFileDialogueTextContentOverrideContentTypeShadow:
-                if(overrideContent->data.shadow.usingComplexed)
-                    result = fwprintf(fp, L"\\%lcshad%g",
-                                      overrideContent->data.shadow.axis == CF2DAxisX ? L'x':L'y',
-                                      overrideContent->data.shadow.depth);
-                else
-                    result = fwprintf(fp, L"\\shad%g", overrideContent->data.shadow.depth);
-                break;
-            case CFASSFileDialogueTextContentOverrideContentTypeBlurEdge:
-                if(overrideContent->data.blurEdge.usingGuassian)
-                    result = fwprintf(fp, L"\\blur%u", overrideContent->data.blurEdge.strength);
-                else
-                    result = fwprintf(fp, L"\\be%u", overrideContent->data.blurEdge.strength);
-                break;
-            case CFASSFileDialogueTextContentOverrideContentTypeFontName:
-                result = fwprintf(fp, L"\\fn%ls", overrideContent->data.fontName.name);
-                break;
-            case CFASSFileDialogueTextContentOverrideContentTypeFontSize:
-                result = fwprintf(fp, L"\\fs%u", overrideContent->data.fontSize.resolutionPixels);
-                break;
-            case CFASSFileDialogueTextContentOverrideContentTypeFontScale:
-                result = fwprintf(fp, L"\\fsc%lc%u",
-                                  overrideContent->data.fontScale.axis == CF2DAxisX?L'x':L'y',
-                                  overrideContent->data.fontScale.percentage);
-                break;
-            case CFASSFileDialogueTextContentOverrideContentTypeFontSpacing:
-                result = fwprintf(fp, L"\\fsp%g", overrideContent->data.spacing.resolutionPixels);
-                break;
-            case CFASSFileDialogueTextContentOverrideContentTypeTextRotation:
-                if(overrideContent->data.rotation.usingComplexed)
-                    result = fwprintf(fp, L"\\fr%lc%d",
-                                      overrideContent->data.rotation.axis == CF3DAxisX?L'x':
-                                      overrideContent->data.rotation.axis == CF3DAxisY?L'y':L'z',
-                                      overrideContent->data.rotation.degrees);
-                else
-                    result = fwprintf(fp, L"\\fr%d", overrideContent->data.rotation.degrees);
-                break;
-            case CFASSFileDialogueTextContentOverrideContentTypeTextShearing:
-                result = fwprintf(fp, L"\\fa%lc%g",
-                                  overrideContent->data.shearing.axis == CF2DAxisX?L'x':L'y',
-                                  overrideContent->data.shearing.factor);
-                break;
-            case CFASSFileDialogueTextContentOverrideContentTypeTextEncoding:
-                result = fwprintf(fp, L"\\fe%u", overrideContent->data.fontEncoding.identifier);
-                break;
-            case CFASSFileDialogueTextContentOverrideContentTypeColor:
-                colorInfo =
-                      overrideContent->data.color.red
-                    + overrideContent->data.color.green*(0xFF+1)
-                    + overrideContent->data.color.blue *(0xFFFF+1);
-                if(overrideContent->data.color.usingComplexed)
-                    result = fwprintf(fp, L"\\%uc&H%lX&",
-                                      overrideContent->data.color.componentNumber,
-                                      colorInfo);
-                else
-                    result = fwprintf(fp, L"\\c&H%lX&", colorInfo);
-                break;
-            case CFASSFileDialogueTextContentOverrideContentTypeAlpha:
-                if(overrideContent->data.alpha.setAllComponent)
-                    result = fwprintf(fp, L"\\alpha&H%X&", (unsigned int)overrideContent->data.alpha.transparent);
-                else
-                    result = fwprintf(fp, L"\\%ua&H%X&",
-                                      overrideContent->data.alpha.componentNumber,
-                                      (unsigned int)overrideContent->data.alpha.transparent);
-                break;
-            case CFASSFileDialogueTextContentOverrideContentTypeAlignment:
-                if(overrideContent->data.alignment.legacy)
-                    result = fwprintf(fp, L"\\a%u", overrideContent->data.alignment.position);
-                else
-                    result = fwprintf(fp, L"\\an%u", overrideContent->data.alignment.position);
-                break;
-            case CFASSFileDialogueTextContentOverrideContentTypeKaraokeDuration:
-                if(overrideContent->data.karaokeDuration.hasSweepEffect)
-                    result = fwprintf(fp, L"\\kf%u", overrideContent->data.karaokeDuration.sentiSeconds);
-                else if(overrideContent->data.karaokeDuration.removeBorderOutlineBeforeHighlight)
-                    result = fwprintf(fp, L"\\ko%u", overrideContent->data.karaokeDuration.sentiSeconds);
-                else
-                    result = fwprintf(fp, L"\\k%u", overrideContent->data.karaokeDuration.sentiSeconds);
-                break;
-            case CFASSFileDialogueTextContentOverrideContentTypeWrapingStyle:
-                result = fwprintf(fp, L"\\q%u", overrideContent->data.wrapStyle.style);
-                break;
-            case CFASSFileDialogueTextContentOverrideContentTypeReset:
-                if(overrideContent->data.reset.resetToDefault)
-                    result = fwprintf(fp, L"\\r");
-                else
-                    result = fwprintf(fp, L"\\r%ls", overrideContent->data.reset.styleName);
-                break;
-            case CFASSFileDialogueTextContentOverrideContentTypeAnimation:
-                if(overrideContent->data.animation.hasTimeOffset && overrideContent->data.animation.hasAcceleration)
-                    result = fwprintf(fp, L"\\t(%u,%u,%u,%ls)",
-                                      overrideContent->data.animation.beginOffsetMS,
-                                      overrideContent->data.animation.endOffsetMS,
-                                      overrideContent->data.animation.acceleration,
-                                      overrideContent->data.animation.modifiers);
-                else if(overrideContent->data.animation.hasTimeOffset && !overrideContent->data.animation.hasAcceleration)
-                    result = fwprintf(fp, L"\\t(%u,%u,%ls)",
-                                      overrideContent->data.animation.beginOffsetMS,
-                                      overrideContent->data.animation.endOffsetMS,
-                                      overrideContent->data.animation.modifiers);
-                else if(!overrideContent->data.animation.hasTimeOffset && overrideContent->data.animation.hasAcceleration)
-                    result = fwprintf(fp, L"\\t(%u,%ls)",
-                                      overrideContent->data.animation.acceleration,
-                                      overrideContent->data.animation.modifiers);
-                else
-                    result = fwprintf(fp, L"\\t(%ls)", overrideContent->data.animation.modifiers);
-                break;
-            case CFASSFileDialogueTextContentOverrideContentTypeMove:
-                if(overrideContent->data.movement.hasTimeControl)
-                    result = fwprintf(fp, L"\\move(%d,%d,%d,%d,%u,%u)",
-                                      overrideContent->data.movement.fromX,
-                                      overrideContent->data.movement.fromY,
-                                      overrideContent->data.movement.toX,
-                                      overrideContent->data.movement.toY,
-                                      overrideContent->data.movement.startFromMS,
-                                      overrideContent->data.movement.endFromMS);
-                else
-                    result = fwprintf(fp, L"\\move(%d,%d,%d,%d)",
-                                      overrideContent->data.movement.fromX,
-                                      overrideContent->data.movement.fromY,
-                                      overrideContent->data.movement.toX,
-                                      overrideContent->data.movement.toY);
-                break;
-            case CFASSFileDialogueTextContentOverrideContentTypePosition:
-                result = fwprintf(fp, L"\\pos(%d,%d)", overrideContent->data.position.x, overrideContent->data.position.y);
-                break;
-            case CFASSFileDialogueTextContentOverrideContentTypeRotationOrigin:
-                result = fwprintf(fp, L"\\org(%d,%d)",
-                                  overrideContent->data.rotationOrigin.x,
-                                  overrideContent->data.rotationOrigin.y);
-                break;
-            case CFASSFileDialogueTextContentOverrideContentTypeFade:
-                if(overrideContent->data.fade.isComplexed)
-                    result = fwprintf(fp, L"\\fade(%u,%u,%u,%u,%u,%u,%u)",
-                                      (unsigned int)overrideContent->data.fade.beginAlpha,
-                                      (unsigned int)overrideContent->data.fade.middleAlpha,
-                                      (unsigned int)overrideContent->data.fade.endAlpha,
-                                      overrideContent->data.fade.fadeInBeginMS,
-                                      overrideContent->data.fade.fadeInEndMS,
-                                      overrideContent->data.fade.fadeOutBeginMS,
-                                      overrideContent->data.fade.fadeOutEndMS);
-                else
-                    result = fwprintf(fp, L"\\fad(%u,%u)",
-                                      overrideContent->data.fade.fadeInMS,
-                                      overrideContent->data.fade.fadeOutMS);
-                break;
-            case CFASSFileDialogueTextContentOverrideContentTypeClip:
-                if(overrideContent->data.clip.usingDrawingCommand)
-                    if(overrideContent->data.clip.hasScale)
-                        result = fwprintf(fp, L"\\%lsclip(%u,%ls)",
-                                          overrideContent->data.clip.reverse?L"i":L"",
-                                          overrideContent->data.clip.scale,
-                                          overrideContent->data.clip.drawingCommand);
-                    else
-                        result = fwprintf(fp, L"\\%lsclip(%ls)",
-                                          overrideContent->data.clip.reverse?L"i":L"",
-                                          overrideContent->data.clip.drawingCommand);
-                else
-                    result = fwprintf(fp, L"\\%lsclip(%d,%d,%d,%d)",
-                                      overrideContent->data.clip.reverse?L"i":L"",
-                                      overrideContent->data.clip.upLeftX,
-                                      overrideContent->data.clip.upLeftY,
-                                      overrideContent->data.clip.lowRightX,
-                                      overrideContent->data.clip.lowRightY);
-                break;
-            case CFASSFileDialogueTextContentOverrideContentTypeDrawing:
-                result = fwprintf(fp, L"\\p%u", overrideContent->data.drawing.mode);
-                break;
-            case CFASSFileDialogueTextContentOverrideContentTypeBaselineOffset:
-                result = fwprintf(fp, L"\\pbo%d", overrideContent->data.baselineOffset.towardsBottomPixels);
-                break;
-        }
-        fclose(fp);
+            CFMutableStringAppendCharacter(string, L')');
+            break;
+        case CFASSFileDialogueTextContentOverrideContentTypeDrawing:
+            CFMutableStringAppendString(string, L"\\p");
+            CFMutableStringAppendUnsigned(string, overrideContent->data.drawing.mode);
+            break;
+        case CFASSFileDialogueTextContentOverrideContentTypeBaselineOffset:
+            CFMutableStringAppendString(string, L"\\pbo");
+            CFMutableStringAppendInteger(string, overrideContent->data.baselineOffset.towardsBottomPixels);
+            break;
     }
-    else
-        switch (overrideContent->type) {
-            case CFASSFileDialogueTextContentOverrideContentTypeBlod:
-                result = swprintf(targetPoint,SIZE_MAX, L"\\b%u", overrideContent->data.blod.weight);
-                break;
-            case CFASSFileDialogueTextContentOverrideContentTypeItalic:
-                result = swprintf(targetPoint,SIZE_MAX, L"\\i%lc", overrideContent->data.italic.isItalic?L'1':L'0');
-                break;
-            case CFASSFileDialogueTextContentOverrideContentTypeUnderline:
-                result = swprintf(targetPoint,SIZE_MAX, L"\\u%lc", overrideContent->data.underline.isUnderline?L'1':L'0');
-                break;
-            case CFASSFileDialogueTextContentOverrideContentTypeStrikeOut:
-                result = swprintf(targetPoint,SIZE_MAX, L"\\u%lc", overrideContent->data.underline.isUnderline?L'1':L'0');
-                break;
-            case CFASSFileDialogueTextContentOverrideContentTypeBorder:
-                if(overrideContent->data.border.usingComplexed)
-                    result = swprintf(targetPoint,SIZE_MAX, L"\\%lcbord%g",
-                                      overrideContent->data.border.axis == CF2DAxisX?L'x':L'y',
-                                      overrideContent->data.border.resolutionPixels);
-                else
-                    result = swprintf(targetPoint,SIZE_MAX, L"\\bord%g", overrideContent->data.border.resolutionPixels);
-                break;
-            case CFASSFileDialogueTextContentOverrideContentTypeShadow:
-                if(overrideContent->data.shadow.usingComplexed)
-                    result = swprintf(targetPoint,SIZE_MAX, L"\\%lcshad%g",
-                                      overrideContent->data.shadow.axis == CF2DAxisX ? L'x':L'y',
-                                      overrideContent->data.shadow.depth);
-                else
-                    result = swprintf(targetPoint,SIZE_MAX, L"\\shad%g", overrideContent->data.shadow.depth);
-                break;
-            case CFASSFileDialogueTextContentOverrideContentTypeBlurEdge:
-                if(overrideContent->data.blurEdge.usingGuassian)
-                    result = swprintf(targetPoint,SIZE_MAX, L"\\blur%u", overrideContent->data.blurEdge.strength);
-                else
-                    result = swprintf(targetPoint,SIZE_MAX, L"\\be%u", overrideContent->data.blurEdge.strength);
-                break;
-            case CFASSFileDialogueTextContentOverrideContentTypeFontName:
-                result = swprintf(targetPoint,SIZE_MAX, L"\\fn%ls", overrideContent->data.fontName.name);
-                break;
-            case CFASSFileDialogueTextContentOverrideContentTypeFontSize:
-                result = swprintf(targetPoint,SIZE_MAX, L"\\fs%u", overrideContent->data.fontSize.resolutionPixels);
-                break;
-            case CFASSFileDialogueTextContentOverrideContentTypeFontScale:
-                result = swprintf(targetPoint,SIZE_MAX, L"\\fsc%lc%u",
-                                  overrideContent->data.fontScale.axis == CF2DAxisX?L'x':L'y',
-                                  overrideContent->data.fontScale.percentage);
-                break;
-            case CFASSFileDialogueTextContentOverrideContentTypeFontSpacing:
-                result = swprintf(targetPoint,SIZE_MAX, L"\\fsp%g", overrideContent->data.spacing.resolutionPixels);
-                break;
-            case CFASSFileDialogueTextContentOverrideContentTypeTextRotation:
-                if(overrideContent->data.rotation.usingComplexed)
-                    result = swprintf(targetPoint,SIZE_MAX, L"\\fr%lc%d",
-                                      overrideContent->data.rotation.axis == CF3DAxisX?L'x':
-                                      overrideContent->data.rotation.axis == CF3DAxisY?L'y':L'z',
-                                      overrideContent->data.rotation.degrees);
-                else
-                    result = swprintf(targetPoint,SIZE_MAX, L"\\fr%d", overrideContent->data.rotation.degrees);
-                break;
-            case CFASSFileDialogueTextContentOverrideContentTypeTextShearing:
-                result = swprintf(targetPoint,SIZE_MAX, L"\\fa%lc%g",
-                                  overrideContent->data.shearing.axis == CF2DAxisX?L'x':L'y',
-                                  overrideContent->data.shearing.factor);
-                break;
-            case CFASSFileDialogueTextContentOverrideContentTypeTextEncoding:
-                result = swprintf(targetPoint,SIZE_MAX, L"\\fe%u", overrideContent->data.fontEncoding.identifier);
-                break;
-            case CFASSFileDialogueTextContentOverrideContentTypeColor:
-                colorInfo =
-                overrideContent->data.color.red
-                + overrideContent->data.color.green*(0xFF+1)
-                + overrideContent->data.color.blue *(0xFFFF+1);
-                if(overrideContent->data.color.usingComplexed)
-                    result = swprintf(targetPoint,SIZE_MAX, L"\\%uc&H%lX&",
-                                      overrideContent->data.color.componentNumber,
-                                      colorInfo);
-                else
-                    result = swprintf(targetPoint,SIZE_MAX, L"\\c&H%lX&", colorInfo);
-                break;
-            case CFASSFileDialogueTextContentOverrideContentTypeAlpha:
-                if(overrideContent->data.alpha.setAllComponent)
-                    result = swprintf(targetPoint,SIZE_MAX, L"\\alpha&H%X&", (unsigned int)overrideContent->data.alpha.transparent);
-                else
-                    result = swprintf(targetPoint,SIZE_MAX, L"\\%ua&H%X&",
-                                      overrideContent->data.alpha.componentNumber,
-                                      (unsigned int)overrideContent->data.alpha.transparent);
-                break;
-            case CFASSFileDialogueTextContentOverrideContentTypeAlignment:
-                if(overrideContent->data.alignment.legacy)
-                    result = swprintf(targetPoint,SIZE_MAX, L"\\a%u", overrideContent->data.alignment.position);
-                else
-                    result = swprintf(targetPoint,SIZE_MAX, L"\\an%u", overrideContent->data.alignment.position);
-                break;
-            case CFASSFileDialogueTextContentOverrideContentTypeKaraokeDuration:
-                if(overrideContent->data.karaokeDuration.hasSweepEffect)
-                    result = swprintf(targetPoint,SIZE_MAX, L"\\kf%u", overrideContent->data.karaokeDuration.sentiSeconds);
-                else if(overrideContent->data.karaokeDuration.removeBorderOutlineBeforeHighlight)
-                    result = swprintf(targetPoint,SIZE_MAX, L"\\ko%u", overrideContent->data.karaokeDuration.sentiSeconds);
-                else
-                    result = swprintf(targetPoint,SIZE_MAX, L"\\k%u", overrideContent->data.karaokeDuration.sentiSeconds);
-                break;
-            case CFASSFileDialogueTextContentOverrideContentTypeWrapingStyle:
-                result = swprintf(targetPoint,SIZE_MAX, L"\\q%u", overrideContent->data.wrapStyle.style);
-                break;
-            case CFASSFileDialogueTextContentOverrideContentTypeReset:
-                if(overrideContent->data.reset.resetToDefault)
-                    result = swprintf(targetPoint,SIZE_MAX, L"\\r");
-                else
-                    result = swprintf(targetPoint,SIZE_MAX, L"\\r%ls", overrideContent->data.reset.styleName);
-                break;
-            case CFASSFileDialogueTextContentOverrideContentTypeAnimation:
-                if(overrideContent->data.animation.hasTimeOffset && overrideContent->data.animation.hasAcceleration)
-                    result = swprintf(targetPoint,SIZE_MAX, L"\\t(%u,%u,%u,%ls)",
-                                      overrideContent->data.animation.beginOffsetMS,
-                                      overrideContent->data.animation.endOffsetMS,
-                                      overrideContent->data.animation.acceleration,
-                                      overrideContent->data.animation.modifiers);
-                else if(overrideContent->data.animation.hasTimeOffset && !overrideContent->data.animation.hasAcceleration)
-                    result = swprintf(targetPoint,SIZE_MAX, L"\\t(%u,%u,%ls)",
-                                      overrideContent->data.animation.beginOffsetMS,
-                                      overrideContent->data.animation.endOffsetMS,
-                                      overrideContent->data.animation.modifiers);
-                else if(!overrideContent->data.animation.hasTimeOffset && overrideContent->data.animation.hasAcceleration)
-                    result = swprintf(targetPoint,SIZE_MAX, L"\\t(%u,%ls)",
-                                      overrideContent->data.animation.acceleration,
-                                      overrideContent->data.animation.modifiers);
-                else
-                    result = swprintf(targetPoint,SIZE_MAX, L"\\t(%ls)", overrideContent->data.animation.modifiers);
-                break;
-            case CFASSFileDialogueTextContentOverrideContentTypeMove:
-                if(overrideContent->data.movement.hasTimeControl)
-                    result = swprintf(targetPoint,SIZE_MAX, L"\\move(%d,%d,%d,%d,%u,%u)",
-                                      overrideContent->data.movement.fromX,
-                                      overrideContent->data.movement.fromY,
-                                      overrideContent->data.movement.toX,
-                                      overrideContent->data.movement.toY,
-                                      overrideContent->data.movement.startFromMS,
-                                      overrideContent->data.movement.endFromMS);
-                else
-                    result = swprintf(targetPoint,SIZE_MAX, L"\\move(%d,%d,%d,%d)",
-                                      overrideContent->data.movement.fromX,
-                                      overrideContent->data.movement.fromY,
-                                      overrideContent->data.movement.toX,
-                                      overrideContent->data.movement.toY);
-                break;
-            case CFASSFileDialogueTextContentOverrideContentTypePosition:
-                result = swprintf(targetPoint,SIZE_MAX, L"\\pos(%d,%d)", overrideContent->data.position.x, overrideContent->data.position.y);
-                break;
-            case CFASSFileDialogueTextContentOverrideContentTypeRotationOrigin:
-                result = swprintf(targetPoint,SIZE_MAX, L"\\org(%d,%d)",
-                                  overrideContent->data.rotationOrigin.x,
-                                  overrideContent->data.rotationOrigin.y);
-                break;
-            case CFASSFileDialogueTextContentOverrideContentTypeFade:
-                if(overrideContent->data.fade.isComplexed)
-                    result = swprintf(targetPoint,SIZE_MAX, L"\\fade(%u,%u,%u,%u,%u,%u,%u)",
-                                      (unsigned int)overrideContent->data.fade.beginAlpha,
-                                      (unsigned int)overrideContent->data.fade.middleAlpha,
-                                      (unsigned int)overrideContent->data.fade.endAlpha,
-                                      overrideContent->data.fade.fadeInBeginMS,
-                                      overrideContent->data.fade.fadeInEndMS,
-                                      overrideContent->data.fade.fadeOutBeginMS,
-                                      overrideContent->data.fade.fadeOutEndMS);
-                else
-                    result = swprintf(targetPoint,SIZE_MAX, L"\\fad(%u,%u)",
-                                      overrideContent->data.fade.fadeInMS,
-                                      overrideContent->data.fade.fadeOutMS);
-                break;
-            case CFASSFileDialogueTextContentOverrideContentTypeClip:
-                if(overrideContent->data.clip.usingDrawingCommand)
-                    if(overrideContent->data.clip.hasScale)
-                        result = swprintf(targetPoint,SIZE_MAX, L"\\%lsclip(%u,%ls)",
-                                          overrideContent->data.clip.reverse?L"i":L"",
-                                          overrideContent->data.clip.scale,
-                                          overrideContent->data.clip.drawingCommand);
-                    else
-                        result = swprintf(targetPoint,SIZE_MAX, L"\\%lsclip(%ls)",
-                                          overrideContent->data.clip.reverse?L"i":L"",
-                                          overrideContent->data.clip.drawingCommand);
-                    else
-                        result = swprintf(targetPoint,SIZE_MAX, L"\\%lsclip(%d,%d,%d,%d)",
-                                          overrideContent->data.clip.reverse?L"i":L"",
-                                          overrideContent->data.clip.upLeftX,
-                                          overrideContent->data.clip.upLeftY,
-                                          overrideContent->data.clip.lowRightX,
-                                          overrideContent->data.clip.lowRightY);
-                break;
-            case CFASSFileDialogueTextContentOverrideContentTypeDrawing:
-                result = swprintf(targetPoint,SIZE_MAX, L"\\p%u", overrideContent->data.drawing.mode);
-                break;
-            case CFASSFileDialogueTextContentOverrideContentTypeBaselineOffset:
-                result = swprintf(targetPoint,SIZE_MAX, L"\\pbo%d", overrideContent->data.baselineOffset.towardsBottomPixels);
-                break;
-        }
-    if(result < 0) return -1;
-    return result;
+    return CFMutableStringIsFailed(string) ? -1 : 0;
 }
 
 void CFASSFileDialogueTextContentOverrideContentDestory(CFASSFileDialogueTextContentOverrideContentRef overrideContent)
@@ -1788,6 +1814,7 @@ CFASSFileDialogueTextContentOverrideContentRef CFASSFileDialogueTextContentOverr
     if((result = malloc(sizeof(struct CFASSFileDialogueTextContentOverrideContent))) != NULL)
     {
         result->type = CFASSFileDialogueTextContentOverrideContentTypeClip;
+        result->data.clip.reverse = reverse;
         result->data.clip.usingDrawingCommand = usingDrawingCommand;
         result->data.clip.hasScale = hasScale;
         result->data.clip.upLeftX = upLeftX;
@@ -1835,6 +1862,13 @@ CFASSFileDialogueTextContentOverrideContentRef CFASSFileDialogueTextContentOverr
 
 #pragma mark - Other function
 
+CFASSFileDialogueTextContentOverrideContentType CFASSFileDialogueTextContentOverrideContentGetType(CFASSFileDialogueTextContentOverrideContentRef overrideContent)
+{
+    if(overrideContent == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTextContentOverrideContent NULL GetType");
+    return overrideContent->type;
+}
+
 void CFASSFileDialogueTextContentOverrideContentMakeChange(CFASSFileDialogueTextContentOverrideContentRef overrideContent, CFASSFileChangeRef change)
 {
     if(overrideContent == NULL || change == NULL)
@@ -1851,7 +1885,7 @@ void CFASSFileDialogueTextContentOverrideContentMakeChange(CFASSFileDialogueText
     }
     if(change->type & CFASSFileChangeTypeFontName)
     {
-        if(overrideContent->type == CFASSFileDialogueTextContentOverrideContentTypeFontName && change->fontSize.affectOverride)
+        if(overrideContent->type == CFASSFileDialogueTextContentOverrideContentTypeFontName && change->fontName.affectOverride)
         {
             wchar_t *dumped = CF_Dump_wchar_string(change->fontName.fontName);
             if(dumped != NULL)
@@ -1958,3 +1992,395 @@ static bool CFASSFileDialogueTextContentOverrideContentCheckAnimationModifierSup
 
 
 
+
+#pragma mark - Rasterize Clip
+
+int CFASSFileDialogueTextContentOverrideContentRasterizeClip(CFASSFileDialogueTextContentOverrideContentRef overrideContent,
+                                                             unsigned char *coverage,
+                                                             size_t width, size_t height, size_t bytesPerRow,
+                                                             unsigned int threadAmount)
+{
+    if(overrideContent == NULL || coverage == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTextContentOverrideContent %p RasterizeClip coverage %p", overrideContent, coverage);
+    if(overrideContent->type != CFASSFileDialogueTextContentOverrideContentTypeClip)
+        return -1;
+    int result = -1;
+    if(overrideContent->data.clip.usingDrawingCommand)
+    {
+        // scale n means drawing unit is 1 / 2^(n-1) pixel, the same as \p
+        double scale = 1;
+        if(overrideContent->data.clip.hasScale && overrideContent->data.clip.scale > 1)
+            scale = ldexp(1, -(int)(overrideContent->data.clip.scale - 1));
+        CFASSFileDialogueTextDrawingContextRef drawingContext;
+        if((drawingContext = CFASSFileDialogueTextDrawingContextCreateFromString(overrideContent->data.clip.drawingCommand)) != NULL)
+        {
+            result = CFASSFileDialogueTextDrawingRasterizerFillDrawing(drawingContext, scale, scale, 0, 0,
+                                                                       CFASSFileDialogueTextDrawingRasterizerFillRuleNonZero,
+                                                                       coverage, width, height, bytesPerRow, threadAmount);
+            CFASSFileDialogueTextDrawingContextDestory(drawingContext);
+        }
+    }
+    else
+    {
+        double minX = overrideContent->data.clip.upLeftX, maxX = overrideContent->data.clip.lowRightX,
+               minY = overrideContent->data.clip.upLeftY, maxY = overrideContent->data.clip.lowRightY;
+        CFPoint points[4] = {{.x = minX, .y = minY}, {.x = maxX, .y = minY}, {.x = maxX, .y = maxY}, {.x = minX, .y = maxY}};
+        size_t figureEnd = 4;
+        result = CFASSFileDialogueTextDrawingRasterizerFillPolygon(points, &figureEnd, 1,
+                                                                   CFASSFileDialogueTextDrawingRasterizerFillRuleNonZero,
+                                                                   coverage, width, height, bytesPerRow, threadAmount);
+    }
+    if(result == 0 && overrideContent->data.clip.reverse)
+        for(size_t row = 0; row < height; row++)
+        {
+            unsigned char *rowCoverage = coverage + row * bytesPerRow;
+            for(size_t pixel = 0; pixel < width; pixel++)
+                rowCoverage[pixel] = 255 - rowCoverage[pixel];
+        }
+    return result;
+}
+
+#pragma mark - Evaluation
+
+static unsigned int CFASSFileDialogueTextContentOverrideContentGetAxisProperties(bool usingComplexed, CF2DAxis axis,
+                                                                                 CFASSFileDialogueTextContentOverrideContentProperty propertyX,
+                                                                                 CFASSFileDialogueTextContentOverrideContentProperty propertyY,
+                                                                                 double value,
+                                                                                 CFASSFileDialogueTextContentOverrideContentProperty *properties,
+                                                                                 double *values)
+{
+    if(usingComplexed)
+    {
+        properties[0] = axis == CF2DAxisX ? propertyX : propertyY;
+        values[0] = value;
+        return 1;
+    }
+    properties[0] = propertyX;
+    properties[1] = propertyY;
+    values[0] = values[1] = value;
+    return 2;
+}
+
+unsigned int CFASSFileDialogueTextContentOverrideContentGetProperties(CFASSFileDialogueTextContentOverrideContentRef overrideContent,
+                                                                      CFASSFileDialogueTextContentOverrideContentProperty *properties,
+                                                                      double *values)
+{
+    if(overrideContent == NULL || properties == NULL || values == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTextContentOverrideContent %p GetProperties %p %p", overrideContent, properties, values);
+    switch (overrideContent->type) {
+        case CFASSFileDialogueTextContentOverrideContentTypeFontSize:
+            properties[0] = CFASSFileDialogueTextContentOverrideContentPropertyFontSize;
+            values[0] = overrideContent->data.fontSize.resolutionPixels;
+            return 1;
+        case CFASSFileDialogueTextContentOverrideContentTypeFontScale:
+            return CFASSFileDialogueTextContentOverrideContentGetAxisProperties(true, overrideContent->data.fontScale.axis,
+                                                                                CFASSFileDialogueTextContentOverrideContentPropertyFontScaleX,
+                                                                                CFASSFileDialogueTextContentOverrideContentPropertyFontScaleY,
+                                                                                overrideContent->data.fontScale.percentage,
+                                                                                properties, values);
+        case CFASSFileDialogueTextContentOverrideContentTypeFontSpacing:
+            properties[0] = CFASSFileDialogueTextContentOverrideContentPropertyFontSpacing;
+            values[0] = overrideContent->data.spacing.resolutionPixels;
+            return 1;
+        case CFASSFileDialogueTextContentOverrideContentTypeTextRotation:
+            // \fr is \frz
+            if(!overrideContent->data.rotation.usingComplexed || overrideContent->data.rotation.axis == CF3DAxisZ)
+                properties[0] = CFASSFileDialogueTextContentOverrideContentPropertyRotationZ;
+            else if(overrideContent->data.rotation.axis == CF3DAxisX)
+                properties[0] = CFASSFileDialogueTextContentOverrideContentPropertyRotationX;
+            else
+                properties[0] = CFASSFileDialogueTextContentOverrideContentPropertyRotationY;
+            values[0] = overrideContent->data.rotation.degrees;
+            return 1;
+        case CFASSFileDialogueTextContentOverrideContentTypeTextShearing:
+            return CFASSFileDialogueTextContentOverrideContentGetAxisProperties(true, overrideContent->data.shearing.axis,
+                                                                                CFASSFileDialogueTextContentOverrideContentPropertyShearingX,
+                                                                                CFASSFileDialogueTextContentOverrideContentPropertyShearingY,
+                                                                                overrideContent->data.shearing.factor,
+                                                                                properties, values);
+        case CFASSFileDialogueTextContentOverrideContentTypeBorder:
+            return CFASSFileDialogueTextContentOverrideContentGetAxisProperties(overrideContent->data.border.usingComplexed, overrideContent->data.border.axis,
+                                                                                CFASSFileDialogueTextContentOverrideContentPropertyBorderX,
+                                                                                CFASSFileDialogueTextContentOverrideContentPropertyBorderY,
+                                                                                overrideContent->data.border.resolutionPixels,
+                                                                                properties, values);
+        case CFASSFileDialogueTextContentOverrideContentTypeShadow:
+            return CFASSFileDialogueTextContentOverrideContentGetAxisProperties(overrideContent->data.shadow.usingComplexed, overrideContent->data.shadow.axis,
+                                                                                CFASSFileDialogueTextContentOverrideContentPropertyShadowX,
+                                                                                CFASSFileDialogueTextContentOverrideContentPropertyShadowY,
+                                                                                overrideContent->data.shadow.depth,
+                                                                                properties, values);
+        case CFASSFileDialogueTextContentOverrideContentTypeBlurEdge:
+            properties[0] = overrideContent->data.blurEdge.usingGuassian ? CFASSFileDialogueTextContentOverrideContentPropertyBlur : CFASSFileDialogueTextContentOverrideContentPropertyBlurEdge;
+            values[0] = overrideContent->data.blurEdge.strength;
+            return 1;
+        case CFASSFileDialogueTextContentOverrideContentTypeColor:
+        {
+            // \c is \1c
+            unsigned int component = overrideContent->data.color.componentNumber > 0 ? overrideContent->data.color.componentNumber - 1 : 0;
+            CFASSFileDialogueTextContentOverrideContentProperty first = CFASSFileDialogueTextContentOverrideContentPropertyColor + 3 * component;
+            properties[0] = first;
+            properties[1] = first + 1;
+            properties[2] = first + 2;
+            values[0] = overrideContent->data.color.blue;
+            values[1] = overrideContent->data.color.green;
+            values[2] = overrideContent->data.color.red;
+            return 3;
+        }
+        case CFASSFileDialogueTextContentOverrideContentTypeAlpha:
+            if(overrideContent->data.alpha.setAllComponent)
+            {
+                for(unsigned int index = 0; index < 4; index++)
+                {
+                    properties[index] = CFASSFileDialogueTextContentOverrideContentPropertyAlpha + index;
+                    values[index] = overrideContent->data.alpha.transparent;
+                }
+                return 4;
+            }
+            properties[0] = CFASSFileDialogueTextContentOverrideContentPropertyAlpha + (overrideContent->data.alpha.componentNumber > 0 ? overrideContent->data.alpha.componentNumber - 1 : 0);
+            values[0] = overrideContent->data.alpha.transparent;
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+int CFASSFileDialogueTextContentOverrideContentGetMovement(CFASSFileDialogueTextContentOverrideContentRef overrideContent,
+                                                           int *fromX, int *fromY,
+                                                           int *toX, int *toY,
+                                                           unsigned int *beginMS, unsigned int *endMS)
+{
+    if(overrideContent == NULL || fromX == NULL || fromY == NULL || toX == NULL || toY == NULL || beginMS == NULL || endMS == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTextContentOverrideContent %p GetMovement", overrideContent);
+    if(overrideContent->type == CFASSFileDialogueTextContentOverrideContentTypePosition)
+    {
+        *fromX = *toX = overrideContent->data.position.x;
+        *fromY = *toY = overrideContent->data.position.y;
+        *beginMS = *endMS = 0;
+        return 0;
+    }
+    if(overrideContent->type == CFASSFileDialogueTextContentOverrideContentTypeMove)
+    {
+        *fromX = overrideContent->data.movement.fromX;
+        *fromY = overrideContent->data.movement.fromY;
+        *toX = overrideContent->data.movement.toX;
+        *toY = overrideContent->data.movement.toY;
+        *beginMS = overrideContent->data.movement.hasTimeControl ? overrideContent->data.movement.startFromMS : 0;
+        *endMS = overrideContent->data.movement.hasTimeControl ? overrideContent->data.movement.endFromMS : 0;
+        return 0;
+    }
+    return -1;
+}
+
+int CFASSFileDialogueTextContentOverrideContentGetFade(CFASSFileDialogueTextContentOverrideContentRef overrideContent,
+                                                       bool *isComplexed,
+                                                       unsigned char alphas[3],
+                                                       unsigned int times[4])
+{
+    if(overrideContent == NULL || isComplexed == NULL || alphas == NULL || times == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTextContentOverrideContent %p GetFade", overrideContent);
+    if(overrideContent->type != CFASSFileDialogueTextContentOverrideContentTypeFade)
+        return -1;
+    *isComplexed = overrideContent->data.fade.isComplexed;
+    if(overrideContent->data.fade.isComplexed)
+    {
+        alphas[0] = overrideContent->data.fade.beginAlpha;
+        alphas[1] = overrideContent->data.fade.middleAlpha;
+        alphas[2] = overrideContent->data.fade.endAlpha;
+        times[0] = overrideContent->data.fade.fadeInBeginMS;
+        times[1] = overrideContent->data.fade.fadeInEndMS;
+        times[2] = overrideContent->data.fade.fadeOutBeginMS;
+        times[3] = overrideContent->data.fade.fadeOutEndMS;
+    }
+    else
+    {
+        alphas[0] = 255;
+        alphas[1] = 0;
+        alphas[2] = 255;
+        times[0] = overrideContent->data.fade.fadeInMS;
+        times[1] = overrideContent->data.fade.fadeOutMS;
+        times[2] = times[3] = 0;
+    }
+    return 0;
+}
+
+int CFASSFileDialogueTextContentOverrideContentGetKaraoke(CFASSFileDialogueTextContentOverrideContentRef overrideContent,
+                                                          unsigned int *centiSeconds,
+                                                          bool *hasSweepEffect)
+{
+    if(overrideContent == NULL || centiSeconds == NULL || hasSweepEffect == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTextContentOverrideContent %p GetKaraoke", overrideContent);
+    if(overrideContent->type != CFASSFileDialogueTextContentOverrideContentTypeKaraokeDuration)
+        return -1;
+    *centiSeconds = overrideContent->data.karaokeDuration.sentiSeconds;
+    *hasSweepEffect = overrideContent->data.karaokeDuration.hasSweepEffect;
+    return 0;
+}
+
+int CFASSFileDialogueTextContentOverrideContentGetAnimation(CFASSFileDialogueTextContentOverrideContentRef overrideContent,
+                                                            bool *hasTimeOffset,
+                                                            unsigned int *beginMS, unsigned int *endMS,
+                                                            double *acceleration,
+                                                            const wchar_t **modifiers)
+{
+    if(overrideContent == NULL || hasTimeOffset == NULL || beginMS == NULL || endMS == NULL || acceleration == NULL || modifiers == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTextContentOverrideContent %p GetAnimation", overrideContent);
+    if(overrideContent->type != CFASSFileDialogueTextContentOverrideContentTypeAnimation)
+        return -1;
+    *hasTimeOffset = overrideContent->data.animation.hasTimeOffset;
+    *beginMS = overrideContent->data.animation.beginOffsetMS;
+    *endMS = overrideContent->data.animation.endOffsetMS;
+    *acceleration = overrideContent->data.animation.hasAcceleration ? overrideContent->data.animation.acceleration : 1;
+    *modifiers = overrideContent->data.animation.modifiers;
+    return 0;
+}
+
+int CFASSFileDialogueTextContentOverrideContentGetReset(CFASSFileDialogueTextContentOverrideContentRef overrideContent, const wchar_t **styleName)
+{
+    if(overrideContent == NULL || styleName == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTextContentOverrideContent %p GetReset %p", overrideContent, styleName);
+    if(overrideContent->type != CFASSFileDialogueTextContentOverrideContentTypeReset)
+        return -1;
+    *styleName = overrideContent->data.reset.resetToDefault ? NULL : overrideContent->data.reset.styleName;
+    return 0;
+}
+
+int CFASSFileDialogueTextContentOverrideContentGetDrawingMode(CFASSFileDialogueTextContentOverrideContentRef overrideContent, unsigned int *drawingMode)
+{
+    if(overrideContent == NULL || drawingMode == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTextContentOverrideContent %p GetDrawingMode %p", overrideContent, drawingMode);
+    if(overrideContent->type != CFASSFileDialogueTextContentOverrideContentTypeDrawing)
+        return -1;
+    *drawingMode = overrideContent->data.drawing.mode;
+    return 0;
+}
+
+#pragma mark - Encoding
+
+#define CFASSFileDialogueTextContentOverrideContentDataMemberSize(member) \
+sizeof(((struct CFASSFileDialogueTextContentOverrideContent *)NULL)->data.member)
+
+#define CFASSFileDialogueTextContentOverrideContentEncodingAlign(size) \
+(((size) + CFASSFileDialogueTextContentOverrideContentEncodingAlignment - 1) & ~(size_t)(CFASSFileDialogueTextContentOverrideContentEncodingAlignment - 1))
+
+static size_t CFASSFileDialogueTextContentOverrideContentDataSize(CFASSFileDialogueTextContentOverrideContentType type)
+{
+    switch (type) {
+        case CFASSFileDialogueTextContentOverrideContentTypeBlod: return CFASSFileDialogueTextContentOverrideContentDataMemberSize(blod);
+        case CFASSFileDialogueTextContentOverrideContentTypeItalic: return CFASSFileDialogueTextContentOverrideContentDataMemberSize(italic);
+        case CFASSFileDialogueTextContentOverrideContentTypeUnderline: return CFASSFileDialogueTextContentOverrideContentDataMemberSize(underline);
+        case CFASSFileDialogueTextContentOverrideContentTypeStrikeOut: return CFASSFileDialogueTextContentOverrideContentDataMemberSize(strikeOut);
+        case CFASSFileDialogueTextContentOverrideContentTypeBorder: return CFASSFileDialogueTextContentOverrideContentDataMemberSize(border);
+        case CFASSFileDialogueTextContentOverrideContentTypeShadow: return CFASSFileDialogueTextContentOverrideContentDataMemberSize(shadow);
+        case CFASSFileDialogueTextContentOverrideContentTypeBlurEdge: return CFASSFileDialogueTextContentOverrideContentDataMemberSize(blurEdge);
+        case CFASSFileDialogueTextContentOverrideContentTypeFontName: return CFASSFileDialogueTextContentOverrideContentDataMemberSize(fontName);
+        case CFASSFileDialogueTextContentOverrideContentTypeFontSize: return CFASSFileDialogueTextContentOverrideContentDataMemberSize(fontSize);
+        case CFASSFileDialogueTextContentOverrideContentTypeFontScale: return CFASSFileDialogueTextContentOverrideContentDataMemberSize(fontScale);
+        case CFASSFileDialogueTextContentOverrideContentTypeFontSpacing: return CFASSFileDialogueTextContentOverrideContentDataMemberSize(spacing);
+        case CFASSFileDialogueTextContentOverrideContentTypeTextRotation: return CFASSFileDialogueTextContentOverrideContentDataMemberSize(rotation);
+        case CFASSFileDialogueTextContentOverrideContentTypeTextShearing: return CFASSFileDialogueTextContentOverrideContentDataMemberSize(shearing);
+        case CFASSFileDialogueTextContentOverrideContentTypeTextEncoding: return CFASSFileDialogueTextContentOverrideContentDataMemberSize(fontEncoding);
+        case CFASSFileDialogueTextContentOverrideContentTypeColor: return CFASSFileDialogueTextContentOverrideContentDataMemberSize(color);
+        case CFASSFileDialogueTextContentOverrideContentTypeAlpha: return CFASSFileDialogueTextContentOverrideContentDataMemberSize(alpha);
+        case CFASSFileDialogueTextContentOverrideContentTypeAlignment: return CFASSFileDialogueTextContentOverrideContentDataMemberSize(alignment);
+        case CFASSFileDialogueTextContentOverrideContentTypeKaraokeDuration: return CFASSFileDialogueTextContentOverrideContentDataMemberSize(karaokeDuration);
+        case CFASSFileDialogueTextContentOverrideContentTypeWrapingStyle: return CFASSFileDialogueTextContentOverrideContentDataMemberSize(wrapStyle);
+        case CFASSFileDialogueTextContentOverrideContentTypeReset: return CFASSFileDialogueTextContentOverrideContentDataMemberSize(reset);
+        case CFASSFileDialogueTextContentOverrideContentTypeAnimation: return CFASSFileDialogueTextContentOverrideContentDataMemberSize(animation);
+        case CFASSFileDialogueTextContentOverrideContentTypeMove: return CFASSFileDialogueTextContentOverrideContentDataMemberSize(movement);
+        case CFASSFileDialogueTextContentOverrideContentTypePosition: return CFASSFileDialogueTextContentOverrideContentDataMemberSize(position);
+        case CFASSFileDialogueTextContentOverrideContentTypeRotationOrigin: return CFASSFileDialogueTextContentOverrideContentDataMemberSize(rotationOrigin);
+        case CFASSFileDialogueTextContentOverrideContentTypeFade: return CFASSFileDialogueTextContentOverrideContentDataMemberSize(fade);
+        case CFASSFileDialogueTextContentOverrideContentTypeClip: return CFASSFileDialogueTextContentOverrideContentDataMemberSize(clip);
+        case CFASSFileDialogueTextContentOverrideContentTypeDrawing: return CFASSFileDialogueTextContentOverrideContentDataMemberSize(drawing);
+        case CFASSFileDialogueTextContentOverrideContentTypeBaselineOffset: return CFASSFileDialogueTextContentOverrideContentDataMemberSize(baselineOffset);
+    }
+    return 0;
+}
+
+static wchar_t **CFASSFileDialogueTextContentOverrideContentDataString(CFASSFileDialogueTextContentOverrideContentRef overrideContent)
+{
+    // the only member owning memory, same as Copy and Destory
+    switch (overrideContent->type) {
+        case CFASSFileDialogueTextContentOverrideContentTypeFontName:
+            return &overrideContent->data.fontName.name;
+        case CFASSFileDialogueTextContentOverrideContentTypeReset:
+            return overrideContent->data.reset.resetToDefault ? NULL : &overrideContent->data.reset.styleName;
+        case CFASSFileDialogueTextContentOverrideContentTypeAnimation:
+            return &overrideContent->data.animation.modifiers;
+        case CFASSFileDialogueTextContentOverrideContentTypeClip:
+            return overrideContent->data.clip.usingDrawingCommand ? &overrideContent->data.clip.drawingCommand : NULL;
+        default:
+            return NULL;
+    }
+}
+
+size_t CFASSFileDialogueTextContentOverrideContentEncode(CFASSFileDialogueTextContentOverrideContentRef overrideContent, unsigned char *record)
+{
+    if(overrideContent == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTextContentOverrideContent NULL Encode");
+    struct CFASSFileDialogueTextContentOverrideContent local = *overrideContent;
+    wchar_t **string = CFASSFileDialogueTextContentOverrideContentDataString(&local);
+    size_t stringLength = string != NULL ? wcslen(*string) + 1 : 0;
+    size_t dataSize = CFASSFileDialogueTextContentOverrideContentDataSize(local.type);
+    size_t stringOffset = CFASSFileDialogueTextContentOverrideContentEncodingAlign(sizeof(CFASSFileDialogueTextContentOverrideContentEncodingHeader) + dataSize);
+    size_t size = stringOffset + CFASSFileDialogueTextContentOverrideContentEncodingAlign(sizeof(wchar_t) * stringLength);
+    if(record == NULL)
+        return size;
+    memset(record, 0, size);
+    ((CFASSFileDialogueTextContentOverrideContentEncodingHeader *)record)->size = (uint32_t)size;
+    ((CFASSFileDialogueTextContentOverrideContentEncodingHeader *)record)->type = (uint32_t)local.type;
+    if(string != NULL)
+    {
+        wmemcpy((wchar_t *)(record + stringOffset), *string, stringLength);
+        *string = NULL;     // pointer is meaningless in record
+    }
+    memcpy(record + sizeof(CFASSFileDialogueTextContentOverrideContentEncodingHeader), &local.data, dataSize);
+    return size;
+}
+
+static void CFASSFileDialogueTextContentOverrideContentDecode(const unsigned char *record, CFASSFileDialogueTextContentOverrideContentRef overrideContent)
+{
+    // string of result points into record
+    const CFASSFileDialogueTextContentOverrideContentEncodingHeader *header = (const CFASSFileDialogueTextContentOverrideContentEncodingHeader *)record;
+    size_t dataSize = CFASSFileDialogueTextContentOverrideContentDataSize(header->type);
+    overrideContent->type = header->type;
+    memcpy(&overrideContent->data, record + sizeof(CFASSFileDialogueTextContentOverrideContentEncodingHeader), dataSize);
+    wchar_t **string = CFASSFileDialogueTextContentOverrideContentDataString(overrideContent);
+    if(string != NULL)
+        *string = (wchar_t *)(record + CFASSFileDialogueTextContentOverrideContentEncodingAlign(sizeof(CFASSFileDialogueTextContentOverrideContentEncodingHeader) + dataSize));
+}
+
+CFASSFileDialogueTextContentOverrideContentRef CFASSFileDialogueTextContentOverrideContentCreateWithEncoding(const unsigned char *record)
+{
+    if(record == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTextContentOverrideContentCreateWithEncoding NULL");
+    struct CFASSFileDialogueTextContentOverrideContent local;
+    CFASSFileDialogueTextContentOverrideContentDecode(record, &local);
+    return CFASSFileDialogueTextContentOverrideContentCopy(&local);
+}
+
+int CFASSFileDialogueTextContentOverrideContentAppendEncodingStringResult(const unsigned char *record, CFMutableStringRef string)
+{
+    if(record == NULL || string == NULL)
+    {
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTextContentOverrideContent Encoding %p AppendStringResult %p", record, string);
+        return -1;
+    }
+    struct CFASSFileDialogueTextContentOverrideContent local;
+    CFASSFileDialogueTextContentOverrideContentDecode(record, &local);
+    return CFASSFileDialogueTextContentOverrideContentAppendStringResult(&local, string);
+}
+
+bool CFASSFileDialogueTextContentOverrideContentEncodingMakeChange(unsigned char *record, CFASSFileChangeRef change)
+{
+    if(record == NULL || change == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTextContentOverrideContent Encoding %p MakeChange %p", record, change);
+    struct CFASSFileDialogueTextContentOverrideContent local;
+    CFASSFileDialogueTextContentOverrideContentDecode(record, &local);
+    if(CFASSFileDialogueTextContentOverrideContentDataString(&local) != NULL)
+        return false;       // change may free or resize the string, not in place
+    CFASSFileDialogueTextContentOverrideContentMakeChange(&local, change);
+    CFASSFileDialogueTextContentOverrideContentEncode(&local, record);
+    return true;
+}
@@ -10,6 +10,7 @@
 #define CFASSFileDialogueTextContentOverrideContent_h
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <wchar.h>
 
 #include "CFGeometry.h"
@@ -161,10 +162,29 @@ CFASSFileDialogueTextContentOverrideContentRef CFASSFileDialogueTextContentOverr
 
 void CFASSFileDialogueTextContentOverrideContentDestory(CFASSFileDialogueTextContentOverrideContentRef overrideContent);
 
+#pragma mark - Get Component
+
+CFASSFileDialogueTextContentOverrideContentType CFASSFileDialogueTextContentOverrideContentGetType(CFASSFileDialogueTextContentOverrideContentRef overrideContent);
+
 #pragma mark - Receive Change
 
 void CFASSFileDialogueTextContentOverrideContentMakeChange(CFASSFileDialogueTextContentOverrideContentRef overrideContent, CFASSFileChangeRef change);
 
+#pragma mark - Rasterize Clip
+
+int CFASSFileDialogueTextContentOverrideContentRasterizeClip(CFASSFileDialogueTextContentOverrideContentRef overrideContent,
+                                                             unsigned char *coverage,
+                                                             size_t width, size_t height, size_t bytesPerRow,
+                                                             unsigned int threadAmount);
+/* coverage */
+// 8-bit mask in script pixel, 255 where the clip lets content through, every byte of width in each row is overwritten
+/* threadAmount */
+// see CFASSFileDialogueTextDrawingRasterizerFillPolygon
+/* Return */
+// 0 for success, -1 if overrideContent is not \clip or \iclip, or out of memory
+/* Discussion */
+// rectangle and drawing clips are both filled with non-zero winding, \iclip takes the complement
+
 #endif /* CFASSFileDialogueTextContentOverrideContent_h */
 
 
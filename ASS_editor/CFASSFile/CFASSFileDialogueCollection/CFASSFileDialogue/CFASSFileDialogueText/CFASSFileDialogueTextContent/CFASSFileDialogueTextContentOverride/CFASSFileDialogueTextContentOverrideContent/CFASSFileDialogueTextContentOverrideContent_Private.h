@@ -10,8 +10,12 @@
 #define CFASSFileDialogueTextContentOverrideContent_Private_h
 
 #include <wchar.h>
+#include <stdint.h>
+#include <stdbool.h>
 
 #include "CFASSFileDialogueTextContentOverrideContent.h"
+#include "CFASSFileChange.h"
+#include "CFMutableString.h"
 
 #pragma mark - Read File
 
@@ -30,4 +34,118 @@ int CFASSFileDialogueTextContentOverrideContentStoreStringResult(CFASSFileDialog
 // if targetPoint is NULL, it will not try to store string in it
 // return will be the store string Length if targetPoint is long enough even is NULL
 
+int CFASSFileDialogueTextContentOverrideContentAppendStringResult(CFASSFileDialogueTextContentOverrideContentRef overrideContent, CFMutableStringRef string);
+/* Return */
+// 0 for success, -1 if anything went wrong
+
+#pragma mark - Evaluation
+
+typedef enum CFASSFileDialogueTextContentOverrideContentProperty {
+    CFASSFileDialogueTextContentOverrideContentPropertyFontSize,
+    CFASSFileDialogueTextContentOverrideContentPropertyFontScaleX,
+    CFASSFileDialogueTextContentOverrideContentPropertyFontScaleY,
+    CFASSFileDialogueTextContentOverrideContentPropertyFontSpacing,
+    CFASSFileDialogueTextContentOverrideContentPropertyRotationX,
+    CFASSFileDialogueTextContentOverrideContentPropertyRotationY,
+    CFASSFileDialogueTextContentOverrideContentPropertyRotationZ,
+    CFASSFileDialogueTextContentOverrideContentPropertyShearingX,
+    CFASSFileDialogueTextContentOverrideContentPropertyShearingY,
+    CFASSFileDialogueTextContentOverrideContentPropertyBorderX,
+    CFASSFileDialogueTextContentOverrideContentPropertyBorderY,
+    CFASSFileDialogueTextContentOverrideContentPropertyShadowX,
+    CFASSFileDialogueTextContentOverrideContentPropertyShadowY,
+    CFASSFileDialogueTextContentOverrideContentPropertyBlurEdge,
+    CFASSFileDialogueTextContentOverrideContentPropertyBlur,
+    CFASSFileDialogueTextContentOverrideContentPropertyColor,           // blue green red of primary, secondary, outline, back, 12 in total
+    CFASSFileDialogueTextContentOverrideContentPropertyAlpha = CFASSFileDialogueTextContentOverrideContentPropertyColor + 12,     // primary, secondary, outline, back
+    CFASSFileDialogueTextContentOverrideContentPropertyAmount = CFASSFileDialogueTextContentOverrideContentPropertyAlpha + 4
+} CFASSFileDialogueTextContentOverrideContentProperty;
+
+#define CFASSFileDialogueTextContentOverrideContentPropertyMaximumPerContent 4
+
+unsigned int CFASSFileDialogueTextContentOverrideContentGetProperties(CFASSFileDialogueTextContentOverrideContentRef overrideContent,
+                                                                      CFASSFileDialogueTextContentOverrideContentProperty *properties,
+                                                                      double *values);
+/* properties, values */
+// each hold at least CFASSFileDialogueTextContentOverrideContentPropertyMaximumPerContent
+/* Return */
+// the amount of animatable properties overrideContent sets, 0 for other types
+/* Discussion */
+// \bord sets both border axis, \c sets three color channels, \alpha sets all four alpha and so on
+
+int CFASSFileDialogueTextContentOverrideContentGetMovement(CFASSFileDialogueTextContentOverrideContentRef overrideContent,
+                                                           int *fromX, int *fromY,
+                                                           int *toX, int *toY,
+                                                           unsigned int *beginMS, unsigned int *endMS);
+/* Return */
+// 0 for \move and \pos, -1 for other types
+/* Discussion */
+// \pos reports the same point twice, both times are 0 when there is no time control
+
+int CFASSFileDialogueTextContentOverrideContentGetFade(CFASSFileDialogueTextContentOverrideContentRef overrideContent,
+                                                       bool *isComplexed,
+                                                       unsigned char alphas[3],
+                                                       unsigned int times[4]);
+/* Return */
+// 0 for \fad and \fade, -1 for other types
+/* Discussion */
+// \fad(in, out) reports alphas 255 0 255, times[0] is in and times[1] is out, the others are 0
+
+int CFASSFileDialogueTextContentOverrideContentGetKaraoke(CFASSFileDialogueTextContentOverrideContentRef overrideContent,
+                                                          unsigned int *centiSeconds,
+                                                          bool *hasSweepEffect);
+/* Return */
+// 0 for \k \K \kf \ko, -1 for other types
+
+int CFASSFileDialogueTextContentOverrideContentGetAnimation(CFASSFileDialogueTextContentOverrideContentRef overrideContent,
+                                                            bool *hasTimeOffset,
+                                                            unsigned int *beginMS, unsigned int *endMS,
+                                                            double *acceleration,
+                                                            const wchar_t **modifiers);
+/* Return */
+// 0 for \t, -1 for other types
+/* acceleration */
+// 1 when \t does not specify one
+/* modifiers */
+// owned by overrideContent, the override tags inside \t
+
+int CFASSFileDialogueTextContentOverrideContentGetReset(CFASSFileDialogueTextContentOverrideContentRef overrideContent, const wchar_t **styleName);
+/* Return */
+// 0 for \r, -1 for other types
+/* styleName */
+// NULL when resetting to the style of the dialogue
+
+int CFASSFileDialogueTextContentOverrideContentGetDrawingMode(CFASSFileDialogueTextContentOverrideContentRef overrideContent, unsigned int *drawingMode);
+/* Return */
+// 0 for \p, -1 for other types
+/* drawingMode */
+// 0 turns drawing off, the text after any other value is drawing commands
+
+#pragma mark - Encoding
+
+#define CFASSFileDialogueTextContentOverrideContentEncodingAlignment 8
+
+typedef struct CFASSFileDialogueTextContentOverrideContentEncodingHeader {
+    uint32_t size;      // bytes of the whole record, header included, multiple of alignment
+    uint32_t type;      // CFASSFileDialogueTextContentOverrideContentType
+} CFASSFileDialogueTextContentOverrideContentEncodingHeader;
+// a record is header, the fixed data of its type, then the inline string (if any) NUL terminated
+
+size_t CFASSFileDialogueTextContentOverrideContentEncode(CFASSFileDialogueTextContentOverrideContentRef overrideContent, unsigned char *record);
+/* record */
+// this could be NULL, then only measures
+// must be aligned to CFASSFileDialogueTextContentOverrideContentEncodingAlignment
+/* Return */
+// the record size in bytes
+
+CFASSFileDialogueTextContentOverrideContentRef CFASSFileDialogueTextContentOverrideContentCreateWithEncoding(const unsigned char *record);
+
+int CFASSFileDialogueTextContentOverrideContentAppendEncodingStringResult(const unsigned char *record, CFMutableStringRef string);
+// same as AppendStringResult, without materializing the content
+
+bool CFASSFileDialogueTextContentOverrideContentEncodingMakeChange(unsigned char *record, CFASSFileChangeRef change);
+/* Return */
+// false if record holds a string, which could change its size, record stays unchanged
+// then caller should decode, make change and encode again
+
 #endif /* CFASSFileDialogueTextContentOverrideContent_Private_h */
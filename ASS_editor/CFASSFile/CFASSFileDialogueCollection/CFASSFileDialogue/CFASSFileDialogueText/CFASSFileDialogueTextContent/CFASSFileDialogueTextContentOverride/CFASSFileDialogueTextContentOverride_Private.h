@@ -13,6 +13,7 @@
 #include <stddef.h>
 
 #include "CFASSFileDialogueTextContentOverride.h"
+#include "CFMutableString.h"
 
 CFASSFileDialogueTextContentOverrideRef CFASSFileDialogueTextContentOverrideCreateWithString(const wchar_t *string, bool isIncludeBraces);
 /* string */
@@ -28,4 +29,15 @@ int CFASSFileDialogueTextContentOverrideStoreStringResult(CFASSFileDialogueTextC
 // if targetPoint is NULL, it will not try to store string in it
 // return will be the store string Length if targetPoint is long enough even is NULL
 
+int CFASSFileDialogueTextContentOverrideAppendStringResult(CFASSFileDialogueTextContentOverrideRef override, CFMutableStringRef string);
+/* Return */
+// 0 for success, -1 if anything went wrong
+
+CFASSFileDialogueTextContentOverrideRef CFASSFileDialogueTextContentOverrideMakeChangeCopyOnWrite(CFASSFileDialogueTextContentOverrideRef override, CFASSFileChangeRef change);
+/* Return */
+// the override holding the change, caller replace its reference with it
+// it is override itself if change don't affect it or nobody else retain it
+// otherwise it is a changed copy, and override is destoryed once
+// NULL if copy failed, override stays unchanged and still retained by caller
+
 #endif /* CFASSFileDialogueTextContentOverride_Private_h */
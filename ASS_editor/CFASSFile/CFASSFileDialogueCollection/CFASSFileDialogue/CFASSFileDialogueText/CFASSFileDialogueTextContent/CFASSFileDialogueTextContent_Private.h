@@ -10,12 +10,17 @@
 #define CFASSFileDialogueTextContent_Private_h
 
 #include "CFASSFileDialogueTextContent.h"
+#include "CFASSFileDialogueTextContentOverrideCache.h"
+#include "CFMutableString.h"
 
 CFASSFileDialogueTextContentRef CFASSFileDialogueTextContentCreateWithString(CFASSFileDialogueTextContentType type,
                                                                              const wchar_t *data,
-                                                                             const wchar_t *endPoint);
+                                                                             const wchar_t *endPoint,
+                                                                             CFASSFileDialogueTextContentOverrideCacheRef overrideCache);
 /* endPoint */
 // this must be the character before the '\n' or '\0', very important
+/* overrideCache */
+// this could be NULL, then override is never shared
 // if this is an empty text, this should be called with CFASSFileDialogueTextContentCreateEmptyString
 
 CFASSFileDialogueTextContentRef CFASSFileDialogueTextContentCreateEmptyString(void);
@@ -28,4 +33,8 @@ int CFASSFileDialogueTextContentStoreStringResult(CFASSFileDialogueTextContentRe
 // if targetPoint is NULL, it will not try to store string in it
 // return will be the store string Length if targetPoint is long enough even is NULL
 
+int CFASSFileDialogueTextContentAppendStringResult(CFASSFileDialogueTextContentRef textContent, CFMutableStringRef string);
+/* Return */
+// 0 for success, -1 if anything went wrong
+
 #endif /* CFASSFileDialogueTextContent_Private_h */
@@ -6,79 +6,43 @@
 //  Copyright © 2018 Bill Sun. All rights reserved.
 //
 
-#include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
 #include <stdarg.h>
+#include <string.h>
+#include <math.h>
 #include <wchar.h>
 
 #include "CFASSFileDialogueTextDrawingContext.h"
 #include "CFASSFileDialogueTextDrawingContext_Private.h"
-#include "CFPointerArray.h"
 #include "CFException.h"
+#include "CFMutableString.h"
 
 #pragma mark context
 
-struct CFASSFileDialogueTextDrawingContext {
-    CFPointerArrayRef contentArray;
-};
-
-#pragma mark - contextContent
-
-typedef enum CFASSFileDialogueTextDrawingContextContentType {
-    CFASSFileDialogueTextDrawingContextContentTypeMove,
-    CFASSFileDialogueTextDrawingContextContentTypeLine,
-    CFASSFileDialogueTextDrawingContextContentTypeBezier,
-    CFASSFileDialogueTextDrawingContextContentTypeBSpline,
-    CFASSFileDialogueTextDrawingContextContentTypeExtendBSpline,
-    CFASSFileDialogueTextDrawingContextContentTypeCloseBSpline
-} CFASSFileDialogueTextDrawingContextContentType;
+#define CFASSFileDialogueTextDrawingContextInitialCommandCapacity 16
 
-struct CFASSFileDialogueTextDrawingContextContent {
-    CFASSFileDialogueTextDrawingContextContentType type;
-    void *data;
-};
-
-typedef struct CFASSFileDialogueTextDrawingContextContent *CFASSFileDialogueTextDrawingContextContentRef;
-
-struct CFASSFileDialogueTextDrawingContextMoveContent {
-    int x, y;
-    bool closePath;
-};
-
-struct CFASSFileDialogueTextDrawingContextLineContent {
-    int x, y;
-};
-
-struct CFASSFileDialogueTextDrawingContextBezierContent {
-    int x1, y1,
-        x2, y2,
-        x3, y3;
-};
-
-struct CFASSFileDialogueTextDrawingContextBSplineContent {
-    int x1, y1,
-        x2, y2,
-        x3, y3;
+struct CFASSFileDialogueTextDrawingContext {
+    unsigned char *commands;            // CFASSFileDialogueTextDrawingContextCommand each
+    size_t commandAmount, commandCapacity;
+    int32_t *coordinates;               // x, y pairs of every command packed in order
+    size_t coordinateAmount, coordinateCapacity;
 };
 
-struct CFASSFileDialogueTextDrawingContextExtendBSplineContent {
-    bool attachToPreviousBSplineContent;
-    int x, y;
+static const unsigned int CFASSFileDialogueTextDrawingContextCommandPointAmount[] = {
+    [CFASSFileDialogueTextDrawingContextCommandMove] = 1,
+    [CFASSFileDialogueTextDrawingContextCommandMoveNotClosing] = 1,
+    [CFASSFileDialogueTextDrawingContextCommandLine] = 1,
+    [CFASSFileDialogueTextDrawingContextCommandBezier] = 3,
+    [CFASSFileDialogueTextDrawingContextCommandBSpline] = 3,
+    [CFASSFileDialogueTextDrawingContextCommandExtendBSpline] = 1,
+    [CFASSFileDialogueTextDrawingContextCommandExtendBSplineAttached] = 1,
+    [CFASSFileDialogueTextDrawingContextCommandCloseBSpline] = 0
 };
 
-typedef struct CFASSFileDialogueTextDrawingContextContent *CFASSFileDialogueTextDrawingContextContentRef;
-
-typedef struct CFASSFileDialogueTextDrawingContextMoveContent *CFASSFileDialogueTextDrawingContextMoveContentRef;
-
-typedef struct CFASSFileDialogueTextDrawingContextLineContent *CFASSFileDialogueTextDrawingContextLineContentRef;
-
-typedef struct CFASSFileDialogueTextDrawingContextBezierContent *CFASSFileDialogueTextDrawingContextBezierContentRef;
-
-typedef struct CFASSFileDialogueTextDrawingContextBSplineContent *CFASSFileDialogueTextDrawingContextBSplineContentRef;
-
-typedef struct CFASSFileDialogueTextDrawingContextExtendBSplineContent *CFASSFileDialogueTextDrawingContextExtendBSplineContentRef;
-
-static const wchar_t *CFASSFileDialogueTextDrawingContextCreateFromStringSkipElement(const wchar_t *beginPoint, unsigned int elementAmount);
+static int CFASSFileDialogueTextDrawingContextAddCommand(CFASSFileDialogueTextDrawingContextRef context,
+                                                         CFASSFileDialogueTextDrawingContextCommand command,
+                                                         const int *coordinates);
 
 #pragma mark - ContentManagement
 
@@ -87,8 +51,18 @@ CFASSFileDialogueTextDrawingContextRef CFASSFileDialogueTextDrawingContextCreate
     CFASSFileDialogueTextDrawingContextRef result;
     if((result = malloc(sizeof(struct CFASSFileDialogueTextDrawingContext))) != NULL)
     {
-        if((result->contentArray = CFPointerArrayCreateEmpty()) != NULL)
-            return result;
+        if((result->commands = malloc(sizeof(unsigned char) * CFASSFileDialogueTextDrawingContextInitialCommandCapacity)) != NULL)
+        {
+            if((result->coordinates = malloc(sizeof(int32_t) * 2 * CFASSFileDialogueTextDrawingContextInitialCommandCapacity)) != NULL)
+            {
+                result->commandAmount = 0;
+                result->commandCapacity = CFASSFileDialogueTextDrawingContextInitialCommandCapacity;
+                result->coordinateAmount = 0;
+                result->coordinateCapacity = 2 * CFASSFileDialogueTextDrawingContextInitialCommandCapacity;
+                return result;
+            }
+            free(result->commands);
+        }
         free(result);
     }
     return NULL;
@@ -96,53 +70,23 @@ CFASSFileDialogueTextDrawingContextRef CFASSFileDialogueTextDrawingContextCreate
 
 void CFASSFileDialogueTextDrawingContextDestory(CFASSFileDialogueTextDrawingContextRef context)
 {
-    size_t length = CFPointerArrayGetLength(context->contentArray);
-    CFASSFileDialogueTextDrawingContextContentRef content;
-    for(size_t index = 0; index<length; index++)
-    {
-        content = CFPointerArrayGetPointerAtIndex(context->contentArray, index);
-        // if(content->type != CFASSFileDialogueTextDrawingContextContentTypeCloseBSpline)  as it is assigned to NULL
-        free(content->data);
-        free(content);
-    }
-    CFPointerArrayDestory(context->contentArray);
+    if(context == NULL) return;
+    free(context->commands);
+    free(context->coordinates);
     free(context);
 }
 
 void CFASSFileDialogueTextDrawingContextMoveToPosition(CFASSFileDialogueTextDrawingContextRef context,
                                                        int x, int y, bool closing)
 {
-    CFASSFileDialogueTextDrawingContextContentRef content;
-    if((content = malloc(sizeof(struct CFASSFileDialogueTextDrawingContextContent))) != NULL)
-    {
-        if((content->data = malloc(sizeof(struct CFASSFileDialogueTextDrawingContextMoveContent))) != NULL)
-        {
-            content->type = CFASSFileDialogueTextDrawingContextContentTypeMove;
-            ((CFASSFileDialogueTextDrawingContextMoveContentRef)content->data)->closePath = closing;
-            ((CFASSFileDialogueTextDrawingContextMoveContentRef)content->data)->x = x;
-            ((CFASSFileDialogueTextDrawingContextMoveContentRef)content->data)->y = y;
-            CFPointerArrayAddPointer(context->contentArray, content, false);
-            return;
-        }
-        free(content);
-    }
+    CFASSFileDialogueTextDrawingContextAddCommand(context,
+                                                  closing ? CFASSFileDialogueTextDrawingContextCommandMove : CFASSFileDialogueTextDrawingContextCommandMoveNotClosing,
+                                                  (int []){x, y});
 }
 
 void CFASSFileDialogueTextDrawingContextDrawLine(CFASSFileDialogueTextDrawingContextRef context, int x, int y)
 {
-    CFASSFileDialogueTextDrawingContextContentRef content;
-    if((content = malloc(sizeof(struct CFASSFileDialogueTextDrawingContextContent))) != NULL)
-    {
-        if((content->data = malloc(sizeof(struct CFASSFileDialogueTextDrawingContextLineContent))) != NULL)
-        {
-            content->type = CFASSFileDialogueTextDrawingContextContentTypeLine;
-            ((CFASSFileDialogueTextDrawingContextLineContentRef)content->data)->x = x;
-            ((CFASSFileDialogueTextDrawingContextLineContentRef)content->data)->y = y;
-            CFPointerArrayAddPointer(context->contentArray, content, false);
-            return;
-        }
-        free(content);
-    }
+    CFASSFileDialogueTextDrawingContextAddCommand(context, CFASSFileDialogueTextDrawingContextCommandLine, (int []){x, y});
 }
 
 void CFASSFileDialogueTextDrawingContextDrawBezier(CFASSFileDialogueTextDrawingContextRef context,
@@ -150,320 +94,244 @@ void CFASSFileDialogueTextDrawingContextDrawBezier(CFASSFileDialogueTextDrawingC
                                                    int x2, int y2,
                                                    int x3, int y3)
 {
-    CFASSFileDialogueTextDrawingContextContentRef content;
-    if((content = malloc(sizeof(struct CFASSFileDialogueTextDrawingContextContent))) != NULL)
-    {
-        if((content->data = malloc(sizeof(struct CFASSFileDialogueTextDrawingContextBezierContent))) != NULL)
-        {
-            content->type = CFASSFileDialogueTextDrawingContextContentTypeBezier;
-            ((CFASSFileDialogueTextDrawingContextBezierContentRef)content->data)->x1 = x1;
-            ((CFASSFileDialogueTextDrawingContextBezierContentRef)content->data)->y1 = y1;
-            ((CFASSFileDialogueTextDrawingContextBezierContentRef)content->data)->x2 = x2;
-            ((CFASSFileDialogueTextDrawingContextBezierContentRef)content->data)->y2 = y2;
-            ((CFASSFileDialogueTextDrawingContextBezierContentRef)content->data)->x3 = x3;
-            ((CFASSFileDialogueTextDrawingContextBezierContentRef)content->data)->y3 = y3;
-            CFPointerArrayAddPointer(context->contentArray, content, false);
-            return;
-        }
-        free(content);
-    }
+    CFASSFileDialogueTextDrawingContextAddCommand(context, CFASSFileDialogueTextDrawingContextCommandBezier, (int []){x1, y1, x2, y2, x3, y3});
 }
 
 void CFASSFileDialogueTextDrawingContextDrawBSpline(CFASSFileDialogueTextDrawingContextRef context, unsigned int degrees, ...)
 {
     if(degrees<3) return;
-    CFASSFileDialogueTextDrawingContextContentRef content;
-    if((content = malloc(sizeof(struct CFASSFileDialogueTextDrawingContextContent))) != NULL)
-    {
-        if((content->data = malloc(sizeof(struct CFASSFileDialogueTextDrawingContextBSplineContent))) != NULL)
+    int coordinates[6];
+    va_list ap;
+    va_start(ap, degrees);
+    for(unsigned int index = 0; index<6; index++)
+        coordinates[index] = va_arg(ap, int);
+    if(CFASSFileDialogueTextDrawingContextAddCommand(context, CFASSFileDialogueTextDrawingContextCommandBSpline, coordinates) == 0)
+        for(unsigned int currentDegree = 4; currentDegree<=degrees; currentDegree++)
         {
-            content->type = CFASSFileDialogueTextDrawingContextContentTypeBSpline;
-            va_list ap;
-            va_start(ap, degrees);
-            ((CFASSFileDialogueTextDrawingContextBSplineContentRef)content->data)->x1 = va_arg(ap, int);
-            ((CFASSFileDialogueTextDrawingContextBSplineContentRef)content->data)->y1 = va_arg(ap, int);
-            ((CFASSFileDialogueTextDrawingContextBSplineContentRef)content->data)->x2 = va_arg(ap, int);
-            ((CFASSFileDialogueTextDrawingContextBSplineContentRef)content->data)->y2 = va_arg(ap, int);
-            ((CFASSFileDialogueTextDrawingContextBSplineContentRef)content->data)->x3 = va_arg(ap, int);
-            ((CFASSFileDialogueTextDrawingContextBSplineContentRef)content->data)->y3 = va_arg(ap, int);
-            CFPointerArrayAddPointer(context->contentArray, content, false);
-            for(unsigned int currentDegree = 4; currentDegree<=degrees; currentDegree++)
-                CFASSFileDialogueTextDrawingContextExtendBSpline(context, va_arg(ap, int), va_arg(ap, int), true);
-            va_end(ap);
-            return;
+            coordinates[0] = va_arg(ap, int);
+            coordinates[1] = va_arg(ap, int);
+            CFASSFileDialogueTextDrawingContextAddCommand(context, CFASSFileDialogueTextDrawingContextCommandExtendBSplineAttached, coordinates);
         }
-        free(content);
-    }
+    va_end(ap);
 }
 
 void CFASSFileDialogueTextDrawingContextExtendBSpline(CFASSFileDialogueTextDrawingContextRef context,
                                                       int x, int y,
                                                       bool attachToPreviousBSpline)
 {
-    CFASSFileDialogueTextDrawingContextContentType previousType = ((CFASSFileDialogueTextDrawingContextContentRef)CFPointerArrayGetLastPointer(context->contentArray))->type;
-    if(previousType!=CFASSFileDialogueTextDrawingContextContentTypeExtendBSpline &&
-       previousType!=CFASSFileDialogueTextDrawingContextContentTypeBSpline)
+    if(context->commandAmount == 0) return;
+    CFASSFileDialogueTextDrawingContextCommand previousCommand = context->commands[context->commandAmount-1];
+    if(previousCommand!=CFASSFileDialogueTextDrawingContextCommandBSpline &&
+       previousCommand!=CFASSFileDialogueTextDrawingContextCommandExtendBSpline &&
+       previousCommand!=CFASSFileDialogueTextDrawingContextCommandExtendBSplineAttached)
         return;
-    CFASSFileDialogueTextDrawingContextContentRef content;
-    if((content = malloc(sizeof(struct CFASSFileDialogueTextDrawingContextContent))) != NULL)
+    CFASSFileDialogueTextDrawingContextAddCommand(context,
+                                                  attachToPreviousBSpline ? CFASSFileDialogueTextDrawingContextCommandExtendBSplineAttached : CFASSFileDialogueTextDrawingContextCommandExtendBSpline,
+                                                  (int []){x, y});
+}
+
+void CFASSFileDialogueTextDrawingContextClose(CFASSFileDialogueTextDrawingContextRef context)
+{
+    CFASSFileDialogueTextDrawingContextAddCommand(context, CFASSFileDialogueTextDrawingContextCommandCloseBSpline, NULL);
+}
+
+#pragma mark - Transform
+
+void CFASSFileDialogueTextDrawingContextTranslate(CFASSFileDialogueTextDrawingContextRef context, int x, int y)
+{
+    if(context == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTextDrawingContext NULL Translate %d %d", x, y);
+    int32_t *coordinates = context->coordinates;
+    for(size_t index = 0; index < context->coordinateAmount; index += 2)
     {
-        if((content->data = malloc(sizeof(struct CFASSFileDialogueTextDrawingContextExtendBSplineContent))) != NULL)
-        {
-            content->type = CFASSFileDialogueTextDrawingContextContentTypeExtendBSpline;
-            ((CFASSFileDialogueTextDrawingContextExtendBSplineContentRef)content->data)->x = x;
-            ((CFASSFileDialogueTextDrawingContextExtendBSplineContentRef)content->data)->y = y;
-            ((CFASSFileDialogueTextDrawingContextExtendBSplineContentRef)content->data)->attachToPreviousBSplineContent = attachToPreviousBSpline;
-            CFPointerArrayAddPointer(context->contentArray, content, false);
-            return;
-        }
-        free(content);
+        coordinates[index] += x;
+        coordinates[index+1] += y;
     }
 }
 
-void CFASSFileDialogueTextDrawingContextClose(CFASSFileDialogueTextDrawingContextRef context)
+static int32_t CFASSFileDialogueTextDrawingContextScaleCoordinate(int32_t coordinate, double scale)
 {
-    CFASSFileDialogueTextDrawingContextContentRef content;
-    if((content = malloc(sizeof(struct CFASSFileDialogueTextDrawingContextContent))) != NULL)
+    double result = round(coordinate * scale);
+    // converting an out of range double is undefined, saturate instead, NaN falls to 0
+    if(result >= (double)INT32_MAX) return INT32_MAX;
+    if(result <= (double)INT32_MIN) return INT32_MIN;
+    if(result != result) return 0;
+    return (int32_t)result;
+}
+
+void CFASSFileDialogueTextDrawingContextScale(CFASSFileDialogueTextDrawingContextRef context, double scaleX, double scaleY)
+{
+    if(context == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTextDrawingContext NULL Scale %g %g", scaleX, scaleY);
+    int32_t *coordinates = context->coordinates;
+    for(size_t index = 0; index < context->coordinateAmount; index += 2)
     {
-        content->type = CFASSFileDialogueTextDrawingContextContentTypeCloseBSpline;
-        content->data = NULL;       // significant to assign NULL, otherwise destory function will crack
-        CFPointerArrayAddPointer(context->contentArray, content, false);
-        free(content);
+        coordinates[index] = CFASSFileDialogueTextDrawingContextScaleCoordinate(coordinates[index], scaleX);
+        coordinates[index+1] = CFASSFileDialogueTextDrawingContextScaleCoordinate(coordinates[index+1], scaleY);
     }
 }
 
+#pragma mark - Get Component
+
+size_t CFASSFileDialogueTextDrawingContextGetCommandAmount(CFASSFileDialogueTextDrawingContextRef context)
+{
+    if(context == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTextDrawingContext NULL GetCommandAmount");
+    return context->commandAmount;
+}
+
+size_t CFASSFileDialogueTextDrawingContextGetPointAmount(CFASSFileDialogueTextDrawingContextRef context)
+{
+    if(context == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTextDrawingContext NULL GetPointAmount");
+    return context->coordinateAmount / 2;
+}
+
+const unsigned char *CFASSFileDialogueTextDrawingContextGetCommands(CFASSFileDialogueTextDrawingContextRef context)
+{
+    if(context == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTextDrawingContext NULL GetCommands");
+    return context->commands;
+}
+
+const int32_t *CFASSFileDialogueTextDrawingContextGetCoordinates(CFASSFileDialogueTextDrawingContextRef context)
+{
+    if(context == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTextDrawingContext NULL GetCoordinates");
+    return context->coordinates;
+}
+
+unsigned int CFASSFileDialogueTextDrawingContextCommandGetPointAmount(CFASSFileDialogueTextDrawingContextCommand command)
+{
+    return CFASSFileDialogueTextDrawingContextCommandPointAmount[command];
+}
+
+#pragma mark - Allocate Result
+
 wchar_t *CFASSFileDialogueTextDrawingContextAllocateString(CFASSFileDialogueTextDrawingContextRef context)
 {
-    if(CFASSFileDialogueTextDrawingContextCheckValidation(context))
+    if(!CFASSFileDialogueTextDrawingContextCheckValidation(context))
+        return NULL;
+    CFMutableStringRef string;
+    if((string = CFMutableStringCreateEmpty()) == NULL)
+        return NULL;
+    if(CFASSFileDialogueTextDrawingContextAppendString(context, string) != 0)
+    {
+        CFMutableStringDestory(string);
+        return NULL;
+    }
+    return CFMutableStringDestoryAndStealCharacters(string, NULL);
+}
+
+int CFASSFileDialogueTextDrawingContextAppendString(CFASSFileDialogueTextDrawingContextRef context, CFMutableStringRef string)
+{
+    if(context == NULL || string == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTextDrawingContext %p AppendString %p", context, string);
+    size_t beginLength = CFMutableStringGetLength(string);
+    // about 5 characters each coordinate, reserve once instead of growing on the way
+    CFMutableStringReserve(string, context->commandAmount * 2 + context->coordinateAmount * 5);
+    const int32_t *coordinates = context->coordinates;
+    CFASSFileDialogueTextDrawingContextCommand previousCommand = CFASSFileDialogueTextDrawingContextCommandMove;
+    for(size_t index = 0; index<context->commandAmount; index++)
     {
-        FILE *fp;
-        if((fp = tmpfile())!=NULL)
+        CFASSFileDialogueTextDrawingContextCommand command = context->commands[index];
+        const wchar_t *commandString = NULL;    // NULL when the previous command continues
+        switch (command) {
+            case CFASSFileDialogueTextDrawingContextCommandMove:
+                commandString = L"m ";
+                break;
+            case CFASSFileDialogueTextDrawingContextCommandMoveNotClosing:
+                commandString = L"n ";
+                break;
+            case CFASSFileDialogueTextDrawingContextCommandLine:
+                if(index==0 || previousCommand != CFASSFileDialogueTextDrawingContextCommandLine)
+                    commandString = L"l ";
+                break;
+            case CFASSFileDialogueTextDrawingContextCommandBezier:
+                if(index==0 || previousCommand != CFASSFileDialogueTextDrawingContextCommandBezier)
+                    commandString = L"b ";
+                break;
+            case CFASSFileDialogueTextDrawingContextCommandBSpline:
+                commandString = L"s ";
+                break;
+            case CFASSFileDialogueTextDrawingContextCommandExtendBSpline:
+                if(previousCommand != CFASSFileDialogueTextDrawingContextCommandExtendBSpline)
+                    commandString = L"p ";
+                break;
+            case CFASSFileDialogueTextDrawingContextCommandExtendBSplineAttached:
+                break;
+            case CFASSFileDialogueTextDrawingContextCommandCloseBSpline:
+                commandString = L"c ";
+                break;
+        }
+        if(commandString != NULL)
+            CFMutableStringAppendString(string, commandString);
+        unsigned int coordinateAmount = 2 * CFASSFileDialogueTextDrawingContextCommandPointAmount[command];
+        for(unsigned int count = 0; count < coordinateAmount; count++)
         {
-            size_t contentAmount = CFPointerArrayGetLength(context->contentArray);
-            CFASSFileDialogueTextDrawingContextContentRef content;
-            size_t stringLength = 0;
-            int temp;
-            bool creationSuccess = true;
-            
-            CFASSFileDialogueTextDrawingContextContentType previousType = CFASSFileDialogueTextDrawingContextContentTypeMove;
-            bool previousExtendBSplineAttached = false;
-            for(size_t index = 0; index<contentAmount && creationSuccess; index++)
-            {
-                content = CFPointerArrayGetPointerAtIndex(context->contentArray, 1);
-                switch (content->type) {
-                    case CFASSFileDialogueTextDrawingContextContentTypeMove:
-                        if(((CFASSFileDialogueTextDrawingContextMoveContentRef)content->data)->closePath)
-                            temp = fwprintf(fp, L"m %d %d ",
-                                            ((CFASSFileDialogueTextDrawingContextMoveContentRef)content->data)->x,
-                                            ((CFASSFileDialogueTextDrawingContextMoveContentRef)content->data)->y);
-                        else
-                            temp = fwprintf(fp, L"n %d %d ",
-                                            ((CFASSFileDialogueTextDrawingContextMoveContentRef)content->data)->x,
-                                            ((CFASSFileDialogueTextDrawingContextMoveContentRef)content->data)->y);
-                        previousType = CFASSFileDialogueTextDrawingContextContentTypeMove;
-                        break;
-                    case CFASSFileDialogueTextDrawingContextContentTypeLine:
-                        if(index!=0 && previousType == CFASSFileDialogueTextDrawingContextContentTypeLine)
-                            temp = fwprintf(fp, L"%d %d ",
-                                            ((CFASSFileDialogueTextDrawingContextLineContentRef)content->data)->x,
-                                            ((CFASSFileDialogueTextDrawingContextMoveContentRef)content->data)->y);
-                        else
-                        {
-                            temp = fwprintf(fp, L"l %d %d ",
-                                            ((CFASSFileDialogueTextDrawingContextLineContentRef)content->data)->x,
-                                            ((CFASSFileDialogueTextDrawingContextMoveContentRef)content->data)->y);
-                            previousType = CFASSFileDialogueTextDrawingContextContentTypeLine;
-                        }
-                        break;
-                    case CFASSFileDialogueTextDrawingContextContentTypeBezier:
-                        if(index!=0 && previousType == CFASSFileDialogueTextDrawingContextContentTypeBezier)
-                            temp = fwprintf(fp, L"%d %d %d %d %d %d ",
-                                            ((CFASSFileDialogueTextDrawingContextBezierContentRef)content->data)->x1,
-                                            ((CFASSFileDialogueTextDrawingContextBezierContentRef)content->data)->y1,
-                                            ((CFASSFileDialogueTextDrawingContextBezierContentRef)content->data)->x2,
-                                            ((CFASSFileDialogueTextDrawingContextBezierContentRef)content->data)->y2,
-                                            ((CFASSFileDialogueTextDrawingContextBezierContentRef)content->data)->x3,
-                                            ((CFASSFileDialogueTextDrawingContextBezierContentRef)content->data)->y3);
-                        else
-                        {
-                            temp = fwprintf(fp, L"b %d %d %d %d %d %d ",
-                                            ((CFASSFileDialogueTextDrawingContextBezierContentRef)content->data)->x1,
-                                            ((CFASSFileDialogueTextDrawingContextBezierContentRef)content->data)->y1,
-                                            ((CFASSFileDialogueTextDrawingContextBezierContentRef)content->data)->x2,
-                                            ((CFASSFileDialogueTextDrawingContextBezierContentRef)content->data)->y2,
-                                            ((CFASSFileDialogueTextDrawingContextBezierContentRef)content->data)->x3,
-                                            ((CFASSFileDialogueTextDrawingContextBezierContentRef)content->data)->y3);
-                            previousType = CFASSFileDialogueTextDrawingContextContentTypeBezier;
-                        }
-                        break;
-                    case CFASSFileDialogueTextDrawingContextContentTypeBSpline:
-                        temp = fwprintf(fp, L"b %d %d %d %d %d %d ",
-                                        ((CFASSFileDialogueTextDrawingContextBSplineContentRef)content->data)->x1,
-                                        ((CFASSFileDialogueTextDrawingContextBSplineContentRef)content->data)->y1,
-                                        ((CFASSFileDialogueTextDrawingContextBSplineContentRef)content->data)->x2,
-                                        ((CFASSFileDialogueTextDrawingContextBSplineContentRef)content->data)->y2,
-                                        ((CFASSFileDialogueTextDrawingContextBSplineContentRef)content->data)->x3,
-                                        ((CFASSFileDialogueTextDrawingContextBSplineContentRef)content->data)->y3);
-                        previousType = CFASSFileDialogueTextDrawingContextContentTypeBSpline;
-                        break;
-                    case CFASSFileDialogueTextDrawingContextContentTypeExtendBSpline:
-                        if(((CFASSFileDialogueTextDrawingContextExtendBSplineContentRef)content->data)->attachToPreviousBSplineContent)
-                        {
-                            temp = fwprintf(fp, L"%d %d ",
-                                            ((CFASSFileDialogueTextDrawingContextExtendBSplineContentRef)content->data)->x,
-                                            ((CFASSFileDialogueTextDrawingContextExtendBSplineContentRef)content->data)->y);
-                            previousExtendBSplineAttached = true;
-                        }
-                        else
-                        {
-                            
-                            if(previousType == CFASSFileDialogueTextDrawingContextContentTypeExtendBSpline && !previousExtendBSplineAttached)
-                                temp = fwprintf(fp, L"%d %d ",
-                                                ((CFASSFileDialogueTextDrawingContextExtendBSplineContentRef)content->data)->x,
-                                                ((CFASSFileDialogueTextDrawingContextExtendBSplineContentRef)content->data)->y);
-                            else
-                                temp = fwprintf(fp, L"p %d %d ",
-                                                ((CFASSFileDialogueTextDrawingContextExtendBSplineContentRef)content->data)->x,
-                                                ((CFASSFileDialogueTextDrawingContextExtendBSplineContentRef)content->data)->y);
-                            previousExtendBSplineAttached = false;
-                        }
-                        previousType = CFASSFileDialogueTextDrawingContextContentTypeExtendBSpline;
-                        break;
-                    case CFASSFileDialogueTextDrawingContextContentTypeCloseBSpline:
-                        temp = fwprintf(fp, L"c ");
-                        break;
-                }
-                if(temp<0) creationSuccess = false;
-                else stringLength += temp;
-            }
-            fclose(fp);
-            if(creationSuccess)
-            {
-                stringLength--; // blank spacing remaining
-                wchar_t *result;
-                if((result = malloc(sizeof(wchar_t)*(stringLength+1))) != NULL)
-                {
-                    wchar_t *beginPoint = result;
-                    size_t currentRemainLength = stringLength;
-                    
-                    previousExtendBSplineAttached = false;
-                    previousType = CFASSFileDialogueTextDrawingContextContentTypeMove;
-                    for(size_t index = 0; index<contentAmount && creationSuccess; index++)
-                    {
-                        content = CFPointerArrayGetPointerAtIndex(context->contentArray, 1);
-                        switch (content->type) {
-                            case CFASSFileDialogueTextDrawingContextContentTypeMove:
-                                if(((CFASSFileDialogueTextDrawingContextMoveContentRef)content->data)->closePath)
-                                    temp = swprintf(beginPoint, currentRemainLength+1, L"m %d %d ",
-                                                    ((CFASSFileDialogueTextDrawingContextMoveContentRef)content->data)->x,
-                                                    ((CFASSFileDialogueTextDrawingContextMoveContentRef)content->data)->y);
-                                else
-                                    temp = swprintf(beginPoint, currentRemainLength+1, L"n %d %d ",
-                                                    ((CFASSFileDialogueTextDrawingContextMoveContentRef)content->data)->x,
-                                                    ((CFASSFileDialogueTextDrawingContextMoveContentRef)content->data)->y);
-                                previousType = CFASSFileDialogueTextDrawingContextContentTypeMove;
-                                break;
-                            case CFASSFileDialogueTextDrawingContextContentTypeLine:
-                                if(index!=0 && previousType == CFASSFileDialogueTextDrawingContextContentTypeLine)
-                                    temp = swprintf(beginPoint, currentRemainLength+1, L"%d %d ",
-                                                    ((CFASSFileDialogueTextDrawingContextLineContentRef)content->data)->x,
-                                                    ((CFASSFileDialogueTextDrawingContextMoveContentRef)content->data)->y);
-                                else
-                                {
-                                    temp = swprintf(beginPoint, currentRemainLength+1, L"l %d %d ",
-                                                    ((CFASSFileDialogueTextDrawingContextLineContentRef)content->data)->x,
-                                                    ((CFASSFileDialogueTextDrawingContextMoveContentRef)content->data)->y);
-                                    previousType = CFASSFileDialogueTextDrawingContextContentTypeLine;
-                                }
-                                break;
-                            case CFASSFileDialogueTextDrawingContextContentTypeBezier:
-                                if(index!=0 && previousType == CFASSFileDialogueTextDrawingContextContentTypeBezier)
-                                    temp = swprintf(beginPoint, currentRemainLength+1, L"%d %d %d %d %d %d ",
-                                                    ((CFASSFileDialogueTextDrawingContextBezierContentRef)content->data)->x1,
-                                                    ((CFASSFileDialogueTextDrawingContextBezierContentRef)content->data)->y1,
-                                                    ((CFASSFileDialogueTextDrawingContextBezierContentRef)content->data)->x2,
-                                                    ((CFASSFileDialogueTextDrawingContextBezierContentRef)content->data)->y2,
-                                                    ((CFASSFileDialogueTextDrawingContextBezierContentRef)content->data)->x3,
-                                                    ((CFASSFileDialogueTextDrawingContextBezierContentRef)content->data)->y3);
-                                else
-                                {
-                                    temp = swprintf(beginPoint, currentRemainLength+1, L"b %d %d %d %d %d %d ",
-                                                    ((CFASSFileDialogueTextDrawingContextBezierContentRef)content->data)->x1,
-                                                    ((CFASSFileDialogueTextDrawingContextBezierContentRef)content->data)->y1,
-                                                    ((CFASSFileDialogueTextDrawingContextBezierContentRef)content->data)->x2,
-                                                    ((CFASSFileDialogueTextDrawingContextBezierContentRef)content->data)->y2,
-                                                    ((CFASSFileDialogueTextDrawingContextBezierContentRef)content->data)->x3,
-                                                    ((CFASSFileDialogueTextDrawingContextBezierContentRef)content->data)->y3);
-                                    previousType = CFASSFileDialogueTextDrawingContextContentTypeBezier;
-                                }
-                                break;
-                            case CFASSFileDialogueTextDrawingContextContentTypeBSpline:
-                                temp = swprintf(beginPoint, currentRemainLength+1, L"b %d %d %d %d %d %d ",
-                                                ((CFASSFileDialogueTextDrawingContextBSplineContentRef)content->data)->x1,
-                                                ((CFASSFileDialogueTextDrawingContextBSplineContentRef)content->data)->y1,
-                                                ((CFASSFileDialogueTextDrawingContextBSplineContentRef)content->data)->x2,
-                                                ((CFASSFileDialogueTextDrawingContextBSplineContentRef)content->data)->y2,
-                                                ((CFASSFileDialogueTextDrawingContextBSplineContentRef)content->data)->x3,
-                                                ((CFASSFileDialogueTextDrawingContextBSplineContentRef)content->data)->y3);
-                                previousType = CFASSFileDialogueTextDrawingContextContentTypeBSpline;
-                                break;
-                            case CFASSFileDialogueTextDrawingContextContentTypeExtendBSpline:
-                                if(((CFASSFileDialogueTextDrawingContextExtendBSplineContentRef)content->data)->attachToPreviousBSplineContent)
-                                {
-                                    temp = swprintf(beginPoint, currentRemainLength+1, L"%d %d ",
-                                                    ((CFASSFileDialogueTextDrawingContextExtendBSplineContentRef)content->data)->x,
-                                                    ((CFASSFileDialogueTextDrawingContextExtendBSplineContentRef)content->data)->y);
-                                    previousExtendBSplineAttached = true;
-                                }
-                                else
-                                {
-                                    
-                                    if(previousType == CFASSFileDialogueTextDrawingContextContentTypeExtendBSpline && !previousExtendBSplineAttached)
-                                        temp = swprintf(beginPoint, currentRemainLength+1, L"%d %d ",
-                                                        ((CFASSFileDialogueTextDrawingContextExtendBSplineContentRef)content->data)->x,
-                                                        ((CFASSFileDialogueTextDrawingContextExtendBSplineContentRef)content->data)->y);
-                                    else
-                                        temp = swprintf(beginPoint, currentRemainLength+1, L"p %d %d ",
-                                                        ((CFASSFileDialogueTextDrawingContextExtendBSplineContentRef)content->data)->x,
-                                                        ((CFASSFileDialogueTextDrawingContextExtendBSplineContentRef)content->data)->y);
-                                    previousExtendBSplineAttached = false;
-                                }
-                                previousType = CFASSFileDialogueTextDrawingContextContentTypeExtendBSpline;
-                                break;
-                            case CFASSFileDialogueTextDrawingContextContentTypeCloseBSpline:
-                                temp = swprintf(beginPoint, currentRemainLength+1, L"c ");
-                                break;
-                        }
-                        beginPoint += temp;
-                        currentRemainLength -= temp;
-                    }
-                    return result;
-                }
-            }
+            CFMutableStringAppendInteger(string, *coordinates++);
+            CFMutableStringAppendCharacter(string, L' ');
         }
+        previousCommand = command;      // l b p after c must spell out their letter again
     }
-    return NULL;
+    if(CFMutableStringIsFailed(string))
+        return -1;
+    // blank spacing remaining
+    if(CFMutableStringGetLength(string) > beginLength)
+        CFMutableStringTruncate(string, CFMutableStringGetLength(string) - 1);
+    return 0;
 }
 
 bool CFASSFileDialogueTextDrawingContextCheckValidation(CFASSFileDialogueTextDrawingContextRef context)
 {
-    CFPointerArrayRef array = context->contentArray;
-    CFASSFileDialogueTextDrawingContextContentRef content;
-    size_t length = CFPointerArrayGetLength(context->contentArray);
+    const unsigned char *commands = context->commands;
+    size_t length = context->commandAmount;
     if(length <= 1)
         return false;
-    if((content = CFPointerArrayGetPointerAtIndex(array, 1))->type != CFASSFileDialogueTextDrawingContextContentTypeMove)
+    if(commands[0] != CFASSFileDialogueTextDrawingContextCommandMove &&
+       commands[0] != CFASSFileDialogueTextDrawingContextCommandMoveNotClosing)
         return false;
-    CFASSFileDialogueTextDrawingContextContentType previousType = CFASSFileDialogueTextDrawingContextContentTypeMove;
-    for(size_t index = 2; index<length; index++)
-    {
-        content = CFPointerArrayGetPointerAtIndex(array, 1);
-        if(content->type == CFASSFileDialogueTextDrawingContextContentTypeExtendBSpline &&
-           previousType!=CFASSFileDialogueTextDrawingContextContentTypeExtendBSpline &&
-           previousType!=CFASSFileDialogueTextDrawingContextContentTypeBSpline)
+    for(size_t index = 1; index<length; index++)
+        if((commands[index] == CFASSFileDialogueTextDrawingContextCommandExtendBSpline ||
+            commands[index] == CFASSFileDialogueTextDrawingContextCommandExtendBSplineAttached) &&
+           commands[index-1] != CFASSFileDialogueTextDrawingContextCommandBSpline &&
+           commands[index-1] != CFASSFileDialogueTextDrawingContextCommandExtendBSpline &&
+           commands[index-1] != CFASSFileDialogueTextDrawingContextCommandExtendBSplineAttached)
             return false;
-        previousType = content->type;
+    return true;
+}
+
+static bool CFASSFileDialogueTextDrawingContextScanCoordinate(const wchar_t **scanPoint, int *coordinate)
+{
+    const wchar_t *scan = *scanPoint;
+    while(*scan == L' ' || *scan == L'\t') scan++;
+    bool negative = false;
+    if(*scan == L'-' || *scan == L'+')
+        negative = *scan++ == L'-';
+    bool hasDigit = false;
+    int64_t value = 0;
+    while(*scan >= L'0' && *scan <= L'9')
+    {
+        value = value * 10 + (*scan++ - L'0');
+        if(value > (int64_t)INT32_MAX + 1) return false;
+        hasDigit = true;
+    }
+    if(*scan == L'.')
+    {
+        // coordinates are stored as integers, the first fraction digit decides the rounding
+        scan++;
+        if(*scan >= L'5' && *scan <= L'9') value++;
+        while(*scan >= L'0' && *scan <= L'9')
+        {
+            scan++;
+            hasDigit = true;
+        }
     }
+    if(!hasDigit) return false;
+    if(negative) value = -value;
+    if(value > INT32_MAX || value < INT32_MIN) return false;
+    *coordinate = (int)value;
+    *scanPoint = scan;
     return true;
 }
 
@@ -471,113 +339,107 @@ CFASSFileDialogueTextDrawingContextRef CFASSFileDialogueTextDrawingContextCreate
 {
     if(string == NULL)
         CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTextDrawingContextCreateFromString NULL");
-    if(string == L'\0')
-        return NULL;
     CFASSFileDialogueTextDrawingContextRef result;
     if((result = CFASSFileDialogueTextDrawingContextCreate()) != NULL)
     {
-        const wchar_t *beginPoint = string;
-        int temp1, temp2, temp3, temp4, temp5, temp6;
-        CFASSFileDialogueTextDrawingContextContentType previousType = CFASSFileDialogueTextDrawingContextContentTypeLine;
-        bool firstDrawingCode = true;
+        const wchar_t *scan = string;
+        int coordinates[6];
+        bool hasContinuation = false;       // bare coordinates repeat the previous command
+        CFASSFileDialogueTextDrawingContextCommand continuation = CFASSFileDialogueTextDrawingContextCommandLine;
         bool formatCheck = true;
-        while (*beginPoint!=L'\0' && formatCheck) {
-            if(swscanf(beginPoint, L"m %d %d", &temp1, &temp2) == 2)
-            {
-                CFASSFileDialogueTextDrawingContextMoveToPosition(result, temp1, temp2, true);
-                previousType = CFASSFileDialogueTextDrawingContextContentTypeMove;
-                beginPoint = CFASSFileDialogueTextDrawingContextCreateFromStringSkipElement(beginPoint, 3);
-            }
-            else if(swscanf(beginPoint, L"n %d %d", &temp1, &temp2) == 2)
-            {
-                CFASSFileDialogueTextDrawingContextMoveToPosition(result, temp1, temp2, false);
-                previousType = CFASSFileDialogueTextDrawingContextContentTypeMove;
-                beginPoint = CFASSFileDialogueTextDrawingContextCreateFromStringSkipElement(beginPoint, 3);
-            }
-            else if(swscanf(beginPoint, L"l %d %d", &temp1, &temp2) == 2)
-            {
-                CFASSFileDialogueTextDrawingContextDrawLine(result, temp1, temp2);
-                previousType = CFASSFileDialogueTextDrawingContextContentTypeLine;
-                beginPoint = CFASSFileDialogueTextDrawingContextCreateFromStringSkipElement(beginPoint, 3);
-            }
-            else if(swscanf(beginPoint, L"b %d %d %d %d %d %d", &temp1, &temp2, &temp3, &temp4, &temp5, &temp6) == 6)
-            {
-                CFASSFileDialogueTextDrawingContextDrawBezier(result, temp1, temp2, temp3, temp4, temp5, temp6);
-                previousType = CFASSFileDialogueTextDrawingContextContentTypeBezier;
-                beginPoint = CFASSFileDialogueTextDrawingContextCreateFromStringSkipElement(beginPoint, 7);
-            }
-            else if(swscanf(beginPoint, L"s %d %d %d %d %d %d", &temp1, &temp2, &temp3, &temp4, &temp5, &temp6) == 6)
-            {
-                CFASSFileDialogueTextDrawingContextDrawBSpline(result, temp1, temp2, temp3, temp4, temp5, temp6);
-                previousType = CFASSFileDialogueTextDrawingContextContentTypeBSpline;
-                beginPoint = CFASSFileDialogueTextDrawingContextCreateFromStringSkipElement(beginPoint, 7);
-            }
-            else if(swscanf(beginPoint, L"p %d %d", &temp1, &temp2) == 2)
-            {
-                CFASSFileDialogueTextDrawingContextExtendBSpline(result, temp1, temp2, false);
-                previousType = CFASSFileDialogueTextDrawingContextContentTypeExtendBSpline;
-                beginPoint = CFASSFileDialogueTextDrawingContextCreateFromStringSkipElement(beginPoint, 3);
-            }
-            else if(!firstDrawingCode)
-            {
-                if(previousType == CFASSFileDialogueTextDrawingContextContentTypeLine &&
-                   swscanf(beginPoint, L"%d %d", &temp1, &temp2) == 2)
-                {
-                    CFASSFileDialogueTextDrawingContextDrawLine(result, temp1, temp2);
-                    previousType = CFASSFileDialogueTextDrawingContextContentTypeLine;
-                    beginPoint = CFASSFileDialogueTextDrawingContextCreateFromStringSkipElement(beginPoint, 2);
-                }
-                else if(previousType == CFASSFileDialogueTextDrawingContextContentTypeBezier &&
-                        swscanf(beginPoint, L"%d %d %d %d %d %d", &temp1, &temp2, &temp3, &temp4, &temp5, &temp6) == 6)
-                {
-                    CFASSFileDialogueTextDrawingContextDrawBezier(result, temp1, temp2, temp3, temp4, temp5, temp6);
-                    previousType = CFASSFileDialogueTextDrawingContextContentTypeBezier;
-                    beginPoint = CFASSFileDialogueTextDrawingContextCreateFromStringSkipElement(beginPoint, 6);
-                }
-                else if(previousType == CFASSFileDialogueTextDrawingContextContentTypeBSpline &&
-                        swscanf(beginPoint, L"%d %d", &temp1, &temp2) == 2)
-                {
-                    CFASSFileDialogueTextDrawingContextExtendBSpline(result, temp1, temp2, true);
-                    previousType = CFASSFileDialogueTextDrawingContextContentTypeBSpline;
-                    beginPoint = CFASSFileDialogueTextDrawingContextCreateFromStringSkipElement(beginPoint, 2);
-                }
-                else if(previousType == CFASSFileDialogueTextDrawingContextContentTypeExtendBSpline &&
-                        swscanf(beginPoint, L"%d %d", &temp1, &temp2) == 2)
-                {
-                    CFASSFileDialogueTextDrawingContextExtendBSpline(result, temp1, temp2, false);
-                    previousType = CFASSFileDialogueTextDrawingContextContentTypeExtendBSpline;
-                    beginPoint = CFASSFileDialogueTextDrawingContextCreateFromStringSkipElement(beginPoint, 2);
-                }
-                else
-                    formatCheck = false;
+        while(formatCheck)
+        {
+            while(*scan == L' ' || *scan == L'\t') scan++;
+            if(*scan == L'\0') break;
+            CFASSFileDialogueTextDrawingContextCommand command;
+            bool hasLetter = true;
+            switch (*scan) {
+                case L'm': command = CFASSFileDialogueTextDrawingContextCommandMove; break;
+                case L'n': command = CFASSFileDialogueTextDrawingContextCommandMoveNotClosing; break;
+                case L'l': command = CFASSFileDialogueTextDrawingContextCommandLine; break;
+                case L'b': command = CFASSFileDialogueTextDrawingContextCommandBezier; break;
+                case L's': command = CFASSFileDialogueTextDrawingContextCommandBSpline; break;
+                case L'p': command = CFASSFileDialogueTextDrawingContextCommandExtendBSpline; break;
+                case L'c': command = CFASSFileDialogueTextDrawingContextCommandCloseBSpline; break;
+                default:
+                    if(!hasContinuation)
+                    {
+                        formatCheck = false;
+                        continue;
+                    }
+                    command = continuation;
+                    hasLetter = false;
+                    break;
             }
-            else
+            if(hasLetter) scan++;
+            if(result->commandAmount == 0 &&
+               command != CFASSFileDialogueTextDrawingContextCommandMove &&
+               command != CFASSFileDialogueTextDrawingContextCommandMoveNotClosing)
                 formatCheck = false;
-            if(firstDrawingCode && previousType!=CFASSFileDialogueTextDrawingContextContentTypeMove)
-                formatCheck = false;
-            firstDrawingCode = false;
+            else if(command == CFASSFileDialogueTextDrawingContextCommandExtendBSpline &&
+                    (!hasContinuation ||
+                     (continuation != CFASSFileDialogueTextDrawingContextCommandExtendBSpline &&
+                      continuation != CFASSFileDialogueTextDrawingContextCommandExtendBSplineAttached)))
+                formatCheck = false;        // p must extend a b-spline
+            unsigned int coordinateAmount = 2 * CFASSFileDialogueTextDrawingContextCommandPointAmount[command];
+            for(unsigned int index = 0; index < coordinateAmount && formatCheck; index++)
+                formatCheck = CFASSFileDialogueTextDrawingContextScanCoordinate(&scan, &coordinates[index]);
+            if(formatCheck)
+                formatCheck = CFASSFileDialogueTextDrawingContextAddCommand(result, command, coordinates) == 0;
+            switch (command) {
+                case CFASSFileDialogueTextDrawingContextCommandLine:
+                case CFASSFileDialogueTextDrawingContextCommandBezier:
+                case CFASSFileDialogueTextDrawingContextCommandExtendBSpline:
+                case CFASSFileDialogueTextDrawingContextCommandExtendBSplineAttached:
+                    hasContinuation = true;
+                    continuation = command;
+                    break;
+                case CFASSFileDialogueTextDrawingContextCommandBSpline:
+                    hasContinuation = true;
+                    continuation = CFASSFileDialogueTextDrawingContextCommandExtendBSplineAttached;
+                    break;
+                default:
+                    hasContinuation = false;
+                    break;
+            }
         }
-        if(formatCheck)
+        if(formatCheck && result->commandAmount != 0)
             return result;
         CFASSFileDialogueTextDrawingContextDestory(result);
     }
     return NULL;
 }
 
-static const wchar_t *CFASSFileDialogueTextDrawingContextCreateFromStringSkipElement(const wchar_t *beginPoint, unsigned int elementAmount)
+#pragma mark - Private
+
+static int CFASSFileDialogueTextDrawingContextAddCommand(CFASSFileDialogueTextDrawingContextRef context,
+                                                         CFASSFileDialogueTextDrawingContextCommand command,
+                                                         const int *coordinates)
 {
-    if(beginPoint == NULL)
-        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTextDrawingContextCreateFromString NULL SkipElement");
-    const wchar_t *search;
-    const wchar_t *unfoundResult = beginPoint + wcslen(beginPoint);
-    for(unsigned int count = 1; count<=elementAmount; count++)
+    if(context == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTextDrawingContext NULL AddCommand %d", (int)command);
+    unsigned int coordinateAmount = 2 * CFASSFileDialogueTextDrawingContextCommandPointAmount[command];
+    if(context->commandAmount == context->commandCapacity)
+    {
+        unsigned char *commands;
+        if((commands = realloc(context->commands, sizeof(unsigned char) * context->commandCapacity * 2)) == NULL)
+            return -1;
+        context->commands = commands;
+        context->commandCapacity *= 2;
+    }
+    if(context->coordinateAmount + coordinateAmount > context->coordinateCapacity)
     {
-        search = wcschr(beginPoint, L' ');
-        if(search == NULL)
-            return unfoundResult;
-        beginPoint = search;
-        while(*beginPoint==L' ') beginPoint++;
-        /* if now beginPoint is '\0', it is OK */
+        size_t capacity = context->coordinateCapacity * 2;
+        if(capacity < context->coordinateAmount + coordinateAmount)
+            capacity = context->coordinateAmount + coordinateAmount;
+        int32_t *resizedCoordinates;
+        if((resizedCoordinates = realloc(context->coordinates, sizeof(int32_t) * capacity)) == NULL)
+            return -1;
+        context->coordinates = resizedCoordinates;
+        context->coordinateCapacity = capacity;
     }
-    return beginPoint;
+    context->commands[context->commandAmount++] = (unsigned char)command;
+    for(unsigned int index = 0; index < coordinateAmount; index++)
+        context->coordinates[context->coordinateAmount++] = (int32_t)coordinates[index];
+    return 0;
 }
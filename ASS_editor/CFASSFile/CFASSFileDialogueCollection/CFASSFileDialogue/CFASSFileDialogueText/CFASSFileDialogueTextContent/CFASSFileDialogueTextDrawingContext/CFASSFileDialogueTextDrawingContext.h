@@ -10,6 +10,7 @@
 #define CFASSFileDialogueTextDrawingContext_h
 
 #include <stdbool.h>
+#include <stddef.h>
 
 typedef struct CFASSFileDialogueTextDrawingContext *CFASSFileDialogueTextDrawingContextRef;
 
@@ -35,4 +36,18 @@ void CFASSFileDialogueTextDrawingContextExtendBSpline(CFASSFileDialogueTextDrawi
 
 void CFASSFileDialogueTextDrawingContextClose(CFASSFileDialogueTextDrawingContextRef context);
 
+#pragma mark - Transform
+
+void CFASSFileDialogueTextDrawingContextTranslate(CFASSFileDialogueTextDrawingContextRef context, int x, int y);
+
+void CFASSFileDialogueTextDrawingContextScale(CFASSFileDialogueTextDrawingContextRef context, double scaleX, double scaleY);
+/* Discussion */
+// every coordinate is rounded to the nearest integer after scaling
+
+#pragma mark - Get Component
+
+size_t CFASSFileDialogueTextDrawingContextGetCommandAmount(CFASSFileDialogueTextDrawingContextRef context);
+
+size_t CFASSFileDialogueTextDrawingContextGetPointAmount(CFASSFileDialogueTextDrawingContextRef context);
+
 #endif /* CFASSFileDialogueTextDrawing_h */
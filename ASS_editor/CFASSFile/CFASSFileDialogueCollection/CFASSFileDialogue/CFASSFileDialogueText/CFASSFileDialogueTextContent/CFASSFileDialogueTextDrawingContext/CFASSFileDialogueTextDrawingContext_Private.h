@@ -9,11 +9,52 @@
 #ifndef CFASSFileDialogueTextDrawingContext_Private_h
 #define CFASSFileDialogueTextDrawingContext_Private_h
 
+#include <stdint.h>
+#include <wchar.h>
+
 #include "CFASSFileDialogueTextDrawingContext.h"
+#include "CFMutableString.h"
+
+#pragma mark - Flat Storage
+
+typedef enum CFASSFileDialogueTextDrawingContextCommand {
+    CFASSFileDialogueTextDrawingContextCommandMove,                     // m, 1 point
+    CFASSFileDialogueTextDrawingContextCommandMoveNotClosing,           // n, 1 point
+    CFASSFileDialogueTextDrawingContextCommandLine,                     // l, 1 point
+    CFASSFileDialogueTextDrawingContextCommandBezier,                   // b, 3 points
+    CFASSFileDialogueTextDrawingContextCommandBSpline,                  // s, 3 points
+    CFASSFileDialogueTextDrawingContextCommandExtendBSpline,            // p, 1 point
+    CFASSFileDialogueTextDrawingContextCommandExtendBSplineAttached,    // more point of s, 1 point
+    CFASSFileDialogueTextDrawingContextCommandCloseBSpline              // c, no point
+} CFASSFileDialogueTextDrawingContextCommand;
+
+const unsigned char *CFASSFileDialogueTextDrawingContextGetCommands(CFASSFileDialogueTextDrawingContextRef context);
+/* Return */
+// CFASSFileDialogueTextDrawingContextGetCommandAmount commands, one CFASSFileDialogueTextDrawingContextCommand each
+
+const int32_t *CFASSFileDialogueTextDrawingContextGetCoordinates(CFASSFileDialogueTextDrawingContextRef context);
+/* Return */
+// x, y of every point packed in command order, 2 * CFASSFileDialogueTextDrawingContextGetPointAmount integers
+/* Discussion */
+// both arrays are owned by context, invalid after the next command is added
+
+unsigned int CFASSFileDialogueTextDrawingContextCommandGetPointAmount(CFASSFileDialogueTextDrawingContextCommand command);
+
+#pragma mark - Read/Write String
 
 wchar_t *CFASSFileDialogueTextDrawingContextAllocateString(CFASSFileDialogueTextDrawingContextRef context);
 
+int CFASSFileDialogueTextDrawingContextAppendString(CFASSFileDialogueTextDrawingContextRef context, CFMutableStringRef string);
+/* Return */
+// 0 for success, -1 if anything went wrong
+// drawing commands separated by blank, without trailing blank
+
 CFASSFileDialogueTextDrawingContextRef CFASSFileDialogueTextDrawingContextCreateFromString(const wchar_t *string);
+/* Return */
+// NULL if string holds no command, or anything in it is not a drawing command
+/* Discussion */
+// single pass, the first command must be m or n, bare coordinates repeat l b p and extend s
+// fraction coordinates are rounded to the nearest integer
 
 bool CFASSFileDialogueTextDrawingContextCheckValidation(CFASSFileDialogueTextDrawingContextRef context);
 
@@ -0,0 +1,322 @@
+//
+//  CFASSFileDialogueTextDrawingGeometry.c
+//  ASS_editor
+//
+//  Created by Bill Sun on 2018/11/5.
+//  Copyright © 2018 Bill Sun. All rights reserved.
+//
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+
+#include "CFASSFileDialogueTextDrawingGeometry.h"
+#include "CFASSFileDialogueTextDrawingContext.h"
+#include "CFASSFileDialogueTextDrawingContext_Private.h"
+#include "CFException.h"
+
+#define CFASSFileDialogueTextDrawingGeometryMaximumCurveSegment 1024     // bound the work for absurd control points
+
+typedef struct CFASSFileDialogueTextDrawingGeometryVisitor
+{
+    void (*beginFigure)(void *info, CFPoint point);
+    void (*line)(void *info, CFPoint to);
+    void (*cubic)(void *info, const CFPoint control[4]);     // control[0] is always the current point
+    void *info;
+} CFASSFileDialogueTextDrawingGeometryVisitor;
+
+static int CFASSFileDialogueTextDrawingGeometryWalk(CFASSFileDialogueTextDrawingContextRef context,
+                                                    const CFASSFileDialogueTextDrawingGeometryVisitor *visitor);
+
+#pragma mark - Bounding Box
+
+static void CFASSFileDialogueTextDrawingGeometryBoxAddPoint(void *info, CFPoint point)
+{
+    CFRect *box = info;
+    if(point.x < box->minX) box->minX = point.x;
+    if(point.x > box->maxX) box->maxX = point.x;
+    if(point.y < box->minY) box->minY = point.y;
+    if(point.y > box->maxY) box->maxY = point.y;
+}
+
+static void CFASSFileDialogueTextDrawingGeometryBoxAddCubicAxis(double p0, double p1, double p2, double p3,
+                                                                double *minimum, double *maximum)
+{
+    // B'(t) / 3 = a t^2 + b t + c, only roots inside (0, 1) could exceed the end points
+    double a = -p0 + 3*p1 - 3*p2 + p3,
+           b = 2*(p0 - 2*p1 + p2),
+           c = p1 - p0;
+    double roots[2];
+    int rootAmount = 0;
+    if(fabs(a) < 1e-12)
+    {
+        if(fabs(b) > 1e-12) roots[rootAmount++] = -c / b;
+    }
+    else
+    {
+        double discriminant = b*b - 4*a*c;
+        if(discriminant >= 0)
+        {
+            double squareRoot = sqrt(discriminant);
+            roots[rootAmount++] = (-b + squareRoot) / (2*a);
+            roots[rootAmount++] = (-b - squareRoot) / (2*a);
+        }
+    }
+    for(int index = 0; index < rootAmount; index++)
+    {
+        double t = roots[index];
+        if(t <= 0 || t >= 1) continue;
+        double mt = 1 - t;
+        double value = mt*mt*mt*p0 + 3*mt*mt*t*p1 + 3*mt*t*t*p2 + t*t*t*p3;
+        if(value < *minimum) *minimum = value;
+        if(value > *maximum) *maximum = value;
+    }
+}
+
+static void CFASSFileDialogueTextDrawingGeometryBoxAddCubic(void *info, const CFPoint control[4])
+{
+    CFRect *box = info;
+    CFASSFileDialogueTextDrawingGeometryBoxAddPoint(box, control[3]);
+    CFASSFileDialogueTextDrawingGeometryBoxAddCubicAxis(control[0].x, control[1].x, control[2].x, control[3].x, &box->minX, &box->maxX);
+    CFASSFileDialogueTextDrawingGeometryBoxAddCubicAxis(control[0].y, control[1].y, control[2].y, control[3].y, &box->minY, &box->maxY);
+}
+
+int CFASSFileDialogueTextDrawingGeometryGetBoundingBox(CFASSFileDialogueTextDrawingContextRef context, CFRect *box)
+{
+    if(context == NULL || box == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTextDrawingGeometry %p GetBoundingBox %p", context, box);
+    CFRect result = {.minX = INFINITY, .minY = INFINITY, .maxX = -INFINITY, .maxY = -INFINITY};
+    CFASSFileDialogueTextDrawingGeometryVisitor visitor = {
+        .beginFigure = CFASSFileDialogueTextDrawingGeometryBoxAddPoint,
+        .line = CFASSFileDialogueTextDrawingGeometryBoxAddPoint,
+        .cubic = CFASSFileDialogueTextDrawingGeometryBoxAddCubic,
+        .info = &result
+    };
+    if(CFASSFileDialogueTextDrawingGeometryWalk(context, &visitor) != 0)
+        return -1;
+    *box = result;
+    return 0;
+}
+
+#pragma mark - Flatten
+
+typedef struct CFASSFileDialogueTextDrawingGeometryFlattenState
+{
+    double tolerance;
+    CFPoint *points;
+    size_t pointCapacity, pointAmount;
+    size_t *figureEnds;
+    size_t figureCapacity, figureAmount;
+    bool figureBegan;
+} CFASSFileDialogueTextDrawingGeometryFlattenState;
+
+static void CFASSFileDialogueTextDrawingGeometryFlattenEndFigure(CFASSFileDialogueTextDrawingGeometryFlattenState *state)
+{
+    if(!state->figureBegan) return;
+    if(state->figureEnds != NULL && state->figureAmount < state->figureCapacity)
+        state->figureEnds[state->figureAmount] = state->pointAmount;
+    state->figureAmount++;
+    state->figureBegan = false;
+}
+
+static void CFASSFileDialogueTextDrawingGeometryFlattenAddPoint(void *info, CFPoint point)
+{
+    CFASSFileDialogueTextDrawingGeometryFlattenState *state = info;
+    if(state->points != NULL && state->pointAmount < state->pointCapacity)
+        state->points[state->pointAmount] = point;
+    state->pointAmount++;
+}
+
+static void CFASSFileDialogueTextDrawingGeometryFlattenBeginFigure(void *info, CFPoint point)
+{
+    CFASSFileDialogueTextDrawingGeometryFlattenState *state = info;
+    CFASSFileDialogueTextDrawingGeometryFlattenEndFigure(state);
+    state->figureBegan = true;
+    CFASSFileDialogueTextDrawingGeometryFlattenAddPoint(state, point);
+}
+
+static size_t CFASSFileDialogueTextDrawingGeometryCubicSegmentAmount(const CFPoint control[4], double tolerance)
+{
+    // Wang's formula, n = sqrt(3/4 * max|second difference| / tolerance) bounds the distance to the curve
+    double dx1 = control[0].x - 2*control[1].x + control[2].x, dy1 = control[0].y - 2*control[1].y + control[2].y,
+           dx2 = control[1].x - 2*control[2].x + control[3].x, dy2 = control[1].y - 2*control[2].y + control[3].y;
+    double length1 = sqrt(dx1*dx1 + dy1*dy1), length2 = sqrt(dx2*dx2 + dy2*dy2);
+    double segment = ceil(sqrt(0.75 * (length1 > length2 ? length1 : length2) / tolerance));
+    if(!(segment >= 1)) return 1;
+    if(segment > CFASSFileDialogueTextDrawingGeometryMaximumCurveSegment) return CFASSFileDialogueTextDrawingGeometryMaximumCurveSegment;
+    return (size_t)segment;
+}
+
+static void CFASSFileDialogueTextDrawingGeometryFlattenCubic(void *info, const CFPoint control[4])
+{
+    CFASSFileDialogueTextDrawingGeometryFlattenState *state = info;
+    size_t segmentAmount = CFASSFileDialogueTextDrawingGeometryCubicSegmentAmount(control, state->tolerance);
+    if(state->points == NULL || state->pointAmount + segmentAmount > state->pointCapacity)
+    {
+        state->pointAmount += segmentAmount;        // only measuring, or it does not fit anyway
+        return;
+    }
+    // power basis, B(t) = ((a t + b) t + c) t + d
+    double ax = -control[0].x + 3*control[1].x - 3*control[2].x + control[3].x,
+           bx = 3*control[0].x - 6*control[1].x + 3*control[2].x,
+           cx = 3*(control[1].x - control[0].x),
+           dx = control[0].x;
+    double ay = -control[0].y + 3*control[1].y - 3*control[2].y + control[3].y,
+           by = 3*control[0].y - 6*control[1].y + 3*control[2].y,
+           cy = 3*(control[1].y - control[0].y),
+           dy = control[0].y;
+    double step = 1.0 / (double)segmentAmount;
+    CFPoint *writingPoint = state->points + state->pointAmount;
+    // no dependency between iterations, so the compiler is free to vectorize it
+    for(size_t index = 0; index < segmentAmount; index++)
+    {
+        double t = (double)(index + 1) * step;
+        writingPoint[index].x = ((ax*t + bx)*t + cx)*t + dx;
+        writingPoint[index].y = ((ay*t + by)*t + cy)*t + dy;
+    }
+    writingPoint[segmentAmount - 1] = control[3];       // exact end point, rounding in t must not open a gap
+    state->pointAmount += segmentAmount;
+}
+
+int CFASSFileDialogueTextDrawingGeometryFlatten(CFASSFileDialogueTextDrawingContextRef context,
+                                                double tolerance,
+                                                CFPoint *points, size_t *pointAmount,
+                                                size_t *figureEnds, size_t *figureAmount)
+{
+    if(context == NULL || pointAmount == NULL || figureAmount == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTextDrawingGeometry %p Flatten pointAmount %p figureAmount %p", context, pointAmount, figureAmount);
+    CFASSFileDialogueTextDrawingGeometryFlattenState state = {
+        .tolerance = tolerance > 0 ? tolerance : CFASSFileDialogueTextDrawingGeometryDefaultTolerance,
+        .points = points,
+        .pointCapacity = *pointAmount,
+        .pointAmount = 0,
+        .figureEnds = figureEnds,
+        .figureCapacity = *figureAmount,
+        .figureAmount = 0,
+        .figureBegan = false
+    };
+    CFASSFileDialogueTextDrawingGeometryVisitor visitor = {
+        .beginFigure = CFASSFileDialogueTextDrawingGeometryFlattenBeginFigure,
+        .line = CFASSFileDialogueTextDrawingGeometryFlattenAddPoint,
+        .cubic = CFASSFileDialogueTextDrawingGeometryFlattenCubic,
+        .info = &state
+    };
+    if(CFASSFileDialogueTextDrawingGeometryWalk(context, &visitor) != 0)
+        return -1;
+    CFASSFileDialogueTextDrawingGeometryFlattenEndFigure(&state);
+    *pointAmount = state.pointAmount;
+    *figureAmount = state.figureAmount;
+    if((points != NULL && state.pointAmount > state.pointCapacity) ||
+       (figureEnds != NULL && state.figureAmount > state.figureCapacity))
+        return -1;
+    return 0;
+}
+
+#pragma mark - Walk
+
+static CFPoint CFASSFileDialogueTextDrawingGeometryPointAtIndex(const int32_t *coordinates, size_t index)
+{
+    return (CFPoint){.x = coordinates[2*index], .y = coordinates[2*index + 1]};
+}
+
+static void CFASSFileDialogueTextDrawingGeometryVisitSplineWindow(const CFASSFileDialogueTextDrawingGeometryVisitor *visitor,
+                                                                  CFPoint *pen,
+                                                                  CFPoint p0, CFPoint p1, CFPoint p2, CFPoint p3)
+{
+    // uniform cubic b-spline segment in bezier form, spans between p1 and p2
+    CFPoint control[4] = {
+        {.x = (p0.x + 4*p1.x + p2.x) / 6, .y = (p0.y + 4*p1.y + p2.y) / 6},
+        {.x = (2*p1.x + p2.x) / 3,        .y = (2*p1.y + p2.y) / 3},
+        {.x = (p1.x + 2*p2.x) / 3,        .y = (p1.y + 2*p2.y) / 3},
+        {.x = (p1.x + 4*p2.x + p3.x) / 6, .y = (p1.y + 4*p2.y + p3.y) / 6}
+    };
+    // the first segment does not start at the pen, join them the way the renderer does
+    if(control[0].x != pen->x || control[0].y != pen->y)
+        visitor->line(visitor->info, control[0]);
+    visitor->cubic(visitor->info, control);
+    *pen = control[3];
+}
+
+static int CFASSFileDialogueTextDrawingGeometryWalk(CFASSFileDialogueTextDrawingContextRef context,
+                                                    const CFASSFileDialogueTextDrawingGeometryVisitor *visitor)
+{
+    if(!CFASSFileDialogueTextDrawingContextCheckValidation(context))
+        return -1;
+    size_t commandAmount = CFASSFileDialogueTextDrawingContextGetCommandAmount(context);
+    const unsigned char *commands = CFASSFileDialogueTextDrawingContextGetCommands(context);
+    const int32_t *coordinates = CFASSFileDialogueTextDrawingContextGetCoordinates(context);
+
+    CFPoint pen = {0, 0};
+    size_t pointIndex = 0;
+    bool splineActive = false;
+    size_t splineBegin = 0;         // point index of the first control point, the one before s
+    for(size_t index = 0; index < commandAmount; index++)
+    {
+        CFASSFileDialogueTextDrawingContextCommand command = commands[index];
+        switch (command) {
+            case CFASSFileDialogueTextDrawingContextCommandMove:
+            case CFASSFileDialogueTextDrawingContextCommandMoveNotClosing:
+                splineActive = false;
+                pen = CFASSFileDialogueTextDrawingGeometryPointAtIndex(coordinates, pointIndex);
+                visitor->beginFigure(visitor->info, pen);
+                break;
+            case CFASSFileDialogueTextDrawingContextCommandLine:
+                splineActive = false;
+                pen = CFASSFileDialogueTextDrawingGeometryPointAtIndex(coordinates, pointIndex);
+                visitor->line(visitor->info, pen);
+                break;
+            case CFASSFileDialogueTextDrawingContextCommandBezier:
+            {
+                splineActive = false;
+                CFPoint control[4] = {
+                    pen,
+                    CFASSFileDialogueTextDrawingGeometryPointAtIndex(coordinates, pointIndex),
+                    CFASSFileDialogueTextDrawingGeometryPointAtIndex(coordinates, pointIndex + 1),
+                    CFASSFileDialogueTextDrawingGeometryPointAtIndex(coordinates, pointIndex + 2)
+                };
+                visitor->cubic(visitor->info, control);
+                pen = control[3];
+                break;
+            }
+            case CFASSFileDialogueTextDrawingContextCommandBSpline:
+                splineActive = true;
+                splineBegin = pointIndex - 1;       // validation makes sure a move comes first
+                CFASSFileDialogueTextDrawingGeometryVisitSplineWindow(visitor, &pen,
+                                                                      CFASSFileDialogueTextDrawingGeometryPointAtIndex(coordinates, pointIndex - 1),
+                                                                      CFASSFileDialogueTextDrawingGeometryPointAtIndex(coordinates, pointIndex),
+                                                                      CFASSFileDialogueTextDrawingGeometryPointAtIndex(coordinates, pointIndex + 1),
+                                                                      CFASSFileDialogueTextDrawingGeometryPointAtIndex(coordinates, pointIndex + 2));
+                break;
+            case CFASSFileDialogueTextDrawingContextCommandExtendBSpline:
+            case CFASSFileDialogueTextDrawingContextCommandExtendBSplineAttached:
+                if(!splineActive) break;
+                CFASSFileDialogueTextDrawingGeometryVisitSplineWindow(visitor, &pen,
+                                                                      CFASSFileDialogueTextDrawingGeometryPointAtIndex(coordinates, pointIndex - 3),
+                                                                      CFASSFileDialogueTextDrawingGeometryPointAtIndex(coordinates, pointIndex - 2),
+                                                                      CFASSFileDialogueTextDrawingGeometryPointAtIndex(coordinates, pointIndex - 1),
+                                                                      CFASSFileDialogueTextDrawingGeometryPointAtIndex(coordinates, pointIndex));
+                break;
+            case CFASSFileDialogueTextDrawingContextCommandCloseBSpline:
+                if(!splineActive) break;
+                {
+                    // wrap around with the first three control points
+                    size_t controlAmount = pointIndex - splineBegin;
+                    for(size_t wrap = 0; wrap < 3; wrap++)
+                    {
+                        CFPoint window[4];
+                        for(size_t count = 0; count < 4; count++)
+                        {
+                            size_t controlIndex = (controlAmount - 3 + wrap + count) % controlAmount;
+                            window[count] = CFASSFileDialogueTextDrawingGeometryPointAtIndex(coordinates, splineBegin + controlIndex);
+                        }
+                        CFASSFileDialogueTextDrawingGeometryVisitSplineWindow(visitor, &pen, window[0], window[1], window[2], window[3]);
+                    }
+                }
+                splineActive = false;
+                break;
+        }
+        pointIndex += CFASSFileDialogueTextDrawingContextCommandGetPointAmount(command);
+    }
+    return 0;
+}
@@ -0,0 +1,48 @@
+//
+//  CFASSFileDialogueTextDrawingGeometry.h
+//  ASS_editor
+//
+//  Created by Bill Sun on 2018/11/5.
+//  Copyright © 2018 Bill Sun. All rights reserved.
+//
+
+#ifndef CFASSFileDialogueTextDrawingGeometry_h
+#define CFASSFileDialogueTextDrawingGeometry_h
+
+#include <stddef.h>
+
+#include "CFGeometry.h"
+#include "CFASSFileDialogueTextDrawingContext.h"
+
+#define CFASSFileDialogueTextDrawingGeometryDefaultTolerance 0.25      // drawing unit
+
+#pragma mark - Bounding Box
+
+int CFASSFileDialogueTextDrawingGeometryGetBoundingBox(CFASSFileDialogueTextDrawingContextRef context, CFRect *box);
+/* Return */
+// 0 for success, -1 if context is not a valid drawing and box stays unchanged
+/* Discussion */
+// tight box of the outline, curve extremes are solved exactly, control points off the curve are not counted
+// b-spline segments are converted to bezier the way the renderer does, so the box matches what is drawn
+
+#pragma mark - Flatten
+
+int CFASSFileDialogueTextDrawingGeometryFlatten(CFASSFileDialogueTextDrawingContextRef context,
+                                                double tolerance,
+                                                CFPoint *points, size_t *pointAmount,
+                                                size_t *figureEnds, size_t *figureAmount);
+/* tolerance */
+// the largest distance allowed between curve and polyline, zero or negative means default
+/* points, figureEnds */
+// caller-provided buffers, could be NULL to measure only
+// figureEnds receive the index after the last point of each figure, each m or n begins a new figure
+/* pointAmount, figureAmount */
+// in: capacity of points and figureEnds, out: the amount needed
+/* Return */
+// 0 for success, -1 if context is not a valid drawing or a buffer is too small
+// call again with buffers of the returned amounts when it is too small
+/* Discussion */
+// curves are subdivided adaptively, each one gets just enough uniform segments for tolerance
+// segment points are evaluated independently so the inner loop has no carried dependency
+
+#endif /* CFASSFileDialogueTextDrawingGeometry_h */
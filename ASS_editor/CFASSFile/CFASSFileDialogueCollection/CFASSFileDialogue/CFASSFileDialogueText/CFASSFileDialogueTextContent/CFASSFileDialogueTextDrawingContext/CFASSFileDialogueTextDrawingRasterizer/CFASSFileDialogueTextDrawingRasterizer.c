@@ -0,0 +1,348 @@
+//
+//  CFASSFileDialogueTextDrawingRasterizer.c
+//  ASS_editor
+//
+//  Created by Bill Sun on 2018/11/5.
+//  Copyright © 2018 Bill Sun. All rights reserved.
+//
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+
+#include "CFPlatform.h"
+
+#ifdef CF_OS_UNIX
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#include "CFASSFileDialogueTextDrawingRasterizer.h"
+#include "CFASSFileDialogueTextDrawingGeometry.h"
+#include "CFException.h"
+
+#define CFASSFileDialogueTextDrawingRasterizerSubScanlineShift 4         // 16 sub-scanlines each pixel row
+#define CFASSFileDialogueTextDrawingRasterizerSubPixelShift 8            // span ends in 1/256 pixel
+#define CFASSFileDialogueTextDrawingRasterizerSubScanline (1u << CFASSFileDialogueTextDrawingRasterizerSubScanlineShift)
+#define CFASSFileDialogueTextDrawingRasterizerSubPixel (1u << CFASSFileDialogueTextDrawingRasterizerSubPixelShift)
+#define CFASSFileDialogueTextDrawingRasterizerConcurrentMinimumRows 64   // rows each worker at least take, otherwise thread creation dominates
+#define CFASSFileDialogueTextDrawingRasterizerFlattenTolerance 0.125     // pixel
+
+typedef struct CFASSFileDialogueTextDrawingRasterizerEdge
+{
+    double topY, bottomY;           // sample rows in [topY, bottomY) cross this edge
+    double topX, slope;             // x at topY, dx/dy
+    int winding;                    // +1 going down, -1 going up
+} CFASSFileDialogueTextDrawingRasterizerEdge;
+
+typedef struct CFASSFileDialogueTextDrawingRasterizerActiveEdge
+{
+    double x;
+    const CFASSFileDialogueTextDrawingRasterizerEdge *edge;
+} CFASSFileDialogueTextDrawingRasterizerActiveEdge;
+
+typedef struct CFASSFileDialogueTextDrawingRasterizerWorker
+{
+    const CFASSFileDialogueTextDrawingRasterizerEdge *edges;
+    size_t edgeAmount;
+    CFASSFileDialogueTextDrawingRasterizerFillRule fillRule;
+    unsigned char *coverage;
+    size_t width, bytesPerRow;
+    size_t beginRow, endRow;
+    int status;
+} CFASSFileDialogueTextDrawingRasterizerWorker;
+
+static void *CFASSFileDialogueTextDrawingRasterizerWorkerMain(void *argument);
+
+#pragma mark - Fill Polygon
+
+static int CFASSFileDialogueTextDrawingRasterizerEdgeCompare(const void *first, const void *second)
+{
+    const CFASSFileDialogueTextDrawingRasterizerEdge *firstEdge = first, *secondEdge = second;
+    if(firstEdge->topY < secondEdge->topY) return -1;
+    if(firstEdge->topY > secondEdge->topY) return 1;
+    return 0;
+}
+
+static size_t CFASSFileDialogueTextDrawingRasterizerBuildEdges(const CFPoint *points,
+                                                               const size_t *figureEnds, size_t figureAmount,
+                                                               double height,
+                                                               CFASSFileDialogueTextDrawingRasterizerEdge *edges)
+{
+    size_t edgeAmount = 0, figureBegin = 0;
+    for(size_t figure = 0; figure < figureAmount; figure++)
+    {
+        size_t figureEnd = figureEnds[figure];
+        for(size_t index = figureBegin; index < figureEnd; index++)
+        {
+            CFPoint from = points[index], to = points[index + 1 < figureEnd ? index + 1 : figureBegin];
+            if(!isfinite(from.x) || !isfinite(from.y) || !isfinite(to.x) || !isfinite(to.y))
+                continue;
+            if(from.y == to.y)
+                continue;       // horizontal edge never crosses a sample row
+            CFASSFileDialogueTextDrawingRasterizerEdge *edge = &edges[edgeAmount];
+            if(from.y < to.y)
+            {
+                edge->winding = 1;
+                edge->topY = from.y; edge->topX = from.x; edge->bottomY = to.y;
+            }
+            else
+            {
+                edge->winding = -1;
+                edge->topY = to.y; edge->topX = to.x; edge->bottomY = from.y;
+            }
+            if(edge->bottomY <= 0 || edge->topY >= height)
+                continue;
+            edge->slope = (to.x - from.x) / (to.y - from.y);
+            edgeAmount++;
+        }
+        figureBegin = figureEnd;
+    }
+    qsort(edges, edgeAmount, sizeof(CFASSFileDialogueTextDrawingRasterizerEdge), CFASSFileDialogueTextDrawingRasterizerEdgeCompare);
+    return edgeAmount;
+}
+
+int CFASSFileDialogueTextDrawingRasterizerFillPolygon(const CFPoint *points,
+                                                      const size_t *figureEnds, size_t figureAmount,
+                                                      CFASSFileDialogueTextDrawingRasterizerFillRule fillRule,
+                                                      unsigned char *coverage,
+                                                      size_t width, size_t height, size_t bytesPerRow,
+                                                      unsigned int threadAmount)
+{
+    if((figureAmount != 0 && (points == NULL || figureEnds == NULL)) || coverage == NULL || bytesPerRow < width)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTextDrawingRasterizer FillPolygon points %p figureEnds %p coverage %p width %zu bytesPerRow %zu", points, figureEnds, coverage, width, bytesPerRow);
+    if(width == 0 || height == 0)
+        return 0;
+    size_t pointAmount = figureAmount == 0 ? 0 : figureEnds[figureAmount - 1];
+    CFASSFileDialogueTextDrawingRasterizerEdge *edges;
+    if((edges = malloc(sizeof(CFASSFileDialogueTextDrawingRasterizerEdge) * (pointAmount != 0 ? pointAmount : 1))) != NULL)
+    {
+        CFASSFileDialogueTextDrawingRasterizerWorker worker = {
+            .edges = edges,
+            .edgeAmount = CFASSFileDialogueTextDrawingRasterizerBuildEdges(points, figureEnds, figureAmount, (double)height, edges),
+            .fillRule = fillRule,
+            .coverage = coverage,
+            .width = width,
+            .bytesPerRow = bytesPerRow,
+            .beginRow = 0,
+            .endRow = height,
+            .status = -1
+        };
+#ifdef CF_OS_UNIX
+        if(threadAmount == 0)
+        {
+            long processorAmount = sysconf(_SC_NPROCESSORS_ONLN);
+            threadAmount = processorAmount > 0 ? (unsigned int)processorAmount : 1;
+        }
+        if(threadAmount > height / CFASSFileDialogueTextDrawingRasterizerConcurrentMinimumRows)
+            threadAmount = (unsigned int)(height / CFASSFileDialogueTextDrawingRasterizerConcurrentMinimumRows);
+        if(threadAmount > 1 && worker.edgeAmount != 0)
+        {
+            CFASSFileDialogueTextDrawingRasterizerWorker *workers;
+            if((workers = malloc(sizeof(CFASSFileDialogueTextDrawingRasterizerWorker) * threadAmount)) != NULL)
+            {
+                pthread_t *threads;
+                if((threads = malloc(sizeof(pthread_t) * threadAmount)) != NULL)
+                {
+                    bool *threadCreated;
+                    if((threadCreated = calloc(threadAmount, sizeof(bool))) != NULL)
+                    {
+                        for(unsigned int index = 0; index < threadAmount; index++)
+                        {
+                            workers[index] = worker;
+                            workers[index].beginRow = height * index / threadAmount;
+                            workers[index].endRow = height * (index + 1) / threadAmount;
+                        }
+                        // worker 0 runs on calling thread, and so does any worker failed to get its own thread
+                        for(unsigned int index = 1; index < threadAmount; index++)
+                            threadCreated[index] = pthread_create(&threads[index], NULL, CFASSFileDialogueTextDrawingRasterizerWorkerMain, &workers[index]) == 0;
+                        for(unsigned int index = 0; index < threadAmount; index++)
+                            if(!threadCreated[index])
+                                CFASSFileDialogueTextDrawingRasterizerWorkerMain(&workers[index]);
+                        for(unsigned int index = 1; index < threadAmount; index++)
+                            if(threadCreated[index])
+                                pthread_join(threads[index], NULL);
+                        int result = 0;
+                        for(unsigned int index = 0; index < threadAmount; index++)
+                            if(workers[index].status != 0)
+                                result = -1;
+                        free(threadCreated);
+                        free(threads);
+                        free(workers);
+                        free(edges);
+                        return result;
+                    }
+                    free(threads);
+                }
+                free(workers);
+            }
+        }
+#endif
+        CFASSFileDialogueTextDrawingRasterizerWorkerMain(&worker);
+        free(edges);
+        return worker.status;
+    }
+    return -1;
+}
+
+#pragma mark - Fill Drawing
+
+int CFASSFileDialogueTextDrawingRasterizerFillDrawing(CFASSFileDialogueTextDrawingContextRef context,
+                                                      double scaleX, double scaleY,
+                                                      double offsetX, double offsetY,
+                                                      CFASSFileDialogueTextDrawingRasterizerFillRule fillRule,
+                                                      unsigned char *coverage,
+                                                      size_t width, size_t height, size_t bytesPerRow,
+                                                      unsigned int threadAmount)
+{
+    if(context == NULL || coverage == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTextDrawingRasterizer %p FillDrawing coverage %p", context, coverage);
+    double largerScale = fabs(scaleX) > fabs(scaleY) ? fabs(scaleX) : fabs(scaleY);
+    double tolerance = largerScale > 0 ? CFASSFileDialogueTextDrawingRasterizerFlattenTolerance / largerScale : 0;
+    size_t pointAmount = 0, figureAmount = 0;
+    if(CFASSFileDialogueTextDrawingGeometryFlatten(context, tolerance, NULL, &pointAmount, NULL, &figureAmount) != 0)
+        return -1;
+    CFPoint *points;
+    if((points = malloc(sizeof(CFPoint) * (pointAmount != 0 ? pointAmount : 1))) != NULL)
+    {
+        size_t *figureEnds;
+        if((figureEnds = malloc(sizeof(size_t) * (figureAmount != 0 ? figureAmount : 1))) != NULL)
+        {
+            if(CFASSFileDialogueTextDrawingGeometryFlatten(context, tolerance, points, &pointAmount, figureEnds, &figureAmount) == 0)
+            {
+                for(size_t index = 0; index < pointAmount; index++)
+                {
+                    points[index].x = points[index].x * scaleX + offsetX;
+                    points[index].y = points[index].y * scaleY + offsetY;
+                }
+                int result = CFASSFileDialogueTextDrawingRasterizerFillPolygon(points, figureEnds, figureAmount, fillRule, coverage, width, height, bytesPerRow, threadAmount);
+                free(figureEnds);
+                free(points);
+                return result;
+            }
+            free(figureEnds);
+        }
+        free(points);
+    }
+    return -1;
+}
+
+#pragma mark - Scanline
+
+static void CFASSFileDialogueTextDrawingRasterizerAddSpan(uint16_t *accumulation, size_t width, double begin, double end)
+{
+    // accumulation has width + 1 cells, a span ending exactly on the right border spills zero into the last one
+    double limit = (double)width;
+    if(begin < 0) begin = 0;
+    if(end > limit) end = limit;
+    if(!(end > begin)) return;
+    size_t fixedBegin = (size_t)(begin * CFASSFileDialogueTextDrawingRasterizerSubPixel + 0.5),
+           fixedEnd = (size_t)(end * CFASSFileDialogueTextDrawingRasterizerSubPixel + 0.5);
+    if(fixedEnd <= fixedBegin) return;
+    size_t pixelBegin = fixedBegin >> CFASSFileDialogueTextDrawingRasterizerSubPixelShift,
+           pixelEnd = fixedEnd >> CFASSFileDialogueTextDrawingRasterizerSubPixelShift;
+    if(pixelBegin == pixelEnd)
+    {
+        accumulation[pixelBegin] += fixedEnd - fixedBegin;
+        return;
+    }
+    accumulation[pixelBegin] += CFASSFileDialogueTextDrawingRasterizerSubPixel - (fixedBegin & (CFASSFileDialogueTextDrawingRasterizerSubPixel - 1));
+    // constant add over a contiguous run, the compiler turns it into vector adds
+    for(size_t pixel = pixelBegin + 1; pixel < pixelEnd; pixel++)
+        accumulation[pixel] += CFASSFileDialogueTextDrawingRasterizerSubPixel;
+    accumulation[pixelEnd] += fixedEnd & (CFASSFileDialogueTextDrawingRasterizerSubPixel - 1);
+}
+
+static bool CFASSFileDialogueTextDrawingRasterizerIsInside(CFASSFileDialogueTextDrawingRasterizerFillRule fillRule, int winding)
+{
+    if(fillRule == CFASSFileDialogueTextDrawingRasterizerFillRuleEvenOdd)
+        return (winding & 1) != 0;
+    return winding != 0;
+}
+
+static void CFASSFileDialogueTextDrawingRasterizerFillRows(CFASSFileDialogueTextDrawingRasterizerWorker *worker,
+                                                           uint16_t *accumulation,
+                                                           CFASSFileDialogueTextDrawingRasterizerActiveEdge *activeEdges)
+{
+    const CFASSFileDialogueTextDrawingRasterizerEdge *edges = worker->edges;
+    size_t edgeAmount = worker->edgeAmount, width = worker->width;
+    size_t nextEdge = 0, activeAmount = 0;
+    for(size_t row = worker->beginRow; row < worker->endRow; row++)
+    {
+        unsigned char *rowCoverage = worker->coverage + row * worker->bytesPerRow;
+        if(activeAmount == 0 && (nextEdge == edgeAmount || edges[nextEdge].topY >= (double)(row + 1)))
+        {
+            memset(rowCoverage, 0, width);
+            continue;
+        }
+        for(unsigned int subScanline = 0; subScanline < CFASSFileDialogueTextDrawingRasterizerSubScanline; subScanline++)
+        {
+            double sampleY = (double)row + (subScanline + 0.5) / CFASSFileDialogueTextDrawingRasterizerSubScanline;
+            size_t keptAmount = 0;
+            for(size_t index = 0; index < activeAmount; index++)
+                if(activeEdges[index].edge->bottomY > sampleY)
+                    activeEdges[keptAmount++] = activeEdges[index];
+            activeAmount = keptAmount;
+            while(nextEdge < edgeAmount && edges[nextEdge].topY <= sampleY)
+            {
+                if(edges[nextEdge].bottomY > sampleY)
+                    activeEdges[activeAmount++].edge = &edges[nextEdge];
+                nextEdge++;
+            }
+            // insertion sort, the order barely changes between sub-scanlines so it is almost linear
+            for(size_t index = 0; index < activeAmount; index++)
+            {
+                CFASSFileDialogueTextDrawingRasterizerActiveEdge active = activeEdges[index];
+                active.x = active.edge->topX + (sampleY - active.edge->topY) * active.edge->slope;
+                size_t position = index;
+                while(position > 0 && activeEdges[position - 1].x > active.x)
+                {
+                    activeEdges[position] = activeEdges[position - 1];
+                    position--;
+                }
+                activeEdges[position] = active;
+            }
+            int winding = 0;
+            double spanBegin = 0;
+            for(size_t index = 0; index < activeAmount; index++)
+            {
+                bool wasInside = CFASSFileDialogueTextDrawingRasterizerIsInside(worker->fillRule, winding);
+                winding += activeEdges[index].edge->winding;
+                bool isInside = CFASSFileDialogueTextDrawingRasterizerIsInside(worker->fillRule, winding);
+                if(!wasInside && isInside)
+                    spanBegin = activeEdges[index].x;
+                else if(wasInside && !isInside)
+                    CFASSFileDialogueTextDrawingRasterizerAddSpan(accumulation, width, spanBegin, activeEdges[index].x);
+            }
+        }
+        // full accumulation is exactly sub-scanline * sub-pixel, scale it down to 255
+        for(size_t pixel = 0; pixel < width; pixel++)
+        {
+            rowCoverage[pixel] = (unsigned char)((accumulation[pixel] * 255u + (1u << (CFASSFileDialogueTextDrawingRasterizerSubScanlineShift + CFASSFileDialogueTextDrawingRasterizerSubPixelShift - 1)))
+                                                 >> (CFASSFileDialogueTextDrawingRasterizerSubScanlineShift + CFASSFileDialogueTextDrawingRasterizerSubPixelShift));
+            accumulation[pixel] = 0;
+        }
+        accumulation[width] = 0;
+    }
+}
+
+static void *CFASSFileDialogueTextDrawingRasterizerWorkerMain(void *argument)
+{
+    CFASSFileDialogueTextDrawingRasterizerWorker *worker = argument;
+    worker->status = -1;
+    uint16_t *accumulation;
+    if((accumulation = calloc(worker->width + 1, sizeof(uint16_t))) != NULL)
+    {
+        CFASSFileDialogueTextDrawingRasterizerActiveEdge *activeEdges;
+        if((activeEdges = malloc(sizeof(CFASSFileDialogueTextDrawingRasterizerActiveEdge) * (worker->edgeAmount != 0 ? worker->edgeAmount : 1))) != NULL)
+        {
+            CFASSFileDialogueTextDrawingRasterizerFillRows(worker, accumulation, activeEdges);
+            worker->status = 0;
+            free(activeEdges);
+        }
+        free(accumulation);
+    }
+    return NULL;
+}
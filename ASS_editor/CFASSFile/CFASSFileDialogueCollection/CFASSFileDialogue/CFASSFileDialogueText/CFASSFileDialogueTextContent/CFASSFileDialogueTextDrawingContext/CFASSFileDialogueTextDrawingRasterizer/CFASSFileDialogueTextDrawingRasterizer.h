@@ -0,0 +1,59 @@
+//
+//  CFASSFileDialogueTextDrawingRasterizer.h
+//  ASS_editor
+//
+//  Created by Bill Sun on 2018/11/5.
+//  Copyright © 2018 Bill Sun. All rights reserved.
+//
+
+#ifndef CFASSFileDialogueTextDrawingRasterizer_h
+#define CFASSFileDialogueTextDrawingRasterizer_h
+
+#include <stddef.h>
+
+#include "CFGeometry.h"
+#include "CFASSFileDialogueTextDrawingContext.h"
+
+typedef enum CFASSFileDialogueTextDrawingRasterizerFillRule {
+    CFASSFileDialogueTextDrawingRasterizerFillRuleNonZero,
+    CFASSFileDialogueTextDrawingRasterizerFillRuleEvenOdd
+} CFASSFileDialogueTextDrawingRasterizerFillRule;
+
+#pragma mark - Fill Polygon
+
+int CFASSFileDialogueTextDrawingRasterizerFillPolygon(const CFPoint *points,
+                                                      const size_t *figureEnds, size_t figureAmount,
+                                                      CFASSFileDialogueTextDrawingRasterizerFillRule fillRule,
+                                                      unsigned char *coverage,
+                                                      size_t width, size_t height, size_t bytesPerRow,
+                                                      unsigned int threadAmount);
+/* points, figureEnds */
+// in pixel, the layout CFASSFileDialogueTextDrawingGeometryFlatten produces, each figure is closed implicitly
+/* coverage */
+// 8-bit mask of height rows, bytesPerRow apart, every one of the width bytes in each row is overwritten
+/* threadAmount */
+// 0 means one thread for each online processor
+/* Return */
+// 0 for success, -1 if out of memory and coverage content is undefined
+/* Discussion */
+// anti-aliased, coverage of each pixel is the area inside, sampled on sub-scanlines with sub-pixel span ends
+// rows are partitioned into contiguous bands, each filled by its own worker thread
+// small mask, or platform without pthread, fills on calling thread
+
+#pragma mark - Fill Drawing
+
+int CFASSFileDialogueTextDrawingRasterizerFillDrawing(CFASSFileDialogueTextDrawingContextRef context,
+                                                      double scaleX, double scaleY,
+                                                      double offsetX, double offsetY,
+                                                      CFASSFileDialogueTextDrawingRasterizerFillRule fillRule,
+                                                      unsigned char *coverage,
+                                                      size_t width, size_t height, size_t bytesPerRow,
+                                                      unsigned int threadAmount);
+/* scaleX, scaleY, offsetX, offsetY */
+// pixel = drawing unit * scale + offset, \p2 for example is scale 0.5
+/* Return */
+// 0 for success, -1 if context is not a valid drawing or out of memory
+/* Discussion */
+// curves are flattened finely enough that the error stays below a fraction of a pixel after scaling
+
+#endif /* CFASSFileDialogueTextDrawingRasterizer_h */
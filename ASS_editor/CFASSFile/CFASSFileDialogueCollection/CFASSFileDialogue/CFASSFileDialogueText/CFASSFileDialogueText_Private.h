@@ -9,11 +9,17 @@
 #ifndef CFASSFileDialogueText_Private_h
 #define CFASSFileDialogueText_Private_h
 
+#include "CFASSFileDialogueText.h"
+#include "CFASSFileDialogueTextContentOverrideCache.h"
+#include "CFMutableString.h"
+
 #pragma mark - Read File
 
-CFASSFileDialogueTextRef CFASSFileDialogueTextCreateWithString(const wchar_t *source);
+CFASSFileDialogueTextRef CFASSFileDialogueTextCreateWithString(const wchar_t *source, CFASSFileDialogueTextContentOverrideCacheRef overrideCache);
 /* source */
 // begin with current text filed
+/* overrideCache */
+// this could be NULL
 /* Discussion */
 // this function should handle the empty source, that is point to '\n' or '\0'
 
@@ -28,4 +34,9 @@ int CFASSFileDialogueTextStoreStringResult(CFASSFileDialogueTextRef text, wchar_
 // return will be the store string Length if targetPoint is long enough even is NULL
 // this will count until the '\n', so it will store the last '\n'
 
+int CFASSFileDialogueTextAppendStringResult(CFASSFileDialogueTextRef text, CFMutableStringRef string);
+/* Return */
+// 0 for success, -1 if anything went wrong
+// the last '\n' is appended as well
+
 #endif /* CFASSFileDialogueText_Private_h */
@@ -10,15 +10,28 @@
 #define CFASSFileDialogue_Private_h
 
 #include "CFASSFileDialogue.h"
+#include "CFUnicodeStringInternTable.h"
+#include "CFMutableString.h"
+#include "CFASSFileDialogueTextContentOverrideCache.h"
 
 #pragma mark - Read File
 
-CFASSFileDialogueRef CFASSFileDialogueCreateWithString(const wchar_t *source);
+CFASSFileDialogueRef CFASSFileDialogueCreateWithString(const wchar_t *source, CFUnicodeStringInternTableRef nameTable, CFASSFileDialogueTextContentOverrideCacheRef overrideCache);
 /* source */
 // begin with "Dialogue:", end with '\n' or '\0'
+/* nameTable */
+// style and speaker name are interned into it, dialogue retains it
+/* overrideCache */
+// this could be NULL, identical override blocks parsed with the same cache are shared
 /* Discussion */
 // this function should handle the empty source, that is point to '\n'
 
+#pragma mark - Set Component
+
+void CFASSFileDialogueSetTime(CFASSFileDialogueRef dialogue, unsigned long startHundredths, unsigned long endHundredths);
+/* startHundredths, endHundredths */
+// time in hundredths of second
+
 #pragma mark - Store Result
 
 int CFASSFileDialogueStoreStringResult(CFASSFileDialogueRef dialogue, wchar_t *targetPoint);
@@ -30,5 +43,9 @@ int CFASSFileDialogueStoreStringResult(CFASSFileDialogueRef dialogue, wchar_t *t
 // return will be the store string Length if targetPoint is long enough even is NULL
 // this begin with "Dialogue:" end with '\n'
 
+int CFASSFileDialogueAppendStringResult(CFASSFileDialogueRef dialogue, CFMutableStringRef string);
+/* Return */
+// 0 for success, -1 if anything went wrong
+
 
 #endif /* CFASSFileDialogue_Private_h */
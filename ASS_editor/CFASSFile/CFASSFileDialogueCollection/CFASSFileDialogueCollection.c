@@ -9,6 +9,13 @@
 #include <wchar.h>
 #include <stdlib.h>
 
+#include "CFPlatform.h"
+
+#ifdef CF_OS_UNIX
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
 #include "CFASSFile.h"
 #include "CFASSFile_Private.h"
 #include "CFASSFileDialogueCollection.h"
@@ -16,26 +23,115 @@
 #include "CFASSFileDialogue.h"
 #include "CFASSFileDialogue_Private.h"
 #include "CFPointerArray.h"
+#include "CFUnicodeStringInternTable.h"
+#include "CFASSFileDialogueTextContentOverrideCache.h"
 #include "CFEnumerator.h"
 #include "CFException.h"
+#include "CFMutableString.h"
 #include "CFASSFileControl.h"
 #include "CFASSFileControl_Private.h"
+#include "CFASSFileChange.h"
+#include "CFASSFileChange_Private.h"
 
 struct CFASSFileDialogueCollection
 {
     CFPointerArrayRef collectionArray;
+    CFUnicodeStringInternTableRef nameTable;    // style and speaker names of dialogues, shared with copies
     CFASSFileRef registeredFile;
 };
 
+#define CFASSFileDialogueCollectionConcurrentMinimumPartition 256     // dialogues each worker at least take, otherwise thread creation dominates
+
+#define CFASSFileDialogueCollectionEstimatedDialogueLength 80         // characters, a typical line with a short override block
+
+typedef struct CFASSFileDialogueCollectionChangeWorker
+{
+    CFASSFileDialogueCollectionRef dialogueCollection;
+    CFASSFileChangeRef change;
+    size_t beginIndex, endIndex;
+    CFExceptionCatchFunction catchFunction;     // catch function of the calling thread
+} CFASSFileDialogueCollectionChangeWorker;
+
+static void *CFASSFileDialogueCollectionChangeWorkerMain(void *argument);
+
 void CFASSFileDialogueCollectionMakeChange(CFASSFileDialogueCollectionRef dialogueCollection, CFASSFileChangeRef change)
 {
     if(dialogueCollection == NULL || change == NULL)
         CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueCollection %p MakeChange %p", dialogueCollection, change);
-    CFEnumeratorRef enumerator = CFASSFileDialogueCollectionCreateEnumerator(dialogueCollection);
-    CFASSFileDialogueRef eachDialogue;
-    while ((eachDialogue = CFEnumeratorNextObject(enumerator)) != NULL)
-        CFASSFileDialogueMakeChange(eachDialogue, change);
-    CFEnumeratorDestory(enumerator);
+    if(!CFASSFileChangeShouldDispatchToDialogueCollection(change))
+        return;
+    size_t arrayLength = CFPointerArrayGetLength(dialogueCollection->collectionArray);
+    for(size_t index = 0; index < arrayLength; index++)
+        CFASSFileDialogueMakeChange(CFPointerArrayGetPointerAtIndex(dialogueCollection->collectionArray, index), change);
+}
+
+void CFASSFileDialogueCollectionMakeChangeConcurrently(CFASSFileDialogueCollectionRef dialogueCollection, CFASSFileChangeRef change, unsigned int threadAmount)
+{
+    if(dialogueCollection == NULL || change == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueCollection %p MakeChangeConcurrently %p", dialogueCollection, change);
+    if(!CFASSFileChangeShouldDispatchToDialogueCollection(change))
+        return;
+    size_t arrayLength = CFPointerArrayGetLength(dialogueCollection->collectionArray);
+#ifdef CF_OS_UNIX
+    if(threadAmount == 0)
+    {
+        long processorAmount = sysconf(_SC_NPROCESSORS_ONLN);
+        threadAmount = processorAmount > 0 ? (unsigned int)processorAmount : 1;
+    }
+    if(threadAmount > arrayLength / CFASSFileDialogueCollectionConcurrentMinimumPartition)
+        threadAmount = (unsigned int)(arrayLength / CFASSFileDialogueCollectionConcurrentMinimumPartition);
+    if(threadAmount > 1)
+    {
+        CFASSFileDialogueCollectionChangeWorker *workers;
+        if((workers = malloc(sizeof(CFASSFileDialogueCollectionChangeWorker) * threadAmount)) != NULL)
+        {
+            pthread_t *threads;
+            if((threads = malloc(sizeof(pthread_t) * threadAmount)) != NULL)
+            {
+                bool *threadCreated;
+                if((threadCreated = calloc(threadAmount, sizeof(bool))) != NULL)
+                {
+                    CFExceptionCatchFunction catchFunction = CFExceptionCatchStackCurrentFunction();
+                    for(unsigned int index = 0; index < threadAmount; index++)
+                    {
+                        workers[index].dialogueCollection = dialogueCollection;
+                        workers[index].change = change;
+                        workers[index].beginIndex = arrayLength * index / threadAmount;
+                        workers[index].endIndex = arrayLength * (index + 1) / threadAmount;
+                        workers[index].catchFunction = catchFunction;
+                    }
+                    // worker 0 runs on calling thread, and so does any worker failed to get its own thread
+                    for(unsigned int index = 1; index < threadAmount; index++)
+                        threadCreated[index] = pthread_create(&threads[index], NULL, CFASSFileDialogueCollectionChangeWorkerMain, &workers[index]) == 0;
+                    for(unsigned int index = 0; index < threadAmount; index++)
+                        if(!threadCreated[index])
+                            CFASSFileDialogueCollectionChangeWorkerMain(&workers[index]);
+                    for(unsigned int index = 1; index < threadAmount; index++)
+                        if(threadCreated[index])
+                            pthread_join(threads[index], NULL);
+                    free(threadCreated);
+                    free(threads);
+                    free(workers);
+                    return;
+                }
+                free(threads);
+            }
+            free(workers);
+        }
+    }
+#endif
+    for(size_t index = 0; index < arrayLength; index++)
+        CFASSFileDialogueMakeChange(CFPointerArrayGetPointerAtIndex(dialogueCollection->collectionArray, index), change);
+}
+
+static void *CFASSFileDialogueCollectionChangeWorkerMain(void *argument)
+{
+    CFASSFileDialogueCollectionChangeWorker *worker = argument;
+    CFExceptionCatchStackPush(worker->catchFunction);
+    for(size_t index = worker->beginIndex; index < worker->endIndex; index++)
+        CFASSFileDialogueMakeChange(CFPointerArrayGetPointerAtIndex(worker->dialogueCollection->collectionArray, index), worker->change);
+    CFExceptionCatchStackPop();
+    return NULL;
 }
 
 CFASSFileDialogueCollectionRef CFASSFileDialogueCollectionCopy(CFASSFileDialogueCollectionRef dialogueCollection)
@@ -59,7 +155,10 @@ CFASSFileDialogueCollectionRef CFASSFileDialogueCollectionCopy(CFASSFileDialogue
                     CFPointerArrayAddPointer(result->collectionArray, eachDialogue, false);
             }
             if(copyCheck)
+            {
+                result->nameTable = CFUnicodeStringInternTableRetain(dialogueCollection->nameTable);
                 return result;
+            }
             arrayLength = CFPointerArrayGetLength(result->collectionArray);
             for(size_t index = 0; index<arrayLength; index++)
                 CFASSFileDialogueDestory
@@ -78,6 +177,22 @@ CFEnumeratorRef CFASSFileDialogueCollectionCreateEnumerator(CFASSFileDialogueCol
     return CFEnumeratorCreateFromArray(dialogueCollection->collectionArray);
 }
 
+size_t CFASSFileDialogueCollectionGetLength(CFASSFileDialogueCollectionRef dialogueCollection)
+{
+    if(dialogueCollection == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueCollection NULL GetLength");
+    return CFPointerArrayGetLength(dialogueCollection->collectionArray);
+}
+
+CFASSFileDialogueRef CFASSFileDialogueCollectionGetDialogueAtIndex(CFASSFileDialogueCollectionRef dialogueCollection, size_t index)
+{
+    if(dialogueCollection == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueCollection NULL GetDialogueAtIndex %zu", index);
+    if(index >= CFPointerArrayGetLength(dialogueCollection->collectionArray))
+        CFExceptionRaise(CFExceptionNameArrayOutOfBounds, NULL, "CFASSFileDialogueCollection %p GetDialogueAtIndex %zu", dialogueCollection, index);
+    return CFPointerArrayGetPointerAtIndex(dialogueCollection->collectionArray, index);
+}
+
 void CFASSFileDialogueCollectionDestory(CFASSFileDialogueCollectionRef dialogueCollection)
 {
     if(dialogueCollection == NULL) return;
@@ -85,6 +200,7 @@ void CFASSFileDialogueCollectionDestory(CFASSFileDialogueCollectionRef dialogueC
     for(size_t index = 0; index<arrayLength; index++)
         CFASSFileDialogueDestory(CFPointerArrayGetPointerAtIndex(dialogueCollection->collectionArray, index));
     CFPointerArrayDestory(dialogueCollection->collectionArray);
+    CFUnicodeStringInternTableRelease(dialogueCollection->nameTable);
     free(dialogueCollection);
 }
 
@@ -111,14 +227,18 @@ CFASSFileDialogueCollectionRef CFASSFileDialogueCollectionCreateWithUnicodeFileC
         if((result = malloc(sizeof(struct CFASSFileDialogueCollection))) != NULL)
         {
             result->registeredFile = NULL;
-            if((result->collectionArray = CFPointerArrayCreateEmpty())!=NULL)
+            if((result->collectionArray = CFPointerArrayCreateEmpty())!=NULL &&
+               (result->nameTable = CFUnicodeStringInternTableCreateEmpty())!=NULL)
             {
                 size_t skipLength = wcslen(L"\nDialogue:");
+                CFASSFileDialogueTextContentOverrideCacheRef overrideCache = NULL;     // only lives during parsing, NULL for not sharing
+                if(CFASSFileControlGetOverrideSharing())
+                    overrideCache = CFASSFileDialogueTextContentOverrideCacheCreateEmpty();
                 CFASSFileDialogueRef eachDialogue;
                 bool formatCheck = true;
                 while(formatCheck && (searchPoint = wcsstr(searchPoint, L"\nDialogue:")) != NULL)
                 {
-                    eachDialogue = CFASSFileDialogueCreateWithString(searchPoint+1);
+                    eachDialogue = CFASSFileDialogueCreateWithString(searchPoint+1, result->nameTable, overrideCache);
                     if(eachDialogue == NULL)
                     {
                         CFASSFileControlErrorHandling errorHandle = CFASSFileControlGetErrorHandling();
@@ -135,13 +255,17 @@ CFASSFileDialogueCollectionRef CFASSFileDialogueCollectionCreateWithUnicodeFileC
                         searchPoint += skipLength;
                     }
                 }
+                CFASSFileDialogueTextContentOverrideCacheDestory(overrideCache);
                 if(formatCheck)
                     return result;
                 size_t arrayLength = CFPointerArrayGetLength(result->collectionArray);
                 for(size_t index = 0; index<arrayLength; index++)
                     CFASSFileDialogueDestory(CFPointerArrayGetPointerAtIndex(result->collectionArray, index));
                 CFPointerArrayDestory(result->collectionArray);
+                CFUnicodeStringInternTableRelease(result->nameTable);
             }
+            else if(result->collectionArray != NULL)
+                CFPointerArrayDestory(result->collectionArray);
             free(result);
         }
     }
@@ -150,37 +274,27 @@ CFASSFileDialogueCollectionRef CFASSFileDialogueCollectionCreateWithUnicodeFileC
 
 wchar_t *CFASSFileDialogueCollectionAllocateFileContent(CFASSFileDialogueCollectionRef dialogueCollection)
 {
-    size_t stringLength = 0,
-    prefixLength = wcslen(L"[Events]\nFormat: Layer, Start, End, Style, Name, MarginL, MarginR, MarginV, Effect, Text\n");
-    
-    stringLength += prefixLength;
-    
-    int temp;
-    size_t arrayLength = CFPointerArrayGetLength(dialogueCollection->collectionArray);
-    for(size_t index = 0; index<arrayLength; index++)
-    {
-        temp = CFASSFileDialogueStoreStringResult(CFPointerArrayGetPointerAtIndex(dialogueCollection->collectionArray, index), NULL);
-        if(temp == -1) return NULL;
-        else stringLength += temp;
-    }
-    
-    wchar_t *result;
-    if((result = malloc(sizeof(wchar_t)*(stringLength+1)))!=NULL)
+    CFMutableStringRef string;
+    if((string = CFMutableStringCreateEmpty()) == NULL)
+        return NULL;
+    if(CFASSFileDialogueCollectionAppendFileContent(dialogueCollection, string) != 0)
     {
-        swprintf(result, SIZE_MAX, L"[Events]\nFormat: Layer, Start, End, Style, Name, MarginL, MarginR, MarginV, Effect, Text\n");
-        wchar_t *currentPoint = result + prefixLength;
-        bool formatCheck = true;
-        for(size_t index = 0; index<arrayLength && formatCheck; index++)
-        {
-            temp = CFASSFileDialogueStoreStringResult(CFPointerArrayGetPointerAtIndex(dialogueCollection->collectionArray, index), currentPoint);
-            if(temp<0)
-                formatCheck = false;
-            else
-                currentPoint += temp;
-        }
-        if(formatCheck)
-            return result;
-        free(result);
+        CFMutableStringDestory(string);
+        return NULL;
     }
-    return NULL;
+    return CFMutableStringDestoryAndStealCharacters(string, NULL);
+}
+
+int CFASSFileDialogueCollectionAppendFileContent(CFASSFileDialogueCollectionRef dialogueCollection, CFMutableStringRef string)
+{
+    if(dialogueCollection == NULL || string == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueCollection %p AppendFileContent %p", dialogueCollection, string);
+    size_t arrayLength = CFPointerArrayGetLength(dialogueCollection->collectionArray);
+    // a rough guess saves most of the regrowth on large files
+    CFMutableStringReserve(string, arrayLength * CFASSFileDialogueCollectionEstimatedDialogueLength);
+    CFMutableStringAppendString(string, L"[Events]\nFormat: Layer, Start, End, Style, Name, MarginL, MarginR, MarginV, Effect, Text\n");
+    for(size_t index = 0; index<arrayLength; index++)
+        if(CFASSFileDialogueAppendStringResult(CFPointerArrayGetPointerAtIndex(dialogueCollection->collectionArray, index), string) != 0)
+            return -1;
+    return CFMutableStringIsFailed(string) ? -1 : 0;
 }
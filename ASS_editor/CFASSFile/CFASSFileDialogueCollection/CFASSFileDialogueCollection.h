@@ -9,6 +9,11 @@
 #ifndef CFASSFileDialogueCollection_h
 #define CFASSFileDialogueCollection_h
 
+#include <stddef.h>
+
+#include "CFEnumerator.h"
+#include "CFASSFileDialogue.h"
+
 typedef struct CFASSFileDialogueCollection *CFASSFileDialogueCollectionRef;
 
 #pragma mark - Copy/Destory
@@ -21,8 +26,23 @@ void CFASSFileDialogueCollectionDestory(CFASSFileDialogueCollectionRef dialogueC
 
 CFEnumeratorRef CFASSFileDialogueCollectionCreateEnumerator(CFASSFileDialogueCollectionRef dialogueCollection);
 
+size_t CFASSFileDialogueCollectionGetLength(CFASSFileDialogueCollectionRef dialogueCollection);
+
+CFASSFileDialogueRef CFASSFileDialogueCollectionGetDialogueAtIndex(CFASSFileDialogueCollectionRef dialogueCollection, size_t index);
+/* Return */
+// the collection keeps the ownership
+
 #pragma mark - Receive Change
 
 void CFASSFileDialogueCollectionMakeChange(CFASSFileDialogueCollectionRef dialogueCollection, CFASSFileChangeRef change);
 
+void CFASSFileDialogueCollectionMakeChangeConcurrently(CFASSFileDialogueCollectionRef dialogueCollection, CFASSFileChangeRef change, unsigned int threadAmount);
+/* threadAmount */
+// 0 means one thread for each online processor
+/* Discussion */
+// dialogues are partitioned into contiguous ranges, each applied by its own worker thread
+// change is only read during apply, so one change could be shared by all workers
+// small collection, or platform without pthread, falls back to CFASSFileDialogueCollectionMakeChange
+// WARNING: the collection must not be accessed by other thread until this returns
+
 #endif /* CFASSFileDialogueCollection_h */
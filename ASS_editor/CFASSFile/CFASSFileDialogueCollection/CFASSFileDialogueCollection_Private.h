@@ -12,6 +12,7 @@
 #include <wchar.h>
 
 #include "CFASSFileDialogueCollection.h"
+#include "CFMutableString.h"
 
 #pragma mark - Read File
 
@@ -21,6 +22,10 @@ CFASSFileDialogueCollectionRef CFASSFileDialogueCollectionCreateWithUnicodeFileC
 
 wchar_t *CFASSFileDialogueCollectionAllocateFileContent(CFASSFileDialogueCollectionRef dialogueCollection);
 
+int CFASSFileDialogueCollectionAppendFileContent(CFASSFileDialogueCollectionRef dialogueCollection, CFMutableStringRef string);
+/* Return */
+// 0 for success, -1 if anything went wrong
+
 #pragma mark - Register Callbacks
 
 int CFASSFileDialogueCollectionRegisterAssociationwithFile(CFASSFileDialogueCollectionRef collection, CFASSFileRef assFile);
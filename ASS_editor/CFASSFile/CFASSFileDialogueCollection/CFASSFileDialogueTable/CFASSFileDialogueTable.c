@@ -0,0 +1,343 @@
+//
+//  CFASSFileDialogueTable.c
+//  ASS_editor
+//
+//  Created by Bill Sun on 2018/11/4.
+//  Copyright © 2018 Bill Sun. All rights reserved.
+//
+
+#include <stdlib.h>
+#include <wchar.h>
+
+#include "CFASSFileDialogueTable.h"
+#include "CFASSFileDialogue.h"
+#include "CFASSFileDialogue_Private.h"
+#include "CFASSFileDialogueCollection.h"
+#include "CFPointerArray.h"
+#include "CFException.h"
+
+typedef struct CFASSFileDialogueTableColumnBlock
+{
+    CFASSFileDialogueRef *row;              // don't have ownership
+    unsigned long *start, *end;
+    unsigned int *layer;
+    unsigned int *styleIdentifier, *actorIdentifier;
+    unsigned int *marginL, *marginR, *marginV;
+} CFASSFileDialogueTableColumnBlock;
+
+struct CFASSFileDialogueTable
+{
+    size_t rowAmount;
+    CFASSFileDialogueTableColumnBlock columns;  // all columns live in one allocation starting at columns.row
+    CFPointerArrayRef styleNames;           // interned names, index is the identifier, don't have ownership
+    CFPointerArrayRef actorNames;
+};
+
+typedef struct CFASSFileDialogueTableSortItem
+{
+    unsigned long key;
+    size_t row;
+} CFASSFileDialogueTableSortItem;
+
+static int CFASSFileDialogueTableColumnBlockAllocate(CFASSFileDialogueTableColumnBlock *block, size_t rowAmount);
+
+static unsigned int CFASSFileDialogueTableIdentifierForName(CFPointerArrayRef names, const wchar_t *name);
+
+static int CFASSFileDialogueTableSortItemCompare(const void *item1, const void *item2);
+
+#pragma mark - Create/Destory
+
+CFASSFileDialogueTableRef CFASSFileDialogueTableCreateWithCollection(CFASSFileDialogueCollectionRef dialogueCollection)
+{
+    if(dialogueCollection == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTable CreateWithCollection NULL");
+    CFASSFileDialogueTableRef result;
+    if((result = malloc(sizeof(struct CFASSFileDialogueTable))) != NULL)
+    {
+        result->rowAmount = CFASSFileDialogueCollectionGetLength(dialogueCollection);
+        if(CFASSFileDialogueTableColumnBlockAllocate(&result->columns, result->rowAmount) == 0)
+        {
+            if((result->styleNames = CFPointerArrayCreateEmpty()) != NULL)
+            {
+                if((result->actorNames = CFPointerArrayCreateEmpty()) != NULL)
+                {
+                    CFASSFileDialogueTableColumnBlock *columns = &result->columns;
+                    CFASSFileDialogueRef dialogue;
+                    bool identifierCheck = true;
+                    for(size_t row = 0; row<result->rowAmount && identifierCheck; row++)
+                    {
+                        dialogue = CFASSFileDialogueCollectionGetDialogueAtIndex(dialogueCollection, row);
+                        columns->row[row] = dialogue;
+                        columns->layer[row] = CFASSFileDialogueGetLayer(dialogue);
+                        columns->start[row] = CFASSFileDialogueGetStartTime(dialogue);
+                        columns->end[row] = CFASSFileDialogueGetEndTime(dialogue);
+                        CFASSFileDialogueGetMargins(dialogue, columns->marginL + row, columns->marginR + row, columns->marginV + row);
+                        columns->styleIdentifier[row] = CFASSFileDialogueTableIdentifierForName(result->styleNames, CFASSFileDialogueGetStyleName(dialogue));
+                        columns->actorIdentifier[row] = CFASSFileDialogueTableIdentifierForName(result->actorNames, CFASSFileDialogueGetActorName(dialogue));
+                        if((columns->styleIdentifier[row] == CFASSFileDialogueTableIdentifierNone && CFASSFileDialogueGetStyleName(dialogue) != NULL) ||
+                           (columns->actorIdentifier[row] == CFASSFileDialogueTableIdentifierNone && CFASSFileDialogueGetActorName(dialogue) != NULL))
+                            identifierCheck = false;
+                    }
+                    if(identifierCheck)
+                        return result;
+                    CFPointerArrayDestory(result->actorNames);
+                }
+                CFPointerArrayDestory(result->styleNames);
+            }
+            free(result->columns.row);
+        }
+        free(result);
+    }
+    return NULL;
+}
+
+void CFASSFileDialogueTableDestory(CFASSFileDialogueTableRef table)
+{
+    if(table == NULL) return;
+    CFPointerArrayDestory(table->styleNames);
+    CFPointerArrayDestory(table->actorNames);
+    free(table->columns.row);
+    free(table);
+}
+
+#pragma mark - Get Component
+
+CFASSFileDialogueTableColumns CFASSFileDialogueTableGetColumns(CFASSFileDialogueTableRef table)
+{
+    if(table == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTable NULL GetColumns");
+    return (CFASSFileDialogueTableColumns){.rowAmount = table->rowAmount,
+                                          .layer = table->columns.layer,
+                                          .start = table->columns.start,
+                                          .end = table->columns.end,
+                                          .styleIdentifier = table->columns.styleIdentifier,
+                                          .actorIdentifier = table->columns.actorIdentifier,
+                                          .marginL = table->columns.marginL,
+                                          .marginR = table->columns.marginR,
+                                          .marginV = table->columns.marginV};
+}
+
+CFASSFileDialogueRef CFASSFileDialogueTableGetRow(CFASSFileDialogueTableRef table, size_t row)
+{
+    if(table == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTable NULL GetRow %zu", row);
+    if(row >= table->rowAmount)
+        CFExceptionRaise(CFExceptionNameArrayOutOfBounds, NULL, "CFASSFileDialogueTable %p GetRow %zu", table, row);
+    return table->columns.row[row];
+}
+
+const wchar_t *CFASSFileDialogueTableGetStyleName(CFASSFileDialogueTableRef table, unsigned int styleIdentifier)
+{
+    if(table == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTable NULL GetStyleName %u", styleIdentifier);
+    if(styleIdentifier == CFASSFileDialogueTableIdentifierNone)
+        return NULL;
+    if(styleIdentifier >= CFPointerArrayGetLength(table->styleNames))
+        CFExceptionRaise(CFExceptionNameArrayOutOfBounds, NULL, "CFASSFileDialogueTable %p GetStyleName %u", table, styleIdentifier);
+    return CFPointerArrayGetPointerAtIndex(table->styleNames, styleIdentifier);
+}
+
+const wchar_t *CFASSFileDialogueTableGetActorName(CFASSFileDialogueTableRef table, unsigned int actorIdentifier)
+{
+    if(table == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTable NULL GetActorName %u", actorIdentifier);
+    if(actorIdentifier == CFASSFileDialogueTableIdentifierNone)
+        return NULL;
+    if(actorIdentifier >= CFPointerArrayGetLength(table->actorNames))
+        CFExceptionRaise(CFExceptionNameArrayOutOfBounds, NULL, "CFASSFileDialogueTable %p GetActorName %u", table, actorIdentifier);
+    return CFPointerArrayGetPointerAtIndex(table->actorNames, actorIdentifier);
+}
+
+unsigned int CFASSFileDialogueTableGetStyleIdentifier(CFASSFileDialogueTableRef table, const wchar_t *styleName)
+{
+    if(table == NULL || styleName == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTable %p GetStyleIdentifier %p", table, styleName);
+    size_t nameAmount = CFPointerArrayGetLength(table->styleNames);
+    for(size_t index = 0; index<nameAmount; index++)
+        if(wcscmp(CFPointerArrayGetPointerAtIndex(table->styleNames, index), styleName) == 0)
+            return (unsigned int)index;
+    return CFASSFileDialogueTableIdentifierNone;
+}
+
+#pragma mark - Bulk Operation
+
+size_t CFASSFileDialogueTableFilterByTime(CFASSFileDialogueTableRef table, unsigned long hundredths, size_t *rows)
+{
+    if(table == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTable NULL FilterByTime %lu", hundredths);
+    const unsigned long *start = table->columns.start, *end = table->columns.end;
+    size_t rowAmount = table->rowAmount, matched = 0;
+    if(rows == NULL)
+    {
+        for(size_t row = 0; row<rowAmount; row++)
+            matched += (start[row] <= hundredths) & (hundredths < end[row]);
+    }
+    else
+    {
+        for(size_t row = 0; row<rowAmount; row++)
+        {
+            rows[matched] = row;
+            matched += (start[row] <= hundredths) & (hundredths < end[row]);
+        }
+    }
+    return matched;
+}
+
+size_t CFASSFileDialogueTableFilterByStyle(CFASSFileDialogueTableRef table, unsigned int styleIdentifier, size_t *rows)
+{
+    if(table == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTable NULL FilterByStyle %u", styleIdentifier);
+    const unsigned int *identifier = table->columns.styleIdentifier;
+    size_t rowAmount = table->rowAmount, matched = 0;
+    if(rows == NULL)
+    {
+        for(size_t row = 0; row<rowAmount; row++)
+            matched += identifier[row] == styleIdentifier;
+    }
+    else
+    {
+        for(size_t row = 0; row<rowAmount; row++)
+        {
+            rows[matched] = row;
+            matched += identifier[row] == styleIdentifier;
+        }
+    }
+    return matched;
+}
+
+int CFASSFileDialogueTableSort(CFASSFileDialogueTableRef table, CFASSFileDialogueTableSortKey key)
+{
+    if(table == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTable NULL Sort %d", (int)key);
+    size_t rowAmount = table->rowAmount;
+    if(rowAmount <= 1)
+        return 0;
+    CFASSFileDialogueTableSortItem *items;
+    if((items = malloc(sizeof(CFASSFileDialogueTableSortItem)*rowAmount)) != NULL)
+    {
+        CFASSFileDialogueTableColumnBlock sorted;
+        if(CFASSFileDialogueTableColumnBlockAllocate(&sorted, rowAmount) == 0)
+        {
+            CFASSFileDialogueTableColumnBlock *columns = &table->columns;
+            for(size_t row = 0; row<rowAmount; row++)
+            {
+                switch (key) {
+                    case CFASSFileDialogueTableSortKeyStart:
+                        items[row].key = columns->start[row];
+                        break;
+                    case CFASSFileDialogueTableSortKeyEnd:
+                        items[row].key = columns->end[row];
+                        break;
+                    case CFASSFileDialogueTableSortKeyLayer:
+                        items[row].key = columns->layer[row];
+                        break;
+                }
+                items[row].row = row;
+            }
+            qsort(items, rowAmount, sizeof(CFASSFileDialogueTableSortItem), CFASSFileDialogueTableSortItemCompare);
+            
+            size_t from;
+            for(size_t row = 0; row<rowAmount; row++)
+            {
+                from = items[row].row;
+                sorted.row[row] = columns->row[from];
+                sorted.start[row] = columns->start[from];
+                sorted.end[row] = columns->end[from];
+                sorted.layer[row] = columns->layer[from];
+                sorted.styleIdentifier[row] = columns->styleIdentifier[from];
+                sorted.actorIdentifier[row] = columns->actorIdentifier[from];
+                sorted.marginL[row] = columns->marginL[from];
+                sorted.marginR[row] = columns->marginR[from];
+                sorted.marginV[row] = columns->marginV[from];
+            }
+            free(columns->row);
+            *columns = sorted;
+            free(items);
+            return 0;
+        }
+        free(items);
+    }
+    return -1;
+}
+
+void CFASSFileDialogueTableShiftTime(CFASSFileDialogueTableRef table, long hundredths)
+{
+    if(table == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileDialogueTable NULL ShiftTime %ld", hundredths);
+    unsigned long *start = table->columns.start, *end = table->columns.end;
+    size_t rowAmount = table->rowAmount;
+    if(hundredths >= 0)
+    {
+        unsigned long offset = (unsigned long)hundredths;
+        for(size_t row = 0; row<rowAmount; row++)
+        {
+            start[row] += offset;
+            end[row] += offset;
+        }
+    }
+    else
+    {
+        unsigned long offset = (unsigned long)-(hundredths+1) + 1;
+        for(size_t row = 0; row<rowAmount; row++)
+        {
+            start[row] = start[row] > offset ? start[row] - offset : 0;
+            end[row] = end[row] > offset ? end[row] - offset : 0;
+        }
+    }
+    for(size_t row = 0; row<rowAmount; row++)
+        CFASSFileDialogueSetTime(table->columns.row[row], start[row], end[row]);
+}
+
+#pragma mark - Private
+
+static int CFASSFileDialogueTableColumnBlockAllocate(CFASSFileDialogueTableColumnBlock *block, size_t rowAmount)
+{
+    // widest column first, so every column stays aligned
+    size_t blockSize = rowAmount*(sizeof(CFASSFileDialogueRef) + 2*sizeof(unsigned long) + 6*sizeof(unsigned int));
+    char *memory;
+    if((memory = malloc(blockSize == 0 ? 1 : blockSize)) == NULL)
+        return -1;
+    block->row = (CFASSFileDialogueRef *)memory;
+    memory += rowAmount*sizeof(CFASSFileDialogueRef);
+    block->start = (unsigned long *)memory;
+    memory += rowAmount*sizeof(unsigned long);
+    block->end = (unsigned long *)memory;
+    memory += rowAmount*sizeof(unsigned long);
+    block->layer = (unsigned int *)memory;
+    memory += rowAmount*sizeof(unsigned int);
+    block->styleIdentifier = (unsigned int *)memory;
+    memory += rowAmount*sizeof(unsigned int);
+    block->actorIdentifier = (unsigned int *)memory;
+    memory += rowAmount*sizeof(unsigned int);
+    block->marginL = (unsigned int *)memory;
+    memory += rowAmount*sizeof(unsigned int);
+    block->marginR = (unsigned int *)memory;
+    memory += rowAmount*sizeof(unsigned int);
+    block->marginV = (unsigned int *)memory;
+    return 0;
+}
+
+static unsigned int CFASSFileDialogueTableIdentifierForName(CFPointerArrayRef names, const wchar_t *name)
+{
+    // names are interned per file, so pointer equality is enough
+    if(name == NULL)
+        return CFASSFileDialogueTableIdentifierNone;
+    size_t nameAmount = CFPointerArrayGetLength(names);
+    for(size_t index = nameAmount; index>0; index--)
+        if(CFPointerArrayGetPointerAtIndex(names, index-1) == name)
+            return (unsigned int)(index-1);
+    CFPointerArrayAddPointer(names, (void *)name, false);
+    if(CFPointerArrayGetLength(names) != nameAmount+1)
+        return CFASSFileDialogueTableIdentifierNone;
+    return (unsigned int)nameAmount;
+}
+
+static int CFASSFileDialogueTableSortItemCompare(const void *item1, const void *item2)
+{
+    const CFASSFileDialogueTableSortItem *sortItem1 = item1, *sortItem2 = item2;
+    if(sortItem1->key != sortItem2->key)
+        return sortItem1->key < sortItem2->key ? -1 : 1;
+    if(sortItem1->row != sortItem2->row)
+        return sortItem1->row < sortItem2->row ? -1 : 1;
+    return 0;
+}
@@ -0,0 +1,88 @@
+//
+//  CFASSFileDialogueTable.h
+//  ASS_editor
+//
+//  Created by Bill Sun on 2018/11/4.
+//  Copyright © 2018 Bill Sun. All rights reserved.
+//
+
+#ifndef CFASSFileDialogueTable_h
+#define CFASSFileDialogueTable_h
+
+#include <stddef.h>
+#include <wchar.h>
+
+#include "CFASSFileDialogue.h"
+#include "CFASSFileDialogueCollection.h"
+
+typedef struct CFASSFileDialogueTable *CFASSFileDialogueTableRef;
+
+#define CFASSFileDialogueTableIdentifierNone ((unsigned int)-1)
+
+typedef struct CFASSFileDialogueTableColumns
+{
+    size_t rowAmount;
+    const unsigned int *layer;
+    const unsigned long *start, *end;           // in hundredths of second
+    const unsigned int *styleIdentifier;        // CFASSFileDialogueTableIdentifierNone for empty
+    const unsigned int *actorIdentifier;        // CFASSFileDialogueTableIdentifierNone for empty
+    const unsigned int *marginL, *marginR, *marginV;
+} CFASSFileDialogueTableColumns;
+
+typedef enum CFASSFileDialogueTableSortKey {
+    CFASSFileDialogueTableSortKeyStart,
+    CFASSFileDialogueTableSortKeyEnd,
+    CFASSFileDialogueTableSortKeyLayer
+} CFASSFileDialogueTableSortKey;
+
+#pragma mark - Create/Destory
+
+CFASSFileDialogueTableRef CFASSFileDialogueTableCreateWithCollection(CFASSFileDialogueCollectionRef dialogueCollection);
+/* Discussion */
+// every field except text and effect is copied into parallel columns, one row per dialogue
+// rows keep referring the dialogues of the collection, so destory the table before the collection
+// the table is not notified by the collection, recreate it after adding, removing or changing dialogues elsewhere
+
+void CFASSFileDialogueTableDestory(CFASSFileDialogueTableRef table);
+
+#pragma mark - Get Component
+
+CFASSFileDialogueTableColumns CFASSFileDialogueTableGetColumns(CFASSFileDialogueTableRef table);
+/* Return */
+// the columns are owned by table, and are valid until table is sorted or destoryed
+
+CFASSFileDialogueRef CFASSFileDialogueTableGetRow(CFASSFileDialogueTableRef table, size_t row);
+/* Return */
+// the row view of the dialogue, the collection keeps the ownership
+
+const wchar_t *CFASSFileDialogueTableGetStyleName(CFASSFileDialogueTableRef table, unsigned int styleIdentifier);
+
+const wchar_t *CFASSFileDialogueTableGetActorName(CFASSFileDialogueTableRef table, unsigned int actorIdentifier);
+/* Return */
+// NULL if identifier is CFASSFileDialogueTableIdentifierNone
+
+unsigned int CFASSFileDialogueTableGetStyleIdentifier(CFASSFileDialogueTableRef table, const wchar_t *styleName);
+/* Return */
+// CFASSFileDialogueTableIdentifierNone if no row uses styleName
+
+#pragma mark - Bulk Operation
+
+size_t CFASSFileDialogueTableFilterByTime(CFASSFileDialogueTableRef table, unsigned long hundredths, size_t *rows);
+
+size_t CFASSFileDialogueTableFilterByStyle(CFASSFileDialogueTableRef table, unsigned int styleIdentifier, size_t *rows);
+/* rows */
+// this could be NULL, otherwise it should hold at least the row amount
+/* Return */
+// the amount of rows matched, displaying at hundredths or using styleIdentifier, in table order
+
+int CFASSFileDialogueTableSort(CFASSFileDialogueTableRef table, CFASSFileDialogueTableSortKey key);
+/* Return */
+// return zero means success, -1 means failed and table order stays unchanged
+/* Discussion */
+// the sort is stable, it only reorders the table, not the collection
+
+void CFASSFileDialogueTableShiftTime(CFASSFileDialogueTableRef table, long hundredths);
+/* Discussion */
+// time earlier than zero is clamped to zero, the rows are updated as well
+
+#endif /* CFASSFileDialogueTable_h */
@@ -15,11 +15,17 @@
 #include "CFASSFileStyle.h"
 #include "CFASSFileDialogueCollection.h"
 #include "CFASSFileDialogue.h"
+#include "CFASSFileDialogueTable.h"
 #include "CFASSFileDialogueEffect.h"
 #include "CFASSFileDialogueText.h"
 #include "CFASSFileDialogueTextContent.h"
 #include "CFASSFileDialogueTextDrawingContext.h"
+#include "CFASSFileDialogueTextDrawingGeometry.h"
+#include "CFASSFileDialogueTextDrawingRasterizer.h"
 #include "CFASSFileDialogueTextContentOverride.h"
+#include "CFASSFileDialogueTextContentOverrideBytecode.h"
+#include "CFASSFileDialogueTextContentOverrideCache.h"
+#include "CFASSFileDialogueEvaluator.h"
 #include "CFASSFileChange.h"
 #include "CFASSFileControl.h"
 
@@ -34,6 +40,8 @@
 #include "CFASSFileDialogueTextContent_Private.h"
 #include "CFASSFileDialogueTextDrawingContext_Private.h"
 #include "CFASSFileDialogueTextContentOverride_Private.h"
+#include "CFASSFileDialogueTextContentOverrideBytecode_Private.h"
+#include "CFASSFileDialogueTextContentOverrideCache_Private.h"
 #include "CFASSFileChange_Private.h"
 #include "CFASSFileControl_Private.h"
 
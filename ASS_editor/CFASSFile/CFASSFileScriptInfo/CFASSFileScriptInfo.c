@@ -17,6 +17,7 @@
 #include "CFUnicodeStringArray.h"
 #include "CFUseTool.h"
 #include "CFException.h"
+#include "CFMutableString.h"
 #include "CFASSFileChange.h"
 #include "CFASSFileChange_Private.h"
 
@@ -69,191 +70,66 @@ int CFASSFileScriptInfoRegisterAssociationwithFile(CFASSFileScriptInfoRef script
 
 wchar_t *CFASSFileScriptInfoAllocateFileContent(CFASSFileScriptInfoRef scriptInfo)
 {
-    size_t commentAmount = CFUnicodeStringArrayGetLength(scriptInfo->comment),
-    scriptStringLength = 0;
-    int temp;
-    
-    scriptStringLength += wcslen(L"[Script Info]\n");
-    
-    for(size_t count = 1; count<=commentAmount; count++)
-        scriptStringLength += wcslen(CFUnicodeStringArrayGetStringAtIndex(scriptInfo->comment, count-1))+2;
-    
-    FILE *fp;
-    if((fp=tmpfile()) == NULL) return NULL;
-    
-    temp =
-    fwprintf(fp, L"Title:%ls\n"
-                 L"Original Script:%ls\n",
-                scriptInfo->title==NULL?L"":scriptInfo->title,
-                scriptInfo->original_script==NULL?L"":scriptInfo->original_script);
-    if(temp<0) {fclose(fp); return NULL;}
-    else scriptStringLength+=temp;
-    
-    if(scriptInfo->original_translation!=NULL) {
-        temp = fwprintf(fp, L"Original Translation:%ls\n", scriptInfo->original_translation);
-        if(temp<0) {fclose(fp); return NULL;}
-        else scriptStringLength+=temp;
-    }
-    if(scriptInfo->original_editing!=NULL) {
-        temp = fwprintf(fp, L"Original Editing:%ls\n", scriptInfo->original_editing);
-        if(temp<0) {fclose(fp); return NULL;}
-        else scriptStringLength+=temp;
-    }
-    if(scriptInfo->original_timing!=NULL) {
-        temp = fwprintf(fp, L"Original Timing:%ls\n", scriptInfo->original_timing);
-        if(temp<0) {fclose(fp); return NULL;}
-        else scriptStringLength+=temp;
-    }
-    if(scriptInfo->synch_point!=NULL) {
-        temp = fwprintf(fp, L"Synch Point:%ls\n", scriptInfo->synch_point);
-        if(temp<0) {fclose(fp); return NULL;}
-        else scriptStringLength+=temp;
-    }
-    if(scriptInfo->script_updated_by!=NULL) {
-        temp = fwprintf(fp, L"Script Updated By:%ls\n", scriptInfo->script_updated_by);
-        if(temp<0) {fclose(fp); return NULL;}
-        else scriptStringLength+=temp;
-    }
-    if(scriptInfo->update_details!=NULL) {
-        temp = fwprintf(fp, L"Update Details:%ls\n", scriptInfo->update_details);
-        if(temp<0) {fclose(fp); return NULL;}
-        else scriptStringLength+=temp;
-    }
-    if(scriptInfo->script_type!=NULL) {
-        temp = fwprintf(fp, L"ScriptType:%ls\n", scriptInfo->script_type);
-        if(temp<0) {fclose(fp); return NULL;}
-        else scriptStringLength+=temp;
-    }
-    
-    if(scriptInfo->is_collisions_normal)
-        scriptStringLength+=wcslen(L"Collisions:Normal\n");
-    else
-        scriptStringLength+=wcslen(L"Collisions:Reversed\n");
-    
-    temp =
-    fwprintf(fp, L"PlayResX:%u\n"
-                 L"PlayResY:%u\n",
-                 scriptInfo->play_res_x,
-                 scriptInfo->play_res_y);
-    if(temp<0) {fclose(fp); return NULL;}
-    else scriptStringLength+=temp;
-    
-    if(scriptInfo->play_depth!=NULL) {
-        temp = fwprintf(fp, L"PlayDepth:%ls\n", scriptInfo->play_depth);
-        if(temp<0) {fclose(fp); return NULL;}
-        else scriptStringLength+=temp;
-    }
-    
-    temp =
-    fwprintf(fp, L"Timer:%.4f\n"
-                 L"WrapStyle:%u\n",
-                 scriptInfo->timer,
-                 scriptInfo->wrap_style);
-    if(temp<0) {fclose(fp); return NULL;}
-    else scriptStringLength+=temp;
-    
-    wchar_t *result;
-    if((result = malloc(sizeof(wchar_t)*(scriptStringLength+1))) == NULL)
-        {fclose(fp); return NULL;}
-    
-    wchar_t *writingPoint = result;
-    
-    temp = swprintf(writingPoint, scriptStringLength+1, L"[Script Info]\n");
-    writingPoint+=temp; scriptStringLength-=temp;
+    CFMutableStringRef string;
+    if((string = CFMutableStringCreateEmpty()) == NULL)
+        return NULL;
+    wchar_t *result = NULL;
+    if(CFASSFileScriptInfoAppendFileContent(scriptInfo, string) == 0)
+        result = CFMutableStringCopyCharacters(string);
+    CFMutableStringDestory(string);
+    return result;
+}
+
+static void CFASSFileScriptInfoAppendEachContent(CFMutableStringRef string, const wchar_t *name, const wchar_t *content)
+{
+    // skip optional field which is NULL
+    if(content == NULL) return;
+    CFMutableStringAppendString(string, name);
+    CFMutableStringAppendCharacter(string, L':');
+    CFMutableStringAppendString(string, content);
+    CFMutableStringAppendCharacter(string, L'\n');
+}
+
+int CFASSFileScriptInfoAppendFileContent(CFASSFileScriptInfoRef scriptInfo, CFMutableStringRef string)
+{
+    if(scriptInfo == NULL || string == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileScriptInfo %p AppendFileContent %p", scriptInfo, string);
+    CFMutableStringAppendString(string, L"[Script Info]\n");
     
+    size_t commentAmount = CFUnicodeStringArrayGetLength(scriptInfo->comment);
     for(size_t count = 1; count<=commentAmount; count++)
     {
-        temp = swprintf(writingPoint, scriptStringLength+1, L";%ls\n", CFUnicodeStringArrayGetStringAtIndex(scriptInfo->comment, count-1));
-        writingPoint+=temp; scriptStringLength-=temp;
-    }
-    
-    temp =
-    swprintf(writingPoint, scriptStringLength+1,
-             L"Title:%ls\n"
-             L"Original Script:%ls\n",
-             scriptInfo->title==NULL?L"":scriptInfo->title,
-             scriptInfo->original_script==NULL?L"":scriptInfo->original_script);
-    writingPoint+=temp; scriptStringLength-=temp;
-    
-    if(scriptInfo->original_translation!=NULL) {
-        temp =
-        swprintf(writingPoint, scriptStringLength+1,
-                 L"Original Translation:%ls\n", scriptInfo->original_translation);
-        writingPoint+=temp; scriptStringLength-=temp;
-    }
-    if(scriptInfo->original_editing!=NULL) {
-        temp =
-        swprintf(writingPoint, scriptStringLength+1,
-                 L"Original Editing:%ls\n", scriptInfo->original_editing);
-        writingPoint+=temp; scriptStringLength-=temp;
-    }
-    if(scriptInfo->original_timing!=NULL) {
-        temp =
-        swprintf(writingPoint, scriptStringLength+1,
-                 L"Original Timing:%ls\n", scriptInfo->original_timing);
-        writingPoint+=temp; scriptStringLength-=temp;
-    }
-    if(scriptInfo->synch_point!=NULL) {
-        temp =
-        swprintf(writingPoint, scriptStringLength+1,
-                 L"Synch Point:%ls\n", scriptInfo->synch_point);
-        writingPoint+=temp; scriptStringLength-=temp;
-    }
-    if(scriptInfo->script_updated_by!=NULL) {
-        temp =
-        swprintf(writingPoint, scriptStringLength+1,
-                 L"Script Updated By:%ls\n", scriptInfo->script_updated_by);
-        writingPoint+=temp; scriptStringLength-=temp;
-    }
-    if(scriptInfo->update_details!=NULL) {
-        temp =
-        swprintf(writingPoint, scriptStringLength+1,
-                 L"Update Details:%ls\n", scriptInfo->update_details);
-        writingPoint+=temp; scriptStringLength-=temp;
-    }
-    if(scriptInfo->script_type!=NULL) {
-        temp =
-        swprintf(writingPoint, scriptStringLength+1,
-                 L"ScriptType:%ls\n", scriptInfo->script_type);
-        writingPoint+=temp; scriptStringLength-=temp;
-    }
-    
-    if(scriptInfo->is_collisions_normal)
-    {
-        temp =
-        swprintf(writingPoint, scriptStringLength+1, L"Collisions:Normal\n");
-        writingPoint+=temp; scriptStringLength-=temp;
-    }
-    else
-    {
-        temp =
-        swprintf(writingPoint, scriptStringLength+1, L"Collisions:Reversed\n");
-        writingPoint+=temp; scriptStringLength-=temp;
-    }
-    
-    temp =
-    swprintf(writingPoint, scriptStringLength+1,
-             L"PlayResX:%u\n"
-             L"PlayResY:%u\n",
-             scriptInfo->play_res_x,
-             scriptInfo->play_res_y);
-    writingPoint+=temp; scriptStringLength-=temp;
-    
-    if(scriptInfo->play_depth!=NULL) {
-        temp = swprintf(writingPoint, scriptStringLength+1,
-                 L"PlayDepth:%ls\n", scriptInfo->play_depth);
-        writingPoint+=temp; scriptStringLength-=temp;
-    }
-    temp =
-    swprintf(writingPoint, scriptStringLength+1,
-             L"Timer:%.4f\n"
-             L"WrapStyle:%u\n",
-             scriptInfo->timer,
-             scriptInfo->wrap_style);
-    // writingPoint+=temp; scriptStringLength-=temp;
-    
-    fclose(fp);
-    return result;
+        CFMutableStringAppendCharacter(string, L';');
+        CFMutableStringAppendString(string, CFUnicodeStringArrayGetStringAtIndex(scriptInfo->comment, count-1));
+        CFMutableStringAppendCharacter(string, L'\n');
+    }
+    
+    CFASSFileScriptInfoAppendEachContent(string, L"Title", scriptInfo->title==NULL?L"":scriptInfo->title);
+    CFASSFileScriptInfoAppendEachContent(string, L"Original Script", scriptInfo->original_script==NULL?L"":scriptInfo->original_script);
+    CFASSFileScriptInfoAppendEachContent(string, L"Original Translation", scriptInfo->original_translation);
+    CFASSFileScriptInfoAppendEachContent(string, L"Original Editing", scriptInfo->original_editing);
+    CFASSFileScriptInfoAppendEachContent(string, L"Original Timing", scriptInfo->original_timing);
+    CFASSFileScriptInfoAppendEachContent(string, L"Synch Point", scriptInfo->synch_point);
+    CFASSFileScriptInfoAppendEachContent(string, L"Script Updated By", scriptInfo->script_updated_by);
+    CFASSFileScriptInfoAppendEachContent(string, L"Update Details", scriptInfo->update_details);
+    CFASSFileScriptInfoAppendEachContent(string, L"ScriptType", scriptInfo->script_type);
+    
+    CFMutableStringAppendString(string, scriptInfo->is_collisions_normal ? L"Collisions:Normal\n" : L"Collisions:Reversed\n");
+    
+    CFMutableStringAppendString(string, L"PlayResX:");
+    CFMutableStringAppendUnsigned(string, scriptInfo->play_res_x);
+    CFMutableStringAppendString(string, L"\nPlayResY:");
+    CFMutableStringAppendUnsigned(string, scriptInfo->play_res_y);
+    CFMutableStringAppendCharacter(string, L'\n');
+    
+    CFASSFileScriptInfoAppendEachContent(string, L"PlayDepth", scriptInfo->play_depth);
+    
+    CFMutableStringAppendString(string, L"Timer:");
+    CFMutableStringAppendDoubleWithPrecision(string, scriptInfo->timer, 4);
+    CFMutableStringAppendString(string, L"\nWrapStyle:");
+    CFMutableStringAppendUnsigned(string, scriptInfo->wrap_style);
+    CFMutableStringAppendCharacter(string, L'\n');
+    return CFMutableStringIsFailed(string) ? -1 : 0;
 }
 
 static wchar_t *CFASSFileScriptInfoAllocateEachContent(const wchar_t *name,         /* sample: L"Tiltle", without comma */
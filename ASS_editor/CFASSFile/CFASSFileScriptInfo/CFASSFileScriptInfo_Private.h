@@ -12,6 +12,7 @@
 #include <wchar.h>
 
 #include "CFASSFileScriptInfo.h"
+#include "CFMutableString.h"
 
 #pragma mark - Read File
 
@@ -21,6 +22,10 @@ CFASSFileScriptInfoRef CFASSFileScriptInfoCreateWithUnicodeFileContent(const wch
 
 wchar_t *CFASSFileScriptInfoAllocateFileContent(CFASSFileScriptInfoRef scriptInfo);
 
+int CFASSFileScriptInfoAppendFileContent(CFASSFileScriptInfoRef scriptInfo, CFMutableStringRef string);
+/* Return */
+// 0 for success, -1 if anything went wrong
+
 #pragma mark - Register Callbacks
 
 int CFASSFileScriptInfoRegisterAssociationwithFile(CFASSFileScriptInfoRef scriptInfo, CFASSFileRef assFile);
@@ -13,8 +13,10 @@
 #include <limits.h>
 
 #include "CFASSFileStyle.h"
+#include "CFASSFileStyle_Private.h"
 #include "CFASSFile_Private.h"
 #include "CFException.h"
+#include "CFMutableString.h"
 #include "CFASSFileChange.h"
 #include "CFASSFileChange_Private.h"
 
@@ -145,6 +147,78 @@ void CFASSFileStyleDestory(CFASSFileStyleRef style)
     free(style);
 }
 
+const wchar_t *CFASSFileStyleGetName(CFASSFileStyleRef style)
+{
+    if(style == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileStyle NULL GetName");
+    return style->name;
+}
+
+unsigned int CFASSFileStyleGetFontSize(CFASSFileStyleRef style)
+{
+    if(style == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileStyle NULL GetFontSize");
+    return style->font_size;
+}
+
+void CFASSFileStyleGetScale(CFASSFileStyleRef style, double *scaleX, double *scaleY)
+{
+    if(style == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileStyle NULL GetScale");
+    if(scaleX != NULL) *scaleX = style->scale_x;
+    if(scaleY != NULL) *scaleY = style->scale_y;
+}
+
+double CFASSFileStyleGetSpacing(CFASSFileStyleRef style)
+{
+    if(style == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileStyle NULL GetSpacing");
+    return style->spacing;
+}
+
+double CFASSFileStyleGetAngle(CFASSFileStyleRef style)
+{
+    if(style == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileStyle NULL GetAngle");
+    return style->angle;
+}
+
+void CFASSFileStyleGetOutlineAndShadow(CFASSFileStyleRef style, unsigned int *outline, unsigned int *shadow)
+{
+    if(style == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileStyle NULL GetOutlineAndShadow");
+    if(outline != NULL) *outline = style->outline;
+    if(shadow != NULL) *shadow = style->shadow;
+}
+
+void CFASSFileStyleGetColors(CFASSFileStyleRef style,
+                             CFASSFileStyleColor *primaryColor,
+                             CFASSFileStyleColor *secondaryColor,
+                             CFASSFileStyleColor *outlineColor,
+                             CFASSFileStyleColor *backColor)
+{
+    if(style == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileStyle NULL GetColors");
+    if(primaryColor != NULL) *primaryColor = style->primary_colour;
+    if(secondaryColor != NULL) *secondaryColor = style->secondary_colour;
+    if(outlineColor != NULL) *outlineColor = style->outline_colour;
+    if(backColor != NULL) *backColor = style->back_colour;
+}
+
+int CFASSFileStyleSetName(CFASSFileStyleRef style, const wchar_t *name)
+{
+    if(style == NULL || name == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileStyle %p SetName %p", style, name);
+    if(*name == L'\0' || wcschr(name, L',') != NULL)
+        return -1;
+    wchar_t *dumped;
+    if((dumped = CF_Dump_wchar_string(name)) == NULL)
+        return -1;
+    free(style->name);
+    style->name = dumped;
+    return 0;
+}
+
 CFASSFileStyleRef CFASSFileStyleCreate(wchar_t *name,
                                        wchar_t *font_name, unsigned int font_size,
                                        CFASSFileStyleColor primary_colour,
@@ -207,76 +281,77 @@ CFASSFileStyleRef CFASSFileStyleCreate(wchar_t *name,
 
 wchar_t *CFASSFileStyleAllocateFileContent(CFASSFileStyleRef style)
 {
-    FILE *fp;
-    if((fp = tmpfile())==NULL) return NULL;
-    
-    int stringLength =
-    fwprintf(fp,
-             L"Style: %ls,%ls,%u,"                  /* font */
-             L"&H%2.2hX%2.2hX%2.2hX%2.2hX,"     /* colour */
-             L"&H%2.2hX%2.2hX%2.2hX%2.2hX,"
-             L"&H%2.2hX%2.2hX%2.2hX%2.2hX,"
-             L"&H%2.2hX%2.2hX%2.2hX%2.2hX,"
-             L"%d,%d,%d,%d,"                        /* blod, italic, underline, strike_out */
-             L"%g,%g,"                              /* scale_x, scale_y */
-             L"%g,"                                 /* spacing */
-             L"%g,"                                 /* angle */
-             L"%d,"                                 /* border_style */
-             L"%u,%u,"                              /* outline, shadow */
-             L"%d,"                                 /* alignment */
-             L"%u,%u,%u,"                           /* margins */
-             L"%u\n",                              /* encoding */
-             style->name, style->font_name, style->font_size,
-             (unsigned int)style->primary_colour.alpha, (unsigned int)style->primary_colour.blue, (unsigned int)style->primary_colour.green, (unsigned int)style->primary_colour.red,
-             (unsigned int)style->secondary_colour.alpha, (unsigned int)style->secondary_colour.blue, (unsigned int)style->secondary_colour.green, (unsigned int)style->secondary_colour.red,
-             (unsigned int)style->outline_colour.alpha, (unsigned int)style->outline_colour.blue, (unsigned int)style->outline_colour.green, (unsigned int)style->outline_colour.red,
-             (unsigned int)style->back_colour.alpha, (unsigned int)style->back_colour.blue, (unsigned int)style->back_colour.green, (unsigned int)style->back_colour.red,
-             style->blod?-1:0,style->italic?-1:0,style->underline?-1:0,style->strike_out?-1:0,
-             style->scale_x, style->scale_y,
-             style->spacing,
-             style->angle,
-             style->border_style,
-             style->outline, style->shadow,
-             style->alignment,
-             style->marginL, style->marginR, style->marginV,
-             style->encoding);
-    
-    wchar_t *result;
-    if((result=malloc(sizeof(wchar_t)*(stringLength+1)))!=NULL)
-    {
-        swprintf(result, stringLength+1,
-                 L"Style: %ls,%ls,%u,"                  /* font */
-                 L"&H%2.2hX%2.2hX%2.2hX%2.2hX,"         /* colour */
-                 L"&H%2.2hX%2.2hX%2.2hX%2.2hX,"
-                 L"&H%2.2hX%2.2hX%2.2hX%2.2hX,"
-                 L"&H%2.2hX%2.2hX%2.2hX%2.2hX,"
-                 L"%d,%d,%d,%d,"                        /* blod, italic, underline, strike_out */
-                 L"%g,%g,"                              /* scale_x, scale_y */
-                 L"%g,"                                 /* spacing */
-                 L"%g,"                                 /* angle */
-                 L"%d,"                                 /* border_style */
-                 L"%u,%u,"                              /* outline, shadow */
-                 L"%d,"                                 /* alignment */
-                 L"%u,%u,%u,"                           /* margins */
-                 L"%u\n",                               /* encoding */
-                 style->name, style->font_name, style->font_size,
-                 (unsigned int)style->primary_colour.alpha, (unsigned int)style->primary_colour.blue, (unsigned int)style->primary_colour.green, (unsigned int)style->primary_colour.red,
-                 (unsigned int)style->secondary_colour.alpha, (unsigned int)style->secondary_colour.blue, (unsigned int)style->secondary_colour.green, (unsigned int)style->secondary_colour.red,
-                 (unsigned int)style->outline_colour.alpha, (unsigned int)style->outline_colour.blue, (unsigned int)style->outline_colour.green, (unsigned int)style->outline_colour.red,
-                 (unsigned int)style->back_colour.alpha, (unsigned int)style->back_colour.blue, (unsigned int)style->back_colour.green, (unsigned int)style->back_colour.red,
-                 style->blod?-1:0,style->italic?-1:0,style->underline?-1:0,style->strike_out?-1:0,
-                 style->scale_x, style->scale_y,
-                 style->spacing,
-                 style->angle,
-                 style->border_style,
-                 style->outline, style->shadow,
-                 style->alignment,
-                 style->marginL, style->marginR, style->marginV,
-                 style->encoding);
-        return result;
-    }
-    fclose(fp);
-    return NULL;
+    CFMutableStringRef string;
+    if((string = CFMutableStringCreateEmpty()) == NULL)
+        return NULL;
+    wchar_t *result = NULL;
+    if(CFASSFileStyleAppendFileContent(style, string) == 0)
+        result = CFMutableStringCopyCharacters(string);
+    CFMutableStringDestory(string);
+    return result;
+}
+
+static void CFASSFileStyleAppendColor(CFMutableStringRef string, CFASSFileStyleColor color)
+{
+    // &HAABBGGRR,
+    CFMutableStringAppendString(string, L"&H");
+    CFMutableStringAppendHex(string, color.alpha, 2);
+    CFMutableStringAppendHex(string, color.blue, 2);
+    CFMutableStringAppendHex(string, color.green, 2);
+    CFMutableStringAppendHex(string, color.red, 2);
+    CFMutableStringAppendCharacter(string, L',');
+}
+
+int CFASSFileStyleAppendFileContent(CFASSFileStyleRef style, CFMutableStringRef string)
+{
+    if(style == NULL || string == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileStyle %p AppendFileContent %p", style, string);
+    /* font */
+    CFMutableStringAppendString(string, L"Style: ");
+    CFMutableStringAppendString(string, style->name);
+    CFMutableStringAppendCharacter(string, L',');
+    CFMutableStringAppendString(string, style->font_name);
+    CFMutableStringAppendCharacter(string, L',');
+    CFMutableStringAppendUnsigned(string, style->font_size);
+    CFMutableStringAppendCharacter(string, L',');
+    /* colour */
+    CFASSFileStyleAppendColor(string, style->primary_colour);
+    CFASSFileStyleAppendColor(string, style->secondary_colour);
+    CFASSFileStyleAppendColor(string, style->outline_colour);
+    CFASSFileStyleAppendColor(string, style->back_colour);
+    /* blod, italic, underline, strike_out */
+    CFMutableStringAppendString(string, style->blod ? L"-1," : L"0,");
+    CFMutableStringAppendString(string, style->italic ? L"-1," : L"0,");
+    CFMutableStringAppendString(string, style->underline ? L"-1," : L"0,");
+    CFMutableStringAppendString(string, style->strike_out ? L"-1," : L"0,");
+    /* scale_x, scale_y, spacing, angle */
+    CFMutableStringAppendDouble(string, style->scale_x);
+    CFMutableStringAppendCharacter(string, L',');
+    CFMutableStringAppendDouble(string, style->scale_y);
+    CFMutableStringAppendCharacter(string, L',');
+    CFMutableStringAppendDouble(string, style->spacing);
+    CFMutableStringAppendCharacter(string, L',');
+    CFMutableStringAppendDouble(string, style->angle);
+    CFMutableStringAppendCharacter(string, L',');
+    /* border_style, outline, shadow, alignment */
+    CFMutableStringAppendInteger(string, style->border_style);
+    CFMutableStringAppendCharacter(string, L',');
+    CFMutableStringAppendUnsigned(string, style->outline);
+    CFMutableStringAppendCharacter(string, L',');
+    CFMutableStringAppendUnsigned(string, style->shadow);
+    CFMutableStringAppendCharacter(string, L',');
+    CFMutableStringAppendInteger(string, style->alignment);
+    CFMutableStringAppendCharacter(string, L',');
+    /* margins, encoding */
+    CFMutableStringAppendUnsigned(string, style->marginL);
+    CFMutableStringAppendCharacter(string, L',');
+    CFMutableStringAppendUnsigned(string, style->marginR);
+    CFMutableStringAppendCharacter(string, L',');
+    CFMutableStringAppendUnsigned(string, style->marginV);
+    CFMutableStringAppendCharacter(string, L',');
+    CFMutableStringAppendUnsigned(string, style->encoding);
+    CFMutableStringAppendCharacter(string, L'\n');
+    return CFMutableStringIsFailed(string) ? -1 : 0;
 }
 
 CFASSFileStyleRef CFASSFileStyleCreateWithString(const wchar_t *content)
@@ -289,12 +364,13 @@ CFASSFileStyleRef CFASSFileStyleCreateWithString(const wchar_t *content)
     if(scanedAmount == wcslen(L"Style:"))
     {
         beginPoint+=scanedAmount;
+        while(beginPoint<endPoint && *beginPoint==L' ') beginPoint++;
         CFASSFileStyleRef result;
         if((result = malloc(sizeof(struct CFASSFileStyle))) != NULL)
         {
             if((result->name = CF_allocate_wchar_string_with_endPoint_skip_terminate(beginPoint, endPoint - 1, CFASSFileStyleCreateWithStringIsSkip, NULL)) != NULL)
             {
-                while(*beginPoint!=L',' && beginPoint<endPoint) beginPoint++;
+                while(beginPoint<endPoint && *beginPoint!=L',') beginPoint++;
                 if(*beginPoint == L',')
                 {
                     beginPoint++;
@@ -302,14 +378,14 @@ CFASSFileStyleRef CFASSFileStyleCreateWithString(const wchar_t *content)
                     {
                         #if CFASSFileStyleCreateWithStringScanBySteps
                         
-                        while(*beginPoint!=L',' && beginPoint<endPoint) beginPoint++;
+                        while(beginPoint<endPoint && *beginPoint!=L',') beginPoint++;
                         if(*beginPoint == L',') beginPoint++;
                         else goto LABEL_1;
                         
                         if(swscanf(beginPoint, L"%u%n", &result->font_size, &scanedAmount) != 1) goto LABEL_1;
                         if(result->font_size == 0) goto LABEL_1;
                         beginPoint += scanedAmount;
-                        while(*beginPoint!=L',' && beginPoint<endPoint) beginPoint++;
+                        while(beginPoint<endPoint && *beginPoint!=L',') beginPoint++;
                         if(*beginPoint == L',') beginPoint++;
                         else goto LABEL_1;
                         
@@ -326,7 +402,7 @@ CFASSFileStyleRef CFASSFileStyleCreateWithString(const wchar_t *content)
                         result->primary_colour = CFASSFileStyleColorMake(alpha, blue, green, red);
                         
                         beginPoint += scanedAmount;
-                        while(*beginPoint!=L',' && beginPoint<endPoint) beginPoint++;
+                        while(beginPoint<endPoint && *beginPoint!=L',') beginPoint++;
                         if(*beginPoint == L',') beginPoint++;
                         else goto LABEL_1;
                         
@@ -342,7 +418,7 @@ CFASSFileStyleRef CFASSFileStyleCreateWithString(const wchar_t *content)
                         result->secondary_colour = CFASSFileStyleColorMake(alpha, blue, green, red);
                         
                         beginPoint += scanedAmount;
-                        while(*beginPoint!=L',' && beginPoint<endPoint) beginPoint++;
+                        while(beginPoint<endPoint && *beginPoint!=L',') beginPoint++;
                         if(*beginPoint == L',') beginPoint++;
                         else goto LABEL_1;
                         
@@ -358,7 +434,7 @@ CFASSFileStyleRef CFASSFileStyleCreateWithString(const wchar_t *content)
                         result->outline_colour = CFASSFileStyleColorMake(alpha, blue, green, red);
                         
                         beginPoint += scanedAmount;
-                        while(*beginPoint!=L',' && beginPoint<endPoint) beginPoint++;
+                        while(beginPoint<endPoint && *beginPoint!=L',') beginPoint++;
                         if(*beginPoint == L',') beginPoint++;
                         else goto LABEL_1;
                         
@@ -374,7 +450,7 @@ CFASSFileStyleRef CFASSFileStyleCreateWithString(const wchar_t *content)
                         result->back_colour = CFASSFileStyleColorMake(alpha, blue, green, red);
                         
                         beginPoint += scanedAmount;
-                        while(*beginPoint!=L',' && beginPoint<endPoint) beginPoint++;
+                        while(beginPoint<endPoint && *beginPoint!=L',') beginPoint++;
                         if(*beginPoint == L',') beginPoint++;
                         else goto LABEL_1;
                         
@@ -386,7 +462,7 @@ CFASSFileStyleRef CFASSFileStyleCreateWithString(const wchar_t *content)
                             result->blod = false;
                         else goto LABEL_1;
                         beginPoint += scanedAmount;
-                        while(*beginPoint!=L',' && beginPoint<endPoint) beginPoint++;
+                        while(beginPoint<endPoint && *beginPoint!=L',') beginPoint++;
                         if(*beginPoint == L',') beginPoint++;
                         else goto LABEL_1;
                         
@@ -397,7 +473,7 @@ CFASSFileStyleRef CFASSFileStyleCreateWithString(const wchar_t *content)
                             result->italic = false;
                         else goto LABEL_1;
                         beginPoint += scanedAmount;
-                        while(*beginPoint!=L',' && beginPoint<endPoint) beginPoint++;
+                        while(beginPoint<endPoint && *beginPoint!=L',') beginPoint++;
                         if(*beginPoint == L',') beginPoint++;
                         else goto LABEL_1;
                         
@@ -408,7 +484,7 @@ CFASSFileStyleRef CFASSFileStyleCreateWithString(const wchar_t *content)
                             result->underline = false;
                         else goto LABEL_1;
                         beginPoint += scanedAmount;
-                        while(*beginPoint!=L',' && beginPoint<endPoint) beginPoint++;
+                        while(beginPoint<endPoint && *beginPoint!=L',') beginPoint++;
                         if(*beginPoint == L',') beginPoint++;
                         else goto LABEL_1;
                         
@@ -419,85 +495,85 @@ CFASSFileStyleRef CFASSFileStyleCreateWithString(const wchar_t *content)
                             result->strike_out = false;
                         else goto LABEL_1;
                         beginPoint += scanedAmount;
-                        while(*beginPoint!=L',' && beginPoint<endPoint) beginPoint++;
+                        while(beginPoint<endPoint && *beginPoint!=L',') beginPoint++;
                         if(*beginPoint == L',') beginPoint++;
                         else goto LABEL_1;
                         
                         if(swscanf(beginPoint, L"%lf%n", &result->scale_x, &scanedAmount) != 1) goto LABEL_1;
                         if(result->scale_x<0.0) goto LABEL_1;
                         beginPoint += scanedAmount;
-                        while(*beginPoint!=L',' && beginPoint<endPoint) beginPoint++;
+                        while(beginPoint<endPoint && *beginPoint!=L',') beginPoint++;
                         if(*beginPoint == L',') beginPoint++;
                         else goto LABEL_1;
                         
                         if(swscanf(beginPoint, L"%lf%n", &result->scale_y, &scanedAmount) != 1) goto LABEL_1;
                         if(result->scale_y<0.0) goto LABEL_1;
                         beginPoint += scanedAmount;
-                        while(*beginPoint!=L',' && beginPoint<endPoint) beginPoint++;
+                        while(beginPoint<endPoint && *beginPoint!=L',') beginPoint++;
                         if(*beginPoint == L',') beginPoint++;
                         else goto LABEL_1;
                         
                         if(swscanf(beginPoint, L"%lf%n", &result->spacing, &scanedAmount) != 1) goto LABEL_1;
                         beginPoint += scanedAmount;
-                        while(*beginPoint!=L',' && beginPoint<endPoint) beginPoint++;
+                        while(beginPoint<endPoint && *beginPoint!=L',') beginPoint++;
                         if(*beginPoint == L',') beginPoint++;
                         else goto LABEL_1;
                         
                         if(swscanf(beginPoint, L"%lf%n", &result->angle, &scanedAmount) != 1) goto LABEL_1;
                         beginPoint += scanedAmount;
-                        while(*beginPoint!=L',' && beginPoint<endPoint) beginPoint++;
+                        while(beginPoint<endPoint && *beginPoint!=L',') beginPoint++;
                         if(*beginPoint == L',') beginPoint++;
                         else goto LABEL_1;
                         
                         if(swscanf(beginPoint, L"%d%n", &result->border_style, &scanedAmount) != 1) goto LABEL_1;
                         if(result->border_style!=1 && result->border_style!=3) goto LABEL_1;
                         beginPoint += scanedAmount;
-                        while(*beginPoint!=L',' && beginPoint<endPoint) beginPoint++;
+                        while(beginPoint<endPoint && *beginPoint!=L',') beginPoint++;
                         if(*beginPoint == L',') beginPoint++;
                         else goto LABEL_1;
                         
                         if(swscanf(beginPoint, L"%u%n", &result->outline, &scanedAmount) != 1) goto LABEL_1;
                         if((result->border_style!=1 && result->outline!=0) || result->outline>4) goto LABEL_1;
                         beginPoint += scanedAmount;
-                        while(*beginPoint!=L',' && beginPoint<endPoint) beginPoint++;
+                        while(beginPoint<endPoint && *beginPoint!=L',') beginPoint++;
                         if(*beginPoint == L',') beginPoint++;
                         else goto LABEL_1;
                         
                         if(swscanf(beginPoint, L"%u%n", &result->shadow, &scanedAmount) != 1) goto LABEL_1;
                         if((result->border_style!=1 && result->shadow!=0) || result->shadow>4 || (result->shadow!=0 && result->outline==0)) goto LABEL_1;
                         beginPoint += scanedAmount;
-                        while(*beginPoint!=L',' && beginPoint<endPoint) beginPoint++;
+                        while(beginPoint<endPoint && *beginPoint!=L',') beginPoint++;
                         if(*beginPoint == L',') beginPoint++;
                         else goto LABEL_1;
                         
                         if(swscanf(beginPoint, L"%d%n", &result->alignment, &scanedAmount) != 1) goto LABEL_1;
                         if(result->alignment<1 || result->alignment>9) goto LABEL_1;
                         beginPoint += scanedAmount;
-                        while(*beginPoint!=L',' && beginPoint<endPoint) beginPoint++;
+                        while(beginPoint<endPoint && *beginPoint!=L',') beginPoint++;
                         if(*beginPoint == L',') beginPoint++;
                         else goto LABEL_1;
                         
                         if(swscanf(beginPoint, L"%u%n", &result->marginL, &scanedAmount) != 1) goto LABEL_1;
                         beginPoint += scanedAmount;
-                        while(*beginPoint!=L',' && beginPoint<endPoint) beginPoint++;
+                        while(beginPoint<endPoint && *beginPoint!=L',') beginPoint++;
                         if(*beginPoint == L',') beginPoint++;
                         else goto LABEL_1;
                         
                         if(swscanf(beginPoint, L"%u%n", &result->marginR, &scanedAmount) != 1) goto LABEL_1;
                         beginPoint += scanedAmount;
-                        while(*beginPoint!=L',' && beginPoint<endPoint) beginPoint++;
+                        while(beginPoint<endPoint && *beginPoint!=L',') beginPoint++;
                         if(*beginPoint == L',') beginPoint++;
                         else goto LABEL_1;
                         
                         if(swscanf(beginPoint, L"%u%n", &result->marginV, &scanedAmount) != 1) goto LABEL_1;
                         beginPoint += scanedAmount;
-                        while(*beginPoint!=L',' && beginPoint<endPoint) beginPoint++;
+                        while(beginPoint<endPoint && *beginPoint!=L',') beginPoint++;
                         if(*beginPoint == L',') beginPoint++;
                         else goto LABEL_1;
                         
                         if(swscanf(beginPoint, L"%u%n", &result->encoding, &scanedAmount) != 1) goto LABEL_1;
                         beginPoint += scanedAmount;
-                        while(*beginPoint!=L',' && beginPoint<endPoint) beginPoint++;
+                        while(beginPoint<endPoint && *beginPoint!=L',') beginPoint++;
                         if(*beginPoint == L',') beginPoint++;
                         else goto LABEL_1;
                         
@@ -507,7 +583,7 @@ CFASSFileStyleRef CFASSFileStyleCreateWithString(const wchar_t *content)
                         
                         #else
                         
-                        while(*beginPoint!=L',' && beginPoint<endPoint) beginPoint++;
+                        while(beginPoint<endPoint && *beginPoint!=L',') beginPoint++;
                         if(*beginPoint == L',')
                         {
                             beginPoint++;
@@ -44,6 +44,34 @@ CFASSFileStyleRef CFASSFileStyleCopy(CFASSFileStyleRef style);
 
 void CFASSFileStyleDestory(CFASSFileStyleRef style);
 
+#pragma mark - Get Component
+
+const wchar_t *CFASSFileStyleGetName(CFASSFileStyleRef style);
+/* Return */
+// the returned string is owned by style, rename it through CFASSFileStyleCollectionRenameStyle
+
+unsigned int CFASSFileStyleGetFontSize(CFASSFileStyleRef style);
+
+void CFASSFileStyleGetScale(CFASSFileStyleRef style, double *scaleX, double *scaleY);
+/* scaleX, scaleY */
+// percentage, could be NULL
+
+double CFASSFileStyleGetSpacing(CFASSFileStyleRef style);
+
+double CFASSFileStyleGetAngle(CFASSFileStyleRef style);
+
+void CFASSFileStyleGetOutlineAndShadow(CFASSFileStyleRef style, unsigned int *outline, unsigned int *shadow);
+/* outline, shadow */
+// in pixels, could be NULL
+
+void CFASSFileStyleGetColors(CFASSFileStyleRef style,
+                             CFASSFileStyleColor *primaryColor,
+                             CFASSFileStyleColor *secondaryColor,
+                             CFASSFileStyleColor *outlineColor,
+                             CFASSFileStyleColor *backColor);
+/* primaryColor, secondaryColor, outlineColor, backColor */
+// could be NULL
+
 #pragma mark - Receive Change
 
 void CFASSFileStyleMakeChange(CFASSFileStyleRef style, CFASSFileChangeRef change);
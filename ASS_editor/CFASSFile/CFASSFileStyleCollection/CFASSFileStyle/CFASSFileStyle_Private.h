@@ -10,6 +10,7 @@
 #define CFASSFileStyle_Private_h
 
 #include "CFASSFileStyle.h"
+#include "CFMutableString.h"
 
 #pragma mark - Read File
 
@@ -18,8 +19,20 @@ CFASSFileStyleRef CFASSFileStyleCreateWithString(const wchar_t *content);
 // Sample:
 // Style: Name,FontName,25,&H00FFFFFF,&HF0000000,&H00000000,&HF0000000,-1,0,0,0,100,100,0,0.00,1,0,0,2,30,30,10,1
 
+#pragma mark - Set Component
+
+int CFASSFileStyleSetName(CFASSFileStyleRef style, const wchar_t *name);
+/* Return */
+// return zero means success, -1 means failed and the name stays unchanged
+/* Discussion */
+// the style collection holding style must reload its name index after this
+
 #pragma mark - Allocate Result
 
 wchar_t *CFASSFileStyleAllocateFileContent(CFASSFileStyleRef style);
 
+int CFASSFileStyleAppendFileContent(CFASSFileStyleRef style, CFMutableStringRef string);
+/* Return */
+// 0 for success, -1 if anything went wrong
+
 #endif /* CFASSFileStyle_Private_h */
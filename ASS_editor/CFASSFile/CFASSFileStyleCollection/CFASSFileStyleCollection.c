@@ -7,6 +7,7 @@
 //
 
 #include <stdio.h>
+#include <stdatomic.h>
 #include <stdlib.h>
 #include <wchar.h>
 
@@ -20,16 +21,40 @@
 #include "CFASSFileStyle_Private.h"
 #include "CFUnicodeStringArray.h"
 #include "CFException.h"
+#include "CFMutableString.h"
 #include "CFEnumerator.h"
 #include "CFASSFileControl.h"
 #include "CFASSFileControl_Private.h"
 
+typedef struct CFASSFileStyleCollectionNameIndexSlot
+{
+    size_t hash;
+    CFASSFileStyleRef style;                // NULL for empty slot, don't have ownership
+} CFASSFileStyleCollectionNameIndexSlot;
+
 struct CFASSFileStyleCollection
 {
     CFPointerArrayRef styleCollection;
+    CFASSFileStyleCollectionNameIndexSlot *nameIndex;   // open addressing, keyed by style name
+    size_t nameIndexCapacity;               // power of 2, at least twice of the style amount
+    unsigned long generation;               // renewed whenever the styles name resolved to may change
     CFASSFileRef registeredFile;            // don't have ownership
 };
 
+static atomic_ulong CFASSFileStyleCollectionGenerationCounter = 0;      // collections of different files could be changed on different threads
+
+static unsigned long CFASSFileStyleCollectionNextGeneration(void);
+
+static size_t CFASSFileStyleCollectionNameHash(const wchar_t *name);
+
+static size_t CFASSFileStyleCollectionNameIndexCapacityForAmount(size_t styleAmount);
+
+static int CFASSFileStyleCollectionNameIndexResize(CFASSFileStyleCollectionRef styleCollection, size_t capacity);
+
+static void CFASSFileStyleCollectionNameIndexInsert(CFASSFileStyleCollectionRef styleCollection, CFASSFileStyleRef style);
+
+static void CFASSFileStyleCollectionNameIndexReload(CFASSFileStyleCollectionRef styleCollection);
+
 static wchar_t const * const CFASSFileStyleCollectionDiscription = L"Format: Name, Fontname, Fontsize, PrimaryColour, SecondaryColour, OutlineColour, BackColour, Bold, Italic, Underline, StrikeOut, ScaleX, ScaleY, Spacing, Angle, BorderStyle, Outline, Shadow, Alignment, MarginL, MarginR, MarginV, Encoding\n";
 
 CFEnumeratorRef CFASSFileStyleCollectionCreateEnumerator(CFASSFileStyleCollectionRef styleCollection)
@@ -68,8 +93,11 @@ CFASSFileStyleCollectionRef CFASSFileStyleCollectionCopy(CFASSFileStyleCollectio
                 else
                     CFPointerArrayAddPointer(result->styleCollection, eachStyle, false);
             }
-            if(copyCheck)
+            result->nameIndex = NULL;
+            if(copyCheck &&
+               CFASSFileStyleCollectionNameIndexResize(result, CFASSFileStyleCollectionNameIndexCapacityForAmount(arrayLength)) == 0)
             {
+                result->generation = CFASSFileStyleCollectionNextGeneration();
                 result->registeredFile = NULL;
                 return result;
             }
@@ -83,60 +111,163 @@ CFASSFileStyleCollectionRef CFASSFileStyleCollectionCopy(CFASSFileStyleCollectio
     return NULL;
 }
 
-wchar_t *CFASSFileStyleCollectionAllocateFileContent(CFASSFileStyleCollectionRef styleCollection)
+CFASSFileStyleRef CFASSFileStyleCollectionGetStyleByName(CFASSFileStyleCollectionRef styleCollection, const wchar_t *name)
+{
+    if(styleCollection == NULL || name == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileStyleCollection %p GetStyleByName %p", styleCollection, name);
+    size_t hash = CFASSFileStyleCollectionNameHash(name);
+    size_t mask = styleCollection->nameIndexCapacity - 1;
+    CFASSFileStyleCollectionNameIndexSlot *slot;
+    for(size_t position = hash & mask; (slot = styleCollection->nameIndex + position)->style != NULL; position = (position + 1) & mask)
+        if(slot->hash == hash && wcscmp(CFASSFileStyleGetName(slot->style), name) == 0)
+            return slot->style;
+    return NULL;
+}
+
+int CFASSFileStyleCollectionAddStyle(CFASSFileStyleCollectionRef styleCollection, CFASSFileStyleRef style)
 {
+    if(styleCollection == NULL || style == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileStyleCollection %p AddStyle %p", styleCollection, style);
     size_t styleAmount = CFPointerArrayGetLength(styleCollection->styleCollection);
-    CFUnicodeStringArrayRef stringArray;
-    if((stringArray = CFUnicodeStringArrayCreateEmpty()) != NULL)
-    {
-        const wchar_t *eachStyle;
-        bool isAllocatingSuccess = true;
-        for(size_t count = 1; isAllocatingSuccess && count<=styleAmount; count++)
+    size_t requiredCapacity = CFASSFileStyleCollectionNameIndexCapacityForAmount(styleAmount + 1);
+    if(requiredCapacity > styleCollection->nameIndexCapacity &&
+       CFASSFileStyleCollectionNameIndexResize(styleCollection, requiredCapacity) != 0)
+        return -1;
+    CFPointerArrayAddPointer(styleCollection->styleCollection, style, false);
+    if(CFPointerArrayGetLength(styleCollection->styleCollection) != styleAmount + 1)
+        return -1;
+    CFASSFileStyleCollectionNameIndexInsert(styleCollection, style);
+    styleCollection->generation = CFASSFileStyleCollectionNextGeneration();
+    return 0;
+}
+
+int CFASSFileStyleCollectionRemoveStyle(CFASSFileStyleCollectionRef styleCollection, CFASSFileStyleRef style)
+{
+    if(styleCollection == NULL || style == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileStyleCollection %p RemoveStyle %p", styleCollection, style);
+    size_t styleAmount = CFPointerArrayGetLength(styleCollection->styleCollection);
+    for(size_t index = 0; index<styleAmount; index++)
+        if(CFPointerArrayGetPointerAtIndex(styleCollection->styleCollection, index) == style)
         {
-            if((eachStyle =
-                CFASSFileStyleAllocateFileContent
-                ((CFASSFileStyleRef)CFPointerArrayGetPointerAtIndex(styleCollection->styleCollection,
-                                                                    count-1))) != NULL)
-                CFUnicodeStringArrayAddString(stringArray, eachStyle, true);
-            else
-                isAllocatingSuccess = false;
+            CFPointerArrayRemovePointerAtIndex(styleCollection->styleCollection, index, false);
+            CFASSFileStyleCollectionNameIndexReload(styleCollection);
+            styleCollection->generation = CFASSFileStyleCollectionNextGeneration();
+            CFASSFileStyleDestory(style);
+            return 0;
         }
-        if(isAllocatingSuccess)
+    return -1;
+}
+
+int CFASSFileStyleCollectionRenameStyle(CFASSFileStyleCollectionRef styleCollection, CFASSFileStyleRef style, const wchar_t *name)
+{
+    if(styleCollection == NULL || style == NULL || name == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileStyleCollection %p RenameStyle %p to %p", styleCollection, style, name);
+    size_t styleAmount = CFPointerArrayGetLength(styleCollection->styleCollection);
+    for(size_t index = 0; index<styleAmount; index++)
+        if(CFPointerArrayGetPointerAtIndex(styleCollection->styleCollection, index) == style)
         {
-            size_t styleCollectionStringLength = wcslen(L"[V4+ Styles]\n") + wcslen(CFASSFileStyleCollectionDiscription);
-            for(size_t count = 1; count<=styleAmount; count++)
-                styleCollectionStringLength += wcslen(CFUnicodeStringArrayGetStringAtIndex(stringArray, count-1));
-            
-            wchar_t *result;
-            if((result = malloc(sizeof(wchar_t)*(styleCollectionStringLength+1))) != NULL)
-            {
-                wchar_t *beginPoint = result;
-                size_t eachLength;
-                
-                eachLength = wcslen(L"[V4+ Styles]\n");
-                wmemcpy(beginPoint, L"[V4+ Styles]\n", eachLength);
-                beginPoint += eachLength;
-                
-                eachLength = wcslen(CFASSFileStyleCollectionDiscription);
-                wmemcpy(beginPoint, CFASSFileStyleCollectionDiscription, eachLength);
-                beginPoint += eachLength;
-                
-                for(size_t count = 1; count<=styleAmount; count++)
-                {
-                    eachStyle = CFUnicodeStringArrayGetStringAtIndex(stringArray, count-1);
-                    eachLength = wcslen(eachStyle);
-                    wmemcpy(beginPoint, eachStyle, eachLength);
-                    beginPoint += eachLength;
-                }
-                *beginPoint = L'\0';
-                
-                CFUnicodeStringArrayDestory(stringArray);
-                return result;
-            }
+            if(CFASSFileStyleSetName(style, name) != 0)
+                return -1;
+            CFASSFileStyleCollectionNameIndexReload(styleCollection);
+            styleCollection->generation = CFASSFileStyleCollectionNextGeneration();
+            return 0;
         }
-        CFUnicodeStringArrayDestory(stringArray);
+    return -1;
+}
+
+static unsigned long CFASSFileStyleCollectionNextGeneration(void)
+{
+    return atomic_fetch_add_explicit(&CFASSFileStyleCollectionGenerationCounter, 1, memory_order_relaxed) + 1;
+}
+
+unsigned long CFASSFileStyleCollectionGetGeneration(CFASSFileStyleCollectionRef styleCollection)
+{
+    return styleCollection->generation;
+}
+
+#pragma mark - Name Index
+
+static size_t CFASSFileStyleCollectionNameHash(const wchar_t *name)
+{
+    // FNV-1a over each wide character
+    size_t hash = (size_t)2166136261u;
+    for(; *name != L'\0'; name++)
+    {
+        hash ^= (size_t)*name;
+        hash *= (size_t)16777619u;
     }
-    return NULL;
+    return hash;
+}
+
+static size_t CFASSFileStyleCollectionNameIndexCapacityForAmount(size_t styleAmount)
+{
+    size_t capacity = 8;
+    while(capacity < styleAmount*2) capacity <<= 1;
+    return capacity;
+}
+
+static int CFASSFileStyleCollectionNameIndexResize(CFASSFileStyleCollectionRef styleCollection, size_t capacity)
+{
+    CFASSFileStyleCollectionNameIndexSlot *nameIndex;
+    if((nameIndex = calloc(capacity, sizeof(CFASSFileStyleCollectionNameIndexSlot))) == NULL)
+        return -1;
+    free(styleCollection->nameIndex);
+    styleCollection->nameIndex = nameIndex;
+    styleCollection->nameIndexCapacity = capacity;
+    CFASSFileStyleCollectionNameIndexReload(styleCollection);
+    return 0;
+}
+
+static void CFASSFileStyleCollectionNameIndexInsert(CFASSFileStyleCollectionRef styleCollection, CFASSFileStyleRef style)
+{
+    // the later style replaces the former one with the same name, as the renderer does
+    const wchar_t *name = CFASSFileStyleGetName(style);
+    size_t hash = CFASSFileStyleCollectionNameHash(name);
+    size_t mask = styleCollection->nameIndexCapacity - 1;
+    CFASSFileStyleCollectionNameIndexSlot *slot;
+    for(size_t position = hash & mask; (slot = styleCollection->nameIndex + position)->style != NULL; position = (position + 1) & mask)
+        if(slot->hash == hash && wcscmp(CFASSFileStyleGetName(slot->style), name) == 0)
+            break;
+    slot->hash = hash;
+    slot->style = style;
+}
+
+static void CFASSFileStyleCollectionNameIndexReload(CFASSFileStyleCollectionRef styleCollection)
+{
+    // removing or renaming never grows the style amount, so the capacity stays enough
+    for(size_t position = 0; position<styleCollection->nameIndexCapacity; position++)
+        styleCollection->nameIndex[position].style = NULL;
+    size_t styleAmount = CFPointerArrayGetLength(styleCollection->styleCollection);
+    for(size_t index = 0; index<styleAmount; index++)
+        CFASSFileStyleCollectionNameIndexInsert(styleCollection, CFPointerArrayGetPointerAtIndex(styleCollection->styleCollection, index));
+}
+
+#pragma mark - Allocate Result
+
+wchar_t *CFASSFileStyleCollectionAllocateFileContent(CFASSFileStyleCollectionRef styleCollection)
+{
+    CFMutableStringRef string;
+    if((string = CFMutableStringCreateEmpty()) == NULL)
+        return NULL;
+    if(CFASSFileStyleCollectionAppendFileContent(styleCollection, string) != 0)
+    {
+        CFMutableStringDestory(string);
+        return NULL;
+    }
+    return CFMutableStringDestoryAndStealCharacters(string, NULL);
+}
+
+int CFASSFileStyleCollectionAppendFileContent(CFASSFileStyleCollectionRef styleCollection, CFMutableStringRef string)
+{
+    if(styleCollection == NULL || string == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFASSFileStyleCollection %p AppendFileContent %p", styleCollection, string);
+    CFMutableStringAppendString(string, L"[V4+ Styles]\n");
+    CFMutableStringAppendString(string, CFASSFileStyleCollectionDiscription);
+    size_t styleAmount = CFPointerArrayGetLength(styleCollection->styleCollection);
+    for(size_t index = 0; index<styleAmount; index++)
+        if(CFASSFileStyleAppendFileContent((CFASSFileStyleRef)CFPointerArrayGetPointerAtIndex(styleCollection->styleCollection, index), string) != 0)
+            return -1;
+    return CFMutableStringIsFailed(string) ? -1 : 0;
 }
 
 void CFASSFileStyleCollectionDestory(CFASSFileStyleCollectionRef styleCollection)
@@ -146,6 +277,7 @@ void CFASSFileStyleCollectionDestory(CFASSFileStyleCollectionRef styleCollection
     for(size_t index = 0; index<arrayLength; index++)
         CFASSFileStyleDestory((CFASSFileStyleRef)CFPointerArrayGetPointerAtIndex(styleCollection->styleCollection, index));
     CFPointerArrayDestory(styleCollection->styleCollection);
+    free(styleCollection->nameIndex);
     free(styleCollection);
 }
 
@@ -179,8 +311,11 @@ CFASSFileStyleCollectionRef CFASSFileStyleCollectionCreateWithUnicodeFileContent
                         CFPointerArrayAddPointer(result->styleCollection, eachStyle, false);
                 }
                 
-                if(isFormatCorrect)
+                result->nameIndex = NULL;
+                if(isFormatCorrect &&
+                   CFASSFileStyleCollectionNameIndexResize(result, CFASSFileStyleCollectionNameIndexCapacityForAmount(CFPointerArrayGetLength(result->styleCollection))) == 0)
                 {
+                    result->generation = CFASSFileStyleCollectionNextGeneration();
                     result->registeredFile = NULL;
                     return result;
                 }
@@ -9,7 +9,10 @@
 #ifndef CFASSFileStyleCollection_h
 #define CFASSFileStyleCollection_h
 
+#include <wchar.h>
+
 #include "CFEnumerator.h"
+#include "CFASSFileStyle.h"
 
 typedef struct CFASSFileStyleCollection *CFASSFileStyleCollectionRef;
 
@@ -23,6 +26,33 @@ void CFASSFileStyleCollectionDestory(CFASSFileStyleCollectionRef styleCollection
 
 CFEnumeratorRef CFASSFileStyleCollectionCreateEnumerator(CFASSFileStyleCollectionRef styleCollection);
 
+CFASSFileStyleRef CFASSFileStyleCollectionGetStyleByName(CFASSFileStyleCollectionRef styleCollection, const wchar_t *name);
+/* Return */
+// the style with exactly the same name, NULL if not found
+// if several styles share the name, the last one is returned
+/* Discussion */
+// the lookup is hashed, it doesn't scan the collection
+
+#pragma mark - Modify Component
+
+int CFASSFileStyleCollectionAddStyle(CFASSFileStyleCollectionRef styleCollection, CFASSFileStyleRef style);
+/* style */
+// the collection takes the ownership if success
+/* Return */
+// return zero means success, -1 means failed
+
+int CFASSFileStyleCollectionRemoveStyle(CFASSFileStyleCollectionRef styleCollection, CFASSFileStyleRef style);
+/* style */
+// style will be destoryed if success
+/* Return */
+// return zero means success, -1 means style is not in the collection
+
+int CFASSFileStyleCollectionRenameStyle(CFASSFileStyleCollectionRef styleCollection, CFASSFileStyleRef style, const wchar_t *name);
+/* name */
+// can't be empty or include comma
+/* Return */
+// return zero means success, -1 means failed
+
 #pragma mark - Receive Change
 
 void CFASSFileStyleCollectionMakeChange(CFASSFileStyleCollectionRef styleCollection, CFASSFileChangeRef change);
@@ -12,6 +12,7 @@
 #include <wchar.h>
 
 #include "CFASSFileStyleCollection.h"
+#include "CFMutableString.h"
 
 #pragma mark - Read File
 
@@ -21,6 +22,17 @@ CFASSFileStyleCollectionRef CFASSFileStyleCollectionCreateWithUnicodeFileContent
 
 wchar_t *CFASSFileStyleCollectionAllocateFileContent(CFASSFileStyleCollectionRef styleCollection);
 
+int CFASSFileStyleCollectionAppendFileContent(CFASSFileStyleCollectionRef styleCollection, CFMutableStringRef string);
+/* Return */
+// 0 for success, -1 if anything went wrong
+
+#pragma mark - Name Index
+
+unsigned long CFASSFileStyleCollectionGetGeneration(CFASSFileStyleCollectionRef styleCollection);
+/* Return */
+// a value never shared by other collections, it is renewed every time a name may resolve to another style
+// anyone caching the result of CFASSFileStyleCollectionGetStyleByName should compare with it before reusing
+
 #pragma mark - Register Callbacks
 
 int CFASSFileStyleCollectionRegisterAssociationwithFile(CFASSFileStyleCollectionRef scriptInfo, CFASSFileRef assFile);
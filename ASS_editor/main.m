@@ -8,15 +8,85 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <wchar.h>
 
 #include "CFASSFileKit.h"
+#include "CFASSFileDialogueTextDrawingContext_Private.h"
 #include "CFCrossPlatform.h"
 
+#pragma mark - Regression
+
+typedef struct CFASSDrawingRoundTripCase
+{
+    const wchar_t *drawing;
+    const wchar_t *expected;    // AllocateString of the parsed drawing, which must parse back to itself
+} CFASSDrawingRoundTripCase;
+
+static const CFASSDrawingRoundTripCase CFASSDrawingRoundTripCases[] = {
+    {L"m 0 0 l 10 0 10 10", L"m 0 0 l 10 0 10 10"},
+    /* c ends the run of l, the line after it spells out its letter again */
+    {L"m 0 0 l 1 1 c l 2 2", L"m 0 0 l 1 1 c l 2 2"},
+    {L"m 0 0 s 1 1 2 2 3 3 4 4 c b 5 5 6 6 7 7", L"m 0 0 s 1 1 2 2 3 3 4 4 c b 5 5 6 6 7 7"},
+};
+
+static bool CFASSCheckDrawingRoundTrip(const CFASSDrawingRoundTripCase *testCase)
+{
+    CFASSFileDialogueTextDrawingContextRef context = CFASSFileDialogueTextDrawingContextCreateFromString(testCase->drawing);
+    if(context == NULL)
+        return false;
+    wchar_t *string = CFASSFileDialogueTextDrawingContextAllocateString(context);
+    CFASSFileDialogueTextDrawingContextDestory(context);
+    if(string == NULL)
+        return false;
+    bool result = wcscmp(string, testCase->expected) == 0;
+    if((context = CFASSFileDialogueTextDrawingContextCreateFromString(string)) == NULL)
+        result = false;
+    else
+    {
+        wchar_t *again = CFASSFileDialogueTextDrawingContextAllocateString(context);
+        if(again == NULL || wcscmp(again, string) != 0)
+            result = false;
+        free(again);
+        CFASSFileDialogueTextDrawingContextDestory(context);
+    }
+    free(string);
+    return result;
+}
+
+static bool CFASSCheckDrawingScaleSaturates(void)
+{
+    CFASSFileDialogueTextDrawingContextRef context = CFASSFileDialogueTextDrawingContextCreateFromString(L"m 0 0 l 2000000000 -2000000000");
+    if(context == NULL)
+        return false;
+    CFASSFileDialogueTextDrawingContextScale(context, 4, 4);
+    const int32_t *coordinates = CFASSFileDialogueTextDrawingContextGetCoordinates(context);
+    bool result = coordinates[2] == INT32_MAX && coordinates[3] == INT32_MIN;
+    CFASSFileDialogueTextDrawingContextDestory(context);
+    return result;
+}
+
 int main(int argc, char *argv[])
 {
     CFCrossPlatformUnicodeSupport();
     CFASSFileControlSetErrorHandling(CFASSFileControlErrorHandlingOutput | CFASSFileControlErrorHandlingIgnore);
     
+    int failedAmount = 0;
+    for(size_t caseIndex = 0; caseIndex < sizeof(CFASSDrawingRoundTripCases) / sizeof(CFASSDrawingRoundTripCase); caseIndex++)
+        if(!CFASSCheckDrawingRoundTrip(&CFASSDrawingRoundTripCases[caseIndex]))
+        {
+            fwprintf(stdout, L"Drawing round trip failed: %ls\n", CFASSDrawingRoundTripCases[caseIndex].drawing);
+            failedAmount++;
+        }
+    if(!CFASSCheckDrawingScaleSaturates())
+    {
+        fwprintf(stdout, L"Drawing scale failed to saturate\n");
+        failedAmount++;
+    }
+    if(failedAmount != 0)
+        return EXIT_FAILURE;
+    
     const unsigned int amount = 12;
     const char *fromDictionary = "/Users/captainallred/Desktop/Subtitle/";
     const char *toDictionary = "/Users/captainallred/Desktop/Subtitle/Converted/";
@@ -40,4 +40,14 @@ typedef struct CFSize
     int x, y;
 } CFSize;
 
+typedef struct CFPoint
+{
+    double x, y;
+} CFPoint;
+
+typedef struct CFRect
+{
+    double minX, minY, maxX, maxY;
+} CFRect;
+
 #endif /* CFGeometry_h */
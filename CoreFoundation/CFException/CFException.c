@@ -23,7 +23,7 @@ const char * const CFExceptionNameInvalidArgument = "CFException: InvalidArgumen
 
 const char * const CFExceptionNameProcessFailed = "CFException: ProcessFailed";
 
-static CFPointerArrayRef CFExceptionStack = NULL;
+static _Thread_local CFPointerArrayRef CFExceptionStack = NULL;    // each thread catch its own exception, released when emptied
 
 #pragma mark - Function
 
@@ -40,8 +40,7 @@ void CFExceptionRaise(const char * exceptionName, void * data, const char * form
     vfprintf(stderr, format, ap);
     va_end(ap);
     fprintf(stderr, "\n");
-    if(CFExceptionStack == NULL) CFExceptionStackInitialization();
-    size_t arrayLength = CFPointerArrayGetLength(CFExceptionStack);
+    size_t arrayLength = CFExceptionStack == NULL ? 0 : CFPointerArrayGetLength(CFExceptionStack);
     bool handled = false;
     for(size_t count = arrayLength; count>=1; count--)
         if((handled = ((CFExceptionCatchFunction)CFPointerArrayGetPointerAtIndex(CFExceptionStack, count-1))(exceptionName, data)))
@@ -64,18 +63,22 @@ void CFExceptionCatchStackPush(CFExceptionCatchFunction function)
 
 CFExceptionCatchFunction CFExceptionCatchStackPop(void)
 {
-    if(CFExceptionStack == NULL) CFExceptionStackInitialization();
+    if(CFExceptionStack == NULL) return NULL;
     size_t arrayLength = CFPointerArrayGetLength(CFExceptionStack);
     if(arrayLength==0) return NULL;
     CFExceptionCatchFunction result = CFPointerArrayGetPointerAtIndex(CFExceptionStack, arrayLength-1);
     CFPointerArrayRemovePointerAtIndex(CFExceptionStack, arrayLength-1, false);
+    if(arrayLength==1)
+    {
+        CFPointerArrayDestory(CFExceptionStack);
+        CFExceptionStack = NULL;
+    }
     return result;
 }
 
 CFExceptionCatchFunction CFExceptionCatchStackCurrentFunction(void)
 {
-    if(CFExceptionStack == NULL) CFExceptionStackInitialization();
-    size_t arrayLength = CFPointerArrayGetLength(CFExceptionStack);
+    size_t arrayLength = CFExceptionStack == NULL ? 0 : CFPointerArrayGetLength(CFExceptionStack);
     CFExceptionCatchFunction result;
     if(arrayLength==0)
         result = CFExceptionDefaultCatchFunction;
@@ -31,6 +31,7 @@ void CFExceptionRaise(const char * exceptionName, void * data, const char * form
 __attribute__((format(printf, 3, 4)));
 
 void CFExceptionCatchStackPush(CFExceptionCatchFunction function);
+// catch stack is per thread, a new thread starts with the default catch function only
 
 CFExceptionCatchFunction CFExceptionCatchStackPop(void);
 
@@ -0,0 +1,478 @@
+//
+//  CFMutableString.c
+//  CoreFoundation
+//
+//  Created by Bill Sun on 2018/11/5.
+//  Copyright © 2018 Bill Sun. All rights reserved.
+//
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <math.h>
+#include <wchar.h>
+
+#include "CFMutableString.h"
+#include "CFException.h"
+
+#define CFMutableStringInitialCapacity 64
+
+#define CFMutableStringNumberBufferLength 64        // enough for any integer
+
+#define CFMutableStringFallbackBufferLength 512     // enough for %.9f of DBL_MAX
+
+struct CFMutableString
+{
+    wchar_t *characters;        // always terminate with '\0'
+    size_t length;
+    size_t capacity;            // characters, terminator included
+    bool failed;
+};
+
+static const double CFMutableStringPowerOf10[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9};
+// exact in double, scales value in the fast path
+
+static const unsigned long long CFMutableStringUnsignedPowerOf10[] = {1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull, 10000000ull, 100000000ull, 1000000000ull};
+
+static int CFMutableStringReserveAppend(CFMutableStringRef string, size_t appendLength);
+
+static int CFMutableStringAppendDigits(CFMutableStringRef string, unsigned long long value, unsigned int minimumDigits);
+
+static int CFMutableStringAppendDoubleFallback(CFMutableStringRef string, const wchar_t *format, int precision, double value);
+
+static bool CFMutableStringRoundToInteger(double scaled, unsigned long long *result);
+
+#pragma mark - Create/Destory
+
+CFMutableStringRef CFMutableStringCreateEmpty(void)
+{
+    return CFMutableStringCreateWithCapacity(CFMutableStringInitialCapacity);
+}
+
+CFMutableStringRef CFMutableStringCreateWithCapacity(size_t capacity)
+{
+    if(capacity == 0) capacity = 1;     // room for terminator
+    CFMutableStringRef result;
+    if((result = malloc(sizeof(struct CFMutableString))) != NULL)
+    {
+        if((result->characters = malloc(sizeof(wchar_t) * capacity)) != NULL)
+        {
+            result->characters[0] = L'\0';
+            result->length = 0;
+            result->capacity = capacity;
+            result->failed = false;
+            return result;
+        }
+        free(result);
+    }
+    return NULL;
+}
+
+CFMutableStringRef CFMutableStringCopy(CFMutableStringRef string)
+{
+    if(string == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFMutableString NULL Copy");
+    if(string->failed)
+        return NULL;
+    CFMutableStringRef result;
+    if((result = CFMutableStringCreateWithCapacity(string->length + 1)) != NULL)
+    {
+        wmemcpy(result->characters, string->characters, string->length + 1);
+        result->length = string->length;
+    }
+    return result;
+}
+
+void CFMutableStringDestory(CFMutableStringRef string)
+{
+    if(string == NULL) return;
+    free(string->characters);
+    free(string);
+}
+
+wchar_t *CFMutableStringDestoryAndStealCharacters(CFMutableStringRef string, size_t *length)
+{
+    if(string == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFMutableString NULL DestoryAndStealCharacters");
+    wchar_t *result = NULL;
+    if(!string->failed)
+    {
+        result = string->characters;
+        // give back the unused tail, keep the buffer if shrinking failed
+        wchar_t *shrunk;
+        if(string->capacity > string->length + 1 &&
+           (shrunk = realloc(result, sizeof(wchar_t) * (string->length + 1))) != NULL)
+            result = shrunk;
+        if(length != NULL) *length = string->length;
+    }
+    else free(string->characters);
+    free(string);
+    return result;
+}
+
+#pragma mark - Append
+
+int CFMutableStringAppendCharacter(CFMutableStringRef string, wchar_t character)
+{
+    if(string == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFMutableString NULL AppendCharacter");
+    if(CFMutableStringReserveAppend(string, 1) != 0)
+        return -1;
+    string->characters[string->length++] = character;
+    string->characters[string->length] = L'\0';
+    return 0;
+}
+
+int CFMutableStringAppendString(CFMutableStringRef string, const wchar_t *appendString)
+{
+    if(string == NULL || appendString == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFMutableString %p AppendString %p", string, appendString);
+    size_t appendLength = wcslen(appendString);
+    if(CFMutableStringReserveAppend(string, appendLength) != 0)
+        return -1;
+    wmemcpy(string->characters + string->length, appendString, appendLength + 1);
+    string->length += appendLength;
+    return 0;
+}
+
+int CFMutableStringAppendSubstring(CFMutableStringRef string, const wchar_t *appendString, size_t length)
+{
+    if(string == NULL || (appendString == NULL && length != 0))
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFMutableString %p AppendSubstring %p length %zu", string, appendString, length);
+    if(CFMutableStringReserveAppend(string, length) != 0)
+        return -1;
+    if(length != 0)
+        wmemcpy(string->characters + string->length, appendString, length);
+    string->length += length;
+    string->characters[string->length] = L'\0';
+    return 0;
+}
+
+int CFMutableStringAppendInteger(CFMutableStringRef string, long value)
+{
+    if(string == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFMutableString NULL AppendInteger");
+    if(value < 0)
+    {
+        if(CFMutableStringAppendCharacter(string, L'-') != 0)
+            return -1;
+        return CFMutableStringAppendDigits(string, 0ul - (unsigned long)value, 1);
+    }
+    return CFMutableStringAppendDigits(string, (unsigned long)value, 1);
+}
+
+int CFMutableStringAppendUnsigned(CFMutableStringRef string, unsigned long value)
+{
+    if(string == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFMutableString NULL AppendUnsigned");
+    return CFMutableStringAppendDigits(string, value, 1);
+}
+
+int CFMutableStringAppendUnsignedWithMinimumDigits(CFMutableStringRef string, unsigned long value, unsigned int minimumDigits)
+{
+    if(string == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFMutableString NULL AppendUnsignedWithMinimumDigits");
+    return CFMutableStringAppendDigits(string, value, minimumDigits);
+}
+
+int CFMutableStringAppendHex(CFMutableStringRef string, unsigned long value, unsigned int minimumDigits)
+{
+    if(string == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFMutableString NULL AppendHex");
+    wchar_t buffer[CFMutableStringNumberBufferLength];
+    wchar_t *writingPoint = buffer + CFMutableStringNumberBufferLength;
+    unsigned int digits = 0;
+    do
+    {
+        *--writingPoint = L"0123456789ABCDEF"[value & 0xF];
+        value >>= 4;
+        digits++;
+    }while(value != 0 || (digits < minimumDigits && digits < CFMutableStringNumberBufferLength));
+    size_t appendLength = buffer + CFMutableStringNumberBufferLength - writingPoint;
+    if(CFMutableStringReserveAppend(string, appendLength) != 0)
+        return -1;
+    wmemcpy(string->characters + string->length, writingPoint, appendLength);
+    string->length += appendLength;
+    string->characters[string->length] = L'\0';
+    return 0;
+}
+
+int CFMutableStringAppendDouble(CFMutableStringRef string, double value)
+{
+    if(string == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFMutableString NULL AppendDouble");
+    double magnitude = fabs(value);
+    if(magnitude == 0)
+        return CFMutableStringAppendString(string, signbit(value) ? L"-0" : L"0");
+
+    // %g keeps 6 significant digits, without exponent when 1e-4 <= rounded value < 1e6
+    // find exponent so that 1e5 <= magnitude * 10^(5-exponent) < 1e6, only exact powers are used
+    if(isfinite(magnitude) && magnitude < 1e6)
+    {
+        int exponent = 6;
+        double scaled = 0;
+        for(int power = 0; power<=9; power++)
+            if((scaled = magnitude * CFMutableStringPowerOf10[power]) >= 1e5)
+            {
+                exponent = 5 - power;
+                break;
+            }
+        unsigned long long digits;
+        if(exponent <= 5 && CFMutableStringRoundToInteger(scaled, &digits))
+        {
+            if(digits == 1000000ull)
+            {
+                digits = 100000ull;
+                exponent++;
+            }
+            if(exponent <= 5)
+            {
+                // digits / 10^(5-exponent), then remove trailing zeros of fraction
+                unsigned int fractionDigits = 5 - exponent;
+                unsigned long long integer = digits / CFMutableStringUnsignedPowerOf10[fractionDigits],
+                              fraction = digits % CFMutableStringUnsignedPowerOf10[fractionDigits];
+                while(fractionDigits > 0 && fraction % 10 == 0)
+                {
+                    fraction /= 10;
+                    fractionDigits--;
+                }
+                if(value < 0 && CFMutableStringAppendCharacter(string, L'-') != 0)
+                    return -1;
+                if(CFMutableStringAppendDigits(string, integer, 1) != 0)
+                    return -1;
+                if(fractionDigits == 0)
+                    return 0;
+                if(CFMutableStringAppendCharacter(string, L'.') != 0)
+                    return -1;
+                return CFMutableStringAppendDigits(string, fraction, fractionDigits);
+            }
+        }
+    }
+    return CFMutableStringAppendDoubleFallback(string, L"%g", 0, value);
+}
+
+int CFMutableStringAppendDoubleWithPrecision(CFMutableStringRef string, double value, unsigned int precision)
+{
+    if(string == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFMutableString NULL AppendDoubleWithPrecision");
+    unsigned long long digits;
+    if(precision <= 9 && isfinite(value) &&
+       fabs(value) * CFMutableStringPowerOf10[precision] < 4503599627370496.0 &&        // 2^52, still has fraction bits
+       CFMutableStringRoundToInteger(fabs(value) * CFMutableStringPowerOf10[precision], &digits))
+    {
+        if(signbit(value) && CFMutableStringAppendCharacter(string, L'-') != 0)
+            return -1;
+        if(CFMutableStringAppendDigits(string, digits / CFMutableStringUnsignedPowerOf10[precision], 1) != 0)
+            return -1;
+        if(precision == 0)
+            return 0;
+        if(CFMutableStringAppendCharacter(string, L'.') != 0)
+            return -1;
+        return CFMutableStringAppendDigits(string, digits % CFMutableStringUnsignedPowerOf10[precision], precision);
+    }
+    return CFMutableStringAppendDoubleFallback(string, L"%.*f", (int)precision, value);
+}
+
+#pragma mark - Get Component
+
+bool CFMutableStringIsFailed(CFMutableStringRef string)
+{
+    if(string == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFMutableString NULL IsFailed");
+    return string->failed;
+}
+
+size_t CFMutableStringGetLength(CFMutableStringRef string)
+{
+    if(string == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFMutableString NULL GetLength");
+    return string->length;
+}
+
+const wchar_t *CFMutableStringGetCharacters(CFMutableStringRef string)
+{
+    if(string == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFMutableString NULL GetCharacters");
+    return string->characters;
+}
+
+wchar_t *CFMutableStringCopyCharacters(CFMutableStringRef string)
+{
+    if(string == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFMutableString NULL CopyCharacters");
+    if(string->failed)
+        return NULL;
+    wchar_t *result;
+    if((result = malloc(sizeof(wchar_t) * (string->length + 1))) != NULL)
+        wmemcpy(result, string->characters, string->length + 1);
+    return result;
+}
+
+char *CFMutableStringCopyUTF8Characters(CFMutableStringRef string, size_t *length)
+{
+    if(string == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFMutableString NULL CopyUTF8Characters");
+    if(string->failed)
+        return NULL;
+    // first pass measures, second pass encodes
+    char *result = NULL;
+    size_t resultLength = 0;
+    for(int pass = 0; pass < 2; pass++)
+    {
+        size_t writingIndex = 0;
+        for(size_t index = 0; index < string->length; index++)
+        {
+            uint32_t codePoint = (uint32_t)string->characters[index];
+            if(codePoint >= 0xD800 && codePoint <= 0xDBFF && index+1 < string->length &&
+               (uint32_t)string->characters[index+1] >= 0xDC00 && (uint32_t)string->characters[index+1] <= 0xDFFF)
+            {
+                // surrogate pair, only when wchar_t is UTF-16
+                codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + ((uint32_t)string->characters[index+1] - 0xDC00);
+                index++;
+            }
+            if((codePoint >= 0xD800 && codePoint <= 0xDFFF) || codePoint > 0x10FFFF)
+                codePoint = 0xFFFD;
+            unsigned char encoded[4];
+            size_t encodedLength;
+            if(codePoint < 0x80)
+            {
+                encoded[0] = (unsigned char)codePoint;
+                encodedLength = 1;
+            }
+            else if(codePoint < 0x800)
+            {
+                encoded[0] = (unsigned char)(0xC0 | (codePoint >> 6));
+                encoded[1] = (unsigned char)(0x80 | (codePoint & 0x3F));
+                encodedLength = 2;
+            }
+            else if(codePoint < 0x10000)
+            {
+                encoded[0] = (unsigned char)(0xE0 | (codePoint >> 12));
+                encoded[1] = (unsigned char)(0x80 | ((codePoint >> 6) & 0x3F));
+                encoded[2] = (unsigned char)(0x80 | (codePoint & 0x3F));
+                encodedLength = 3;
+            }
+            else
+            {
+                encoded[0] = (unsigned char)(0xF0 | (codePoint >> 18));
+                encoded[1] = (unsigned char)(0x80 | ((codePoint >> 12) & 0x3F));
+                encoded[2] = (unsigned char)(0x80 | ((codePoint >> 6) & 0x3F));
+                encoded[3] = (unsigned char)(0x80 | (codePoint & 0x3F));
+                encodedLength = 4;
+            }
+            if(result != NULL)
+                for(size_t encodedIndex = 0; encodedIndex < encodedLength; encodedIndex++)
+                    result[writingIndex + encodedIndex] = (char)encoded[encodedIndex];
+            writingIndex += encodedLength;
+        }
+        if(result == NULL)
+        {
+            resultLength = writingIndex;
+            if((result = malloc(resultLength + 1)) == NULL)
+                return NULL;
+        }
+    }
+    result[resultLength] = '\0';
+    if(length != NULL)
+        *length = resultLength;
+    return result;
+}
+
+int CFMutableStringReserve(CFMutableStringRef string, size_t appendLength)
+{
+    if(string == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFMutableString NULL Reserve %zu", appendLength);
+    return CFMutableStringReserveAppend(string, appendLength);
+}
+
+size_t CFMutableStringGetCapacity(CFMutableStringRef string)
+{
+    if(string == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFMutableString NULL GetCapacity");
+    return string->capacity - 1;
+}
+
+void CFMutableStringTruncate(CFMutableStringRef string, size_t length)
+{
+    if(string == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFMutableString NULL Truncate %zu", length);
+    if(length < string->length)
+    {
+        string->length = length;
+        string->characters[length] = L'\0';
+    }
+    string->failed = false;
+}
+
+#pragma mark - Private
+
+static int CFMutableStringReserveAppend(CFMutableStringRef string, size_t appendLength)
+{
+    if(string->failed)
+        return -1;
+    if(string->length + appendLength + 1 <= string->capacity)
+        return 0;
+    if(appendLength > SIZE_MAX / sizeof(wchar_t) / 2 - string->length - 1)
+    {
+        string->failed = true;      // doubling would overflow
+        return -1;
+    }
+    size_t capacity = string->capacity * 2;
+    if(capacity < string->length + appendLength + 1)
+        capacity = string->length + appendLength + 1;
+    wchar_t *characters;
+    if((characters = realloc(string->characters, sizeof(wchar_t) * capacity)) == NULL)
+    {
+        string->failed = true;
+        return -1;
+    }
+    string->characters = characters;
+    string->capacity = capacity;
+    return 0;
+}
+
+static int CFMutableStringAppendDigits(CFMutableStringRef string, unsigned long long value, unsigned int minimumDigits)
+{
+    wchar_t buffer[CFMutableStringNumberBufferLength];
+    wchar_t *writingPoint = buffer + CFMutableStringNumberBufferLength;
+    unsigned int digits = 0;
+    do
+    {
+        *--writingPoint = L'0' + (wchar_t)(value % 10);
+        value /= 10;
+        digits++;
+    }while(value != 0 || (digits < minimumDigits && digits < CFMutableStringNumberBufferLength));
+    size_t appendLength = buffer + CFMutableStringNumberBufferLength - writingPoint;
+    if(CFMutableStringReserveAppend(string, appendLength) != 0)
+        return -1;
+    wmemcpy(string->characters + string->length, writingPoint, appendLength);
+    string->length += appendLength;
+    string->characters[string->length] = L'\0';
+    return 0;
+}
+
+static bool CFMutableStringRoundToInteger(double scaled, unsigned long long *result)
+{
+    // printf rounds the exact binary value, scaled carries error of the multiply
+    // give up when too close to a tie, caller falls back to printf then
+    double integer = floor(scaled);
+    if(fabs(scaled - integer - 0.5) < 1e-6)
+        return false;
+    *result = (unsigned long long)integer + (scaled - integer > 0.5 ? 1 : 0);
+    return true;
+}
+
+static int CFMutableStringAppendDoubleFallback(CFMutableStringRef string, const wchar_t *format, int precision, double value)
+{
+    wchar_t buffer[CFMutableStringFallbackBufferLength];
+    int temp;
+    if(wcschr(format, L'*') != NULL)
+        temp = swprintf(buffer, CFMutableStringFallbackBufferLength, format, precision, value);
+    else
+        temp = swprintf(buffer, CFMutableStringFallbackBufferLength, format, value);
+    if(temp < 0)
+    {
+        string->failed = true;
+        return -1;
+    }
+    return CFMutableStringAppendString(string, buffer);
+}
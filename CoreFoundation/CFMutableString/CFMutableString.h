@@ -0,0 +1,110 @@
+//
+//  CFMutableString.h
+//  CoreFoundation
+//
+//  Created by Bill Sun on 2018/11/5.
+//  Copyright © 2018 Bill Sun. All rights reserved.
+//
+
+#ifndef CFMutableString_h
+#define CFMutableString_h
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <wchar.h>
+
+typedef struct CFMutableString *CFMutableStringRef;
+// growable wide string, used to format output in memory with one pass
+
+#pragma mark - Create/Destory
+
+CFMutableStringRef CFMutableStringCreateEmpty(void);
+
+CFMutableStringRef CFMutableStringCreateWithCapacity(size_t capacity);
+/* capacity */
+// characters reserved up front, terminator included, the string still grows beyond it
+
+CFMutableStringRef CFMutableStringCopy(CFMutableStringRef string);
+/* Return */
+// NULL if string is failed or allocation failed
+
+void CFMutableStringDestory(CFMutableStringRef string);
+
+wchar_t *CFMutableStringDestoryAndStealCharacters(CFMutableStringRef string, size_t *length);
+/* length */
+// this could be NULL, receive the character amount without the terminating '\0'
+/* Return */
+// the internal buffer itself without copy, caller should free it
+// NULL if string is failed
+/* Discussion */
+// string is destoryed in any case, do not use it after this
+
+#pragma mark - Append
+
+int CFMutableStringAppendCharacter(CFMutableStringRef string, wchar_t character);
+
+int CFMutableStringAppendString(CFMutableStringRef string, const wchar_t *appendString);
+
+int CFMutableStringAppendSubstring(CFMutableStringRef string, const wchar_t *appendString, size_t length);
+// append exactly length characters, appendString need not terminate with '\0'
+
+int CFMutableStringAppendInteger(CFMutableStringRef string, long value);
+// same as %ld
+
+int CFMutableStringAppendUnsigned(CFMutableStringRef string, unsigned long value);
+// same as %lu
+
+int CFMutableStringAppendUnsignedWithMinimumDigits(CFMutableStringRef string, unsigned long value, unsigned int minimumDigits);
+// same as %.*lu, padded with '0' to minimumDigits
+
+int CFMutableStringAppendHex(CFMutableStringRef string, unsigned long value, unsigned int minimumDigits);
+// same as %.*lX, upper case, padded with '0' to minimumDigits
+
+int CFMutableStringAppendDouble(CFMutableStringRef string, double value);
+// same as %g
+
+int CFMutableStringAppendDoubleWithPrecision(CFMutableStringRef string, double value, unsigned int precision);
+// same as %.*f
+/* Return */
+// each append function return 0 for success, -1 if allocation failed
+/* Discussion */
+// once an append failed, string is marked failed and every later append do nothing and return -1
+// so a serializer could append all and check only once, see CFMutableStringIsFailed
+
+#pragma mark - Get Component
+
+bool CFMutableStringIsFailed(CFMutableStringRef string);
+
+size_t CFMutableStringGetLength(CFMutableStringRef string);
+
+const wchar_t *CFMutableStringGetCharacters(CFMutableStringRef string);
+/* Return */
+// owned by string, terminate with '\0', invalid after next append
+
+wchar_t *CFMutableStringCopyCharacters(CFMutableStringRef string);
+/* Return */
+// caller should free it, NULL if string is failed or allocation failed
+
+char *CFMutableStringCopyUTF8Characters(CFMutableStringRef string, size_t *length);
+/* length */
+// this could be NULL, receive the byte amount without the terminating '\0'
+/* Return */
+// caller should free it, NULL if string is failed or allocation failed
+// invalid code points are replaced with U+FFFD
+
+int CFMutableStringReserve(CFMutableStringRef string, size_t appendLength);
+/* Return */
+// 0 for success, -1 if allocation failed, the string is then marked failed
+/* Discussion */
+// make sure appendLength more characters could be appended without another allocation
+// growth is geometric, so this is only a hint when the final length is known
+
+size_t CFMutableStringGetCapacity(CFMutableStringRef string);
+/* Return */
+// characters could be hold without another allocation, terminator excluded
+
+void CFMutableStringTruncate(CFMutableStringRef string, size_t length);
+/* Discussion */
+// keep the first length characters, also clear the failed mark, the buffer is kept for reuse
+
+#endif /* CFMutableString_h */
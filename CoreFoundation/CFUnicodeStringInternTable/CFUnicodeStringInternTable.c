@@ -0,0 +1,156 @@
+//
+//  CFUnicodeStringInternTable.c
+//  CoreFoundation
+//
+//  Created by Bill Sun on 2018/11/3.
+//  Copyright © 2018 Bill Sun. All rights reserved.
+//
+
+#include <stdlib.h>
+#include <stdatomic.h>
+#include <wchar.h>
+
+#include "CFUnicodeStringInternTable.h"
+#include "CFException.h"
+
+typedef struct CFUnicodeStringInternTableSlot
+{
+    size_t hash;
+    size_t length;
+    wchar_t *string;                        // NULL for empty slot
+} CFUnicodeStringInternTableSlot;
+
+struct CFUnicodeStringInternTable
+{
+    atomic_size_t retainCount;              // shared by dialogues of the same file, which could be copied or destoryed on different threads
+    size_t amount;
+    size_t capacity;                        // power of 2, kept at least twice of amount
+    CFUnicodeStringInternTableSlot *slots;
+};
+
+static size_t CFUnicodeStringInternTableHash(const wchar_t *string, size_t length);
+
+static CFUnicodeStringInternTableSlot *CFUnicodeStringInternTableFindSlot(CFUnicodeStringInternTableSlot *slots, size_t capacity,
+                                                                          const wchar_t *string, size_t length, size_t hash);
+
+static int CFUnicodeStringInternTableGrow(CFUnicodeStringInternTableRef table);
+
+CFUnicodeStringInternTableRef CFUnicodeStringInternTableCreateEmpty(void)
+{
+    CFUnicodeStringInternTableRef result;
+    if((result = malloc(sizeof(struct CFUnicodeStringInternTable))) != NULL)
+    {
+        result->capacity = 16;
+        if((result->slots = calloc(result->capacity, sizeof(CFUnicodeStringInternTableSlot))) != NULL)
+        {
+            atomic_init(&result->retainCount, 1);
+            result->amount = 0;
+            return result;
+        }
+        free(result);
+    }
+    return NULL;
+}
+
+CFUnicodeStringInternTableRef CFUnicodeStringInternTableRetain(CFUnicodeStringInternTableRef table)
+{
+    if(table == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFUnicodeStringInternTable NULL Retain");
+    atomic_fetch_add_explicit(&table->retainCount, 1, memory_order_relaxed);
+    return table;
+}
+
+void CFUnicodeStringInternTableRelease(CFUnicodeStringInternTableRef table)
+{
+    if(table == NULL) return;
+    if(atomic_fetch_sub_explicit(&table->retainCount, 1, memory_order_acq_rel) != 1) return;
+    for(size_t index = 0; index<table->capacity; index++)
+        if(table->slots[index].string != NULL)
+            free(table->slots[index].string);
+    free(table->slots);
+    free(table);
+}
+
+const wchar_t *CFUnicodeStringInternTableInternString(CFUnicodeStringInternTableRef table, const wchar_t *string)
+{
+    if(table == NULL || string == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFUnicodeStringInternTable %p InternString %p", table, string);
+    return CFUnicodeStringInternTableInternStringWithLength(table, string, wcslen(string));
+}
+
+const wchar_t *CFUnicodeStringInternTableInternStringWithLength(CFUnicodeStringInternTableRef table, const wchar_t *string, size_t length)
+{
+    if(table == NULL || string == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFUnicodeStringInternTable %p InternStringWithLength %p", table, string);
+    size_t hash = CFUnicodeStringInternTableHash(string, length);
+    CFUnicodeStringInternTableSlot *slot = CFUnicodeStringInternTableFindSlot(table->slots, table->capacity, string, length, hash);
+    if(slot->string != NULL)
+        return slot->string;
+    
+    if((table->amount+1)*2 > table->capacity)
+    {
+        if(CFUnicodeStringInternTableGrow(table) != 0)
+            return NULL;
+        slot = CFUnicodeStringInternTableFindSlot(table->slots, table->capacity, string, length, hash);
+    }
+    
+    wchar_t *interned;
+    if((interned = malloc(sizeof(wchar_t)*(length+1))) == NULL)
+        return NULL;
+    wmemcpy(interned, string, length);
+    interned[length] = L'\0';
+    slot->hash = hash;
+    slot->length = length;
+    slot->string = interned;
+    table->amount++;
+    return interned;
+}
+
+size_t CFUnicodeStringInternTableGetLength(CFUnicodeStringInternTableRef table)
+{
+    if(table == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CFUnicodeStringInternTable NULL GetLength");
+    return table->amount;
+}
+
+static size_t CFUnicodeStringInternTableHash(const wchar_t *string, size_t length)
+{
+    // FNV-1a over each wide character
+    size_t hash = (size_t)2166136261u;
+    for(size_t index = 0; index<length; index++)
+    {
+        hash ^= (size_t)string[index];
+        hash *= (size_t)16777619u;
+    }
+    return hash;
+}
+
+static CFUnicodeStringInternTableSlot *CFUnicodeStringInternTableFindSlot(CFUnicodeStringInternTableSlot *slots, size_t capacity,
+                                                                          const wchar_t *string, size_t length, size_t hash)
+{
+    // return the slot holding string, or the empty slot it should be put in
+    size_t mask = capacity - 1;
+    CFUnicodeStringInternTableSlot *slot;
+    for(size_t position = hash & mask; (slot = slots + position)->string != NULL; position = (position + 1) & mask)
+        if(slot->hash == hash && slot->length == length && wmemcmp(slot->string, string, length) == 0)
+            break;
+    return slot;
+}
+
+static int CFUnicodeStringInternTableGrow(CFUnicodeStringInternTableRef table)
+{
+    size_t capacity = table->capacity*2;
+    CFUnicodeStringInternTableSlot *slots;
+    if((slots = calloc(capacity, sizeof(CFUnicodeStringInternTableSlot))) == NULL)
+        return -1;
+    for(size_t index = 0; index<table->capacity; index++)
+        if(table->slots[index].string != NULL)
+            *CFUnicodeStringInternTableFindSlot(slots, capacity,
+                                                table->slots[index].string,
+                                                table->slots[index].length,
+                                                table->slots[index].hash) = table->slots[index];
+    free(table->slots);
+    table->slots = slots;
+    table->capacity = capacity;
+    return 0;
+}
@@ -0,0 +1,42 @@
+//
+//  CFUnicodeStringInternTable.h
+//  CoreFoundation
+//
+//  Created by Bill Sun on 2018/11/3.
+//  Copyright © 2018 Bill Sun. All rights reserved.
+//
+
+#ifndef CFUnicodeStringInternTable_h
+#define CFUnicodeStringInternTable_h
+
+#include <stddef.h>
+#include <wchar.h>
+
+typedef struct CFUnicodeStringInternTable *CFUnicodeStringInternTableRef;
+
+CFUnicodeStringInternTableRef CFUnicodeStringInternTableCreateEmpty(void);
+/* Return */
+// the table is retained once by the creator
+
+CFUnicodeStringInternTableRef CFUnicodeStringInternTableRetain(CFUnicodeStringInternTableRef table);
+/* Return */
+// the same table
+
+void CFUnicodeStringInternTableRelease(CFUnicodeStringInternTableRef table);
+/* Discussion */
+// the table and all interned strings are freed when the last holder release it
+
+const wchar_t *CFUnicodeStringInternTableInternString(CFUnicodeStringInternTableRef table, const wchar_t *string);
+
+const wchar_t *CFUnicodeStringInternTableInternStringWithLength(CFUnicodeStringInternTableRef table, const wchar_t *string, size_t length);
+/* string */
+// only the first length characters are interned, string don't need to terminate with '\0'
+/* Return */
+// the interned string owned by table, NULL if failed
+// equal strings interned into the same table return the same pointer, so compare them by pointer
+
+size_t CFUnicodeStringInternTableGetLength(CFUnicodeStringInternTableRef table);
+/* Return Value */
+// the amount of distinct strings
+
+#endif /* CFUnicodeStringInternTable_h */
@@ -18,6 +18,8 @@
 #include "CFDeclare/CFType.h"
 #include "CFPointArray/CFPointArray.h"
 #include "CFUnicodeStringArray/CFUnicodeStringArray.h"
+#include "CFUnicodeStringInternTable/CFUnicodeStringInternTable.h"
+#include "CFMutableString/CFMutableString.h"
 #include "CFTextProvider/CFTextProvider.h"
 #include "CFUseTool/CFUseTool.h"
 
@@ -16,6 +16,8 @@
 #include "CABidiClassify.h"
 #include "CFException.h"
 #include "CABidiPairedBracket.h"
+#include "CAGraphemeBreak.h"
+#include "CABidiMirroring.h"
 
 #pragma mark - Macro configuration
 
@@ -28,6 +30,9 @@
 #define LeastEvenGreaterThan(x) ((x) + ((x) % 2 == 0 ? 2 : 1))
 #define LOOP for(;;)
 #define EmbeddingDirection(level) ((level) % 2 == 0 ? CABidiTypeL : CABidiTypeR)
+#define StrongDirection(type) ((type) == CABidiTypeL ? CABidiTypeL : CABidiTypeR)
+#define isNeutralOrIsolate(type) ((type) == CABidiTypeB || (type) == CABidiTypeS || (type) == CABidiTypeWS || (type) == CABidiTypeON || isExplicitDirectionalIsolates(type) || (type) == CABidiTypePDI)
+#define CanonicalBracket(character) ((character) == 0x2329 ? 0x3008 : (character) == 0x232A ? 0x3009 : (character))
 
 #pragma mark - Type definition
 
@@ -47,6 +52,8 @@ typedef struct CAIsolatingRunSequencesData *CAIsolatingRunSequencesDataRef;
 static void CABLGeneratorProcessBidiLevel(CABLGeneratorRef generator);  // will consider CRCL status as one paragraph
 static void CABLGeneratorProcessPragraphLevel(CABLGeneratorRef generator, size_t paragraphBeginIndex, size_t paragraphEndIndex);
 static CABidiLevel CABLGeneratorResolvePragraphEmbeddingLevel(CABLGeneratorRef generator, size_t paragraphBeginIndex, size_t paragraphEndIndex);
+static bool CABLGeneratorResolveUnidirectionalPragraph(CABLGeneratorRef generator, size_t paragraphBeginIndex, size_t paragraphEndIndex);
+static int CABLGeneratorResolveIsolatingRunSequence(CABLGeneratorRef generator, CAIsolatingRunSequencesDataRef sequenceData, size_t sequenceIndex, size_t paragraphBeginIndex, size_t paragraphEndIndex, CABidiLevel paragraphLevel, const CABidiLevel *embeddingLevelArr);
 
 /* matchingExplictFormat */
 static CAMatchingExplictFormatRef CABLGeneratorResolveMatchingExplictFormat(CABLGeneratorRef generator, size_t paragraphBeginIndex, size_t paragraphEndIndex);
@@ -156,6 +163,9 @@ typedef struct pairedBracket {
 
 static void CABLGeneratorProcessPragraphLevel(CABLGeneratorRef generator, size_t beginIndex, size_t endIndex)
 {
+    if(CABLGeneratorResolveUnidirectionalPragraph(generator, beginIndex, endIndex))
+        return;
+    
     CAMatchingExplictFormatRef matchingExplictFormat;
     if((matchingExplictFormat = CABLGeneratorResolveMatchingExplictFormat(generator, beginIndex, endIndex)) != NULL)
     {
@@ -166,7 +176,9 @@ static void CABLGeneratorProcessPragraphLevel(CABLGeneratorRef generator, size_t
         for(size_t index = beginIndex; index <= endIndex; index++)
         {
             CABidiType currentType = generator->typeArr[index];
-            if(currentType == CABidiTypeAL || currentType == CABidiTypeR)
+            if(currentType == CABidiTypeL)
+                break;
+            else if(currentType == CABidiTypeAL || currentType == CABidiTypeR)
                 { paragraphLevel = 1; break; }
             else if(isExplicitDirectionalIsolates(currentType))
             {
@@ -193,7 +205,7 @@ static void CABLGeneratorProcessPragraphLevel(CABLGeneratorRef generator, size_t
         // This reflects the number of isolate initiators that were encountered in the pass so far without encountering their matching PDIs, and have been judged valid by the depth limit, i.e. all the entries on the stack with a true directional isolate status.
         
         CABidiLevel currentLevel = 0;
-        for(size_t index = beginIndex; index < endIndex; index++)
+        for(size_t index = beginIndex; index <= endIndex; index++)
         {
             // Only embedding levels from 0 through max_depth are valid in this phase.
             
@@ -330,13 +342,15 @@ static void CABLGeneratorProcessPragraphLevel(CABLGeneratorRef generator, size_t
             {
                 size_t matchingPDIIndex;
                 if(!CAMatchingExplictFormatLocateMatchingPDI(matchingExplictFormat, index, &matchingPDIIndex))
-                    matchingPDIIndex = endIndex;
+                    matchingPDIIndex = endIndex + 1;    // end of paragraph
                 
                 CABidiLevel FSILevel = 0;
-                for(size_t i = index; i <= matchingPDIIndex; i++)
+                for(size_t i = index + 1; i < matchingPDIIndex; i++)
                 {
                     CABidiType currentType = generator->typeArr[i];
-                    if(currentType == CABidiTypeAL || currentType == CABidiTypeR)
+                    if(currentType == CABidiTypeL)
+                        break;
+                    else if(currentType == CABidiTypeAL || currentType == CABidiTypeR)
                     { FSILevel = 1; break; }
                     else if(isExplicitDirectionalIsolates(currentType))
                     {
@@ -442,7 +456,8 @@ static void CABLGeneratorProcessPragraphLevel(CABLGeneratorRef generator, size_t
             else
             {
                 currentLevel = statusStack[topIndex].level;
-                if(statusStack[topIndex].overrideStatus != CADirectionalOverrideStatusNeutral)
+                /* BN is removed by X9, an override never makes it strong */
+                if(currentType != CABidiTypeBN && statusStack[topIndex].overrideStatus != CADirectionalOverrideStatusNeutral)
                 {
                     if(statusStack[topIndex].overrideStatus == CADirectionalOverrideStatusLeftToRight)
                         generator->typeArr[index] = CABidiTypeL;
@@ -465,662 +480,360 @@ static void CABLGeneratorProcessPragraphLevel(CABLGeneratorRef generator, size_t
         
         /* X10 - Unicode Bidirectional Algorithm */
         /* divided into Isolate Run Sequence */
+        /* level runs are formed over characters not removed by X9, so a removed character joins the run before it, unless that run ends with an isolate initiator */
+        for(size_t index = beginIndex + 1; index <= endIndex; index++)
+            if(generator->typeArr[index] == CABidiTypeBN &&
+               !isExplicitDirectionalIsolates(CABidiClassifyTypeForCharacter(UTF32StringGetCharAtIndex(generator->string, index - 1))))
+                generator->levelArr[index] = generator->levelArr[index - 1];
+        
+        /* sos and eos come from the embedding levels of X1-X8, while I1 I2 of earlier sequences already raise levelArr */
         CAIsolatingRunSequencesDataRef sequenceData;
-        if((sequenceData = CAIsolatingRunSequencesDataCreate(generator, matchingExplictFormat, beginIndex, endIndex)) != NULL)
+        CABidiLevel *embeddingLevelArr;
+        if((embeddingLevelArr = malloc(sizeof(CABidiLevel) * (endIndex - beginIndex + 1))) != NULL &&
+           (sequenceData = CAIsolatingRunSequencesDataCreate(generator, matchingExplictFormat, beginIndex, endIndex)) != NULL)
         {
+            memcpy(embeddingLevelArr, generator->levelArr + beginIndex, sizeof(CABidiLevel) * (endIndex - beginIndex + 1));
             size_t sequencesAmount = CAIsolatingRunSequencesDataGetSequenceAmount(sequenceData);
             for(size_t sequenceIndex = 0; sequenceIndex < sequencesAmount; sequenceIndex++)
-            {
-                size_t characterAmountInSequence = CAIsolatingRunSequencesDataGetCharacterAmountInSequence(sequenceData, sequenceIndex);
-                
-                size_t firstCharacterInSequenceParagraphIndex = CAIsolatingRunSequencesDataGetCharacterIndex(sequenceData, sequenceIndex, 0);
-                size_t lastCharacterInSequenceParagraphIndex = CAIsolatingRunSequencesDataGetCharacterIndex(sequenceData, sequenceIndex, characterAmountInSequence - 1);
-                
-                
-                CABidiLevel firstLevel = generator->levelArr[firstCharacterInSequenceParagraphIndex];
-                CABidiLevel lastLevel = generator->levelArr[lastCharacterInSequenceParagraphIndex];
-                
-                CABidiLevel formerLevel;    /* skip over any BNs */
-                size_t formerIndex = firstCharacterInSequenceParagraphIndex - 1;
-                while (generator->typeArr[formerIndex] == CABidiTypeBN && formerIndex >= beginIndex)
-                    formerIndex--;
-                if(formerIndex>=beginIndex) formerLevel = generator->levelArr[formerIndex];
-                else formerLevel = paragraphLevel;
-                
-                CABidiLevel latterLevel;    /* skip over any BNs */
-                size_t latterIndex = lastCharacterInSequenceParagraphIndex + 1;
-                while (generator->typeArr[latterIndex] == CABidiTypeBN && latterIndex <= endIndex)
-                    latterIndex++;
-                if(latterIndex <= endIndex) latterLevel = generator->levelArr[latterIndex];
-                else latterLevel = paragraphLevel;
-                
-                /* resolve SOS & EOS */
-                CABidiType sos = (firstLevel > formerLevel ? firstLevel : formerLevel) % 2 == 0 ? CABidiTypeL : CABidiTypeR;
-                CABidiType eos = (lastLevel > latterLevel ? lastLevel : latterLevel) % 2 == 0 ? CABidiTypeL : CABidiTypeR;
-                
-                /* Resolving Weak Types */
-                
-                /* W1 - Unicode Bidirectional Algorithm */
-                /* caculate non-space mark amount */
-                size_t nonSpaceMarkAmount = 0;
-                size_t *nonSpaceMarkIndexInSequenceArr = NULL;
-                /* In this array, first is the NSM index, then it is the previous matching non-BN index in sequence, if it matches sos, it is SIZE_MAX */
-                
-                for(size_t characterIndexInSequence = 0; characterIndexInSequence < characterAmountInSequence; characterIndexInSequence++)
-                {
-                    size_t currentIndexInString = CAIsolatingRunSequencesDataGetCharacterIndex(sequenceData, sequenceIndex, characterIndexInSequence);
-                    CABidiType currentType = generator->typeArr[currentIndexInString];
-                    if(currentType == CABidiTypeNSM)
-                        nonSpaceMarkAmount++;
-                }
-                
-                /* resolve non-space mark */
-                if(nonSpaceMarkAmount > 0)
-                {
-                    if((nonSpaceMarkIndexInSequenceArr = malloc(sizeof(size_t) * nonSpaceMarkAmount * 2)) != NULL)
-                    {
-                        size_t nonSpaceMarkArrIndex = 0;
-                        for(size_t characterIndexInSequence = 0; characterIndexInSequence < characterAmountInSequence; characterIndexInSequence++)
-                        {
-                            size_t currentIndexInString = CAIsolatingRunSequencesDataGetCharacterIndex(sequenceData, sequenceIndex, characterIndexInSequence);
-                            
-                            CABidiType currentType = generator->typeArr[currentIndexInString];
-                            if(currentType == CABidiTypeNSM)
-                            {
-                                nonSpaceMarkIndexInSequenceArr[nonSpaceMarkArrIndex++] = characterIndexInSequence;
-                                bool isFirstNonBNcharacter = true;
-                                for(long formerIndexInSequence = characterIndexInSequence; formerIndexInSequence >= 0; formerIndexInSequence--)
-                                {
-                                    size_t formerIndexInString = CAIsolatingRunSequencesDataGetCharacterIndex(sequenceData, sequenceIndex, formerIndexInSequence);
-                                    CABidiType formerType = generator->typeArr[formerIndexInString];
-                                    if(formerType != CABidiTypeBN)
-                                    {
-                                        isFirstNonBNcharacter = false;
-                                        nonSpaceMarkIndexInSequenceArr[nonSpaceMarkArrIndex++] = formerIndexInSequence;
-                                        
-                                        if(isExplicitDirectionalIsolates(formerType) || formerType == CABidiTypePDI)
-                                            generator->typeArr[currentIndexInString] = CABidiTypeON;
-                                        else
-                                            generator->typeArr[currentIndexInString] = formerType;
-                                        break;
-                                    }
-                                }
-                                
-                                if(isFirstNonBNcharacter)
-                                {
-                                    nonSpaceMarkIndexInSequenceArr[nonSpaceMarkArrIndex++] = SIZE_MAX;
-                                    generator->typeArr[currentIndexInString] = sos;
-                                }
-                            }
-                        }
-                    }
-                    else
-                    {
-                        CFExceptionRaise(CFExceptionNameProcessFailed, NULL, "CABLGeneratorProcessPragraphLevel allocate pairsInSequence failed");
-                        CAIsolatingRunSequencesDataDestory(sequenceData);
-                        CAMatchingExplictFormatDestory(matchingExplictFormat);
-                        return;
-                    }
-                }
-                
-                /* W2 - Unicode Bidirectional Algorithm */
-                /* resolve European number to AN based on mostly closed strong type */
-                for(long characterIndexInSequence = characterAmountInSequence - 1; characterIndexInSequence >= 0; characterIndexInSequence--)
-                {
-                    size_t currentIndexInString = CAIsolatingRunSequencesDataGetCharacterIndex(sequenceData, sequenceIndex, characterIndexInSequence);
-                    CABidiType currentType = generator->typeArr[currentIndexInString];
-                    if(currentType == CABidiTypeEN)
-                    {
-                        long backwardIndexInSequence;
-                        for(backwardIndexInSequence = characterIndexInSequence - 1; backwardIndexInSequence >= 0; backwardIndexInSequence--)
-                        {
-                            size_t backwardIndexInString = CAIsolatingRunSequencesDataGetCharacterIndex(sequenceData, sequenceIndex, backwardIndexInSequence);
-                            CABidiType backwardType = generator->typeArr[backwardIndexInString];
-                            if(CABidiClassifyCategoryForType(backwardType) == CABidiCategoryStrong)
-                            {
-                                if(backwardType == CABidiTypeAL)
-                                    generator->typeArr[currentIndexInString] = CABidiTypeAN;
-                                break;
-                            }
-                        }
-                        /* break exit */
-                        if(backwardIndexInSequence < 0) /* check sos */
-                            if(sos == CABidiTypeAL)
-                                generator->typeArr[currentIndexInString] = CABidiTypeAN;
-                    }
-                }
-                
-                /* W3 - Unicode Bidirectional Algorithm */
-                /* change all AL to R */
-                for(size_t characterIndexInSequence = 0; characterIndexInSequence < characterAmountInSequence; characterIndexInSequence++)
-                {
-                    size_t currentIndexInString = CAIsolatingRunSequencesDataGetCharacterIndex(sequenceData, sequenceIndex, characterIndexInSequence);
-                    CABidiType currentType = generator->typeArr[currentIndexInString];
-                    if(currentType == CABidiTypeAL)
-                        generator->typeArr[currentIndexInString] = CABidiTypeR;
-                }
-                
-                /* W4 - Unicode Bidirectional Algorithm */
-                /* A single European separator between two European numbers changes to a European number */
-                for(size_t characterIndexInSequence = 0; characterIndexInSequence < characterAmountInSequence; characterIndexInSequence++)
-                {
-                    size_t currentIndexInString = CAIsolatingRunSequencesDataGetCharacterIndex(sequenceData, sequenceIndex, characterIndexInSequence);
-                    CABidiType currentType = generator->typeArr[currentIndexInString];
-                    if(currentType == CABidiTypeES)
-                    {
-                        CABidiType previousType = CABidiTypeBN; /* just avoid un-initialization warning, useless assignment */
-                        bool isFirstNonBN = true;
-                        for(long formerIndexInSequence = characterIndexInSequence; formerIndexInSequence >= 0; formerIndexInSequence--)
-                        {
-                            size_t formerIndexInString = CAIsolatingRunSequencesDataGetCharacterIndex(sequenceData, sequenceIndex, formerIndexInSequence);
-                            previousType = generator->typeArr[formerIndexInString];
-                            if(previousType != CABidiTypeBN)
-                            {
-                                isFirstNonBN = false;
-                                break;
-                            }
-                        }
-                        if(isFirstNonBN) previousType = sos;
-                        
-                        CABidiType latterType = CABidiTypeBN; /* just avoid un-initialization warning, useless assignment */
-                        bool isLastNonBN = true;
-                        for(long latterIndexInSequence = characterIndexInSequence; latterIndexInSequence < characterAmountInSequence; latterIndexInSequence--)
-                        {
-                            size_t latterIndexInString = CAIsolatingRunSequencesDataGetCharacterIndex(sequenceData, sequenceIndex, latterIndexInSequence);
-                            latterType = generator->typeArr[latterIndexInString];
-                            if(latterType != CABidiTypeBN)
-                            {
-                                isLastNonBN = false;
-                                break;
-                            }
-                        }
-                        if(isLastNonBN) latterIndex = eos;
-                        
-                        if(previousType == CABidiTypeEN && latterType == CABidiTypeEN)
-                            generator->typeArr[currentIndexInString] = CABidiTypeEN;
-                    }
-                }
-                
-                /* A single common separator between two numbers of the same type changes to that type */
-                for(size_t characterIndexInSequence = 0; characterIndexInSequence < characterAmountInSequence; characterIndexInSequence++)
-                {
-                    size_t currentIndexInString = CAIsolatingRunSequencesDataGetCharacterIndex(sequenceData, sequenceIndex, characterIndexInSequence);
-                    CABidiType currentType = generator->typeArr[currentIndexInString];
-                    if(currentType == CABidiTypeCS)
-                    {
-                        CABidiType previousType = CABidiTypeBN; /* just avoid un-initialization warning, useless assignment */
-                        bool isFirstNonBN = true;
-                        for(long formerIndexInSequence = characterIndexInSequence; formerIndexInSequence >= 0; formerIndexInSequence--)
-                        {
-                            size_t formerIndexInString = CAIsolatingRunSequencesDataGetCharacterIndex(sequenceData, sequenceIndex, formerIndexInSequence);
-                            previousType = generator->typeArr[formerIndexInString];
-                            if(previousType != CABidiTypeBN)
-                            {
-                                isFirstNonBN = false;
-                                break;
-                            }
-                        }
-                        if(isFirstNonBN) previousType = sos;
-                        
-                        CABidiType latterType = CABidiTypeBN; /* just avoid un-initialization warning, useless assignment */
-                        bool isLastNonBN = true;
-                        for(long latterIndexInSequence = characterIndexInSequence; latterIndexInSequence < characterAmountInSequence; latterIndexInSequence--)
-                        {
-                            size_t latterIndexInString = CAIsolatingRunSequencesDataGetCharacterIndex(sequenceData, sequenceIndex, latterIndexInSequence);
-                            latterType = generator->typeArr[latterIndexInString];
-                            if(latterType != CABidiTypeBN)
-                            {
-                                isLastNonBN = false;
-                                break;
-                            }
-                        }
-                        if(isLastNonBN) latterIndex = eos;
-                        
-                        if(previousType == CABidiTypeEN && latterType == CABidiTypeEN)
-                            generator->typeArr[currentIndexInString] = CABidiTypeEN;
-                        
-                        if(previousType == latterType && (previousType == CABidiTypeEN || previousType == CABidiTypeAN))
-                            generator->typeArr[currentIndexInString] = previousType;
-                    }
-                }
-                
-                /* W5 - Unicode Bidirectional Algorithm */
-                /* A sequence of European terminators adjacent to European numbers changes to all European numbers */
-                for(size_t characterIndexInSequence = 0; characterIndexInSequence < characterAmountInSequence; characterIndexInSequence++)
-                {
-                    size_t currentIndexInString = CAIsolatingRunSequencesDataGetCharacterIndex(sequenceData, sequenceIndex, characterIndexInSequence);
-                    CABidiType currentType = generator->typeArr[currentIndexInString];
-                    if(currentType == CABidiTypeET || currentType == CABidiTypeBN)
-                    {
-                        size_t terminatorsBeginIndexInSequence = characterIndexInSequence;
-                        size_t terminatorsEndIndexInSequence = terminatorsBeginIndexInSequence;
-                        
-                        LOOP
-                        {
-                            if(terminatorsEndIndexInSequence + 1 >= characterAmountInSequence)
-                                break;
-                            CABidiType terminatorsEndType = generator->typeArr[CAIsolatingRunSequencesDataGetCharacterIndex(sequenceData, sequenceIndex, terminatorsEndIndexInSequence + 1)];
-                            if(terminatorsEndType == CABidiTypeET || terminatorsEndType == CABidiTypeBN)
-                                terminatorsEndType++;
-                            else
-                                break;
-                        }
-                        
-                        CABidiType previousType;
-                        if(terminatorsBeginIndexInSequence == 0) previousType = sos;
-                        else previousType = generator->typeArr[CAIsolatingRunSequencesDataGetCharacterIndex(sequenceData, sequenceIndex, terminatorsBeginIndexInSequence - 1)];
-                        
-                        CABidiType latterType;
-                        if(terminatorsEndIndexInSequence == characterAmountInSequence - 1) latterType = eos;
-                        else latterType = generator->typeArr[CAIsolatingRunSequencesDataGetCharacterIndex(sequenceData, sequenceIndex, terminatorsEndIndexInSequence + 1)];
-                        
-                        if(previousType == CABidiTypeEN || previousType == CABidiTypeEN)
-                            for(size_t currentTerminatorIndexInSequence = terminatorsBeginIndexInSequence; currentTerminatorIndexInSequence <= terminatorsEndIndexInSequence; currentTerminatorIndexInSequence++)
-                                generator->typeArr[CAIsolatingRunSequencesDataGetCharacterIndex(sequenceData, sequenceIndex, currentTerminatorIndexInSequence)] = CABidiTypeEN;
-                        
-                        characterIndexInSequence = terminatorsEndIndexInSequence;
-                    }
-                }
-                
-                /* W6 - Unicode Bidirectional Algorithm */
-                /* Otherwise, separators and terminators (only weak type) change to Other Neutral */
-                for(size_t characterIndexInSequence = 0; characterIndexInSequence < characterAmountInSequence; characterIndexInSequence++)
+                if(CABLGeneratorResolveIsolatingRunSequence(generator, sequenceData, sequenceIndex, beginIndex, endIndex, paragraphLevel, embeddingLevelArr) == -1)
                 {
-                    size_t currentIndexInString = CAIsolatingRunSequencesDataGetCharacterIndex(sequenceData, sequenceIndex, characterIndexInSequence);
-                    CABidiType currentType = generator->typeArr[currentIndexInString];
-                    if(currentType == CABidiTypeES || currentType == CABidiTypeET || currentType == CABidiTypeCS)
-                    {
-                        if(characterIndexInSequence > 0)
-                        {
-                            size_t formerIndexInString = CAIsolatingRunSequencesDataGetCharacterIndex(sequenceData, sequenceIndex, characterIndexInSequence - 1);
-                            CABidiType formerType = generator->typeArr[formerIndexInString];
-                            if(formerType == CABidiTypeBN)
-                                generator->typeArr[formerIndexInString] = CABidiTypeON;
-                        }
-                        if(characterIndexInSequence < characterAmountInSequence - 1)
-                        {
-                            size_t latterIndexInString = CAIsolatingRunSequencesDataGetCharacterIndex(sequenceData, sequenceIndex, characterIndexInSequence + 1);
-                            CABidiType latterType = generator->typeArr[latterIndexInString];
-                            if(latterType == CABidiTypeBN)
-                                generator->typeArr[latterIndexInString] = CABidiTypeON;
-                        }
-                        generator->typeArr[currentIndexInString] = CABidiTypeON;
-                    }
-                }
-                
-                /* W7 - Unicode Bidirectional Algorithm */
-                /* Search backward from each instance of a European number until the first strong type (R, L, or sos) is found */
-                /* If an L is found, then change the type of the European number to L */
-                for(long characterIndexInSequence = characterAmountInSequence - 1; characterIndexInSequence >= 0; characterIndexInSequence--)
-                {
-                    size_t currentIndexInString = CAIsolatingRunSequencesDataGetCharacterIndex(sequenceData, sequenceIndex, characterIndexInSequence);
-                    CABidiType currentType = generator->typeArr[currentIndexInString];
-                    if(currentType == CABidiTypeEN)
-                    {
-                        long backwardIndexInSequence;
-                        for(backwardIndexInSequence = characterIndexInSequence - 1; backwardIndexInSequence >= 0; backwardIndexInSequence--)
-                        {
-                            size_t backwardIndexInString = CAIsolatingRunSequencesDataGetCharacterIndex(sequenceData, sequenceIndex, backwardIndexInSequence);
-                            CABidiType backwardType = generator->typeArr[backwardIndexInString];
-                            if(CABidiClassifyCategoryForType(backwardType) == CABidiCategoryStrong)
-                            {
-                                if(backwardType == CABidiTypeL)
-                                    generator->typeArr[currentIndexInString] = CABidiTypeL;
-                                break;
-                            }
-                        }
-                        /* break exit */
-                        if(backwardIndexInSequence < 0) /* check sos */
-                            if(sos == CABidiTypeL)
-                                generator->typeArr[currentIndexInString] = CABidiTypeL;
-                    }
-                }
-                
-                /* Resolving Neutral and Isolate Formatting Types */
-                
-                /* Rosolve Paired Brackets */
-                tryToPairElement tryToPairStack[TryToPairBracketStackSize];
-                size_t stackElementAmount = 0;
-                
-                size_t pairedBracketAmount = 0;
-                for(long characterIndexInSequence = 0; characterIndexInSequence < characterAmountInSequence; characterIndexInSequence++)
-                {
-                    size_t currentIndexInString = CAIsolatingRunSequencesDataGetCharacterIndex(sequenceData, sequenceIndex, characterIndexInSequence);
-                    UTF32Char currentCharacter = UTF32StringGetCharAtIndex(generator->string, currentIndexInString);
-                    UTF32Char pairedChar;
-                    CABidiPairedBracketType bracketType = CABidiGetPairedBracketType(currentCharacter, &pairedChar);
-                    if(bracketType == CABidiPairedBracketTypeOpen)
-                    {
-                        if(stackElementAmount < TryToPairBracketStackSize)
-                            tryToPairStack[stackElementAmount++] = (tryToPairElement){.pairedCloseCharacter = pairedChar, .index = characterIndexInSequence};
-                        else
-                            break; /* break 01 */
-                    }
-                    else if(bracketType == CABidiPairedBracketTypeClose)
-                    {
-                        for(long stackIndex = stackElementAmount - 1; stackIndex >= 0; stackIndex--)
-                            if(tryToPairStack[stackIndex].pairedCloseCharacter == currentCharacter)
-                            {
-                                pairedBracketAmount++;
-                                stackElementAmount = stackIndex;
-                                break;  /* break 02 */
-                            }
-                        /* break 02 exit */
-                    }
-                }
-                /* break 01 exit */
-                
-                pairedBracket *pairsInSequence = NULL; /* if pairedBracketAmount == 0, this is NULL */
-                if(pairedBracketAmount > 0)
-                {
-                    size_t pairsInSequenceArrIndex = 0;
-                    
-                    if((pairsInSequence = malloc(sizeof(pairedBracket))) != NULL)
-                    {
-                        for(long characterIndexInSequence = 0; characterIndexInSequence < characterAmountInSequence; characterIndexInSequence++)
-                        {
-                            size_t currentIndexInString = CAIsolatingRunSequencesDataGetCharacterIndex(sequenceData, sequenceIndex, characterIndexInSequence);
-                            UTF32Char currentCharacter = UTF32StringGetCharAtIndex(generator->string, currentIndexInString);
-                            UTF32Char pairedChar;
-                            CABidiPairedBracketType bracketType = CABidiGetPairedBracketType(currentCharacter, &pairedChar);
-                            if(bracketType == CABidiPairedBracketTypeOpen)
-                            {
-                                if(stackElementAmount < TryToPairBracketStackSize)
-                                    tryToPairStack[stackElementAmount++] = (tryToPairElement){.pairedCloseCharacter = pairedChar, .index = characterIndexInSequence};
-                                else
-                                    break; /* break 01 */
-                            }
-                            else if(bracketType == CABidiPairedBracketTypeClose)
-                            {
-                                for(long stackIndex = stackElementAmount - 1; stackIndex >= 0; stackIndex--)
-                                    if(tryToPairStack[stackIndex].pairedCloseCharacter == currentCharacter)
-                                    {
-                                        pairsInSequence[pairsInSequenceArrIndex++] = (pairedBracket){.openIndex = tryToPairStack[stackIndex].index, .closeIndex = characterIndexInSequence};
-                                        stackElementAmount = stackIndex;
-                                        break;  /* break 02 */
-                                    }
-                                /* break 02 exit */
-                            }
-                        }
-                    }
-                    else
-                    {
-                        CFExceptionRaise(CFExceptionNameProcessFailed, NULL, "CABLGeneratorProcessPragraphLevel allocate pairsInSequence failed");
-                        if(nonSpaceMarkIndexInSequenceArr != NULL) free(pairsInSequence);
-                        CAIsolatingRunSequencesDataDestory(sequenceData);
-                        CAMatchingExplictFormatDestory(matchingExplictFormat);
-                        return;
-                    }
+                    CFExceptionRaise(CFExceptionNameProcessFailed, NULL, "CABLGeneratorProcessPragraphLevel allocate sequence failed");
+                    break;
                 }
-                
-                /* N0 - Unicode Bidirectional Algorithm */
-                /* Process bracket pairs in an isolating run */
-                /* Within this scope, bidirectional types EN and AN are treated as R */
-                for(size_t pairsIndex = 0; pairsIndex < pairedBracketAmount; pairsIndex++)
-                {
-                    size_t openPairIndexInSequence = pairsInSequence[pairsIndex].openIndex;
-                    size_t closePairIndexInSequence = pairsInSequence[pairsIndex].closeIndex;
-                    size_t openPairIndexInString = CAIsolatingRunSequencesDataGetCharacterIndex(sequenceData, sequenceIndex, openPairIndexInSequence);
-                    size_t closePairIndexInString = CAIsolatingRunSequencesDataGetCharacterIndex(sequenceData, sequenceIndex, closePairIndexInSequence);
-                    
-                    /* If any strong type (either L or R) matching the embedding direction is found, set the type for both brackets in the pair to match the embedding direction */
-                    bool isFoundMatchEmbbedingDirection = false;
-                    bool hasStrongType = false;
-                    for(size_t insidePairIndex = openPairIndexInSequence + 1; insidePairIndex < closePairIndexInSequence; insidePairIndex++)
-                    {
-                        size_t insideIndexInString = CAIsolatingRunSequencesDataGetCharacterIndex(sequenceData, sequenceIndex, insidePairIndex);
-                        CABidiType insideType = generator->typeArr[insideIndexInString];
-                        CABidiLevel insideLevel = generator->levelArr[insideIndexInString];
-                        if(insideType == CABidiTypeL)
-                        {
-                            hasStrongType = true;
-                            if(CABidiTypeL == EmbeddingDirection(insideLevel))
-                            {
-                                isFoundMatchEmbbedingDirection = true;
-                                generator->typeArr[openPairIndexInString] = CABidiTypeL;
-                                generator->typeArr[closePairIndexInString] = CABidiTypeL;
-                                
-                                for (size_t NSMPairArrIndex = 0; NSMPairArrIndex < nonSpaceMarkAmount; NSMPairArrIndex++)
-                                    if(nonSpaceMarkIndexInSequenceArr[NSMPairArrIndex * 2 + 1] == openPairIndexInSequence)
-                                    {
-                                        size_t NSMIndexInString = CAIsolatingRunSequencesDataGetCharacterIndex(sequenceData, sequenceIndex, NSMPairArrIndex * 2);
-                                        generator->typeArr[NSMIndexInString] = CABidiTypeL;
-                                        break;
-                                    }
-                                for (size_t NSMPairArrIndex = 0; NSMPairArrIndex < nonSpaceMarkAmount; NSMPairArrIndex++)
-                                    if(nonSpaceMarkIndexInSequenceArr[NSMPairArrIndex * 2 + 1] == closePairIndexInSequence)
-                                    {
-                                        size_t NSMIndexInString = CAIsolatingRunSequencesDataGetCharacterIndex(sequenceData, sequenceIndex, NSMPairArrIndex * 2);
-                                        generator->typeArr[NSMIndexInString] = CABidiTypeL;
-                                        break;
-                                    }
-                                
-                                break;
-                            }
-                        }
-                        else if(insideType == CABidiTypeR || insideType == CABidiTypeEN || insideType == CABidiTypeAN)
-                        {
-                            hasStrongType = true;
-                            if(CABidiTypeR == EmbeddingDirection(insideLevel))
-                            {
-                                isFoundMatchEmbbedingDirection = true;
-                                generator->typeArr[openPairIndexInString] = CABidiTypeR;
-                                generator->typeArr[closePairIndexInString] = CABidiTypeR;
-                                
-                                for (size_t NSMPairArrIndex = 0; NSMPairArrIndex < nonSpaceMarkAmount; NSMPairArrIndex++)
-                                    if(nonSpaceMarkIndexInSequenceArr[NSMPairArrIndex * 2 + 1] == openPairIndexInSequence)
-                                    {
-                                        size_t NSMIndexInString = CAIsolatingRunSequencesDataGetCharacterIndex(sequenceData, sequenceIndex, NSMPairArrIndex * 2);
-                                        generator->typeArr[NSMIndexInString] = CABidiTypeR;
-                                        break;
-                                    }
-                                for (size_t NSMPairArrIndex = 0; NSMPairArrIndex < nonSpaceMarkAmount; NSMPairArrIndex++)
-                                    if(nonSpaceMarkIndexInSequenceArr[NSMPairArrIndex * 2 + 1] == closePairIndexInSequence)
-                                    {
-                                        size_t NSMIndexInString = CAIsolatingRunSequencesDataGetCharacterIndex(sequenceData, sequenceIndex, NSMPairArrIndex * 2);
-                                        generator->typeArr[NSMIndexInString] = CABidiTypeR;
-                                        break;
-                                    }
-                                
-                                break;
-                            }
-                        }
-                    }
-                    /* break exit */
-                    
-                    if(!isFoundMatchEmbbedingDirection)
-                    {
-                        if(hasStrongType)
-                        {
-                            long formerIndexInSequence;
-                            CABidiType firstStrongType = CABidiTypeL;   /* useless assignment */
-                            for(formerIndexInSequence = openPairIndexInSequence - 1; formerIndexInSequence >= 0; formerIndexInSequence--)
-                            {
-                                firstStrongType = generator->typeArr[CAIsolatingRunSequencesDataGetCharacterIndex(sequenceData, sequenceIndex, formerIndexInSequence)];
-                                if(CABidiClassifyCategoryForType(firstStrongType) == CABidiCategoryStrong || firstStrongType == CABidiTypeEN || firstStrongType == CABidiTypeAN)
-                                {
-                                    if(firstStrongType != CABidiTypeL)
-                                        firstStrongType = CABidiTypeR;
-                                    break;
-                                }
-                            }
-                            if(formerIndexInSequence < 0)
-                                firstStrongType = sos;
-                            
-                            CABidiLevel sequenceLevel = generator->levelArr[openPairIndexInString];
-                            
-                            if(EmbeddingDirection(sequenceLevel) != firstStrongType)
-                            {
-                                generator->typeArr[openPairIndexInString] = firstStrongType;
-                                generator->typeArr[closePairIndexInString] = firstStrongType;
-                                
-                                for (size_t NSMPairArrIndex = 0; NSMPairArrIndex < nonSpaceMarkAmount; NSMPairArrIndex++)
-                                    if(nonSpaceMarkIndexInSequenceArr[NSMPairArrIndex * 2 + 1] == openPairIndexInSequence)
-                                    {
-                                        size_t NSMIndexInString = CAIsolatingRunSequencesDataGetCharacterIndex(sequenceData, sequenceIndex, NSMPairArrIndex * 2);
-                                        generator->typeArr[NSMIndexInString] = firstStrongType;
-                                        break;
-                                    }
-                                for (size_t NSMPairArrIndex = 0; NSMPairArrIndex < nonSpaceMarkAmount; NSMPairArrIndex++)
-                                    if(nonSpaceMarkIndexInSequenceArr[NSMPairArrIndex * 2 + 1] == closePairIndexInSequence)
-                                    {
-                                        size_t NSMIndexInString = CAIsolatingRunSequencesDataGetCharacterIndex(sequenceData, sequenceIndex, NSMPairArrIndex * 2);
-                                        generator->typeArr[NSMIndexInString] = firstStrongType;
-                                        break;
-                                    }
-                            }
-                            else
-                            {
-                                generator->typeArr[openPairIndexInString] = EmbeddingDirection(sequenceLevel);
-                                generator->typeArr[closePairIndexInString] = EmbeddingDirection(sequenceLevel);
-                                
-                                for (size_t NSMPairArrIndex = 0; NSMPairArrIndex < nonSpaceMarkAmount; NSMPairArrIndex++)
-                                    if(nonSpaceMarkIndexInSequenceArr[NSMPairArrIndex * 2 + 1] == openPairIndexInSequence)
-                                    {
-                                        size_t NSMIndexInString = CAIsolatingRunSequencesDataGetCharacterIndex(sequenceData, sequenceIndex, NSMPairArrIndex * 2);
-                                        generator->typeArr[NSMIndexInString] = EmbeddingDirection(sequenceLevel);
-                                        break;
-                                    }
-                                for (size_t NSMPairArrIndex = 0; NSMPairArrIndex < nonSpaceMarkAmount; NSMPairArrIndex++)
-                                    if(nonSpaceMarkIndexInSequenceArr[NSMPairArrIndex * 2 + 1] == closePairIndexInSequence)
-                                    {
-                                        size_t NSMIndexInString = CAIsolatingRunSequencesDataGetCharacterIndex(sequenceData, sequenceIndex, NSMPairArrIndex * 2);
-                                        generator->typeArr[NSMIndexInString] = EmbeddingDirection(sequenceLevel);
-                                        break;
-                                    }
-                            }
-                        }
-                    }
-                }
-                
-                /* N1 N2 - Unicode Bidirectional Algorithm */
-                /* A sequence of NIs takes the direction of the surrounding strong text if the text on both sides has the same direction */
-                /* European and Arabic numbers act as if they were R in terms of their influence on NIs */
-                for(size_t characterIndexInSequence = 0; characterIndexInSequence < characterAmountInSequence; characterIndexInSequence++)
-                {
-                    size_t currentIndexInString = CAIsolatingRunSequencesDataGetCharacterIndex(sequenceData, sequenceIndex, characterIndexInSequence);
-                    CABidiType currentType = generator->typeArr[currentIndexInString];
-                    
-                    if(isExplicitDirectionalIsolates(currentType) || currentType == CABidiTypePDI || CABidiClassifyCategoryForType(currentType) == CABidiCategoryNeutral || currentType == CABidiTypeBN)
-                    {
-                        bool hasNI = (currentType != CABidiTypeBN);
-                        size_t NIsBeginIndexInSequence = characterAmountInSequence;
-                        size_t NIsEndIndexInSequence = NIsBeginIndexInSequence;
-                        
-                        LOOP
-                        {
-                            if(NIsEndIndexInSequence < characterAmountInSequence - 1)
-                            {
-                                size_t nextIndexInString = CAIsolatingRunSequencesDataGetCharacterIndex(sequenceData, sequenceIndex, NIsEndIndexInSequence);
-                                CABidiType nextType = generator->typeArr[nextIndexInString];
-                                if(isExplicitDirectionalIsolates(nextType) || nextType == CABidiTypePDI || CABidiClassifyCategoryForType(nextType) == CABidiCategoryNeutral || nextType == CABidiTypeBN)
-                                {
-                                    if(nextType != CABidiTypeBN) hasNI = true;
-                                    NIsEndIndexInSequence++;
-                                    continue;
-                                }
-                            }
-                            break;
-                            /* continue point */
-                        }
-                        
-                        if(hasNI)
-                        {
-                            CABidiType leftType;
-                            if(NIsBeginIndexInSequence == 0)
-                                leftType = sos;
-                            else
-                            {
-                                leftType = generator->typeArr[CAIsolatingRunSequencesDataGetCharacterIndex(sequenceData, sequenceIndex, NIsBeginIndexInSequence - 1)];
-                                if(leftType == CABidiTypeEN || leftType == CABidiTypeAN)
-                                    leftType = CABidiTypeR;
-                            }
-                            
-                            CABidiType rightType;
-                            if(NIsEndIndexInSequence == characterAmountInSequence - 1)
-                                rightType = eos;
-                            else
-                            {
-                                rightType = generator->typeArr[CAIsolatingRunSequencesDataGetCharacterIndex(sequenceData, sequenceIndex, NIsEndIndexInSequence + 1)];
-                                if(rightType == CABidiTypeEN || rightType == CABidiTypeAN)
-                                    rightType = CABidiTypeR;
-                            }
-                            
-                            /* security check */
-                            if(CABidiClassifyCategoryForType(leftType) != CABidiCategoryStrong || CABidiClassifyCategoryForType(rightType) != CABidiCategoryStrong)
-                            {
-                                CFExceptionRaise(CFExceptionNameProcessFailed, NULL, "CABLGeneratorProcessPragraphLevel process sequence of NIs failed by left/right type");
-                                if(nonSpaceMarkIndexInSequenceArr != NULL) free(pairsInSequence);
-                                if(pairsInSequence != NULL) free(pairsInSequence);
-                                CAIsolatingRunSequencesDataDestory(sequenceData);
-                                CAMatchingExplictFormatDestory(matchingExplictFormat);
-                            }
-                            
-                            CABidiType takeDirection;
-                            
-                            if(leftType == rightType)
-                                takeDirection = leftType;
-                            else
-                                takeDirection = EmbeddingDirection(generator->levelArr[currentIndexInString]);
-                            
-                            for(size_t NIsCurrentIndexInSequence = NIsBeginIndexInSequence; NIsCurrentIndexInSequence <= NIsEndIndexInSequence; NIsCurrentIndexInSequence++)
-                            {
-                                size_t NIsCurrentIndexInString = CAIsolatingRunSequencesDataGetCharacterIndex(sequenceData, sequenceIndex, NIsCurrentIndexInSequence);
-                                generator->typeArr[NIsCurrentIndexInString] = takeDirection;
-                            }
-                        }
-                        
-                        characterIndexInSequence = NIsEndIndexInSequence;
-                    }
-                }
-                
-                if(nonSpaceMarkIndexInSequenceArr != NULL) free(pairsInSequence);
-                if(pairsInSequence != NULL) free(pairsInSequence);
-            }
             CAIsolatingRunSequencesDataDestory(sequenceData);
+            free(embeddingLevelArr);
         }
         else
         {
+            free(embeddingLevelArr);
             CFExceptionRaise(CFExceptionNameProcessFailed, NULL, "CABLGeneratorProcessPragraphLevel allocate sequenceData failed");
             CAMatchingExplictFormatDestory(matchingExplictFormat);
             return;
         }
         
         CAMatchingExplictFormatDestory(matchingExplictFormat);
+        
+        /* characters removed by X9 take the level of the one before them, so they never split a reversed run */
+        for(size_t index = beginIndex; index <= endIndex; index++)
+            if(generator->typeArr[index] == CABidiTypeBN)
+                generator->levelArr[index] = index == beginIndex ? paragraphLevel : generator->levelArr[index - 1];
     }
     else
     {
         CFExceptionRaise(CFExceptionNameProcessFailed, NULL, "CABLGeneratorProcessPragraphLevel allocate matchingExplictFormat failed");
         return;
     }
+}
+
+#pragma mark Unidirectional paragraph (CABLGeneratorResolveUnidirectionalPragraph)
+
+static bool CABLGeneratorResolveUnidirectionalPragraph(CABLGeneratorRef generator, size_t beginIndex, size_t endIndex)
+{
+    /* without explicit formatting there is a single isolating run sequence at paragraph level, whose sos and eos is the paragraph direction
+     * no R AL AN: paragraph level is 0, W7 turns every EN into L, so N1 resolves every neutral to L and everything stays at level 0
+     * no L EN AN: paragraph level is 1 if anything is strong, and every neutral resolves to R at level 1 */
+    bool hasLeftToRight = false, hasRightToLeft = false, hasNumber = false;
+    for(size_t index = beginIndex; index <= endIndex; index++)
+        switch(generator->typeArr[index])
+        {
+            case CABidiTypeL:
+                hasLeftToRight = true;
+                break;
+            case CABidiTypeR:
+            case CABidiTypeAL:
+                hasRightToLeft = true;
+                break;
+            case CABidiTypeEN:
+                hasNumber = true;
+                break;
+            case CABidiTypeAN:
+                hasRightToLeft = hasNumber = true;
+                break;
+            case CABidiTypeLRE:
+            case CABidiTypeLRO:
+            case CABidiTypeRLE:
+            case CABidiTypeRLO:
+            case CABidiTypePDF:
+            case CABidiTypeLRI:
+            case CABidiTypeRLI:
+            case CABidiTypeFSI:
+            case CABidiTypePDI:
+                return false;
+            default:
+                break;
+        }
+    
+    CABidiLevel level;
+    if(!hasRightToLeft)
+        level = 0;
+    else if(!hasLeftToRight && !hasNumber)
+        level = 1;
+    else
+        return false;
+    
+    for(size_t index = beginIndex; index <= endIndex; index++)
+        generator->levelArr[index] = level;
+    return true;
+}
+
+#pragma mark Isolating run sequence (CABLGeneratorResolveIsolatingRunSequence)
+
+static int CABLGeneratorResolveIsolatingRunSequence(CABLGeneratorRef generator, CAIsolatingRunSequencesDataRef sequenceData, size_t sequenceIndex, size_t beginIndex, size_t endIndex, CABidiLevel paragraphLevel, const CABidiLevel *embeddingLevelArr)
+{
+    size_t characterAmountInSequence = CAIsolatingRunSequencesDataGetCharacterAmountInSequence(sequenceData, sequenceIndex);
+    
+    /* gather characters not removed by X9, so that every rule below could just look at its neighbours */
+    size_t *stringIndexArr;
+    CABidiType *types;
+    if((stringIndexArr = malloc(sizeof(size_t) * characterAmountInSequence)) == NULL)
+        return -1;
+    if((types = malloc(sizeof(CABidiType) * characterAmountInSequence)) == NULL)
+    {
+        free(stringIndexArr);
+        return -1;
+    }
+    size_t amount = 0;
+    for(size_t characterIndexInSequence = 0; characterIndexInSequence < characterAmountInSequence; characterIndexInSequence++)
+    {
+        size_t stringIndex = CAIsolatingRunSequencesDataGetCharacterIndex(sequenceData, sequenceIndex, characterIndexInSequence);
+        if(generator->typeArr[stringIndex] != CABidiTypeBN)
+        {
+            stringIndexArr[amount] = stringIndex;
+            types[amount++] = generator->typeArr[stringIndex];
+        }
+    }
+    if(amount == 0)
+    {
+        free(types);
+        free(stringIndexArr);
+        return 0;
+    }
+    
+    /* resolve SOS & EOS */
+    size_t firstIndex = CAIsolatingRunSequencesDataGetCharacterIndex(sequenceData, sequenceIndex, 0);
+    size_t lastIndex = CAIsolatingRunSequencesDataGetCharacterIndex(sequenceData, sequenceIndex, characterAmountInSequence - 1);
+    CABidiLevel sequenceLevel = generator->levelArr[stringIndexArr[0]];
+    
+    CABidiLevel formerLevel = paragraphLevel;   /* skip over any BNs */
+    for(size_t index = firstIndex; index > beginIndex; index--)
+        if(generator->typeArr[index - 1] != CABidiTypeBN)
+            { formerLevel = embeddingLevelArr[index - 1 - beginIndex]; break; }
+    
+    CABidiLevel latterLevel = paragraphLevel;   /* skip over any BNs, an isolate initiator without matching PDI is followed by paragraph level */
+    if(!isExplicitDirectionalIsolates(CABidiClassifyTypeForCharacter(UTF32StringGetCharAtIndex(generator->string, lastIndex))))
+        for(size_t index = lastIndex + 1; index <= endIndex; index++)
+            if(generator->typeArr[index] != CABidiTypeBN)
+                { latterLevel = embeddingLevelArr[index - beginIndex]; break; }
+    
+    CABidiType sos = EmbeddingDirection(sequenceLevel > formerLevel ? sequenceLevel : formerLevel);
+    CABidiType eos = EmbeddingDirection(sequenceLevel > latterLevel ? sequenceLevel : latterLevel);
+    CABidiType embeddingDirection = EmbeddingDirection(sequenceLevel);
+    
+    /* Resolving Weak Types */
+    
+    /* W1 - Unicode Bidirectional Algorithm */
+    for(size_t index = 0; index < amount; index++)
+        if(types[index] == CABidiTypeNSM)
+        {
+            if(index == 0)
+                types[index] = sos;
+            else if(isExplicitDirectionalIsolates(types[index - 1]) || types[index - 1] == CABidiTypePDI)
+                types[index] = CABidiTypeON;
+            else
+                types[index] = types[index - 1];
+        }
+    
+    /* W2 W3 - Unicode Bidirectional Algorithm */
+    CABidiType lastStrongType = sos;
+    for(size_t index = 0; index < amount; index++)
+    {
+        if(types[index] == CABidiTypeL || types[index] == CABidiTypeR || types[index] == CABidiTypeAL)
+            lastStrongType = types[index];
+        else if(types[index] == CABidiTypeEN && lastStrongType == CABidiTypeAL)
+            types[index] = CABidiTypeAN;
+    }
+    for(size_t index = 0; index < amount; index++)
+        if(types[index] == CABidiTypeAL) types[index] = CABidiTypeR;
+    
+    /* W4 - Unicode Bidirectional Algorithm */
+    for(size_t index = 1; index + 1 < amount; index++)
+    {
+        if(types[index] == CABidiTypeES && types[index - 1] == CABidiTypeEN && types[index + 1] == CABidiTypeEN)
+            types[index] = CABidiTypeEN;
+        else if(types[index] == CABidiTypeCS && types[index - 1] == types[index + 1] && (types[index - 1] == CABidiTypeEN || types[index - 1] == CABidiTypeAN))
+            types[index] = types[index - 1];
+    }
+    
+    /* W5 - Unicode Bidirectional Algorithm */
+    for(size_t index = 0; index < amount; index++)
+        if(types[index] == CABidiTypeET)
+        {
+            size_t terminatorsEndIndex = index;
+            while(terminatorsEndIndex < amount && types[terminatorsEndIndex] == CABidiTypeET) terminatorsEndIndex++;
+            
+            if((index > 0 && types[index - 1] == CABidiTypeEN) || (terminatorsEndIndex < amount && types[terminatorsEndIndex] == CABidiTypeEN))
+                for(size_t terminatorIndex = index; terminatorIndex < terminatorsEndIndex; terminatorIndex++)
+                    types[terminatorIndex] = CABidiTypeEN;
+            
+            index = terminatorsEndIndex - 1;
+        }
+    
+    /* W6 W7 - Unicode Bidirectional Algorithm */
+    lastStrongType = sos;
+    for(size_t index = 0; index < amount; index++)
+    {
+        CABidiType currentType = types[index];
+        if(currentType == CABidiTypeES || currentType == CABidiTypeET || currentType == CABidiTypeCS)
+            types[index] = CABidiTypeON;
+        else if(currentType == CABidiTypeL || currentType == CABidiTypeR)
+            lastStrongType = currentType;
+        else if(currentType == CABidiTypeEN && lastStrongType == CABidiTypeL)
+            types[index] = CABidiTypeL;
+    }
+    
+    /* Resolving Neutral and Isolate Formatting Types */
+    
+    /* N0 - Unicode Bidirectional Algorithm */
+    /* BD16 */
+    pairedBracket *pairs;
+    if((pairs = malloc(sizeof(pairedBracket) * (amount / 2 + 1))) == NULL)
+    {
+        free(types);
+        free(stringIndexArr);
+        return -1;
+    }
+    size_t pairsAmount = 0;
+    tryToPairElement stack[TryToPairBracketStackSize];
+    size_t stackAmount = 0;
+    for(size_t index = 0; index < amount; index++)
+    {
+        if(types[index] != CABidiTypeON) continue;
+        
+        UTF32Char pairedCharacter;
+        UTF32Char currentCharacter = UTF32StringGetCharAtIndex(generator->string, stringIndexArr[index]);
+        CABidiPairedBracketType bracketType = CABidiGetPairedBracketType(currentCharacter, &pairedCharacter);
+        if(bracketType == CABidiPairedBracketTypeOpen)
+        {
+            if(stackAmount == TryToPairBracketStackSize) break;     // stop processing BD16 for the remainder of the sequence
+            stack[stackAmount++] = (tryToPairElement){.pairedCloseCharacter = CanonicalBracket(pairedCharacter), .index = index};
+        }
+        else if(bracketType == CABidiPairedBracketTypeClose)
+        {
+            currentCharacter = CanonicalBracket(currentCharacter);
+            for(size_t stackIndex = stackAmount; stackIndex > 0; stackIndex--)
+                if(stack[stackIndex - 1].pairedCloseCharacter == currentCharacter)
+                {
+                    pairs[pairsAmount++] = (pairedBracket){.openIndex = stack[stackIndex - 1].index, .closeIndex = index};
+                    stackAmount = stackIndex - 1;
+                    break;
+                }
+        }
+    }
+    
+    /* sort pairs by the position of opening bracket, pairs are found in order of closing bracket */
+    for(size_t pairIndex = 1; pairIndex < pairsAmount; pairIndex++)
+    {
+        pairedBracket currentPair = pairs[pairIndex];
+        size_t insertIndex = pairIndex;
+        while(insertIndex > 0 && pairs[insertIndex - 1].openIndex > currentPair.openIndex)
+            { pairs[insertIndex] = pairs[insertIndex - 1]; insertIndex--; }
+        pairs[insertIndex] = currentPair;
+    }
+    
+    for(size_t pairIndex = 0; pairIndex < pairsAmount; pairIndex++)
+    {
+        size_t openIndex = pairs[pairIndex].openIndex, closeIndex = pairs[pairIndex].closeIndex;
+        
+        bool foundEmbedding = false, foundOpposite = false;
+        for(size_t index = openIndex + 1; index < closeIndex && !foundEmbedding; index++)
+            if(types[index] == CABidiTypeL || types[index] == CABidiTypeR || types[index] == CABidiTypeEN || types[index] == CABidiTypeAN)
+            {
+                if(StrongDirection(types[index]) == embeddingDirection)
+                    foundEmbedding = true;
+                else
+                    foundOpposite = true;
+            }
+        
+        CABidiType takeDirection;
+        if(foundEmbedding)
+            takeDirection = embeddingDirection;
+        else if(foundOpposite)
+        {
+            CABidiType precedingType = sos;
+            for(size_t index = openIndex; index > 0; index--)
+                if(types[index - 1] == CABidiTypeL || types[index - 1] == CABidiTypeR || types[index - 1] == CABidiTypeEN || types[index - 1] == CABidiTypeAN)
+                    { precedingType = StrongDirection(types[index - 1]); break; }
+            takeDirection = precedingType != embeddingDirection ? precedingType : embeddingDirection;
+        }
+        else
+            continue;
+        
+        types[openIndex] = types[closeIndex] = takeDirection;
+        
+        /* non-spacing marks following a bracket changed by N0 take its type */
+        size_t bracketIndexArr[2] = {openIndex, closeIndex};
+        for(size_t bracketIndex = 0; bracketIndex < 2; bracketIndex++)
+            for(size_t index = bracketIndexArr[bracketIndex] + 1;
+                index < amount && CABidiClassifyTypeForCharacter(UTF32StringGetCharAtIndex(generator->string, stringIndexArr[index])) == CABidiTypeNSM;
+                index++)
+                types[index] = takeDirection;
+    }
+    free(pairs);
+    
+    /* N1 N2 - Unicode Bidirectional Algorithm */
+    for(size_t index = 0; index < amount; index++)
+        if(isNeutralOrIsolate(types[index]))
+        {
+            size_t NIsEndIndex = index;
+            while(NIsEndIndex < amount && isNeutralOrIsolate(types[NIsEndIndex])) NIsEndIndex++;
+            
+            CABidiType leftType = index == 0 ? sos : StrongDirection(types[index - 1]);
+            CABidiType rightType = NIsEndIndex == amount ? eos : StrongDirection(types[NIsEndIndex]);
+            CABidiType takeDirection = leftType == rightType ? leftType : embeddingDirection;
+            
+            for(size_t NIsIndex = index; NIsIndex < NIsEndIndex; NIsIndex++)
+                types[NIsIndex] = takeDirection;
+            
+            index = NIsEndIndex - 1;
+        }
     
     /* Resolving Implicit Levels */
     
     /* I1 I2 - Unicode Bidirectional Algorithm */
     /* it is possible for text to end up at level max_depth+1 as a result of this process */
-    for(size_t currentIndex = beginIndex; currentIndex <= endIndex; currentIndex++)
+    for(size_t index = 0; index < amount; index++)
     {
-        CABidiType currentType = generator->typeArr[currentIndex];
-        CABidiLevel currentLevel = generator->levelArr[currentIndex];
+        size_t stringIndex = stringIndexArr[index];
+        CABidiType currentType = types[index];
         
-        if(currentLevel % 2 == 0)
+        generator->typeArr[stringIndex] = currentType;
+        if(generator->levelArr[stringIndex] % 2 == 0)
         {
             /* even */
             if(currentType == CABidiTypeR)
-                generator->levelArr[currentIndex]++;
+                generator->levelArr[stringIndex]++;
             else if(currentType == CABidiTypeEN || currentType == CABidiTypeAN)
-                generator->levelArr[currentIndex] += 2;
+                generator->levelArr[stringIndex] += 2;
         }
         else
         {
             /* odd */
-            if(currentType == CABidiTypeR || currentType == CABidiTypeEN || currentType == CABidiTypeAN)
-                generator->levelArr[currentIndex]++;
+            if(currentType == CABidiTypeL || currentType == CABidiTypeEN || currentType == CABidiTypeAN)
+                generator->levelArr[stringIndex]++;
         }
     }
+    
+    free(types);
+    free(stringIndexArr);
+    return 0;
 }
 
 size_t *CABLGeneratorDisplayLine(CABLGeneratorRef generator, CFRange paragraphRange, CFRange lineRange)
+{
+    return CABLGeneratorDisplayLineWithCharacters(generator, paragraphRange, lineRange, NULL);
+}
+
+size_t *CABLGeneratorDisplayLineWithCharacters(CABLGeneratorRef generator, CFRange paragraphRange, CFRange lineRange, UTF32Char *characters)
 {
     if(generator != NULL &&
        paragraphRange.length > 0 &&
@@ -1137,7 +850,7 @@ size_t *CABLGeneratorDisplayLine(CABLGeneratorRef generator, CFRange paragraphRa
         CABidiLevel *lineLevel;
         if((lineLevel = malloc(sizeof(CABidiLevel) * lineLength)) != NULL)
         {
-            memcpy(lineLevel, generator->typeArr + lineRange.location, sizeof(CABidiLevel) * lineLength);
+            memcpy(lineLevel, generator->levelArr + lineRange.location, sizeof(CABidiLevel) * lineLength);
             
             /* L1 - Unicode Bidirectional Algorithm */
             for (size_t currentLineIndex = 0; currentLineIndex < lineLength; currentLineIndex++)
@@ -1163,7 +876,7 @@ size_t *CABLGeneratorDisplayLine(CABLGeneratorRef generator, CFRange paragraphRa
                     {
                         if(sequencesEndIndex == lineLength - 1)
                             break;
-                        UTF32Char nextCharacter = UTF32StringGetCharAtIndex(generator->string, sequencesEndIndex + 1);
+                        UTF32Char nextCharacter = UTF32StringGetCharAtIndex(generator->string, sequencesEndIndex + 1 + lineIndexPlusToStringIndex);
                         nextType = CABidiClassifyTypeForCharacter(nextCharacter);
                         if(isExplicitDirectionalIsolates(nextType) || nextType == CABidiTypePDI || isExplicitDirectionalEmbeddings(nextType) || nextType == CABidiTypePDF || nextType == CABidiTypeBN || nextType == CABidiTypeWS)
                             sequencesEndIndex++;
@@ -1189,7 +902,7 @@ size_t *CABLGeneratorDisplayLine(CABLGeneratorRef generator, CFRange paragraphRa
                 
                 CABidiLevel leastLevel = max_depth + 1;
                 for(size_t lineIndex = 0; lineIndex < lineLength; lineIndex++)
-                    if(lineLevel[lineIndex] < highestLevel) leastLevel = lineLevel[lineIndex];
+                    if(lineLevel[lineIndex] < leastLevel) leastLevel = lineLevel[lineIndex];
                 
                 CABidiLevel leastOddLevel;
                 if(leastLevel % 2 == 0)
@@ -1222,7 +935,7 @@ size_t *CABLGeneratorDisplayLine(CABLGeneratorRef generator, CFRange paragraphRa
                             }
                             
                             size_t sequenceLength = sequenceEndIndexInLine - sequenceBeginIndexInLine + 1;
-                            for(size_t reverseIndex = sequenceBeginIndexInLine; reverseIndex <= sequenceLength / 2; reverseIndex++)
+                            for(size_t reverseIndex = sequenceBeginIndexInLine; reverseIndex < sequenceBeginIndexInLine + sequenceLength / 2; reverseIndex++)
                             {
                                 size_t temp = result[reverseIndex];
                                 result[reverseIndex] = result[sequenceEndIndexInLine - (reverseIndex - sequenceBeginIndexInLine)];
@@ -1232,13 +945,60 @@ size_t *CABLGeneratorDisplayLine(CABLGeneratorRef generator, CFRange paragraphRa
                             lineIndex = sequenceEndIndexInLine;
                         }
                 
-                free(lineLevel);
-                
                 /* L3 - Unicode Bidirectional Algorithm */
-#warning lack of Combining mark process
-                
-                /* L4 - Unicode Bidirectional Algorithm */
-#warning lack of mirror process
+                /* a grapheme cluster inside a reversed run is put back in logical order, so that combining marks follow their base */
+                CAGraphemeBreakIteratorRef iterator;
+                if((iterator = CAGraphemeBreakIteratorCreate(generator->string)) == NULL)
+                {
+                    free(result);
+                    free(lineLevel);
+                    return NULL;
+                }
+                for(size_t lineIndex = 0; lineIndex < lineLength; lineIndex++)
+                {
+                    size_t reversedEndIndexInLine = lineIndex;
+                    while(reversedEndIndexInLine + 1 < lineLength && result[reversedEndIndexInLine + 1] + 1 == result[reversedEndIndexInLine])
+                        reversedEndIndexInLine++;
+                    
+                    if(reversedEndIndexInLine > lineIndex)
+                    {
+                        size_t highestStringIndex = result[lineIndex], lowestStringIndex = result[reversedEndIndexInLine];
+                        CAGraphemeBreakIteratorSetLocation(iterator, lowestStringIndex);
+                        LOOP
+                        {
+                            CFRange cluster = CAGraphemeBreakIteratorNext(iterator);
+                            if(cluster.length == 0 || cluster.location > highestStringIndex) break;
+                            
+                            size_t clusterBeginIndex = cluster.location < lowestStringIndex ? lowestStringIndex : cluster.location;
+                            size_t clusterEndIndex = CFMaxRange(cluster) - 1 > highestStringIndex ? highestStringIndex : CFMaxRange(cluster) - 1;
+                            
+                            /* string index x is displayed at lineIndex + highestStringIndex - x within this run */
+                            for(size_t swapBeginIndex = lineIndex + highestStringIndex - clusterEndIndex, swapEndIndex = lineIndex + highestStringIndex - clusterBeginIndex;
+                                swapBeginIndex < swapEndIndex;
+                                swapBeginIndex++, swapEndIndex--)
+                            {
+                                size_t temp = result[swapBeginIndex];
+                                result[swapBeginIndex] = result[swapEndIndex];
+                                result[swapEndIndex] = temp;
+                            }
+                        }
+                    }
+                    
+                    /* L4 - Unicode Bidirectional Algorithm */
+                    /* positions up to reversedEndIndexInLine are final, so the characters are written in the same pass */
+                    if(characters != NULL)
+                        for(size_t displayIndex = lineIndex; displayIndex <= reversedEndIndexInLine; displayIndex++)
+                        {
+                            UTF32Char currentCharacter = UTF32StringGetCharAtIndex(generator->string, result[displayIndex]);
+                            if(lineLevel[result[displayIndex] - lineIndexPlusToStringIndex] % 2 == 1)
+                                CABidiGetMirroredCharacter(currentCharacter, &currentCharacter);
+                            characters[displayIndex] = currentCharacter;
+                        }
+                    
+                    lineIndex = reversedEndIndexInLine;
+                }
+                CAGraphemeBreakIteratorDestory(iterator);
+                free(lineLevel);
                 
                 return result;
             }
@@ -1250,32 +1010,25 @@ size_t *CABLGeneratorDisplayLine(CABLGeneratorRef generator, CFRange paragraphRa
 
 static CABidiLevel CABLGeneratorResolvePragraphEmbeddingLevel(CABLGeneratorRef generator, size_t beginIndex, size_t endIndex)
 {
-    CAMatchingExplictFormatRef matchingExplictFormat;
-    if((matchingExplictFormat = CABLGeneratorResolveMatchingExplictFormat(generator, beginIndex, endIndex)) != NULL)
+    /* P2 P3 - Unicode Bidirectional Algorithm */
+    /* typeArr is resolved already, so classify again, characters between an isolate initiator and its matching PDI are skipped */
+    size_t isolateDepth = 0;
+    for(size_t index = beginIndex; index <= endIndex; index++)
     {
-        /* resolve paragraph level */
-        
-        CABidiLevel paragraphLevel = 0;
-        for(size_t index = beginIndex; index <= endIndex; index++)
+        CABidiType currentType = CABidiClassifyTypeForCharacter(UTF32StringGetCharAtIndex(generator->string, index));
+        if(isExplicitDirectionalIsolates(currentType))
+            isolateDepth++;
+        else if(currentType == CABidiTypePDI)
         {
-            CABidiType currentType = CABidiClassifyTypeForCharacter(UTF32StringGetCharAtIndex(generator->string, index));
-            if(currentType == CABidiTypeAL || currentType == CABidiTypeR)
-            { paragraphLevel = 1; break; }
-            else if(isExplicitDirectionalIsolates(currentType))
-            {
-                size_t matchingPDIIndex;
-                if(CAMatchingExplictFormatLocateMatchingPDI(matchingExplictFormat, index, &matchingPDIIndex))
-                    index = matchingPDIIndex;   // not plus 1, consider about it
-                else
-                    index = endIndex;
-            }
+            if(isolateDepth > 0) isolateDepth--;
+        }
+        else if(isolateDepth == 0)
+        {
+            if(currentType == CABidiTypeL)
+                return 0;
+            else if(currentType == CABidiTypeAL || currentType == CABidiTypeR)
+                return 1;
         }
-        CAMatchingExplictFormatDestory(matchingExplictFormat);
-        return paragraphLevel;
-    }
-    else
-    {
-        CFExceptionRaise(CFExceptionNameProcessFailed, NULL, "CABLGeneratorResolvePragraphEmbeddingLevel create matchingExplictFormat failed");
     }
     return 0;
 }
@@ -1332,6 +1085,16 @@ CFRange CABLGeneratorGetParagraphRange(CABLGeneratorRef generator, size_t paragr
     return CFRangeNotFound;
 }
 
+UTF32StringRef CABLGeneratorGetString(CABLGeneratorRef generator)
+{
+    if(generator == NULL)
+    {
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CABLGeneratorGetString NULL");
+        return NULL;
+    }
+    return generator->string;
+}
+
 void CABLGeneratorDestory(CABLGeneratorRef generator)
 {
     if(generator == NULL) return;
@@ -1374,10 +1137,10 @@ static CAIsolatingRunSequencesDataRef CAIsolatingRunSequencesDataCreate(CABLGene
         do
         {
             levelRunEndIndex = levelRunBeginIndex;
-            while (generator->levelArr[levelRunEndIndex + 1] == generator->levelArr[levelRunEndIndex])
+            while (levelRunEndIndex < endIndex && generator->levelArr[levelRunEndIndex + 1] == generator->levelArr[levelRunEndIndex])
                 levelRunEndIndex++;
             
-            if(!CAMatchingExplictFormatLocateMatchingIsolateInitializer(matching, levelRunEndIndex, NULL))
+            if(!CAMatchingExplictFormatLocateMatchingIsolateInitializer(matching, levelRunBeginIndex, NULL))
                 result->amount++;
             
             levelRunBeginIndex = levelRunEndIndex + 1;
@@ -1397,7 +1160,7 @@ static CAIsolatingRunSequencesDataRef CAIsolatingRunSequencesDataCreate(CABLGene
                 while (levelRunEndIndex<endIndex && generator->levelArr[levelRunEndIndex + 1] == generator->levelArr[levelRunEndIndex])
                     levelRunEndIndex++;
                 
-                if(!CAMatchingExplictFormatLocateMatchingIsolateInitializer(matching, levelRunEndIndex, NULL))
+                if(!CAMatchingExplictFormatLocateMatchingIsolateInitializer(matching, levelRunBeginIndex, NULL))
                 {
                     result->isolatingRunSequenceArr[sequenceArrIndex].amount = 1;
                     
@@ -1623,7 +1386,7 @@ static CAMatchingExplictFormatRef CABLGeneratorResolveMatchingExplictFormat(CABL
                         {
                             if(result->matchingPDIArrAllocatedSize - result->matchingPDIArrLength < 2)
                             {
-                                size_t *temp = realloc(result->matchingPDIArr, sizeof(size_t) * result->matchingPDIArrAllocatedSize + CAMatchingExplictFormatIncreasedArraySize);
+                                size_t *temp = realloc(result->matchingPDIArr, sizeof(size_t) * (result->matchingPDIArrAllocatedSize + CAMatchingExplictFormatIncreasedArraySize));
                                 if(temp != NULL)
                                 {
                                     result->matchingPDIArr = temp;
@@ -1648,7 +1411,7 @@ static CAMatchingExplictFormatRef CABLGeneratorResolveMatchingExplictFormat(CABL
                         {
                             if(result->matchingPDFArrAllocatedSize - result->matchingPDFArrLength < 2)
                             {
-                                size_t *temp = realloc(result->matchingPDFArr, sizeof(size_t) * result->matchingPDFArrAllocatedSize + CAMatchingExplictFormatIncreasedArraySize);
+                                size_t *temp = realloc(result->matchingPDFArr, sizeof(size_t) * (result->matchingPDFArrAllocatedSize + CAMatchingExplictFormatIncreasedArraySize));
                                 if(temp != NULL)
                                 {
                                     result->matchingPDFArr = temp;
@@ -42,8 +42,21 @@ CFRange CABLGeneratorGetParagraphRange(CABLGeneratorRef generator, size_t paragr
  */
 size_t *CABLGeneratorDisplayLine(CABLGeneratorRef generator, CFRange paragraphRange, CFRange lineRange);
 
+/**
+ Same as CABLGeneratorDisplayLine, and also give the character to draw at each display position
+ Characters resolved as right to left are replaced by their mirrored glyph (L4), such as '(' to ')'
+ @param characters if not NULL, it should hold the length of lineRange, filled in display order while the line is reordered
+ @return the same as CABLGeneratorDisplayLine, characters is untouched if NULL returned
+ */
+size_t *CABLGeneratorDisplayLineWithCharacters(CABLGeneratorRef generator, CFRange paragraphRange, CFRange lineRange, UTF32Char *characters);
+
 #pragma mark - Additional ask for internal information
 
+/**
+ The string the generator resolved, it is a copy owned by generator, do not destory it
+ */
+UTF32StringRef CABLGeneratorGetString(CABLGeneratorRef generator);
+
 void CABLGeneratorDestory(CABLGeneratorRef generator);
 
 #endif /* CABLGenerator_h */
@@ -0,0 +1,261 @@
+//
+//  CABLGeneratorCache.c
+//  TextKit
+//
+//  Created by Bill Sun on 2018/11/5.
+//  Copyright © 2018 Bill Sun. All rights reserved.
+//
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "CABLGeneratorCache.h"
+#include "CFException.h"
+
+#define CABLGeneratorCacheNone SIZE_MAX
+
+typedef struct CABLGeneratorCacheLine {
+    CFRange paragraphRange;
+    CFRange lineRange;
+    size_t *order;
+    struct CABLGeneratorCacheLine *next;
+} CABLGeneratorCacheLine;
+
+typedef struct CABLGeneratorCacheEntry {
+    size_t hash;
+    CABLGeneratorRef generator;
+    size_t bucketNext;                      // next entry in the same bucket, CABLGeneratorCacheNone ends
+    size_t newer, older;                    // recently used list, CABLGeneratorCacheNone ends
+    CABLGeneratorCacheLine *lines;          // display orders already queried
+} CABLGeneratorCacheEntry;
+
+struct CABLGeneratorCache {
+    size_t capacity;
+    size_t amount;                          // entries below amount are in use, they are never freed until destory
+    size_t bucketMask;                      // bucket amount is a power of 2, no less than capacity
+    size_t *buckets;                        // first entry of each bucket
+    size_t newest, oldest;
+    CABLGeneratorCacheEntry *entries;
+};
+
+static size_t CABLGeneratorCacheHash(UTF32StringRef string);
+static size_t CABLGeneratorCacheFindEntry(CABLGeneratorCacheRef cache, UTF32StringRef string, size_t hash);
+static void CABLGeneratorCacheUnlinkEntry(CABLGeneratorCacheRef cache, size_t entryIndex);
+static void CABLGeneratorCacheLinkNewestEntry(CABLGeneratorCacheRef cache, size_t entryIndex);
+static void CABLGeneratorCacheEvictEntry(CABLGeneratorCacheRef cache, size_t entryIndex);
+
+#pragma mark - Create / Destory
+
+CABLGeneratorCacheRef CABLGeneratorCacheCreate(size_t capacity)
+{
+    if(capacity == 0 || capacity > SIZE_MAX / 2)
+        return NULL;
+    size_t bucketAmount = 1;
+    while(bucketAmount < capacity) bucketAmount *= 2;
+
+    CABLGeneratorCacheRef result;
+    if((result = malloc(sizeof(struct CABLGeneratorCache))) != NULL)
+    {
+        if((result->buckets = malloc(sizeof(size_t) * bucketAmount)) != NULL)
+        {
+            if((result->entries = malloc(sizeof(CABLGeneratorCacheEntry) * capacity)) != NULL)
+            {
+                for(size_t bucketIndex = 0; bucketIndex < bucketAmount; bucketIndex++)
+                    result->buckets[bucketIndex] = CABLGeneratorCacheNone;
+                result->capacity = capacity;
+                result->amount = 0;
+                result->bucketMask = bucketAmount - 1;
+                result->newest = result->oldest = CABLGeneratorCacheNone;
+                return result;
+            }
+            free(result->buckets);
+        }
+        free(result);
+    }
+    return NULL;
+}
+
+void CABLGeneratorCacheDestory(CABLGeneratorCacheRef cache)
+{
+    if(cache == NULL) return;
+    for(size_t entryIndex = 0; entryIndex < cache->amount; entryIndex++)
+    {
+        CABLGeneratorCacheLine *line = cache->entries[entryIndex].lines;
+        while(line != NULL)
+        {
+            CABLGeneratorCacheLine *next = line->next;
+            free(line->order);
+            free(line);
+            line = next;
+        }
+        CABLGeneratorDestory(cache->entries[entryIndex].generator);
+    }
+    free(cache->entries);
+    free(cache->buckets);
+    free(cache);
+}
+
+#pragma mark - Query
+
+CABLGeneratorRef CABLGeneratorCacheGetGenerator(CABLGeneratorCacheRef cache, UTF32StringRef string)
+{
+    if(cache == NULL || string == NULL)
+    {
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CABLGeneratorCacheGetGenerator %p %p", cache, string);
+        return NULL;
+    }
+    if(UTF32StringGetLength(string) == 0)
+        return NULL;
+
+    size_t hash = CABLGeneratorCacheHash(string);
+    size_t entryIndex = CABLGeneratorCacheFindEntry(cache, string, hash);
+    if(entryIndex != CABLGeneratorCacheNone)
+    {
+        CABLGeneratorCacheUnlinkEntry(cache, entryIndex);
+        CABLGeneratorCacheLinkNewestEntry(cache, entryIndex);
+        return cache->entries[entryIndex].generator;
+    }
+
+    CABLGeneratorRef generator;
+    if((generator = CABLGeneratorCreateWithString(string)) == NULL)
+        return NULL;
+
+    if(cache->amount < cache->capacity)
+        entryIndex = cache->amount++;
+    else
+    {
+        entryIndex = cache->oldest;
+        CABLGeneratorCacheEvictEntry(cache, entryIndex);
+    }
+
+    CABLGeneratorCacheEntry *entry = &cache->entries[entryIndex];
+    entry->hash = hash;
+    entry->generator = generator;
+    entry->lines = NULL;
+    entry->bucketNext = cache->buckets[hash & cache->bucketMask];
+    cache->buckets[hash & cache->bucketMask] = entryIndex;
+    CABLGeneratorCacheLinkNewestEntry(cache, entryIndex);
+    return generator;
+}
+
+const size_t *CABLGeneratorCacheDisplayLine(CABLGeneratorCacheRef cache, CABLGeneratorRef generator, CFRange paragraphRange, CFRange lineRange)
+{
+    if(cache == NULL || generator == NULL)
+    {
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CABLGeneratorCacheDisplayLine %p %p", cache, generator);
+        return NULL;
+    }
+
+    // the generator is usually the one just got
+    size_t entryIndex = cache->newest;
+    if(entryIndex == CABLGeneratorCacheNone || cache->entries[entryIndex].generator != generator)
+    {
+        UTF32StringRef string = CABLGeneratorGetString(generator);
+        entryIndex = CABLGeneratorCacheFindEntry(cache, string, CABLGeneratorCacheHash(string));
+        if(entryIndex == CABLGeneratorCacheNone || cache->entries[entryIndex].generator != generator)
+            return NULL;
+    }
+
+    CABLGeneratorCacheEntry *entry = &cache->entries[entryIndex];
+    for(CABLGeneratorCacheLine *line = entry->lines; line != NULL; line = line->next)
+        if(line->paragraphRange.location == paragraphRange.location && line->paragraphRange.length == paragraphRange.length &&
+           line->lineRange.location == lineRange.location && line->lineRange.length == lineRange.length)
+            return line->order;
+
+    size_t *order;
+    if((order = CABLGeneratorDisplayLine(generator, paragraphRange, lineRange)) != NULL)
+    {
+        CABLGeneratorCacheLine *line;
+        if((line = malloc(sizeof(CABLGeneratorCacheLine))) != NULL)
+        {
+            line->paragraphRange = paragraphRange;
+            line->lineRange = lineRange;
+            line->order = order;
+            line->next = entry->lines;
+            entry->lines = line;
+            return order;
+        }
+        free(order);
+    }
+    return NULL;
+}
+
+size_t CABLGeneratorCacheGetAmount(CABLGeneratorCacheRef cache)
+{
+    if(cache == NULL)
+    {
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CABLGeneratorCacheGetAmount NULL");
+        return 0;
+    }
+    return cache->amount;
+}
+
+#pragma mark - Internal
+
+static size_t CABLGeneratorCacheHash(UTF32StringRef string)
+{
+    // FNV-1a over each character
+    const UTF32Char *characters = UTF32StringGetCharacterArray(string);
+    size_t length = UTF32StringGetLength(string);
+    size_t hash = (size_t)2166136261u;
+    for(size_t index = 0; index < length; index++)
+    {
+        hash ^= (size_t)characters[index];
+        hash *= (size_t)16777619u;
+    }
+    return hash;
+}
+
+static size_t CABLGeneratorCacheFindEntry(CABLGeneratorCacheRef cache, UTF32StringRef string, size_t hash)
+{
+    size_t length = UTF32StringGetLength(string);
+    for(size_t entryIndex = cache->buckets[hash & cache->bucketMask]; entryIndex != CABLGeneratorCacheNone; entryIndex = cache->entries[entryIndex].bucketNext)
+    {
+        if(cache->entries[entryIndex].hash != hash) continue;
+        UTF32StringRef cachedString = CABLGeneratorGetString(cache->entries[entryIndex].generator);
+        if(UTF32StringGetLength(cachedString) == length &&
+           memcmp(UTF32StringGetCharacterArray(cachedString), UTF32StringGetCharacterArray(string), sizeof(UTF32Char) * length) == 0)
+            return entryIndex;
+    }
+    return CABLGeneratorCacheNone;
+}
+
+static void CABLGeneratorCacheUnlinkEntry(CABLGeneratorCacheRef cache, size_t entryIndex)
+{
+    CABLGeneratorCacheEntry *entry = &cache->entries[entryIndex];
+    if(entry->newer != CABLGeneratorCacheNone) cache->entries[entry->newer].older = entry->older;
+    else cache->newest = entry->older;
+    if(entry->older != CABLGeneratorCacheNone) cache->entries[entry->older].newer = entry->newer;
+    else cache->oldest = entry->newer;
+}
+
+static void CABLGeneratorCacheLinkNewestEntry(CABLGeneratorCacheRef cache, size_t entryIndex)
+{
+    CABLGeneratorCacheEntry *entry = &cache->entries[entryIndex];
+    entry->newer = CABLGeneratorCacheNone;
+    entry->older = cache->newest;
+    if(cache->newest != CABLGeneratorCacheNone) cache->entries[cache->newest].newer = entryIndex;
+    else cache->oldest = entryIndex;
+    cache->newest = entryIndex;
+}
+
+static void CABLGeneratorCacheEvictEntry(CABLGeneratorCacheRef cache, size_t entryIndex)
+{
+    // unlink from both lists and free what it holds, the entry itself is reused by the caller
+    CABLGeneratorCacheEntry *entry = &cache->entries[entryIndex];
+    size_t *position = &cache->buckets[entry->hash & cache->bucketMask];
+    while(*position != entryIndex) position = &cache->entries[*position].bucketNext;
+    *position = entry->bucketNext;
+    CABLGeneratorCacheUnlinkEntry(cache, entryIndex);
+
+    CABLGeneratorCacheLine *line = entry->lines;
+    while(line != NULL)
+    {
+        CABLGeneratorCacheLine *next = line->next;
+        free(line->order);
+        free(line);
+        line = next;
+    }
+    CABLGeneratorDestory(entry->generator);
+}
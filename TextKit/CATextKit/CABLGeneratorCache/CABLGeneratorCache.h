@@ -0,0 +1,57 @@
+//
+//  CABLGeneratorCache.h
+//  TextKit
+//
+//  Created by Bill Sun on 2018/11/5.
+//  Copyright © 2018 Bill Sun. All rights reserved.
+//
+
+#ifndef CABLGeneratorCache_h
+#define CABLGeneratorCache_h
+
+#include <stddef.h>
+
+#include "CFType.h"
+#include "UTF32String.h"
+#include "CABLGenerator.h"
+
+typedef struct CABLGeneratorCache *CABLGeneratorCacheRef;
+
+#pragma mark - Create / Destory
+
+/**
+ Create an empty cache, generators of the same string content are resolved only once while they stay in it
+
+ @param capacity the most generators kept, the least recently used one is destoryed for a new string when full
+ @return NULL if capacity is zero or out of memory
+ */
+CABLGeneratorCacheRef CABLGeneratorCacheCreate(size_t capacity);
+
+/**
+ Destory the cache with every generator and display order in it
+ */
+void CABLGeneratorCacheDestory(CABLGeneratorCacheRef cache);
+
+#pragma mark - Query
+
+/**
+ Get the generator resolved from string, it is created by CABLGeneratorCreateWithString on the first query of the content
+
+ @param string it is not kept, the generator holds its own copy
+ @return owned by cache, do not destory it, it stays valid until a later CABLGeneratorCacheGetGenerator evicts it,
+         NULL if string is empty or out of memory
+ */
+CABLGeneratorRef CABLGeneratorCacheGetGenerator(CABLGeneratorCacheRef cache, UTF32StringRef string);
+
+/**
+ The same as CABLGeneratorDisplayLine, a line already reordered is returned without reordering again
+
+ @param generator got by CABLGeneratorCacheGetGenerator of the same cache
+ @return owned by cache together with generator, do not free it, NULL in the cases CABLGeneratorDisplayLine does,
+         or if generator is not in cache
+ */
+const size_t *CABLGeneratorCacheDisplayLine(CABLGeneratorCacheRef cache, CABLGeneratorRef generator, CFRange paragraphRange, CFRange lineRange);
+
+size_t CABLGeneratorCacheGetAmount(CABLGeneratorCacheRef cache);
+
+#endif /* CABLGeneratorCache_h */
@@ -25,7 +25,7 @@ static CABidiRange *CABidiTypeDatabase = NULL;  /* if database loaded, this is n
 static unsigned long databaseSize = 0lu;
 
 static void CABidiClassifyLoadDefaultDatabase(void);
-static void CABidiClassifyLoadDatabaseFromString(const char *string);
+static void CABidiClassifyLoadDatabaseFromString(const char *string, bool unassignedOnly);
 static void CABidiClassifyUnloadDatabase(void);
 static CABidiRange *CABidiClassifyFindRangeForCharacter(UTF32Char ch);
 
@@ -1322,7 +1322,10 @@ static const char *default_derivedBidiClass =
 "2066          ; LRI\n"
 "2067          ; RLI\n"
 "2068          ; FSI\n"
-"2069          ; PDI\n"
+"2069          ; PDI\n";
+
+/* loaded after the assigned ones, only fill the code points not assigned yet */
+static const char *default_unassignedBidiClass =
 
 /* unassigned code point for AL */
 "0600..06FF    ; AL\n"      // Arabic
@@ -1367,23 +1370,24 @@ static unsigned long databaseAllocatedSize = 0lu;
 static CABidiType CABidiClassifyTypeFromString(const char *string);
 static void CABidiClassifyInsertRangeIntoDatabase(CABidiRange range);
 static int CABidiRangeCompareCharacter(UTF32Char ch, CABidiRange range);
-static void CABidiClassifyAddRangeFromString(const char *rangeString);
+static void CABidiClassifyInsertRangeIntoGaps(CABidiRange range);
+static void CABidiClassifyAddRangeFromString(const char *rangeString, bool unassignedOnly);
 
 static void CABidiClassifyLoadDefaultDatabase(void)
 {
-    CABidiClassifyLoadDatabaseFromString(default_derivedBidiClass);
+    CABidiClassifyLoadDatabaseFromString(default_derivedBidiClass, false);
+    CABidiClassifyLoadDatabaseFromString(default_unassignedBidiClass, true);
 }
 
-static void CABidiClassifyLoadDatabaseFromString(const char *string)
+static void CABidiClassifyLoadDatabaseFromString(const char *string, bool unassignedOnly)
 {
     const char *current = string;
-    do
+    while(*current != '\0')
     {
-        CABidiClassifyAddRangeFromString(current);
-        do current++; while(*current!='\n' && *current!='\0');
+        CABidiClassifyAddRangeFromString(current, unassignedOnly);
+        while(*current != '\n' && *current != '\0') current++;
         if(*current == '\n') current++;
-        else break;
-    }while (1);
+    }
 }
 
 #pragma clang diagnostic push
@@ -1403,13 +1407,13 @@ static void CABidiClassifyUnloadDatabase(void)
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wformat"
 
-static void CABidiClassifyAddRangeFromString(const char *rangeString)
+static void CABidiClassifyAddRangeFromString(const char *rangeString, bool unassignedOnly)
 {
     UTF32Char from, to;
     char typeString[MaxBidiClassTypeLength + 1];
     CABidiType type;
     bool valid = false;
-    if(sscanf(rangeString, "%"UTF32CharSCNx".."UTF32CharSCNx" ; %" Stringlization(MaxBidiClassTypeLength) "s", &from, &to, typeString) == 3)
+    if(sscanf(rangeString, "%"UTF32CharSCNx"..%"UTF32CharSCNx" ; %" Stringlization(MaxBidiClassTypeLength) "s", &from, &to, typeString) == 3)
         valid = true;
     else if(sscanf(rangeString, "%"UTF32CharSCNx" ; %" Stringlization(MaxBidiClassTypeLength) "s", &from, typeString) == 2)
     {
@@ -1421,7 +1425,10 @@ static void CABidiClassifyAddRangeFromString(const char *rangeString)
         type = CABidiClassifyTypeFromString(typeString);
         CABidiRange range = {.type = type, .from = from, .to = to};
         
-        CABidiClassifyInsertRangeIntoDatabase(range);
+        if(unassignedOnly)
+            CABidiClassifyInsertRangeIntoGaps(range);
+        else
+            CABidiClassifyInsertRangeIntoDatabase(range);
     }
 }
 
@@ -1479,6 +1486,35 @@ static void CABidiClassifyInsertRangeIntoDatabase(CABidiRange range)
     }
 }
 
+static void CABidiClassifyInsertRangeIntoGaps(CABidiRange range)
+{
+    UTF32Char from = range.from;
+    LOOP
+    {
+        /* skip what is assigned */
+        unsigned long index = 0;
+        while(index < databaseSize && CABidiTypeDatabase[index].to < from)
+            index++;
+        if(index < databaseSize && CABidiTypeDatabase[index].from <= from)
+        {
+            if(CABidiTypeDatabase[index].to >= range.to)
+                return;
+            from = CABidiTypeDatabase[index].to + 1;
+            continue;
+        }
+        
+        /* the gap ends before the next assigned range */
+        UTF32Char to = range.to;
+        if(index < databaseSize && CABidiTypeDatabase[index].from <= to)
+            to = CABidiTypeDatabase[index].from - 1;
+        
+        CABidiClassifyInsertRangeIntoDatabase((CABidiRange){.type = range.type, .from = from, .to = to});
+        if(to >= range.to)
+            return;
+        from = to + 1;
+    }
+}
+
 static CABidiRange *CABidiClassifyFindRangeForCharacter(UTF32Char ch)
 {
     if(CABidiTypeDatabase == NULL)
@@ -0,0 +1,26 @@
+//
+//  CABidiMirroring.h
+//  TextKit
+//
+//  Created by Bill Sun on 2018/11/5.
+//  Copyright © 2018 Bill Sun. All rights reserved.
+//
+
+#ifndef CABidiMirroring_h
+#define CABidiMirroring_h
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "CFType.h"
+
+/**
+ Get the Bidi_Mirroring_Glyph of the character, used by L4 for characters resolved as right to left
+
+ @param character any valid character in unicode UTF32 format
+ @param mirroredCharacter if not NULL and character has a mirrored glyph, it is returned
+ @return false if character has no mirrored glyph, including Bidi_Mirrored characters which could only be mirrored by the font
+ */
+bool CABidiGetMirroredCharacter(UTF32Char character, UTF32Char *mirroredCharacter);
+
+#endif /* CABidiMirroring_h */
@@ -6,331 +6,175 @@
 //  Copyright © 2018 Bill Sun. All rights reserved.
 //
 
-#include <stdio.h>
-#include <stdlib.h>
-#include <string.h>
+#include <stddef.h>
+#include <stdint.h>
 
 #include "CABidiPairedBracket.h"
-#include "CFException.h"
 
 typedef struct CABidiBracketPairs {
-    CABidiPairedBracketType type;
     UTF32Char ch, opposite;
+    CABidiPairedBracketType type;
 } CABidiBracketPairs;
 
-static CABidiBracketPairs *CABidiPairDatabase = NULL;  /* if database loaded, this is not NULL */
-static unsigned long databaseSize = 0lu;
-
-static void CABidiPairedBracketLoadDefaultDatabase(void);
-static void CABidiPairedBracketLoadDatabaseFromString(const char *string);
-static void CABidiPairedBracketUnloadDatabase(void);
-static CABidiBracketPairs *CABidiPairedBracketFindPairsForCharacter(UTF32Char ch);
-
-CABidiPairedBracketType CABidiGetPairedBracketType(UTF32Char character, UTF32Char *pairedBracket)
-{
-    if(CABidiPairDatabase == NULL) CABidiPairedBracketLoadDefaultDatabase();
-    if(CABidiPairDatabase != NULL)
-    {
-        CABidiBracketPairs *pairs = CABidiPairedBracketFindPairsForCharacter(character);
-        if(pairs != NULL)
-        {
-            if(pairedBracket != NULL) *pairedBracket = pairs->opposite;
-            return pairs->type;
-        }
-    }
-    return CABidiPairedBracketTypeNone;
-}
-
 #pragma mark - Internal Database
 
-static const char *default_BidiBracketDatabase =
-"0028; 0029; o\n"
-"0029; 0028; c\n"
-"005B; 005D; o\n"
-"005D; 005B; c\n"
-"007B; 007D; o\n"
-"007D; 007B; c\n"
-"0F3A; 0F3B; o\n"
-"0F3B; 0F3A; c\n"
-"0F3C; 0F3D; o\n"
-"0F3D; 0F3C; c\n"
-"169B; 169C; o\n"
-"169C; 169B; c\n"
-"2045; 2046; o\n"
-"2046; 2045; c\n"
-"207D; 207E; o\n"
-"207E; 207D; c\n"
-"208D; 208E; o\n"
-"208E; 208D; c\n"
-"2308; 2309; o\n"
-"2309; 2308; c\n"
-"230A; 230B; o\n"
-"230B; 230A; c\n"
-"2329; 232A; o\n"
-"232A; 2329; c\n"
-"2768; 2769; o\n"
-"2769; 2768; c\n"
-"276A; 276B; o\n"
-"276B; 276A; c\n"
-"276C; 276D; o\n"
-"276D; 276C; c\n"
-"276E; 276F; o\n"
-"276F; 276E; c\n"
-"2770; 2771; o\n"
-"2771; 2770; c\n"
-"2772; 2773; o\n"
-"2773; 2772; c\n"
-"2774; 2775; o\n"
-"2775; 2774; c\n"
-"27C5; 27C6; o\n"
-"27C6; 27C5; c\n"
-"27E6; 27E7; o\n"
-"27E7; 27E6; c\n"
-"27E8; 27E9; o\n"
-"27E9; 27E8; c\n"
-"27EA; 27EB; o\n"
-"27EB; 27EA; c\n"
-"27EC; 27ED; o\n"
-"27ED; 27EC; c\n"
-"27EE; 27EF; o\n"
-"27EF; 27EE; c\n"
-"2983; 2984; o\n"
-"2984; 2983; c\n"
-"2985; 2986; o\n"
-"2986; 2985; c\n"
-"2987; 2988; o\n"
-"2988; 2987; c\n"
-"2989; 298A; o\n"
-"298A; 2989; c\n"
-"298B; 298C; o\n"
-"298C; 298B; c\n"
-"298D; 2990; o\n"
-"298E; 298F; c\n"
-"298F; 298E; o\n"
-"2990; 298D; c\n"
-"2991; 2992; o\n"
-"2992; 2991; c\n"
-"2993; 2994; o\n"
-"2994; 2993; c\n"
-"2995; 2996; o\n"
-"2996; 2995; c\n"
-"2997; 2998; o\n"
-"2998; 2997; c\n"
-"29D8; 29D9; o\n"
-"29D9; 29D8; c\n"
-"29DA; 29DB; o\n"
-"29DB; 29DA; c\n"
-"29FC; 29FD; o\n"
-"29FD; 29FC; c\n"
-"2E22; 2E23; o\n"
-"2E23; 2E22; c\n"
-"2E24; 2E25; o\n"
-"2E25; 2E24; c\n"
-"2E26; 2E27; o\n"
-"2E27; 2E26; c\n"
-"2E28; 2E29; o\n"
-"2E29; 2E28; c\n"
-"3008; 3009; o\n"
-"3009; 3008; c\n"
-"300A; 300B; o\n"
-"300B; 300A; c\n"
-"300C; 300D; o\n"
-"300D; 300C; c\n"
-"300E; 300F; o\n"
-"300F; 300E; c\n"
-"3010; 3011; o\n"
-"3011; 3010; c\n"
-"3014; 3015; o\n"
-"3015; 3014; c\n"
-"3016; 3017; o\n"
-"3017; 3016; c\n"
-"3018; 3019; o\n"
-"3019; 3018; c\n"
-"301A; 301B; o\n"
-"301B; 301A; c\n"
-"FE59; FE5A; o\n"
-"FE5A; FE59; c\n"
-"FE5B; FE5C; o\n"
-"FE5C; FE5B; c\n"
-"FE5D; FE5E; o\n"
-"FE5E; FE5D; c\n"
-"FF08; FF09; o\n"
-"FF09; FF08; c\n"
-"FF3B; FF3D; o\n"
-"FF3D; FF3B; c\n"
-"FF5B; FF5D; o\n"
-"FF5D; FF5B; c\n"
-"FF5F; FF60; o\n"
-"FF60; FF5F; c\n"
-"FF62; FF63; o\n"
-"FF63; FF62; c\n";
-
-#define DatabaseInitializedSize 1232
-#define DatabaseIncreaseSize 250
-#define MaxBidiPairTypeLength 1
-
-#define Stringlization(x) _Stringlization(x)
-#define _Stringlization(x) #x
-
-#define LOOP for(;;)
-
-static unsigned long databaseAllocatedSize = 0lu;
-
-static void CABidiPairedBracketAddPairsFromString(const char *rangeString);
-static CABidiPairedBracketType CABidiPairedBracketTypeFromString(const char *string);
-static void CABidiPairedBracketInsertRangeIntoDatabase(CABidiBracketPairs range);
-static int CABidiPairedBracketCompareCharacter(UTF32Char ch, CABidiBracketPairs pairs);
-
-static CABidiBracketPairs *CABidiPairedBracketFindPairsForCharacter(UTF32Char ch)
-{
-    if(CABidiPairDatabase == NULL)
-    {
-        CFExceptionRaise(CFExceptionNameProcessFailed, NULL, "CABidiPairedBucket database is not loaded");
-        return NULL;
-    }
-    long beginIndex = 0;
-    long endIndex = databaseSize - 1;
-    do
-    {
-        long midIndex = (beginIndex + endIndex) / 2;
-        int compare = CABidiPairedBracketCompareCharacter(ch, CABidiPairDatabase[midIndex]);
-        if(compare < 0)
-            endIndex = midIndex - 1;
-        else if(compare == 0)
-            return CABidiPairDatabase + midIndex;
-        else
-            beginIndex = midIndex + 1;
-    }while(beginIndex <= endIndex);
-    return NULL;
-}
-
-static int CABidiPairedBracketCompareCharacter(UTF32Char ch, CABidiBracketPairs pairs)
-{
-    if(ch < pairs.ch) return -1;
-    if(ch > pairs.ch) return 1;
-    return 0;
-}
-
-static void CABidiPairedBracketLoadDefaultDatabase(void)
+/*
+ * generated from BidiBrackets.txt
+ *
+ * ASCII brackets are mapped directly by character
+ * the others are placed in a perfect hash table, the slots are precomputed from CABidiPairedBracketHash,
+ * an empty slot has ch 0 which no character past ASCII could match, so no initialization is needed
+ */
+
+#define CABidiPairedBracketSlotAmount 256
+
+static const unsigned char CABidiPairedBracketASCIIOpposite[0x80] = {
+    ['('] = ')',
+    [')'] = '(',
+    ['['] = ']',
+    [']'] = '[',
+    ['{'] = '}',
+    ['}'] = '{',
+};
+
+static const CABidiBracketPairs CABidiPairDatabase[CABidiPairedBracketSlotAmount] = {
+    [  1] = {0xFF09, 0xFF08, CABidiPairedBracketTypeClose},
+    [  9] = {0x2329, 0x232A, CABidiPairedBracketTypeOpen},
+    [ 10] = {0x27E6, 0x27E7, CABidiPairedBracketTypeOpen},
+    [ 12] = {0x2E22, 0x2E23, CABidiPairedBracketTypeOpen},
+    [ 13] = {0x232A, 0x2329, CABidiPairedBracketTypeClose},
+    [ 14] = {0x27E7, 0x27E6, CABidiPairedBracketTypeClose},
+    [ 16] = {0x2E23, 0x2E22, CABidiPairedBracketTypeClose},
+    [ 17] = {0x2768, 0x2769, CABidiPairedBracketTypeOpen},
+    [ 18] = {0x27E8, 0x27E9, CABidiPairedBracketTypeOpen},
+    [ 19] = {0x0F3A, 0x0F3B, CABidiPairedBracketTypeOpen},
+    [ 20] = {0x2E24, 0x2E25, CABidiPairedBracketTypeOpen},
+    [ 21] = {0x2769, 0x2768, CABidiPairedBracketTypeClose},
+    [ 22] = {0x27E9, 0x27E8, CABidiPairedBracketTypeClose},
+    [ 23] = {0x0F3B, 0x0F3A, CABidiPairedBracketTypeClose},
+    [ 24] = {0x2E25, 0x2E24, CABidiPairedBracketTypeClose},
+    [ 25] = {0x276A, 0x276B, CABidiPairedBracketTypeOpen},
+    [ 26] = {0x27EA, 0x27EB, CABidiPairedBracketTypeOpen},
+    [ 27] = {0x0F3C, 0x0F3D, CABidiPairedBracketTypeOpen},
+    [ 28] = {0x2E26, 0x2E27, CABidiPairedBracketTypeOpen},
+    [ 29] = {0x276B, 0x276A, CABidiPairedBracketTypeClose},
+    [ 30] = {0x27EB, 0x27EA, CABidiPairedBracketTypeClose},
+    [ 31] = {0x0F3D, 0x0F3C, CABidiPairedBracketTypeClose},
+    [ 32] = {0x2E27, 0x2E26, CABidiPairedBracketTypeClose},
+    [ 33] = {0x276C, 0x276D, CABidiPairedBracketTypeOpen},
+    [ 34] = {0x27EC, 0x27ED, CABidiPairedBracketTypeOpen},
+    [ 36] = {0x2E28, 0x2E29, CABidiPairedBracketTypeOpen},
+    [ 37] = {0x276D, 0x276C, CABidiPairedBracketTypeClose},
+    [ 38] = {0x27ED, 0x27EC, CABidiPairedBracketTypeClose},
+    [ 40] = {0x2E29, 0x2E28, CABidiPairedBracketTypeClose},
+    [ 41] = {0x276E, 0x276F, CABidiPairedBracketTypeOpen},
+    [ 42] = {0x27EE, 0x27EF, CABidiPairedBracketTypeOpen},
+    [ 45] = {0x276F, 0x276E, CABidiPairedBracketTypeClose},
+    [ 46] = {0x27EF, 0x27EE, CABidiPairedBracketTypeClose},
+    [ 49] = {0x2770, 0x2771, CABidiPairedBracketTypeOpen},
+    [ 53] = {0x2771, 0x2770, CABidiPairedBracketTypeClose},
+    [ 57] = {0x2772, 0x2773, CABidiPairedBracketTypeOpen},
+    [ 61] = {0x2773, 0x2772, CABidiPairedBracketTypeClose},
+    [ 63] = {0xFE59, 0xFE5A, CABidiPairedBracketTypeOpen},
+    [ 65] = {0x2774, 0x2775, CABidiPairedBracketTypeOpen},
+    [ 67] = {0xFE5A, 0xFE59, CABidiPairedBracketTypeClose},
+    [ 69] = {0x2775, 0x2774, CABidiPairedBracketTypeClose},
+    [ 71] = {0xFE5B, 0xFE5C, CABidiPairedBracketTypeOpen},
+    [ 74] = {0xFF5B, 0xFF5D, CABidiPairedBracketTypeOpen},
+    [ 75] = {0xFE5C, 0xFE5B, CABidiPairedBracketTypeClose},
+    [ 79] = {0xFE5D, 0xFE5E, CABidiPairedBracketTypeOpen},
+    [ 81] = {0x207D, 0x207E, CABidiPairedBracketTypeOpen},
+    [ 82] = {0xFF5D, 0xFF5B, CABidiPairedBracketTypeClose},
+    [ 83] = {0xFE5E, 0xFE5D, CABidiPairedBracketTypeClose},
+    [ 85] = {0x207E, 0x207D, CABidiPairedBracketTypeClose},
+    [ 90] = {0xFF5F, 0xFF60, CABidiPairedBracketTypeOpen},
+    [ 94] = {0xFF60, 0xFF5F, CABidiPairedBracketTypeClose},
+    [102] = {0xFF62, 0xFF63, CABidiPairedBracketTypeOpen},
+    [104] = {0x29FC, 0x29FD, CABidiPairedBracketTypeOpen},
+    [106] = {0xFF63, 0xFF62, CABidiPairedBracketTypeClose},
+    [108] = {0x29FD, 0x29FC, CABidiPairedBracketTypeClose},
+    [112] = {0x2045, 0x2046, CABidiPairedBracketTypeOpen},
+    [116] = {0x2046, 0x2045, CABidiPairedBracketTypeClose},
+    [131] = {0x2983, 0x2984, CABidiPairedBracketTypeOpen},
+    [132] = {0x2308, 0x2309, CABidiPairedBracketTypeOpen},
+    [134] = {0x27C5, 0x27C6, CABidiPairedBracketTypeOpen},
+    [135] = {0x2984, 0x2983, CABidiPairedBracketTypeClose},
+    [136] = {0x2309, 0x2308, CABidiPairedBracketTypeClose},
+    [138] = {0x27C6, 0x27C5, CABidiPairedBracketTypeClose},
+    [139] = {0x2985, 0x2986, CABidiPairedBracketTypeOpen},
+    [140] = {0x230A, 0x230B, CABidiPairedBracketTypeOpen},
+    [143] = {0x2986, 0x2985, CABidiPairedBracketTypeClose},
+    [144] = {0x230B, 0x230A, CABidiPairedBracketTypeClose},
+    [145] = {0x208D, 0x208E, CABidiPairedBracketTypeOpen},
+    [147] = {0x2987, 0x2988, CABidiPairedBracketTypeOpen},
+    [149] = {0x208E, 0x208D, CABidiPairedBracketTypeClose},
+    [151] = {0x2988, 0x2987, CABidiPairedBracketTypeClose},
+    [155] = {0x2989, 0x298A, CABidiPairedBracketTypeOpen},
+    [159] = {0x298A, 0x2989, CABidiPairedBracketTypeClose},
+    [163] = {0x298B, 0x298C, CABidiPairedBracketTypeOpen},
+    [167] = {0x298C, 0x298B, CABidiPairedBracketTypeClose},
+    [170] = {0x3008, 0x3009, CABidiPairedBracketTypeOpen},
+    [171] = {0x298D, 0x2990, CABidiPairedBracketTypeOpen},
+    [172] = {0x169B, 0x169C, CABidiPairedBracketTypeOpen},
+    [174] = {0x3009, 0x3008, CABidiPairedBracketTypeClose},
+    [175] = {0x298E, 0x298F, CABidiPairedBracketTypeClose},
+    [177] = {0x169C, 0x169B, CABidiPairedBracketTypeClose},
+    [178] = {0x300A, 0x300B, CABidiPairedBracketTypeOpen},
+    [179] = {0x298F, 0x298E, CABidiPairedBracketTypeOpen},
+    [182] = {0x300B, 0x300A, CABidiPairedBracketTypeClose},
+    [183] = {0x2990, 0x298D, CABidiPairedBracketTypeClose},
+    [186] = {0x300C, 0x300D, CABidiPairedBracketTypeOpen},
+    [187] = {0x2991, 0x2992, CABidiPairedBracketTypeOpen},
+    [190] = {0x300D, 0x300C, CABidiPairedBracketTypeClose},
+    [191] = {0x2992, 0x2991, CABidiPairedBracketTypeClose},
+    [194] = {0x300E, 0x300F, CABidiPairedBracketTypeOpen},
+    [195] = {0x2993, 0x2994, CABidiPairedBracketTypeOpen},
+    [198] = {0x300F, 0x300E, CABidiPairedBracketTypeClose},
+    [199] = {0x2994, 0x2993, CABidiPairedBracketTypeClose},
+    [201] = {0xFF3B, 0xFF3D, CABidiPairedBracketTypeOpen},
+    [202] = {0x3010, 0x3011, CABidiPairedBracketTypeOpen},
+    [203] = {0x2995, 0x2996, CABidiPairedBracketTypeOpen},
+    [206] = {0x3011, 0x3010, CABidiPairedBracketTypeClose},
+    [207] = {0x2996, 0x2995, CABidiPairedBracketTypeClose},
+    [209] = {0xFF3D, 0xFF3B, CABidiPairedBracketTypeClose},
+    [211] = {0x2997, 0x2998, CABidiPairedBracketTypeOpen},
+    [215] = {0x2998, 0x2997, CABidiPairedBracketTypeClose},
+    [216] = {0x29D8, 0x29D9, CABidiPairedBracketTypeOpen},
+    [218] = {0x3014, 0x3015, CABidiPairedBracketTypeOpen},
+    [220] = {0x29D9, 0x29D8, CABidiPairedBracketTypeClose},
+    [222] = {0x3015, 0x3014, CABidiPairedBracketTypeClose},
+    [224] = {0x29DA, 0x29DB, CABidiPairedBracketTypeOpen},
+    [226] = {0x3016, 0x3017, CABidiPairedBracketTypeOpen},
+    [228] = {0x29DB, 0x29DA, CABidiPairedBracketTypeClose},
+    [230] = {0x3017, 0x3016, CABidiPairedBracketTypeClose},
+    [234] = {0x3018, 0x3019, CABidiPairedBracketTypeOpen},
+    [238] = {0x3019, 0x3018, CABidiPairedBracketTypeClose},
+    [242] = {0x301A, 0x301B, CABidiPairedBracketTypeOpen},
+    [246] = {0x301B, 0x301A, CABidiPairedBracketTypeClose},
+    [253] = {0xFF08, 0xFF09, CABidiPairedBracketTypeOpen},
+};
+
+static uint_fast8_t CABidiPairedBracketHash(UTF32Char ch)
 {
-    CABidiPairedBracketLoadDatabaseFromString(default_BidiBracketDatabase);
+    return (uint_fast8_t)(((uint32_t)ch * 8215u >> 11) & (CABidiPairedBracketSlotAmount - 1));
 }
 
-static void CABidiPairedBracketLoadDatabaseFromString(const char *string)
-{
-    const char *current = string;
-    do
-    {
-        CABidiPairedBracketAddPairsFromString(current);
-        do current++; while(*current!='\n' && *current!='\0');
-        if(*current == '\n') current++;
-        else break;
-    }while (1);
-}
+#pragma mark - Lookup
 
-#pragma clang diagnostic push
-#pragma clang diagnostic ignored "-Wunused-function"
-static void CABidiPairedBracketUnloadDatabase(void)
-{
-    if(CABidiPairDatabase != NULL)
-    {
-        free(CABidiPairDatabase);
-        CABidiPairDatabase = NULL;
-        databaseAllocatedSize = 0u;
-        databaseSize = 0u;
-    }
-}
-#pragma clang diagnostic pop
-
-#pragma clang diagnostic push
-#pragma clang diagnostic ignored "-Wformat"
-
-static void CABidiPairedBracketAddPairsFromString(const char *rangeString)
-{
-    UTF32Char ch, opposite;
-    char typeString[MaxBidiPairTypeLength + 1];
-    CABidiPairedBracketType type;
-    bool valid = false;
-    if(sscanf(rangeString, "%"UTF32CharSCNx"; "UTF32CharSCNx"; %" Stringlization(MaxBidiPairTypeLength) "s", &ch, &opposite, typeString) == 3)
-        valid = true;
-    if(valid)
-    {
-        type = CABidiPairedBracketTypeFromString(typeString);
-        CABidiBracketPairs pairs = (CABidiBracketPairs){.type = type, .ch = ch, .opposite = opposite};
-        
-        CABidiPairedBracketInsertRangeIntoDatabase(pairs);
-    }
-}
-
-#pragma clang diagnostic pop
-
-static void CABidiPairedBracketInsertRangeIntoDatabase(CABidiBracketPairs pairs)
-{
-    if(CABidiPairDatabase == NULL)
-    {
-        if((CABidiPairDatabase = malloc(sizeof(CABidiBracketPairs) * DatabaseInitializedSize)) != NULL)
-        {
-            databaseAllocatedSize = DatabaseInitializedSize;
-            databaseSize = 0;
-        }
-    }
-    if(CABidiPairDatabase != NULL)
-    {
-        unsigned long insertIndex = 0;
-        LOOP
-        {
-            if(insertIndex == databaseSize)
-                break;
-            if(pairs.ch == CABidiPairDatabase[insertIndex].ch)
-            {
-                CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CABidiPairDatabase pairs exist");
-                return;
-            }
-            else if(pairs.ch > CABidiPairDatabase[insertIndex].ch)
-                insertIndex++;
-            else
-                break;
-        }
-        if(databaseSize >= databaseAllocatedSize)
-        {
-            CABidiBracketPairs *temp = realloc(CABidiPairDatabase, sizeof(CABidiBracketPairs) * (databaseAllocatedSize + DatabaseIncreaseSize));
-            if(temp != NULL)
-            {
-                CABidiPairDatabase = temp;
-                databaseAllocatedSize = databaseAllocatedSize + DatabaseIncreaseSize;
-            }
-            else
-            {
-                CFExceptionRaise(CFExceptionNameProcessFailed, NULL, "CABidiPairedBracketInsertRangeIntoDatabase data size increased failed");
-                return;
-            }
-        }
-        for(size_t index = databaseSize; index > insertIndex; index--)
-            CABidiPairDatabase[index] = CABidiPairDatabase[index - 1];
-        
-        CABidiPairDatabase[insertIndex] = pairs;
-        databaseSize++;
-    }
-}
-
-static CABidiPairedBracketType CABidiPairedBracketTypeFromString(const char *string)
+CABidiPairedBracketType CABidiGetPairedBracketType(UTF32Char character, UTF32Char *pairedBracket)
 {
-    if(string == NULL)
+    if(character < 0x80)
     {
-        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CABidiPairedBracketTypeFromString NULL");
-        return CABidiPairedBracketTypeNone;
+        UTF32Char opposite = CABidiPairedBracketASCIIOpposite[character];
+        if(opposite == 0)
+            return CABidiPairedBracketTypeNone;
+        if(pairedBracket != NULL) *pairedBracket = opposite;
+        // every ASCII opening bracket sits below its closing one
+        return opposite > character ? CABidiPairedBracketTypeOpen : CABidiPairedBracketTypeClose;
     }
-    
-    if(strcmp(string, "o") == 0)
-        return CABidiPairedBracketTypeOpen;
-    else if(strcmp(string, "c") == 0)
-        return CABidiPairedBracketTypeClose;
-    else if(strcmp(string, "n") == 0)
-        return CABidiPairedBracketTypeNone;
-    else
-    {
-        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CABidiPairedBracketTypeFromString invalid \"%s\"", string);
+    const CABidiBracketPairs *pairs = &CABidiPairDatabase[CABidiPairedBracketHash(character)];
+    if(pairs->ch != character)
         return CABidiPairedBracketTypeNone;
-    }
+    if(pairedBracket != NULL) *pairedBracket = pairs->opposite;
+    return pairs->type;
 }
-
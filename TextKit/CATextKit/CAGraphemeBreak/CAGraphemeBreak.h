@@ -0,0 +1,94 @@
+//
+//  CAGraphemeBreak.h
+//  TextKit
+//
+//  Created by Bill Sun on 2018/11/5.
+//  Copyright © 2018 Bill Sun. All rights reserved.
+//
+
+#ifndef CAGraphemeBreak_h
+#define CAGraphemeBreak_h
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "CFType.h"
+#include "UTF32String.h"
+
+typedef enum CAGraphemeBreakProperty {
+    CAGraphemeBreakPropertyOther,
+    CAGraphemeBreakPropertyCR,
+    CAGraphemeBreakPropertyLF,
+    CAGraphemeBreakPropertyControl,
+    CAGraphemeBreakPropertyExtend,
+    CAGraphemeBreakPropertyZWJ,
+    CAGraphemeBreakPropertyRegionalIndicator,
+    CAGraphemeBreakPropertyPrepend,
+    CAGraphemeBreakPropertySpacingMark,
+    CAGraphemeBreakPropertyL,                       // Hangul leading jamo
+    CAGraphemeBreakPropertyV,                       // Hangul vowel jamo
+    CAGraphemeBreakPropertyT,                       // Hangul trailing jamo
+    CAGraphemeBreakPropertyLV,                      // Hangul LV syllable
+    CAGraphemeBreakPropertyLVT,                     // Hangul LVT syllable
+    CAGraphemeBreakPropertyExtendedPictographic     // Extended_Pictographic of emoji data, otherwise Other
+} CAGraphemeBreakProperty;
+
+#pragma mark - Query for Character Property
+
+CAGraphemeBreakProperty CAGraphemeBreakPropertyForCharacter(UTF32Char character);
+
+#pragma mark - Boundary
+
+/**
+ Whether an extended grapheme cluster of UAX #29 begins at index
+
+ @param index 0 and UTF32StringGetLength(string) are always boundaries, beyond the length is not
+ */
+bool CAGraphemeBreakIsBoundary(UTF32StringRef string, size_t index);
+
+/**
+ Find the beginning of every cluster, in a single pass
+
+ @param amount the amount of clusters, the length of the result
+ @return NULL if string is empty or out of memory, and it is your responsibility to call free <stdlib.h> at proper time
+ */
+size_t *CAGraphemeBreakCreateBoundaries(UTF32StringRef string, size_t *amount);
+
+#pragma mark - Iterator
+
+typedef struct CAGraphemeBreakIterator *CAGraphemeBreakIteratorRef;
+
+/**
+ Create an iterator located at the beginning of string
+
+ @param string it is not copied, and must stay alive until the iterator is destoryed
+ @return NULL if string is NULL or out of memory
+ */
+CAGraphemeBreakIteratorRef CAGraphemeBreakIteratorCreate(UTF32StringRef string);
+
+void CAGraphemeBreakIteratorDestory(CAGraphemeBreakIteratorRef iterator);
+
+size_t CAGraphemeBreakIteratorGetLocation(CAGraphemeBreakIteratorRef iterator);
+
+/**
+ Move to the boundary at location, or the nearest one before it if location is inside a cluster
+
+ @param location beyond the length of string means the end of it
+ */
+void CAGraphemeBreakIteratorSetLocation(CAGraphemeBreakIteratorRef iterator, size_t location);
+
+/**
+ The cluster after the location, then the location moves to its end
+
+ @return CFRangeNotFound at the end of string
+ */
+CFRange CAGraphemeBreakIteratorNext(CAGraphemeBreakIteratorRef iterator);
+
+/**
+ The cluster before the location, then the location moves to its beginning
+
+ @return CFRangeNotFound at the beginning of string
+ */
+CFRange CAGraphemeBreakIteratorPrevious(CAGraphemeBreakIteratorRef iterator);
+
+#endif /* CAGraphemeBreak_h */
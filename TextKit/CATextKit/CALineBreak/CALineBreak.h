@@ -0,0 +1,115 @@
+//
+//  CALineBreak.h
+//  TextKit
+//
+//  Created by Bill Sun on 2018/11/5.
+//  Copyright © 2018 Bill Sun. All rights reserved.
+//
+
+#ifndef CALineBreak_h
+#define CALineBreak_h
+
+#include <stddef.h>
+
+#include "CFType.h"
+#include "UTF32String.h"
+
+typedef enum CALineBreakClass {
+
+    /* pair table */
+    CALineBreakClassOP,    // Open Punctuation
+    CALineBreakClassCL,    // Close Punctuation
+    CALineBreakClassCP,    // Close Parenthesis
+    CALineBreakClassQU,    // Quotation
+    CALineBreakClassGL,    // Non-breaking ("Glue")
+    CALineBreakClassNS,    // Nonstarter, Conditional Japanese Starter resolved here
+    CALineBreakClassEX,    // Exclamation/Interrogation
+    CALineBreakClassSY,    // Symbols Allowing Break After
+    CALineBreakClassIS,    // Infix Numeric Separator
+    CALineBreakClassPR,    // Prefix Numeric
+    CALineBreakClassPO,    // Postfix Numeric
+    CALineBreakClassNU,    // Numeric
+    CALineBreakClassAL,    // Alphabetic, Ambiguous, Complex Context and Unknown resolved here
+    CALineBreakClassHL,    // Hebrew Letter
+    CALineBreakClassID,    // Ideographic
+    CALineBreakClassIN,    // Inseparable
+    CALineBreakClassHY,    // Hyphen
+    CALineBreakClassBA,    // Break After
+    CALineBreakClassBB,    // Break Before
+    CALineBreakClassB2,    // Break Opportunity Before and After
+    CALineBreakClassZW,    // Zero Width Space
+    CALineBreakClassCM,    // Combining Mark
+    CALineBreakClassWJ,    // Word Joiner
+    CALineBreakClassH2,    // Hangul LV Syllable
+    CALineBreakClassH3,    // Hangul LVT Syllable
+    CALineBreakClassJL,    // Hangul L Jamo
+    CALineBreakClassJV,    // Hangul V Jamo
+    CALineBreakClassJT,    // Hangul T Jamo
+    CALineBreakClassRI,    // Regional Indicator
+    CALineBreakClassEB,    // Emoji Base
+    CALineBreakClassEM,    // Emoji Modifier
+    CALineBreakClassZWJ,   // Zero Width Joiner
+    CALineBreakClassCB,    // Contingent Break Opportunity
+
+    /* resolved before the pair table */
+    CALineBreakClassBK,    // Mandatory Break
+    CALineBreakClassCR,    // Carriage Return
+    CALineBreakClassLF,    // Line Feed
+    CALineBreakClassNL,    // Next Line
+    CALineBreakClassSP     // Space
+} CALineBreakClass;
+
+typedef enum CALineBreakAction {
+    CALineBreakActionProhibited,   // no break after the character
+    CALineBreakActionAllowed,      // line may break after the character
+    CALineBreakActionMandatory     // line must break after the character
+} CALineBreakAction;
+
+#pragma mark - Query for Character Class
+
+/**
+ Line breaking class of UAX #14, with the LB1 resolution already applied
+
+ @return one of the classes in CALineBreakClass, characters not in the table are CALineBreakClassAL
+ */
+CALineBreakClass CALineBreakClassForCharacter(UTF32Char character);
+
+#pragma mark - Break Opportunities
+
+/**
+ Find the break opportunity after every character of string, in a single pass of the pair table
+
+ @param string if NULL, NULL returned
+ @return an array of UTF32StringGetLength(string) actions, the action at index i is the one between character i and i + 1,
+         the last one is always CALineBreakActionMandatory, NULL if string is empty or out of memory,
+         and it is your responsibility to call free <stdlib.h> at proper time
+ */
+CALineBreakAction *CALineBreakCreateActions(UTF32StringRef string);
+
+#pragma mark - Line Fitting
+
+/**
+ Measure the width of characters in range of string, in whatever unit maximumWidth uses
+ */
+typedef double (*CALineBreakMeasureFunction)(UTF32StringRef string, CFRange range, void *info);
+
+/**
+ Fit the line beginning at location, the result could be passed to CABLGeneratorDisplayLine with the same paragraphRange
+
+ @param actions got by CALineBreakCreateActions of the same string
+ @param paragraphRange got by CABLGeneratorGetParagraphRange, the line never crosses its end
+ @param location the first character of the line, inside paragraphRange, usually the end of the previous line
+ @param measure NULL means every character is 1 wide, trailing spaces of a line are never measured
+ @return the longest line ending at a break opportunity whose width is not greater than maximumWidth,
+         it stops at the first mandatory break, if even the first opportunity does not fit, the line ends there anyway,
+         CFRangeNotFound if location is not inside paragraphRange
+ */
+CFRange CALineBreakGetLineRange(UTF32StringRef string,
+                                const CALineBreakAction *actions,
+                                CFRange paragraphRange,
+                                size_t location,
+                                double maximumWidth,
+                                CALineBreakMeasureFunction measure,
+                                void *info);
+
+#endif /* CALineBreak_h */
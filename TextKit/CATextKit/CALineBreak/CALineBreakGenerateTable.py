@@ -0,0 +1,137 @@
+#!/usr/bin/env python3
+#
+#  CALineBreakGenerateTable.py
+#  TextKit
+#
+#  Created by Bill Sun on 2018/11/5.
+#  Copyright © 2018 Bill Sun. All rights reserved.
+#
+#  Regenerate the class table of CALineBreak.c from LineBreak.txt of the Unicode Character Database
+#
+#  usage: python3 CALineBreakGenerateTable.py LineBreak.txt
+#
+#  the two arrays CALineBreakClassBlockIndex and CALineBreakClassBlocks of CALineBreak.c in the same
+#  directory are replaced, classes are resolved by LB1 of UAX #14 on the way, so that every value is
+#  one of CALineBreakClass, and the ranges CALineBreakClassForCharacter answers without the table are
+#  checked against the file
+#
+
+import os
+import re
+import sys
+
+# in the order of CALineBreakClass
+CLASSES = ['OP', 'CL', 'CP', 'QU', 'GL', 'NS', 'EX', 'SY', 'IS', 'PR', 'PO', 'NU', 'AL', 'HL', 'ID', 'IN', 'HY', 'BA', 'BB', 'B2',
+           'ZW', 'CM', 'WJ', 'H2', 'H3', 'JL', 'JV', 'JT', 'RI', 'EB', 'EM', 'ZWJ', 'CB',
+           'BK', 'CR', 'LF', 'NL', 'SP']
+
+# unassigned code points default to these, files before Unicode 15.1 only state them in the header comment
+DEFAULT_RANGES = [(0x3400, 0x4DBF, 'ID'), (0x4E00, 0x9FFF, 'ID'), (0xF900, 0xFAFF, 'ID'),
+                  (0x20000, 0x2FFFD, 'ID'), (0x30000, 0x3FFFD, 'ID'),
+                  (0x1F000, 0x1FAFF, 'ID'), (0x1FC00, 0x1FFFD, 'ID'),
+                  (0x20A0, 0x20CF, 'PR')]
+
+TABLE_LIMIT = 0x20000       # CALineBreakClassTableLimit
+BLOCK_SHIFT = 7             # CALineBreakClassBlockShift
+CODE_POINT_LIMIT = 0x110000
+
+
+def parse_range(text):
+    bounds = text.strip().split('..')
+    return int(bounds[0], 16), int(bounds[-1], 16)
+
+
+def read_line_break(path):
+    classes = ['XX'] * CODE_POINT_LIMIT
+    categories = ['Cn'] * CODE_POINT_LIMIT
+    missing_range_count = 0
+    entries = []
+    for line in open(path, encoding='utf-8'):
+        missing = re.match(r'#\s*@missing:\s*([0-9A-Fa-f.]+)\s*;\s*(\w+)', line)
+        if missing:
+            first, last = parse_range(missing.group(1))
+            if (first, last) != (0, CODE_POINT_LIMIT - 1):
+                missing_range_count += 1
+            classes[first:last + 1] = [missing.group(2)] * (last - first + 1)
+            continue
+        data, _, comment = line.partition('#')
+        if not data.strip():
+            continue
+        code_points, value = data.split(';')[:2]
+        first, last = parse_range(code_points)
+        entries.append((first, last, value.strip(), comment.split()[0] if comment.split() else 'Cn'))
+    if missing_range_count == 0:
+        for first, last, value in DEFAULT_RANGES:
+            classes[first:last + 1] = [value] * (last - first + 1)
+    for first, last, value, category in entries:
+        classes[first:last + 1] = [value] * (last - first + 1)
+        categories[first:last + 1] = [category] * (last - first + 1)
+    return classes, categories
+
+
+def resolve(value, category):
+    # LB1
+    if value in ('AI', 'SG', 'XX'):
+        return 'AL'
+    if value == 'SA':
+        return 'CM' if category in ('Mn', 'Mc') else 'AL'
+    if value == 'CJ':
+        return 'NS'
+    if value not in CLASSES:
+        sys.exit('unknown line breaking class %s, add it to CALineBreakClass first' % value)
+    return value
+
+
+def class_beyond_table(character):
+    # keep in step with CALineBreakClassForCharacter
+    if character <= 0x3FFFD and character not in (0x2FFFE, 0x2FFFF):
+        return 'ID'
+    if character == 0xE0001 or 0xE0020 <= character <= 0xE007F or 0xE0100 <= character <= 0xE01EF:
+        return 'CM'
+    return 'AL'
+
+
+def main():
+    if len(sys.argv) != 2:
+        sys.exit('usage: python3 CALineBreakGenerateTable.py LineBreak.txt')
+    classes, categories = read_line_break(sys.argv[1])
+    resolved = [resolve(classes[character], categories[character]) for character in range(CODE_POINT_LIMIT)]
+
+    for character in range(TABLE_LIMIT, CODE_POINT_LIMIT):
+        if resolved[character] != class_beyond_table(character):
+            sys.exit('U+%04X is %s, CALineBreakClassForCharacter answers %s' % (character, resolved[character], class_beyond_table(character)))
+
+    data = [CLASSES.index(value) for value in resolved[:TABLE_LIMIT]]
+    blocks, block_index, seen = [], [], {}
+    for begin in range(0, TABLE_LIMIT, 1 << BLOCK_SHIFT):
+        block = tuple(data[begin:begin + (1 << BLOCK_SHIFT)])
+        if block not in seen:
+            seen[block] = len(blocks)
+            blocks.append(block)
+        block_index.append(seen[block])
+
+    lines = ['static const unsigned char CALineBreakClassBlockIndex[CALineBreakClassTableLimit >> CALineBreakClassBlockShift] = {']
+    for begin in range(0, len(block_index), 16):
+        lines.append('    ' + ' '.join('%3d,' % value for value in block_index[begin:begin + 16]))
+    lines.append('};')
+    lines.append('')
+    lines.append('static const unsigned char CALineBreakClassBlocks[%d][1 << CALineBreakClassBlockShift] = {' % len(blocks))
+    for number, block in enumerate(blocks):
+        lines.append('    {   /* %d */' % number)
+        for begin in range(0, len(block), 32):
+            lines.append('        ' + ''.join('%d,' % value for value in block[begin:begin + 32]))
+        lines.append('    },')
+    lines.append('};')
+    table = '\n'.join(lines) + '\n'
+
+    source_path = os.path.join(os.path.dirname(os.path.abspath(__file__)), 'CALineBreak.c')
+    source = open(source_path, encoding='utf-8').read()
+    pattern = re.compile(r'static const unsigned char CALineBreakClassBlockIndex\[.*?\n\};\n\nstatic const unsigned char CALineBreakClassBlocks\[.*?\n\};\n', re.S)
+    if not pattern.search(source):
+        sys.exit('class table not found in CALineBreak.c')
+    open(source_path, 'w', encoding='utf-8').write(pattern.sub(lambda match: table, source, count=1))
+    print('%d blocks written to %s' % (len(blocks), source_path))
+
+
+if __name__ == '__main__':
+    main()
@@ -1,5 +1,3 @@
-
-
 //
 //  CAPunycode.c
 //  TextKit
@@ -14,14 +12,31 @@
 #include <limits.h>
 #include <stdbool.h>
 #include <string.h>
+#include <stdio.h>
+
+#include "CFPlatform.h"
+
+#ifdef CF_OS_UNIX
+#include <pthread.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 #include "CFDebug.h"
+#include "CFException.h"
 #include "CFType.h"
 #include "CAPunycode.h"
 #include "UTF32String.h"
 
 #pragma mark - Macro configuration
-#define CAPunycodeDecodeInitialTempArraySize 512
-#define CAPunycodeDecodeInitialTempArrayIncreasedAmount 64
+#define CAPunycodeEncodeMaximumDigitsPerCodePoint 11    // a 32-bit delta never takes more, weight grows at least 10 times per digit
+#define CAPunycodeSortInsertionThreshold 32             // distinct non-basic code points sorted by insertion below it
+#define CAPunycodeLabelMaximumLength 63                 // octets of an encoded label, RFC 5890
+#define CAPunycodeDomainBatchInitialArenaSize 4096
+#define CAPunycodeDomainBatchInitialDomainAmount 64
+#define CAPunycodePipelineChunkSize (1 << 20)           // input octets a worker takes each round, rounded up to a line end
 #define LOOP for(;;)
 
 #pragma mark - Punycode static constant configuration
@@ -36,12 +51,13 @@ static const unsigned int overflowValue = UINT_MAX;
 
 #pragma mark - static function declearation
 static unsigned int CAPunycodeBiasAdaptation(unsigned int delta, unsigned int numpoints, bool firstTime);
-static const UTF8Char * CAPunycodeStrrchr(const UTF8Char *source, UTF8Char ch);
+static unsigned int CAPunycodeThreshold(unsigned int timesOfBase, unsigned int bias);
 static size_t CAPunycodeStrlen(const UTF8Char *source);
-static bool CAPunycodeIsBasicCodePoint(UTF32Char codePoint);
 static unsigned int CAPunycodeDecodeDigit(UTF8Char ch);
 static size_t CAPunycodeUnicodeStrlen(const UTF32Char *source);
-static UTF32Char CAPunycodeEecodeDigit(unsigned int value);
+static UTF8Char CAPunycodeEecodeDigit(unsigned int value);
+static int CAPunycodeEncodeLabel(const UTF32Char *source, size_t sourceLength, UTF32Char *sortedScratch, UTF8Char *output, size_t *outputLength);
+static int CAPunycodeDecodeLabel(const UTF8Char *source, size_t sourceLength, UTF32Char *output, size_t *outputLength);
 
 /**
  Punycode bias cuculation function
@@ -66,172 +82,193 @@ static unsigned int CAPunycodeBiasAdaptation(unsigned int delta, unsigned int nu
     return divisionTimes * base + (((base - tmin + 1) * delta) / (delta + skew));
 }
 
+static unsigned int CAPunycodeThreshold(unsigned int timesOfBase, unsigned int bias)
+{
+    // threadhold = base * (j + 1) - bias (j is current loop index), clamped to [tmin, tmax]
+    if(timesOfBase <= bias + tmin) return tmin;
+    if(timesOfBase >= bias + tmax) return tmax;
+    return timesOfBase - bias;
+}
+
+#pragma mark - Label
+
+static int CAPunycodeCompareCodePoint(const void *first, const void *second)
+{
+    UTF32Char firstCodePoint = *(const UTF32Char *)first, secondCodePoint = *(const UTF32Char *)second;
+    return firstCodePoint < secondCodePoint ? -1 : firstCodePoint > secondCodePoint;
+}
+
 /**
- This follow the RFC3492 tutorial to decode the Punycode String
+ RFC 3492 encoding of one label, without the ACE prefix
 
- @param source a ASCII string terminated will '\0'
- @return a UTF32String with ownership
+ @param sortedScratch room for sourceLength code points
+ @param output room for sourceLength * CAPunycodeEncodeMaximumDigitsPerCodePoint + 1 octets
+ @return 0 for success, -1 on overflow
  */
-UTF32StringRef CAPunycodeDecodeASCIIString(const UTF8Char *source)
+static int CAPunycodeEncodeLabel(const UTF32Char *source, size_t sourceLength, UTF32Char *sortedScratch, UTF8Char *output, size_t *outputLength)
 {
-    size_t storeArraySize = CAPunycodeDecodeInitialTempArraySize;   // 512
-    const size_t storeArrayIncreaseAmount = CAPunycodeDecodeInitialTempArrayIncreasedAmount;    // 64
-    size_t currentStoreStringLength = 0;
-    UTF32Char *longStringArr;
-    if((longStringArr = malloc(sizeof(UTF32Char) * storeArraySize)) != NULL)
+    size_t currentOutputLength = 0, sortedAmount = 0;
+    for(size_t index = 0; index < sourceLength; index++)
+        if(source[index] < initial_value)
+            output[currentOutputLength++] = (UTF8Char)source[index];
+        else
+            sortedScratch[sortedAmount++] = source[index];
+    
+    unsigned int numberOfBasicCodePoint = (unsigned int)currentOutputLength;
+    if(numberOfBasicCodePoint > 0)
+        output[currentOutputLength++] = '-';
+    
+    // distinct non-basic code points in ascending order, so no round rescans the label for its minimum
+    if(sortedAmount < CAPunycodeSortInsertionThreshold)
+        for(size_t index = 1; index < sortedAmount; index++)
+        {
+            UTF32Char codePoint = sortedScratch[index];
+            size_t insertIndex = index;
+            for(; insertIndex > 0 && sortedScratch[insertIndex - 1] > codePoint; insertIndex--)
+                sortedScratch[insertIndex] = sortedScratch[insertIndex - 1];
+            sortedScratch[insertIndex] = codePoint;
+        }
+    else
+        qsort(sortedScratch, sortedAmount, sizeof(UTF32Char), CAPunycodeCompareCodePoint);
+    
+    unsigned int value = initial_value;
+    unsigned int currentOutputpoints = 0;     // delta of accumulated
+    unsigned int bias = initial_bias;
+    unsigned int alreadyOutputLength = numberOfBasicCodePoint;
+    
+    for(size_t sortedIndex = 0; sortedIndex < sortedAmount; sortedIndex++)
     {
-        const UTF8Char *lastDelimiter = CAPunycodeStrrchr(source, '-');
-        // consume all code points before the last delimiter (if there is one)
-        // and copy them to output, fail on any non-basic code point
-        if(lastDelimiter == NULL) lastDelimiter = source + CAPunycodeStrlen(source);
-        for(const UTF8Char *current = source; current < lastDelimiter; current++)
+        UTF32Char minimumCodePoint = sortedScratch[sortedIndex];
+        if(sortedIndex > 0 && minimumCodePoint == sortedScratch[sortedIndex - 1])
+            continue;
+        
+        if (minimumCodePoint - value > (overflowValue - currentOutputpoints) / (alreadyOutputLength + 1))
+            return -1;
+        currentOutputpoints += (minimumCodePoint - value) * (alreadyOutputLength + 1);
+        value = minimumCodePoint;
+        
+        for(size_t index = 0; index < sourceLength; index++)
         {
-            if(!CAPunycodeIsBasicCodePoint(*current))
+            UTF32Char character = source[index];
+            if(character < value)
             {
-                free(longStringArr);
-                CFDebugLog("CAPunycodeDecodeASCIIString not valid punycode string");
-                return NULL;
+                if (++currentOutputpoints == 0)
+                    return -1;
             }
-            if(currentStoreStringLength > storeArraySize)
+            else if(character == value)
             {
-                UTF32Char *temp = realloc(longStringArr, sizeof(UTF32Char) * (storeArraySize + storeArrayIncreaseAmount));
-                if(temp == NULL)
+                unsigned int remainingPoints = currentOutputpoints;
+                for(unsigned int timesOfBase = base; ; timesOfBase += base)
                 {
-                    free(longStringArr);
-                    CFDebugLog("CAPunycodeDecodeASCIIString allcate temp array failed");
-                    return NULL;
+                    unsigned int threadhold = CAPunycodeThreshold(timesOfBase, bias);
+                    if(remainingPoints < threadhold)
+                        break;
+                    output[currentOutputLength++] = CAPunycodeEecodeDigit(threadhold + (remainingPoints - threadhold) % (base - threadhold));
+                    remainingPoints = (remainingPoints - threadhold) / (base - threadhold);
                 }
-                longStringArr = temp;
-                storeArraySize += storeArrayIncreaseAmount;
+                output[currentOutputLength++] = CAPunycodeEecodeDigit(remainingPoints);
+                
+                bias = CAPunycodeBiasAdaptation(currentOutputpoints, alreadyOutputLength + 1, alreadyOutputLength == numberOfBasicCodePoint);
+                currentOutputpoints = 0;
+                alreadyOutputLength++;
             }
-            longStringArr[currentStoreStringLength++] = *current;
+        }
+        currentOutputpoints++;
+        value++;
+    }
+    
+    *outputLength = currentOutputLength;
+    return 0;
+}
+
+/**
+ RFC 3492 decoding of one label, without the ACE prefix
+
+ @param output room for sourceLength code points, a label never decodes to more
+ @return 0 for success, -1 if source is not valid punycode or decodes to a basic, surrogate or out of range code point
+ */
+static int CAPunycodeDecodeLabel(const UTF8Char *source, size_t sourceLength, UTF32Char *output, size_t *outputLength)
+{
+    // consume all code points before the last delimiter (if there is one)
+    size_t numberOfBasicCodePoint = 0;
+    for(size_t index = 0; index < sourceLength; index++)
+        if(source[index] == '-')
+            numberOfBasicCodePoint = index;
+    for(size_t index = 0; index < numberOfBasicCodePoint; index++)
+    {
+        if(source[index] >= initial_value)
+            return -1;
+        output[index] = source[index];
+    }
+    size_t currentStoreStringLength = numberOfBasicCodePoint;
+    size_t index = numberOfBasicCodePoint > 0 ? numberOfBasicCodePoint + 1 : 0;
+    
+    unsigned int bias = initial_bias;   // 72
+    unsigned int insertIndex = 0;
+    unsigned int value = initial_value; // n 0x80, curresponding to current least-non-basic-codepoint value
+    
+    while (index < sourceLength)
+    {
+        unsigned int oldInsertIndex = insertIndex;
+        unsigned int weight = 1;
+        for(unsigned int timesOfBase = base; ; timesOfBase += base)
+        {
+            if(index >= sourceLength)
+                return -1;
+            unsigned int digit = CAPunycodeDecodeDigit(source[index++]);
+            if(digit >= base)
+                return -1;
+            if (digit > (overflowValue - insertIndex) / weight)
+                return -1;
+            insertIndex += digit * weight;
+            unsigned int threadhold = CAPunycodeThreshold(timesOfBase, bias);
+            if(digit < threadhold)
+                break;
+            if (weight > overflowValue / (base - threadhold))
+                return -1;
+            weight *= (base - threadhold);
         }
         
-        lastDelimiter++; // points to the point if non-basic codepoint coded position
+        unsigned int possibleInsertPointsAmount = (unsigned int)(currentStoreStringLength + 1);
+        bias = CAPunycodeBiasAdaptation(insertIndex - oldInsertIndex, possibleInsertPointsAmount, oldInsertIndex == 0);
         
-        size_t index = lastDelimiter - source;
-        size_t sourceStringLength = CAPunycodeStrlen(source);
+        if (insertIndex / possibleInsertPointsAmount > overflowValue - value)
+            return -1;
+        value += insertIndex / possibleInsertPointsAmount;
+        insertIndex %= possibleInsertPointsAmount;
         
-        unsigned int bias = initial_bias;   // 72
-        unsigned int insertIndex = 0;
-        unsigned int value = initial_value; // n 0x80, curresponding to current least-non-basic-codepoint value
+        if(value < initial_value || value > 0x10FFFF || (value >= 0xD800 && value <= 0xDFFF))
+            return -1;
         
-        while (index < sourceStringLength)
+        memmove(output + insertIndex + 1, output + insertIndex, sizeof(UTF32Char) * (currentStoreStringLength - insertIndex));
+        output[insertIndex++] = value;
+        currentStoreStringLength++;
+    }
+    
+    *outputLength = currentStoreStringLength;
+    return 0;
+}
+
+#pragma mark - Single Label
+
+/**
+ This follow the RFC3492 tutorial to decode the Punycode String
+
+ @param source a ASCII string terminated will '\0'
+ @return a UTF32String with ownership
+ */
+UTF32StringRef CAPunycodeDecodeASCIIString(const UTF8Char *source)
+{
+    size_t sourceStringLength = CAPunycodeStrlen(source);
+    UTF32Char *longStringArr;
+    if((longStringArr = malloc(sizeof(UTF32Char) * (sourceStringLength + 1))) != NULL)
+    {
+        size_t currentStoreStringLength;
+        if(CAPunycodeDecodeLabel(source, sourceStringLength, longStringArr, &currentStoreStringLength) != 0)
         {
-            size_t oldInsertIndex = insertIndex;    // oldInsertIndex is only used to whether it is the first time of non-basic-codepoint transform
-            unsigned int weight = 1;
-            unsigned int timesOfBase = base;    // 36
-            
-            LOOP
-            {
-                // begin consume a code point, or fail if there was none to consume
-                
-                if(index >= sourceStringLength)
-                {
-                    // punycode_bad_code
-                    free(longStringArr);
-                    CFDebugLog("CAPunycodeDecodeASCIIString badcode");
-                    return NULL;
-                }
-                
-                unsigned int digit = CAPunycodeDecodeDigit(source[index++]);
-                
-                if(digit >= base)
-                {
-                    // punycode badcode
-                    free(longStringArr);
-                    return NULL;
-                }
-                
-                if (digit > (overflowValue - insertIndex) / weight)
-                {
-                    // punycode_overflow
-                    free(longStringArr);
-                    CFDebugLog("CAPunycodeDecodeASCIIString failed on overflow");
-                    return NULL;
-                }
-                
-                insertIndex = insertIndex + digit * weight;
-                
-                unsigned int threadhold;
-                if(timesOfBase <= bias + tmin) threadhold = tmin;
-                else if(timesOfBase >= bias + tmax) threadhold = tmax;
-                else threadhold = timesOfBase - bias;     // threadhold = base * (j + 1) - bias (j is current loop index)
-                
-                if(digit < threadhold) break;
-                
-                if (weight > overflowValue / (base - threadhold))
-                {
-                    // punycode_overflow
-                    free(longStringArr);
-                    CFDebugLog("CAPunycodeDecodeASCIIString failed on overflow");
-                    return NULL;
-                }
-                
-                weight *= (base - threadhold);
-                
-                timesOfBase += base;
-            }
-            
-            bias = CAPunycodeBiasAdaptation((unsigned int)(insertIndex - oldInsertIndex), (unsigned int)(currentStoreStringLength + 1), oldInsertIndex == 0);
-            
-//            bool firstTimeOfNonBasicCodePoint = oldAccumulated == 0;
-//            unsigned int delta = (unsigned int)(accumulated - oldAccumulated);  // delta of Accumulated
-//            unsigned int possibleInsertPointsAmount = (unsigned int)(currentStoreStringLength + 1);
-//
-//            if(firstTimeOfNonBasicCodePoint) delta = delta / damp;
-//            else delta = delta / 2;
-//
-//            delta = delta + (delta / possibleInsertPointsAmount);
-//
-//            unsigned int divisionTimes;
-//            for (divisionTimes = 0;  delta > ((base - tmin) * tmax) / 2;  divisionTimes++)
-//                delta /= base - tmin;
-//
-//            bias = divisionTimes * base + (((base - tmin + 1) * delta) / (delta + skew));
-            
-            if (insertIndex / (currentStoreStringLength + 1) > overflowValue - value)
-            {
-                // punycode_overflow
-                free(longStringArr);
-                CFDebugLog("CAPunycodeDecodeASCIIString failed on overflow");
-                return NULL;
-            }
-            
-            value = (unsigned int)(value + insertIndex / (currentStoreStringLength + 1));
-            insertIndex = insertIndex % (currentStoreStringLength + 1);
-            
-            if(CAPunycodeIsBasicCodePoint(value))
-            {
-                free(longStringArr);
-                CFDebugLog("CAPunycodeDecodeASCIIString failed on punycode basic code point");
-                return NULL;
-            }
-            
-            if(currentStoreStringLength > storeArraySize)
-            {
-                UTF32Char *temp = realloc(longStringArr, sizeof(UTF32Char) * (storeArraySize + storeArrayIncreaseAmount));
-                if(temp == NULL)
-                {
-                    free(longStringArr);
-                    CFDebugLog("CAPunycodeDecodeASCIIString allcate temp array failed");
-                    return NULL;
-                }
-                longStringArr = temp;
-                storeArraySize += storeArrayIncreaseAmount;
-            }
-            
-            if(currentStoreStringLength > 0)
-            {
-                for(long stringArrIndex = currentStoreStringLength - 1; stringArrIndex >= insertIndex; stringArrIndex--)
-                    longStringArr[stringArrIndex + 1] = longStringArr[stringArrIndex];
-            }
-            
-            longStringArr[insertIndex] = value;
-            
-            currentStoreStringLength++;
-            
-            insertIndex++;
+            free(longStringArr);
+            CFDebugLog("CAPunycodeDecodeASCIIString not valid punycode string");
+            return NULL;
         }
         
         UTF32StringRef result;
@@ -250,201 +287,580 @@ UTF32StringRef CAPunycodeDecodeASCIIString(const UTF8Char *source)
 
 UTF32StringRef CAPunycodeEecodeUnicodeString(const UTF32Char *source)
 {
-    size_t storeArraySize = CAPunycodeDecodeInitialTempArraySize;   // 512
-    const size_t storeArrayIncreaseAmount = CAPunycodeDecodeInitialTempArrayIncreasedAmount;    // 64
-    size_t currentStoreStringLength = 0;
-    UTF32Char *longStringArr;
-    if((longStringArr = malloc(sizeof(UTF32Char) * storeArraySize)) != NULL)
+    size_t sourceStringLength = CAPunycodeUnicodeStrlen(source);
+    UTF32Char *sortedScratch;
+    if((sortedScratch = malloc(sizeof(UTF32Char) * (sourceStringLength + 1))) != NULL)
     {
-        
-        size_t sourceStringLength = CAPunycodeUnicodeStrlen(source);
-        
-        unsigned int value = initial_value;
-        unsigned int currentOutputpoints = 0;     // delta of accumulated
-        unsigned int bias = initial_bias;
-        
-        
-        unsigned int numberOfBasicCodePoint = 0;
-        for(size_t loopIndex = 0; loopIndex < sourceStringLength; loopIndex++)
-            if((CAPunycodeIsBasicCodePoint(source[loopIndex])))
-                numberOfBasicCodePoint++;
-        
-        if(numberOfBasicCodePoint > 0)
+        UTF8Char *output;
+        if((output = malloc(sourceStringLength * CAPunycodeEncodeMaximumDigitsPerCodePoint + 2)) != NULL)
         {
-            for(size_t loopIndex = 0; loopIndex < sourceStringLength; loopIndex++)
-                if((CAPunycodeIsBasicCodePoint(source[loopIndex])))
-                {
-                    if(currentStoreStringLength > storeArraySize)
-                    {
-                        UTF32Char *temp = realloc(longStringArr, sizeof(UTF32Char) * (storeArraySize + storeArrayIncreaseAmount));
-                        if(temp == NULL)
-                        {
-                            free(longStringArr);
-                            CFDebugLog("CAPunycodeEecodeUnicodeString allcate temp array failed");
-                            return NULL;
-                        }
-                        longStringArr = temp;
-                        storeArraySize += storeArrayIncreaseAmount;
-                    }
-                    
-                    longStringArr[currentStoreStringLength++] = source[loopIndex];
-                }
+            size_t currentStoreStringLength;
+            if(CAPunycodeEncodeLabel(source, sourceStringLength, sortedScratch, output, &currentStoreStringLength) != 0)
+            {
+                free(output);
+                free(sortedScratch);
+                CFDebugLog("CAPunycodeEecodeUnicodeString overflow");
+                return NULL;
+            }
+            output[currentStoreStringLength] = '\0';
             
-            if(currentStoreStringLength > storeArraySize)
+            UTF32StringRef result;
+            if((result = UTF32StringCreateWithUTF8String(output)) != NULL)
             {
-                UTF32Char *temp = realloc(longStringArr, sizeof(UTF32Char) * (storeArraySize + storeArrayIncreaseAmount));
-                if(temp == NULL)
-                {
-                    free(longStringArr);
-                    CFDebugLog("CAPunycodeEecodeUnicodeString allcate temp array failed");
-                    return NULL;
-                }
-                longStringArr = temp;
-                storeArraySize += storeArrayIncreaseAmount;
+                free(output);
+                free(sortedScratch);
+                return result;
             }
             
-            longStringArr[currentStoreStringLength++] = '-';
+            CFDebugLog("CAPunycodeEecodeASCIIString create UTF32String failed");
+            
+            free(output);
         }
-        
-        unsigned int alreadyOutputLength = numberOfBasicCodePoint;
-        
-        while (alreadyOutputLength < sourceStringLength)
+        free(sortedScratch);
+    }
+    return NULL;
+}
+
+#pragma mark - Domain Batch
+
+typedef struct CAPunycodeDomain {
+    size_t offset, length;
+    bool valid;
+} CAPunycodeDomain;
+
+struct CAPunycodeDomainBatch {
+    UTF8Char *arena;                    // every converted domain, each terminated by '\0'
+    size_t arenaLength, arenaSize;
+    CAPunycodeDomain *domains;
+    size_t domainAmount, domainSize;
+    UTF32Char *codePoints, *sortedScratch;  // label scratch
+    size_t scratchSize;
+};
+
+static int CAPunycodeDomainBatchConvert(CAPunycodeDomainBatchRef batch, const UTF8Char *domains, size_t length, bool encode);
+static int CAPunycodeDomainBatchConvertDomain(CAPunycodeDomainBatchRef batch, const UTF8Char *domain, size_t length, bool encode);
+static int CAPunycodeDomainBatchEncodeLabel(CAPunycodeDomainBatchRef batch, const UTF8Char *label, size_t length);
+static int CAPunycodeDomainBatchDecodeLabel(CAPunycodeDomainBatchRef batch, const UTF8Char *label, size_t length);
+static int CAPunycodeDomainBatchReserveArena(CAPunycodeDomainBatchRef batch, size_t amount);
+static int CAPunycodeDomainBatchReserveScratch(CAPunycodeDomainBatchRef batch, size_t amount);
+static size_t CAPunycodeDecodeUTF8(const UTF8Char *source, size_t length, UTF32Char *output);
+static size_t CAPunycodeEncodeUTF8(const UTF32Char *source, size_t length, UTF8Char *output);
+static bool CAPunycodeIsACELabel(const UTF8Char *label, size_t length);
+
+CAPunycodeDomainBatchRef CAPunycodeDomainBatchCreate(void)
+{
+    CAPunycodeDomainBatchRef result;
+    if((result = malloc(sizeof(struct CAPunycodeDomainBatch))) != NULL)
+    {
+        if((result->arena = malloc(CAPunycodeDomainBatchInitialArenaSize)) != NULL)
         {
-            unsigned int min_non_basic_codepoint = overflowValue;
-            for (size_t loopIndex = 0;  loopIndex < sourceStringLength;  loopIndex++)
+            if((result->domains = malloc(sizeof(CAPunycodeDomain) * CAPunycodeDomainBatchInitialDomainAmount)) != NULL)
             {
-                UTF32Char character = source[loopIndex];
-                if (character >= value && character < min_non_basic_codepoint)   // value begin with 0x80
-                    min_non_basic_codepoint = source[loopIndex];
+                result->arenaLength = 0;
+                result->arenaSize = CAPunycodeDomainBatchInitialArenaSize;
+                result->domainAmount = 0;
+                result->domainSize = CAPunycodeDomainBatchInitialDomainAmount;
+                result->codePoints = NULL;
+                result->sortedScratch = NULL;
+                result->scratchSize = 0;
+                return result;
             }
-            
-            if (min_non_basic_codepoint - value > (overflowValue - currentOutputpoints) / (alreadyOutputLength + 1))
+            free(result->arena);
+        }
+        free(result);
+    }
+    return NULL;
+}
+
+void CAPunycodeDomainBatchDestory(CAPunycodeDomainBatchRef batch)
+{
+    if(batch == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CAPunycodeDomainBatchDestory NULL");
+    free(batch->arena);
+    free(batch->domains);
+    free(batch->codePoints);
+    free(batch->sortedScratch);
+    free(batch);
+}
+
+void CAPunycodeDomainBatchRemoveAllDomains(CAPunycodeDomainBatchRef batch)
+{
+    if(batch == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CAPunycodeDomainBatchRemoveAllDomains NULL");
+    batch->arenaLength = 0;
+    batch->domainAmount = 0;
+}
+
+int CAPunycodeDomainBatchEncodeDomains(CAPunycodeDomainBatchRef batch, const UTF8Char *domains, size_t length)
+{
+    if(batch == NULL || (domains == NULL && length != 0))
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CAPunycodeDomainBatch %p EncodeDomains %p", batch, domains);
+    return CAPunycodeDomainBatchConvert(batch, domains, length, true);
+}
+
+int CAPunycodeDomainBatchDecodeDomains(CAPunycodeDomainBatchRef batch, const UTF8Char *domains, size_t length)
+{
+    if(batch == NULL || (domains == NULL && length != 0))
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CAPunycodeDomainBatch %p DecodeDomains %p", batch, domains);
+    return CAPunycodeDomainBatchConvert(batch, domains, length, false);
+}
+
+size_t CAPunycodeDomainBatchGetDomainAmount(CAPunycodeDomainBatchRef batch)
+{
+    if(batch == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CAPunycodeDomainBatchGetDomainAmount NULL");
+    return batch->domainAmount;
+}
+
+const UTF8Char *CAPunycodeDomainBatchGetDomainAtIndex(CAPunycodeDomainBatchRef batch, size_t index, size_t *length)
+{
+    if(batch == NULL || index >= batch->domainAmount)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CAPunycodeDomainBatch %p GetDomainAtIndex %zu", batch, index);
+    CAPunycodeDomain domain = batch->domains[index];
+    if(length != NULL) *length = domain.length;
+    return domain.valid ? batch->arena + domain.offset : NULL;
+}
+
+static int CAPunycodeDomainBatchConvert(CAPunycodeDomainBatchRef batch, const UTF8Char *domains, size_t length, bool encode)
+{
+    const UTF8Char *current = domains, *end = domains + length;
+    while(current < end)
+    {
+        const UTF8Char *lineEnd = memchr(current, '\n', end - current);
+        const UTF8Char *next = lineEnd != NULL ? lineEnd + 1 : end;
+        if(lineEnd == NULL) lineEnd = end;
+        if(lineEnd > current && lineEnd[-1] == '\r') lineEnd--;
+        if(CAPunycodeDomainBatchConvertDomain(batch, current, lineEnd - current, encode) != 0)
+            return -1;
+        current = next;
+    }
+    return 0;
+}
+
+static int CAPunycodeDomainBatchConvertDomain(CAPunycodeDomainBatchRef batch, const UTF8Char *domain, size_t length, bool encode)
+{
+    if(batch->domainAmount == batch->domainSize)
+    {
+        CAPunycodeDomain *temp = realloc(batch->domains, sizeof(CAPunycodeDomain) * batch->domainSize * 2);
+        if(temp == NULL)
+            return -1;
+        batch->domains = temp;
+        batch->domainSize *= 2;
+    }
+    
+    // all-ASCII domain without ACE label is the same in both forms, copied as a whole
+    bool fastPath = true;
+    for(size_t index = 0; index < length && fastPath; index++)
+        if(domain[index] >= initial_value ||
+           (!encode && (index == 0 || domain[index - 1] == '.') && CAPunycodeIsACELabel(domain + index, length - index)))
+            fastPath = false;
+    
+    size_t domainOffset = batch->arenaLength;
+    bool valid = true;
+    if(fastPath)
+    {
+        if(CAPunycodeDomainBatchReserveArena(batch, length + 1) != 0)
+            return -1;
+        memcpy(batch->arena + batch->arenaLength, domain, length);
+        batch->arenaLength += length;
+    }
+    else
+    {
+        const UTF8Char *label = domain, *end = domain + length;
+        LOOP
+        {
+            const UTF8Char *labelEnd = memchr(label, '.', end - label);
+            if(labelEnd == NULL) labelEnd = end;
+            int result = encode ? CAPunycodeDomainBatchEncodeLabel(batch, label, labelEnd - label) : CAPunycodeDomainBatchDecodeLabel(batch, label, labelEnd - label);
+            if(result < 0)
+                return -1;
+            if(result > 0)
             {
-                CFDebugLog("CAPunycodeEecodeUnicodeString overflow");
-                free(longStringArr);
-                return NULL;
+                valid = false;
+                break;
             }
-            
-            // currentOutputpoints is intially zero, actually is the points of output
-            currentOutputpoints += (min_non_basic_codepoint - value) * (alreadyOutputLength + 1);
-            // intially currentOutputpoints = 0
-            value = min_non_basic_codepoint;
-            
-            for(size_t index = 0; index < sourceStringLength; index++)
+            if(labelEnd == end)
+                break;
+            if(CAPunycodeDomainBatchReserveArena(batch, 2) != 0)
+                return -1;
+            batch->arena[batch->arenaLength++] = '.';
+            label = labelEnd + 1;
+        }
+    }
+    
+    if(valid)
+    {
+        batch->arena[batch->arenaLength++] = '\0';   // every label path reserves the extra octet
+        batch->domains[batch->domainAmount++] = (CAPunycodeDomain){.offset = domainOffset, .length = batch->arenaLength - 1 - domainOffset, .valid = true};
+    }
+    else
+    {
+        batch->arenaLength = domainOffset;
+        batch->domains[batch->domainAmount++] = (CAPunycodeDomain){.offset = domainOffset, .length = 0, .valid = false};
+    }
+    return 0;
+}
+
+/**
+ @return 0 for success, 1 if the label could not be encoded, -1 if out of memory
+ */
+static int CAPunycodeDomainBatchEncodeLabel(CAPunycodeDomainBatchRef batch, const UTF8Char *label, size_t length)
+{
+    if(CAPunycodeDomainBatchReserveScratch(batch, length) != 0)
+        return -1;
+    size_t codePointAmount = CAPunycodeDecodeUTF8(label, length, batch->codePoints);
+    if(codePointAmount == SIZE_MAX)
+        return 1;
+    
+    if(codePointAmount == length)
+    {
+        // ASCII label
+        if(CAPunycodeDomainBatchReserveArena(batch, length + 1) != 0)
+            return -1;
+        memcpy(batch->arena + batch->arenaLength, label, length);
+        batch->arenaLength += length;
+        return 0;
+    }
+    
+    if(CAPunycodeDomainBatchReserveArena(batch, 4 + codePointAmount * CAPunycodeEncodeMaximumDigitsPerCodePoint + 2) != 0)
+        return -1;
+    UTF8Char *output = batch->arena + batch->arenaLength;
+    memcpy(output, "xn--", 4);
+    size_t outputLength;
+    if(CAPunycodeEncodeLabel(batch->codePoints, codePointAmount, batch->sortedScratch, output + 4, &outputLength) != 0)
+        return 1;
+    if(outputLength + 4 > CAPunycodeLabelMaximumLength)
+        return 1;
+    batch->arenaLength += outputLength + 4;
+    return 0;
+}
+
+/**
+ @return 0 for success, 1 if the label is not valid punycode or malformed UTF-8, -1 if out of memory
+ */
+static int CAPunycodeDomainBatchDecodeLabel(CAPunycodeDomainBatchRef batch, const UTF8Char *label, size_t length)
+{
+    if(!CAPunycodeIsACELabel(label, length))
+    {
+        // copied as it is, but non-ASCII octets must still be well-formed UTF-8
+        bool isASCII = true;
+        for(size_t index = 0; index < length && isASCII; index++)
+            if(label[index] >= initial_value) isASCII = false;
+        if(!isASCII)
+        {
+            if(CAPunycodeDomainBatchReserveScratch(batch, length) != 0)
+                return -1;
+            if(CAPunycodeDecodeUTF8(label, length, batch->codePoints) == SIZE_MAX)
+                return 1;
+        }
+        if(CAPunycodeDomainBatchReserveArena(batch, length + 1) != 0)
+            return -1;
+        memcpy(batch->arena + batch->arenaLength, label, length);
+        batch->arenaLength += length;
+        return 0;
+    }
+    
+    if(CAPunycodeDomainBatchReserveScratch(batch, length) != 0)
+        return -1;
+    size_t codePointAmount;
+    if(length == 4 || CAPunycodeDecodeLabel(label + 4, length - 4, batch->codePoints, &codePointAmount) != 0)
+        return 1;
+    if(CAPunycodeDomainBatchReserveArena(batch, codePointAmount * 4 + 1) != 0)
+        return -1;
+    batch->arenaLength += CAPunycodeEncodeUTF8(batch->codePoints, codePointAmount, batch->arena + batch->arenaLength);
+    return 0;
+}
+
+static int CAPunycodeDomainBatchReserveArena(CAPunycodeDomainBatchRef batch, size_t amount)
+{
+    if(batch->arenaSize - batch->arenaLength >= amount)
+        return 0;
+    size_t newSize = batch->arenaSize * 2;
+    while(newSize - batch->arenaLength < amount) newSize *= 2;
+    UTF8Char *temp = realloc(batch->arena, newSize);
+    if(temp == NULL)
+        return -1;
+    batch->arena = temp;
+    batch->arenaSize = newSize;
+    return 0;
+}
+
+static int CAPunycodeDomainBatchReserveScratch(CAPunycodeDomainBatchRef batch, size_t amount)
+{
+    if(batch->scratchSize >= amount)
+        return 0;
+    size_t newSize = batch->scratchSize == 0 ? 64 : batch->scratchSize;
+    while(newSize < amount) newSize *= 2;
+    UTF32Char *codePoints, *sortedScratch;
+    if((codePoints = realloc(batch->codePoints, sizeof(UTF32Char) * newSize)) == NULL)
+        return -1;
+    batch->codePoints = codePoints;
+    if((sortedScratch = realloc(batch->sortedScratch, sizeof(UTF32Char) * newSize)) == NULL)
+        return -1;
+    batch->sortedScratch = sortedScratch;
+    batch->scratchSize = newSize;
+    return 0;
+}
+
+#pragma mark - Pipeline
+
+typedef struct CAPunycodePipelineWorker
+{
+    CAPunycodeDomainBatchRef batch;     // per-thread scratch and output arena, reused every round
+    const UTF8Char *domains;
+    size_t length;
+    bool encode;
+    int result;
+    CFExceptionCatchFunction catchFunction;     // catch function of the calling thread
+} CAPunycodePipelineWorker;
+
+static void *CAPunycodePipelineWorkerMain(void *argument)
+{
+    CAPunycodePipelineWorker *worker = argument;
+    CFExceptionCatchStackPush(worker->catchFunction);
+    CAPunycodeDomainBatchRemoveAllDomains(worker->batch);
+    worker->result = CAPunycodeDomainBatchConvert(worker->batch, worker->domains, worker->length, worker->encode);
+    CFExceptionCatchStackPop();
+    return NULL;
+}
+
+static int CAPunycodePipelineWriteBatch(CAPunycodeDomainBatchRef batch, FILE *output)
+{
+    // valid domains lie back to back in the arena, so their '\0' becomes '\n' and runs of them are written at once
+    size_t runBegin = 0, runEnd = 0;
+    for(size_t index = 0; index < batch->domainAmount; index++)
+    {
+        CAPunycodeDomain domain = batch->domains[index];
+        if(domain.valid)
+        {
+            batch->arena[domain.offset + domain.length] = '\n';
+            runEnd = domain.offset + domain.length + 1;
+            continue;
+        }
+        if(runEnd > runBegin && fwrite(batch->arena + runBegin, 1, runEnd - runBegin, output) != runEnd - runBegin)
+            return -1;
+        runBegin = runEnd;
+        if(fputc('\n', output) == EOF)
+            return -1;
+    }
+    if(runEnd > runBegin && fwrite(batch->arena + runBegin, 1, runEnd - runBegin, output) != runEnd - runBegin)
+        return -1;
+    return 0;
+}
+
+static const UTF8Char *CAPunycodePipelineChunkEnd(const UTF8Char *current, const UTF8Char *end)
+{
+    if((size_t)(end - current) <= CAPunycodePipelineChunkSize)
+        return end;
+    const UTF8Char *lineEnd = memchr(current + CAPunycodePipelineChunkSize, '\n', end - current - CAPunycodePipelineChunkSize);
+    return lineEnd != NULL ? lineEnd + 1 : end;
+}
+
+int CAPunycodeConvertDomainsConcurrently(const UTF8Char *domains, size_t length, bool encode, FILE *output, unsigned int threadAmount)
+{
+    if((domains == NULL && length != 0) || output == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CAPunycodeConvertDomainsConcurrently %p %zu %p", domains, length, output);
+#ifdef CF_OS_UNIX
+    if(threadAmount == 0)
+    {
+        long processorAmount = sysconf(_SC_NPROCESSORS_ONLN);
+        threadAmount = processorAmount > 0 ? (unsigned int)processorAmount : 1;
+    }
+    size_t chunkAmount = length / CAPunycodePipelineChunkSize + 1;
+    if(threadAmount > chunkAmount)
+        threadAmount = (unsigned int)chunkAmount;
+#else
+    threadAmount = 1;
+#endif
+    int result = -1;
+    CAPunycodePipelineWorker *workers;
+    if((workers = calloc(threadAmount, sizeof(CAPunycodePipelineWorker))) != NULL)
+    {
+        bool batchCreated = true;
+        for(unsigned int index = 0; index < threadAmount && batchCreated; index++)
+            batchCreated = (workers[index].batch = CAPunycodeDomainBatchCreate()) != NULL;
+        if(batchCreated)
+        {
+#ifdef CF_OS_UNIX
+            pthread_t *threads;
+            if((threads = malloc(sizeof(pthread_t) * threadAmount)) != NULL)
             {
-                UTF32Char character = source[index];
-                
-                if(character < value)
-                    if (++currentOutputpoints == 0)   // the position of position value added to points is caculated here
-                    {
-                        CFDebugLog("CAPunycodeEecodeUnicodeString overflow");
-                        free(longStringArr);
-                        return NULL;
-                    }
-                
-                if (character == value)
+                bool *threadCreated;
+                if((threadCreated = calloc(threadAmount, sizeof(bool))) != NULL)
                 {
-                    unsigned int remainingPoints = currentOutputpoints;
-                    unsigned timesOfBase = base;
-                    
-                    LOOP
+#endif
+                    CFExceptionCatchFunction catchFunction = CFExceptionCatchStackCurrentFunction();
+                    const UTF8Char *current = domains, *end = domains + length;
+                    result = 0;
+                    // each round hands every worker the next chunk, then writes the chunks out in input order
+                    while(current < end && result == 0)
                     {
-                        unsigned int threadhold;
-                        if(timesOfBase <= bias + tmin) threadhold = tmin;
-                        else if(timesOfBase >= bias + tmax) threadhold = tmax;
-                        else threadhold = timesOfBase - bias;     // threadhold = base * (j + 1) - bias (j is current loop index)
-                        
-                        if(remainingPoints < threadhold)
-                            break;
-                        
-                        UTF32Char codePointForDigit = CAPunycodeEecodeDigit(threadhold + (remainingPoints - threadhold) % (base - threadhold));
-                        
-                        if(!CAPunycodeIsBasicCodePoint(codePointForDigit))
+                        unsigned int roundAmount = 0;
+                        for(; roundAmount < threadAmount && current < end; roundAmount++)
                         {
-                            free(longStringArr);
-                            CFDebugLog("CAPunycodeEecodeUnicodeString badcode");
-                            return NULL;
+                            const UTF8Char *chunkEnd = CAPunycodePipelineChunkEnd(current, end);
+                            workers[roundAmount].domains = current;
+                            workers[roundAmount].length = chunkEnd - current;
+                            workers[roundAmount].encode = encode;
+                            workers[roundAmount].catchFunction = catchFunction;
+                            current = chunkEnd;
                         }
-                        
-                        if(currentStoreStringLength > storeArraySize)
-                        {
-                            UTF32Char *temp = realloc(longStringArr, sizeof(UTF32Char) * (storeArraySize + storeArrayIncreaseAmount));
-                            if(temp == NULL)
+#ifdef CF_OS_UNIX
+                        // worker 0 runs on calling thread, and so does any worker failed to get its own thread
+                        for(unsigned int index = 1; index < roundAmount; index++)
+                            threadCreated[index] = pthread_create(&threads[index], NULL, CAPunycodePipelineWorkerMain, &workers[index]) == 0;
+                        for(unsigned int index = 0; index < roundAmount; index++)
+                            if(!threadCreated[index])
+                                CAPunycodePipelineWorkerMain(&workers[index]);
+                        for(unsigned int index = 1; index < roundAmount; index++)
+                            if(threadCreated[index])
                             {
-                                free(longStringArr);
-                                CFDebugLog("CAPunycodeEecodeUnicodeString allcate temp array failed");
-                                return NULL;
+                                pthread_join(threads[index], NULL);
+                                threadCreated[index] = false;
                             }
-                            longStringArr = temp;
-                            storeArraySize += storeArrayIncreaseAmount;
-                        }
-                        
-                        longStringArr[currentStoreStringLength++] = codePointForDigit;
-                        
-                        remainingPoints = (remainingPoints - threadhold) / (base - threadhold);
-                        timesOfBase += base;
+#else
+                        CAPunycodePipelineWorkerMain(&workers[0]);
+#endif
+                        for(unsigned int index = 0; index < roundAmount && result == 0; index++)
+                            if(workers[index].result != 0 || CAPunycodePipelineWriteBatch(workers[index].batch, output) != 0)
+                                result = -1;
                     }
-                    
-                    UTF32Char codePointForDigit = CAPunycodeEecodeDigit(remainingPoints);
-                    
-                    if(!CAPunycodeIsBasicCodePoint(codePointForDigit))
-                    {
-                        free(longStringArr);
-                        CFDebugLog("CAPunycodeEecodeUnicodeString badcode");
-                        return NULL;
-                    }
-                    
-                    if(currentStoreStringLength > storeArraySize)
-                    {
-                        UTF32Char *temp = realloc(longStringArr, sizeof(UTF32Char) * (storeArraySize + storeArrayIncreaseAmount));
-                        if(temp == NULL)
-                        {
-                            free(longStringArr);
-                            CFDebugLog("CAPunycodeDecodeASCIIString allcate temp array failed");
-                            return NULL;
-                        }
-                        longStringArr = temp;
-                        storeArraySize += storeArrayIncreaseAmount;
-                    }
-                    
-                    longStringArr[currentStoreStringLength++] = codePointForDigit;
-                    
-                    bias = CAPunycodeBiasAdaptation(currentOutputpoints, alreadyOutputLength+1, alreadyOutputLength == numberOfBasicCodePoint);
-                    
-                    currentOutputpoints = 0;    // it is cleared here
-                    
-                    alreadyOutputLength++;
+#ifdef CF_OS_UNIX
+                    free(threadCreated);
                 }
+                free(threads);
             }
-            currentOutputpoints++;
-            value++;    // next time value is larger than before
+#endif
         }
-        
-        UTF32StringRef result;
-        if((result = UTF32StringCreateWithCharacterArray(longStringArr, currentStoreStringLength)) != NULL)
+        for(unsigned int index = 0; index < threadAmount; index++)
+            if(workers[index].batch != NULL)
+                CAPunycodeDomainBatchDestory(workers[index].batch);
+        free(workers);
+    }
+    return result;
+}
+
+int CAPunycodeConvertDomainFileConcurrently(const char *path, bool encode, FILE *output, unsigned int threadAmount)
+{
+    if(path == NULL || output == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "CAPunycodeConvertDomainFileConcurrently %p %p", path, output);
+    int result = -1;
+#ifdef CF_OS_UNIX
+    int file;
+    if((file = open(path, O_RDONLY)) != -1)
+    {
+        struct stat fileStatus;
+        if(fstat(file, &fileStatus) == 0)
         {
-            free(longStringArr);
-            return result;
+            size_t length = (size_t)fileStatus.st_size;
+            if(length == 0)
+                result = 0;
+            else
+            {
+                void *mapped;
+                if((mapped = mmap(NULL, length, PROT_READ, MAP_PRIVATE, file, 0)) != MAP_FAILED)
+                {
+                    madvise(mapped, length, MADV_SEQUENTIAL);
+                    result = CAPunycodeConvertDomainsConcurrently(mapped, length, encode, output, threadAmount);
+                    munmap(mapped, length);
+                }
+            }
         }
-        
-        CFDebugLog("CAPunycodeEecodeASCIIString create UTF32String failed");
-        
-        free(longStringArr);
+        close(file);
     }
-    return NULL;
+#else
+    FILE *file;
+    if((file = fopen(path, "rb")) != NULL)
+    {
+        if(fseek(file, 0, SEEK_END) == 0)
+        {
+            long length = ftell(file);
+            UTF8Char *content;
+            if(length >= 0 && fseek(file, 0, SEEK_SET) == 0 && (content = malloc((size_t)length + 1)) != NULL)
+            {
+                if(fread(content, 1, (size_t)length, file) == (size_t)length)
+                    result = CAPunycodeConvertDomainsConcurrently(content, (size_t)length, encode, output, threadAmount);
+                free(content);
+            }
+        }
+        fclose(file);
+    }
+#endif
+    return result;
+}
+
+#pragma mark - Utility
+
+static bool CAPunycodeIsACELabel(const UTF8Char *label, size_t length)
+{
+    return length >= 4 && (label[0] | 0x20) == 'x' && (label[1] | 0x20) == 'n' && label[2] == '-' && label[3] == '-';
+}
+
+/**
+ @return code point amount, SIZE_MAX if source is not well-formed UTF-8
+ */
+static size_t CAPunycodeDecodeUTF8(const UTF8Char *source, size_t length, UTF32Char *output)
+{
+    size_t outputLength = 0;
+    for(size_t index = 0; index < length; )
+    {
+        UTF8Char lead = source[index];
+        if(lead < 0x80)
+        {
+            output[outputLength++] = lead;
+            index++;
+            continue;
+        }
+        size_t trailAmount;
+        UTF32Char codePoint, minimum;
+        if(lead >= 0xC2 && lead <= 0xDF) { trailAmount = 1; codePoint = lead & 0x1F; minimum = 0x80; }
+        else if(lead >= 0xE0 && lead <= 0xEF) { trailAmount = 2; codePoint = lead & 0x0F; minimum = 0x800; }
+        else if(lead >= 0xF0 && lead <= 0xF4) { trailAmount = 3; codePoint = lead & 0x07; minimum = 0x10000; }
+        else return SIZE_MAX;
+        if(length - index <= trailAmount)
+            return SIZE_MAX;
+        for(size_t trail = 1; trail <= trailAmount; trail++)
+        {
+            if((source[index + trail] & 0xC0) != 0x80)
+                return SIZE_MAX;
+            codePoint = (codePoint << 6) | (source[index + trail] & 0x3F);
+        }
+        if(codePoint < minimum || codePoint > 0x10FFFF || (codePoint >= 0xD800 && codePoint <= 0xDFFF))
+            return SIZE_MAX;
+        output[outputLength++] = codePoint;
+        index += trailAmount + 1;
+    }
+    return outputLength;
 }
 
-static const UTF8Char * CAPunycodeStrrchr(const UTF8Char *source, UTF8Char ch)
+static size_t CAPunycodeEncodeUTF8(const UTF32Char *source, size_t length, UTF8Char *output)
 {
-    if(source == NULL) return NULL;
-    const UTF8Char *endPoint = source;
-    while (*endPoint != '\0') endPoint++;
-    while (endPoint >= source)
+    size_t outputLength = 0;
+    for(size_t index = 0; index < length; index++)
     {
-        if(*endPoint == ch) return endPoint;
-        endPoint--;
+        UTF32Char codePoint = source[index];
+        if(codePoint < 0x80)
+            output[outputLength++] = (UTF8Char)codePoint;
+        else if(codePoint < 0x800)
+        {
+            output[outputLength++] = (UTF8Char)(0xC0 | codePoint >> 6);
+            output[outputLength++] = (UTF8Char)(0x80 | (codePoint & 0x3F));
+        }
+        else if(codePoint < 0x10000)
+        {
+            output[outputLength++] = (UTF8Char)(0xE0 | codePoint >> 12);
+            output[outputLength++] = (UTF8Char)(0x80 | (codePoint >> 6 & 0x3F));
+            output[outputLength++] = (UTF8Char)(0x80 | (codePoint & 0x3F));
+        }
+        else
+        {
+            output[outputLength++] = (UTF8Char)(0xF0 | codePoint >> 18);
+            output[outputLength++] = (UTF8Char)(0x80 | (codePoint >> 12 & 0x3F));
+            output[outputLength++] = (UTF8Char)(0x80 | (codePoint >> 6 & 0x3F));
+            output[outputLength++] = (UTF8Char)(0x80 | (codePoint & 0x3F));
+        }
     }
-    return NULL;
+    return outputLength;
 }
 
 static size_t CAPunycodeStrlen(const UTF8Char *source)
@@ -463,27 +879,16 @@ static size_t CAPunycodeUnicodeStrlen(const UTF32Char *source)
     return --result;
 }
 
-static bool CAPunycodeIsBasicCodePoint(UTF32Char codePoint)
-{
-    if((codePoint >= 'a' && codePoint <= 'z') ||
-       (codePoint >= 'A' && codePoint <= 'Z') ||
-       (codePoint >= '0' && codePoint <= '9'))
-        return true;
-    return false;
-}
-
 static unsigned int CAPunycodeDecodeDigit(UTF8Char ch)
 {
     if(ch >= 'a' && ch <= 'z') return ch - 'a';
     if(ch >= 'A' && ch <= 'Z') return ch - 'A';
     if(ch >= '0' && ch <= '9') return ch - '0' + 26;
-    CFDebugLog("CAPunycodePunycodeDecodeDigit hex:%#X failed, not a valid encoded punycode value", (unsigned int)ch);
     return UINT_MAX;
 }
 
-static UTF32Char CAPunycodeEecodeDigit(unsigned int value)
+static UTF8Char CAPunycodeEecodeDigit(unsigned int value)
 {
     if(value <= 25) return 'a' + value;
-    if(value < 36) return '0' + value - 26;
-    return (UTF32Char)-1;
+    return '0' + value - 26;
 }
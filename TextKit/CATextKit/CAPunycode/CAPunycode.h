@@ -9,10 +9,85 @@
 #ifndef CAPunycode_h
 #define CAPunycode_h
 
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdio.h>
+
 #include "UTF32String.h"
 
+#pragma mark - Single Label
+
 UTF32StringRef CAPunycodeDecodeASCIIString(const UTF8Char *source);
 
 UTF32StringRef CAPunycodeEecodeUnicodeString(const UTF32Char *source);
 
+#pragma mark - Domain Batch
+
+typedef struct CAPunycodeDomainBatch *CAPunycodeDomainBatchRef;
+
+/**
+ Create an empty batch, converted domains of all later calls are appended to its single output arena
+
+ @return NULL if out of memory
+ */
+CAPunycodeDomainBatchRef CAPunycodeDomainBatchCreate(void);
+
+void CAPunycodeDomainBatchDestory(CAPunycodeDomainBatchRef batch);
+
+/**
+ Forget every converted domain, the arena and scratch buffers are kept for the next batch
+ */
+void CAPunycodeDomainBatchRemoveAllDomains(CAPunycodeDomainBatchRef batch);
+
+/**
+ IDNA ToASCII of every domain in the buffer, labels with non-ASCII code points become "xn--" punycode labels
+
+ @param domains UTF-8 domains separated by '\n', a '\r' before '\n' is dropped, need not be terminated
+ @param length length of domains in octets
+ @return 0 for success, -1 if out of memory, the domains converted before it stay in the batch
+ */
+int CAPunycodeDomainBatchEncodeDomains(CAPunycodeDomainBatchRef batch, const UTF8Char *domains, size_t length);
+
+/**
+ IDNA ToUnicode of every domain in the buffer, "xn--" labels (case insensitive) are decoded to UTF-8, others are copied
+
+ @param domains the same layout CAPunycodeDomainBatchEncodeDomains takes
+ @return 0 for success, -1 if out of memory
+ */
+int CAPunycodeDomainBatchDecodeDomains(CAPunycodeDomainBatchRef batch, const UTF8Char *domains, size_t length);
+
+size_t CAPunycodeDomainBatchGetDomainAmount(CAPunycodeDomainBatchRef batch);
+
+/**
+ Get one converted domain, in the order of input, one for each line including empty ones
+
+ @param length if not NULL, the length of the domain in octets
+ @return the domain terminated by '\0' inside the batch arena, invalid after next convert or remove,
+         NULL if the domain failed: malformed UTF-8, bad punycode, or an encoded label longer than 63 octets
+ */
+const UTF8Char *CAPunycodeDomainBatchGetDomainAtIndex(CAPunycodeDomainBatchRef batch, size_t index, size_t *length);
+
+#pragma mark - Pipeline
+
+/**
+ Convert a large buffer of domains on several threads, writing one line for each input line to output
+
+ @param domains the same layout CAPunycodeDomainBatchEncodeDomains takes
+ @param encode true for IDNA ToASCII, false for ToUnicode
+ @param output every converted domain followed by '\n', in input order, a failed domain is an empty line
+ @param threadAmount 0 means one thread for each online processor
+ @return 0 for success, -1 if out of memory or writing output failed, output then holds a prefix of the result
+ @discussion the buffer is cut into chunks at line ends, each round every worker converts one chunk into its own batch,
+             then the chunks are written in order, so memory stays bounded by the thread amount, not the input
+             platform without pthread converts on calling thread
+ */
+int CAPunycodeConvertDomainsConcurrently(const UTF8Char *domains, size_t length, bool encode, FILE *output, unsigned int threadAmount);
+
+/**
+ CAPunycodeConvertDomainsConcurrently on the content of a file, memory mapped where the platform could
+
+ @return 0 for success, -1 if the file could not be read, or the conversion failed
+ */
+int CAPunycodeConvertDomainFileConcurrently(const char *path, bool encode, FILE *output, unsigned int threadAmount);
+
 #endif /* CAPunycode_h */
@@ -14,6 +14,12 @@
 #include "UTF32String.h"
 #include "CFException.h"
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE4_1__)
+#include <smmintrin.h>
+#endif
+
 #define UTF8Mask0(mask) (!(((UTF8Char)(1 << 7)) & (mask)))
 #define UTF8Mask10(mask) (!(((UTF8Char)(1 << 6)) & (mask)))
 #define UTF8Mask110(mask) (!(((UTF8Char)(1 << 5)) & (mask)))
@@ -28,6 +34,8 @@ struct UTF32String {
 };
 
 static UTF32StringRef UTF32StringCreateWithLength(size_t length);
+static size_t UTF32StringCopyASCIIRun(const UTF32Char *data, size_t length, UTF8Char *buffer);
+static size_t UTF32StringCopyBMPRun(const UTF32Char *data, size_t length, UTF16Char *buffer);
 
 UTF32StringRef UTF32StringCreateWithCharacterArray(UTF32Char *array, size_t length)
 {
@@ -42,6 +50,40 @@ UTF32StringRef UTF32StringCreateWithCharacterArray(UTF32Char *array, size_t leng
     return NULL;
 }
 
+UTF32StringRef UTF32StringCreateWithWideCharacterRuns(const wchar_t *const *runs, const size_t *runLengths, size_t runAmount)
+{
+    if(runAmount != 0 && (runs == NULL || runLengths == NULL))
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "UTF32StringCreateWithWideCharacterRuns runs %p runLengths %p", runs, runLengths);
+    size_t length = 0;
+    for(size_t runIndex = 0; runIndex < runAmount; runIndex++)
+        length += runLengths[runIndex];
+    
+    UTF32StringRef result;
+    if((result = UTF32StringCreateWithLength(length)) != NULL)
+    {
+        size_t dataIndex = 0;
+#if WCHAR_MAX > 0xFFFF
+        for(size_t runIndex = 0; runIndex < runAmount; runIndex++)
+            for(size_t index = 0; index < runLengths[runIndex]; index++)
+                result->data[dataIndex++] = (UTF32Char)runs[runIndex][index];
+#else
+        for(size_t runIndex = 0; runIndex < runAmount; runIndex++)
+            for(size_t index = 0; index < runLengths[runIndex]; index++)
+            {
+                UTF32Char unit = (UTF32Char)runs[runIndex][index];
+                if(unit >= 0xDC00 && unit <= 0xDFFF && index > 0 && result->data[dataIndex - 1] >= 0xD800 && result->data[dataIndex - 1] <= 0xDBFF)
+                    result->data[dataIndex - 1] = 0x10000 + ((result->data[dataIndex - 1] - 0xD800) << 10) + (unit - 0xDC00);
+                else
+                    result->data[dataIndex++] = unit;
+            }
+        result->length = dataIndex;
+#endif
+        result->data[dataIndex] = '\0';
+        return result;
+    }
+    return NULL;
+}
+
 UTF32StringRef UTF32StringCopy(UTF32StringRef from)
 {
     UTF32StringRef result;
@@ -67,6 +109,13 @@ size_t UTF32StringGetLength(UTF32StringRef string)
     return string->length;
 }
 
+const UTF32Char *UTF32StringGetCharacterArray(UTF32StringRef string)
+{
+    if(string == NULL)
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "UTF32StringGetCharacterArray string NULL");
+    return string->data;
+}
+
 UTF32StringRef UTF32StringCreateWithUTF8String(const UTF8Char *string)
 {
     if(string == NULL)
@@ -250,3 +299,197 @@ void UTF32StringDestory(UTF32StringRef string)
     if(string == NULL) return;
     free(string);
 }
+
+#pragma mark - Encode
+
+#define UTF32CharIsSurrogate(character) (((character) & 0xFFFFF800) == 0xD800)
+#define UTF32CharIsEncodable(character) ((character) <= 0x10FFFF && !UTF32CharIsSurrogate(character))
+#define UTF32CharReplacement 0xFFFD
+
+size_t UTF32StringCopyUTF8Bytes(UTF32StringRef string, UTF8Char *buffer, size_t bufferLength)
+{
+    if(string == NULL)
+    {
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "UTF32StringCopyUTF8Bytes string NULL");
+        return 0;
+    }
+    const UTF32Char *data = string->data;
+    size_t length = string->length;
+    
+    // surrogates and U+FFFD take 3 bytes alike
+    size_t byteLength = 0;
+    for(size_t index = 0; index < length; index++)
+    {
+        if(data[index] < 0x80)
+        {
+            size_t runLength = UTF32StringCopyASCIIRun(data + index, length - index, NULL);
+            index += runLength - 1;
+            byteLength += runLength;
+        }
+        else
+            byteLength += 2 + (data[index] >= 0x800) + (data[index] >= 0x10000 && data[index] <= 0x10FFFF);
+    }
+    if(buffer == NULL || byteLength > bufferLength)
+        return byteLength;
+    
+    size_t byteIndex = 0;
+    for(size_t index = 0; index < length; index++)
+    {
+        if(data[index] < 0x80)
+        {
+            size_t runLength = UTF32StringCopyASCIIRun(data + index, length - index, buffer + byteIndex);
+            index += runLength - 1;
+            byteIndex += runLength;
+            continue;
+        }
+        UTF32Char character = UTF32CharIsEncodable(data[index]) ? data[index] : UTF32CharReplacement;
+        if(character < 0x800)
+        {
+            buffer[byteIndex++] = (UTF8Char)(0xC0 | (character >> 6));
+            buffer[byteIndex++] = (UTF8Char)(0x80 | (character & 0x3F));
+        }
+        else if(character < 0x10000)
+        {
+            buffer[byteIndex++] = (UTF8Char)(0xE0 | (character >> 12));
+            buffer[byteIndex++] = (UTF8Char)(0x80 | ((character >> 6) & 0x3F));
+            buffer[byteIndex++] = (UTF8Char)(0x80 | (character & 0x3F));
+        }
+        else
+        {
+            buffer[byteIndex++] = (UTF8Char)(0xF0 | (character >> 18));
+            buffer[byteIndex++] = (UTF8Char)(0x80 | ((character >> 12) & 0x3F));
+            buffer[byteIndex++] = (UTF8Char)(0x80 | ((character >> 6) & 0x3F));
+            buffer[byteIndex++] = (UTF8Char)(0x80 | (character & 0x3F));
+        }
+    }
+    if(byteLength < bufferLength) buffer[byteLength] = '\0';
+    return byteLength;
+}
+
+size_t UTF32StringCopyUTF16Units(UTF32StringRef string, UTF16Char *buffer, size_t bufferLength)
+{
+    if(string == NULL)
+    {
+        CFExceptionRaise(CFExceptionNameInvalidArgument, NULL, "UTF32StringCopyUTF16Units string NULL");
+        return 0;
+    }
+    const UTF32Char *data = string->data;
+    size_t length = string->length;
+    
+    size_t unitLength = 0;
+    for(size_t index = 0; index < length; index++)
+    {
+        if(data[index] < 0x10000 && !UTF32CharIsSurrogate(data[index]))
+        {
+            size_t runLength = UTF32StringCopyBMPRun(data + index, length - index, NULL);
+            index += runLength - 1;
+            unitLength += runLength;
+        }
+        else
+            unitLength += 1 + (data[index] >= 0x10000 && data[index] <= 0x10FFFF);
+    }
+    if(buffer == NULL || unitLength > bufferLength)
+        return unitLength;
+    
+    size_t unitIndex = 0;
+    for(size_t index = 0; index < length; index++)
+    {
+        if(data[index] < 0x10000 && !UTF32CharIsSurrogate(data[index]))
+        {
+            size_t runLength = UTF32StringCopyBMPRun(data + index, length - index, buffer + unitIndex);
+            index += runLength - 1;
+            unitIndex += runLength;
+            continue;
+        }
+        UTF32Char character = UTF32CharIsEncodable(data[index]) ? data[index] : UTF32CharReplacement;
+        if(character < 0x10000)
+            buffer[unitIndex++] = (UTF16Char)character;
+        else
+        {
+            buffer[unitIndex++] = (UTF16Char)(0xD800 | ((character - 0x10000) >> 10));
+            buffer[unitIndex++] = (UTF16Char)(0xDC00 | ((character - 0x10000) & 0x3FF));
+        }
+    }
+    if(unitLength < bufferLength) buffer[unitLength] = 0;
+    return unitLength;
+}
+
+static size_t UTF32StringCopyASCIIRun(const UTF32Char *data, size_t length, UTF8Char *buffer)
+{
+    // narrow the leading ASCII characters, 16 at a time when SIMD is available, return the amount of them
+    // buffer could be NULL to count only
+    size_t index = 0;
+#if defined(__AVX2__)
+    const __m256i nonASCII = _mm256_set1_epi32(~0x7F);
+    for(; index + 16 <= length; index += 16)
+    {
+        __m256i first = _mm256_loadu_si256((const __m256i *)(data + index));
+        __m256i second = _mm256_loadu_si256((const __m256i *)(data + index + 8));
+        if(!_mm256_testz_si256(_mm256_or_si256(first, second), nonASCII)) break;
+        // packing works inside 128 bit lanes, the permutation restores character order
+        if(buffer == NULL) continue;
+        __m256i units = _mm256_permute4x64_epi64(_mm256_packus_epi32(first, second), 0xD8);
+        _mm_storeu_si128((__m128i *)(buffer + index), _mm_packus_epi16(_mm256_castsi256_si128(units), _mm256_extracti128_si256(units, 1)));
+    }
+#elif defined(__SSE4_1__)
+    const __m128i nonASCII = _mm_set1_epi32(~0x7F);
+    for(; index + 16 <= length; index += 16)
+    {
+        __m128i block0 = _mm_loadu_si128((const __m128i *)(data + index));
+        __m128i block1 = _mm_loadu_si128((const __m128i *)(data + index + 4));
+        __m128i block2 = _mm_loadu_si128((const __m128i *)(data + index + 8));
+        __m128i block3 = _mm_loadu_si128((const __m128i *)(data + index + 12));
+        if(!_mm_testz_si128(_mm_or_si128(_mm_or_si128(block0, block1), _mm_or_si128(block2, block3)), nonASCII)) break;
+        if(buffer == NULL) continue;
+        _mm_storeu_si128((__m128i *)(buffer + index), _mm_packus_epi16(_mm_packus_epi32(block0, block1), _mm_packus_epi32(block2, block3)));
+    }
+#endif
+    if(buffer == NULL)
+        while(index < length && data[index] < 0x80) index++;
+    else
+        for(; index < length && data[index] < 0x80; index++)
+            buffer[index] = (UTF8Char)data[index];
+    return index;
+}
+
+static size_t UTF32StringCopyBMPRun(const UTF32Char *data, size_t length, UTF16Char *buffer)
+{
+    // narrow the leading BMP characters which are not surrogates, 16 at a time when SIMD is available, return the amount of them
+    // buffer could be NULL to count only
+    size_t index = 0;
+#if defined(__AVX2__)
+    const __m256i beyondBMP = _mm256_set1_epi32(~0xFFFF);
+    const __m256i surrogateMask = _mm256_set1_epi32(0xF800);
+    const __m256i surrogate = _mm256_set1_epi32(0xD800);
+    for(; index + 16 <= length; index += 16)
+    {
+        __m256i first = _mm256_loadu_si256((const __m256i *)(data + index));
+        __m256i second = _mm256_loadu_si256((const __m256i *)(data + index + 8));
+        __m256i surrogates = _mm256_or_si256(_mm256_cmpeq_epi32(_mm256_and_si256(first, surrogateMask), surrogate),
+                                             _mm256_cmpeq_epi32(_mm256_and_si256(second, surrogateMask), surrogate));
+        if(!_mm256_testz_si256(_mm256_or_si256(first, second), beyondBMP) || !_mm256_testz_si256(surrogates, surrogates)) break;
+        if(buffer == NULL) continue;
+        _mm256_storeu_si256((__m256i *)(buffer + index), _mm256_permute4x64_epi64(_mm256_packus_epi32(first, second), 0xD8));
+    }
+#elif defined(__SSE4_1__)
+    const __m128i beyondBMP = _mm_set1_epi32(~0xFFFF);
+    const __m128i surrogateMask = _mm_set1_epi32(0xF800);
+    const __m128i surrogate = _mm_set1_epi32(0xD800);
+    for(; index + 8 <= length; index += 8)
+    {
+        __m128i first = _mm_loadu_si128((const __m128i *)(data + index));
+        __m128i second = _mm_loadu_si128((const __m128i *)(data + index + 4));
+        __m128i surrogates = _mm_or_si128(_mm_cmpeq_epi32(_mm_and_si128(first, surrogateMask), surrogate),
+                                          _mm_cmpeq_epi32(_mm_and_si128(second, surrogateMask), surrogate));
+        if(!_mm_testz_si128(_mm_or_si128(first, second), beyondBMP) || !_mm_testz_si128(surrogates, surrogates)) break;
+        if(buffer == NULL) continue;
+        _mm_storeu_si128((__m128i *)(buffer + index), _mm_packus_epi32(first, second));
+    }
+#endif
+    if(buffer == NULL)
+        while(index < length && data[index] < 0x10000 && !UTF32CharIsSurrogate(data[index])) index++;
+    else
+        for(; index < length && data[index] < 0x10000 && !UTF32CharIsSurrogate(data[index]); index++)
+            buffer[index] = (UTF16Char)data[index];
+    return index;
+}
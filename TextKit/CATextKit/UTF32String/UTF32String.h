@@ -9,6 +9,8 @@
 #ifndef UTF32String_h
 #define UTF32String_h
 
+#include <wchar.h>
+
 #include "CFType.h"
 
 typedef struct UTF32String *UTF32StringRef;
@@ -17,12 +19,44 @@ UTF32Char UTF32StringGetCharAtIndex(UTF32StringRef string, size_t index);
 
 size_t UTF32StringGetLength(UTF32StringRef string);
 
+const UTF32Char *UTF32StringGetCharacterArray(UTF32StringRef string);
+/* Return */
+// UTF32StringGetLength characters followed by '\0', owned by string, for scanning without a call per character
+
 UTF32StringRef UTF32StringCreateWithUTF8String(const UTF8Char *string);
 
 UTF32StringRef UTF32StringCreateWithCharacterArray(UTF32Char *array, size_t length);
 
+UTF32StringRef UTF32StringCreateWithWideCharacterRuns(const wchar_t *const *runs, const size_t *runLengths, size_t runAmount);
+/* runLengths */
+// the amount of wchar_t of each run, runs don't need to terminate with '\0'
+/* Return */
+// the runs joined, NULL if out of memory
+/* Discussion */
+// where wchar_t is 16 bits, surrogate pairs inside a run are combined, lone surrogates are kept as they are
+
 void UTF32StringDestory(UTF32StringRef string);
 
 UTF32StringRef UTF32StringCopy(UTF32StringRef from);
 
+#pragma mark - Encode
+
+size_t UTF32StringCopyUTF8Bytes(UTF32StringRef string, UTF8Char *buffer, size_t bufferLength);
+/* buffer */
+// NULL to get the exact size only
+/* Return */
+// the amount of UTF8Char the whole string takes, without the terminating '\0'
+// nothing is written if it is greater than bufferLength, '\0' is appended only if bufferLength leaves room for it
+/* Discussion */
+// surrogates and characters beyond 0x10FFFF are written as U+FFFD
+
+size_t UTF32StringCopyUTF16Units(UTF32StringRef string, UTF16Char *buffer, size_t bufferLength);
+/* buffer */
+// NULL to get the exact size only
+/* Return */
+// the amount of UTF16Char the whole string takes, characters beyond the BMP take a surrogate pair
+// nothing is written if it is greater than bufferLength, '\0' is appended only if bufferLength leaves room for it
+/* Discussion */
+// surrogates and characters beyond 0x10FFFF are written as U+FFFD
+
 #endif /* UTF32String_h */
@@ -7,18 +7,106 @@
 //
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
 #include "CATextKit/UTF32String/UTF32String.h"
 #include "CATextKit/CAPunycode/CAPunycode.h"
+#include "CATextKit/CABLGenerator/CABLGenerator.h"
+
+#pragma mark - Regression
+
+typedef struct CADisplayOrderCase
+{
+    const char *name;
+    UTF32Char characters[16];
+    size_t length;
+    size_t order[16];       // expected CABLGeneratorDisplayLine of the whole string as one line
+} CADisplayOrderCase;
+
+static const CADisplayOrderCase CADisplayOrderCases[] = {
+    /* sos of the level 1 sequence comes from the embedding level of the AN, not its level after I2 */
+    {"AN RLE ) EN", {0x0660, 0x202B, ')', '1'}, 4, {3, 2, 0, 1}},
+    /* an override never makes a boundary neutral strong */
+    {"RLO RLO [ PDF ZWSP LRE ZWSP )", {0x202E, 0x202E, '[', 0x202C, 0x200B, 0x202A, 0x200B, ')'}, 8, {0, 1, 6, 5, 4, 3, 2, 7}},
+    /* characters removed by X9 don't split a level run */
+    {", PDF ZWSP [ AN LRO ZWSP PDF ( AN", {',', 0x202C, 0x200B, '[', 0x0660, 0x202D, 0x200B, 0x202C, '(', 0x0660}, 10, {0, 1, 2, 3, 9, 8, 4, 5, 6, 7}},
+};
+
+static bool CACheckDisplayOrder(const CADisplayOrderCase *testCase)
+{
+    bool result = false;
+    UTF32StringRef string = UTF32StringCreateWithCharacterArray((UTF32Char *)testCase->characters, testCase->length);
+    CABLGeneratorRef generator = CABLGeneratorCreateWithString(string);
+    size_t *order = CABLGeneratorDisplayLine(generator, CFRangeMake(0, testCase->length), CFRangeMake(0, testCase->length));
+    if(order != NULL)
+    {
+        result = true;
+        for(size_t index = 0; index < testCase->length; index++)
+            if(order[index] != testCase->order[index]) result = false;
+        free(order);
+    }
+    CABLGeneratorDestory(generator);
+    UTF32StringDestory(string);
+    return result;
+}
+
+typedef struct CAPunycodeDecodeCase
+{
+    const char *domain;
+    const char *expected;   // NULL if the domain must fail
+} CAPunycodeDecodeCase;
+
+static const CAPunycodeDecodeCase CAPunycodeDecodeCases[] = {
+    {"xn--mgbh0fb.example", "\xD9\x85\xD8\xAB\xD8\xA7\xD9\x84.example"},
+    {"caf\xC3\xA9.example", "caf\xC3\xA9.example"},
+    /* a label that is not ACE is passed through, but only if it is UTF-8 */
+    {"\xFF.x", NULL},
+    {"caf\xC3.example", NULL},
+};
+
+static bool CACheckPunycodeDecode(const CAPunycodeDecodeCase *testCase)
+{
+    CAPunycodeDomainBatchRef batch = CAPunycodeDomainBatchCreate();
+    if(batch == NULL)
+        return false;
+    bool result = false;
+    if(CAPunycodeDomainBatchDecodeDomains(batch, (const UTF8Char *)testCase->domain, strlen(testCase->domain)) == 0 &&
+       CAPunycodeDomainBatchGetDomainAmount(batch) == 1)
+    {
+        const UTF8Char *domain = CAPunycodeDomainBatchGetDomainAtIndex(batch, 0, NULL);
+        if(testCase->expected == NULL)
+            result = domain == NULL;
+        else
+            result = domain != NULL && strcmp((const char *)domain, testCase->expected) == 0;
+    }
+    CAPunycodeDomainBatchDestory(batch);
+    return result;
+}
 
 int main(int argc, const char * argv[]) {
-    
+
     UTF32StringRef result = CAPunycodeEecodeUnicodeString((UTF32Char []){0x5E05, 0x54E5, 0});
-    
+
     for(size_t index = 0; index < UTF32StringGetLength(result); index++)
     {
         UTF32Char ch = UTF32StringGetCharAtIndex(result, index);
         fprintf(stdout, "Index %zu: %c\n", index, ch);
     }
-    
-    return 0;
+
+    int failedAmount = 0;
+    for(size_t caseIndex = 0; caseIndex < sizeof(CADisplayOrderCases) / sizeof(CADisplayOrderCase); caseIndex++)
+        if(!CACheckDisplayOrder(&CADisplayOrderCases[caseIndex]))
+        {
+            fprintf(stdout, "Display order failed: %s\n", CADisplayOrderCases[caseIndex].name);
+            failedAmount++;
+        }
+    for(size_t caseIndex = 0; caseIndex < sizeof(CAPunycodeDecodeCases) / sizeof(CAPunycodeDecodeCase); caseIndex++)
+        if(!CACheckPunycodeDecode(&CAPunycodeDecodeCases[caseIndex]))
+        {
+            fprintf(stdout, "Punycode decode failed: %s\n", CAPunycodeDecodeCases[caseIndex].domain);
+            failedAmount++;
+        }
+
+    return failedAmount == 0 ? 0 : 1;
 }